@@ -0,0 +1,209 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "ad_rss/core/RssCycleState.hpp"
+#include "ad_rss/core/RssSituationChecking.hpp"
+#include "ad_rss/core/RssSituationExtraction.hpp"
+#include "ad_rss/state/RssState.hpp"
+#include "ad_rss/world/Object.hpp"
+#include "ad_rss/world/RoadArea.hpp"
+#include "ad_rss/world/RssDynamics.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+class RssThreadPool;
+
+/*!
+ * @brief A traffic participant of the RssAllPairsCheck
+ */
+struct RssAllPairsParticipant
+{
+  /*!
+   * The participant; its occupied regions refer to the lane segments of the common road area. The velocity is given
+   * as for the object of a scene.
+   */
+  world::Object object;
+
+  /*!
+   * The RSS dynamics of the participant
+   */
+  world::RssDynamics rssDynamics;
+
+  /*!
+   * True if the participant drives in the direction of the common road area, false if it drives against it
+   */
+  bool drivesInRoadDirection{true};
+};
+
+/*!
+ * @brief The input of the RssAllPairsCheck: all traffic participants on a common road area at a point in time
+ */
+struct RssAllPairsWorldModel
+{
+  /*!
+   * The time index; has to increase with every call of the RssAllPairsCheck
+   */
+  physics::TimeIndex timeIndex{0u};
+
+  /*!
+   * The road area all participants are located on
+   */
+  world::RoadArea roadArea;
+
+  /*!
+   * The traffic participants; the object ids have to be unique
+   */
+  std::vector<RssAllPairsParticipant> participants;
+};
+
+/*!
+ * @brief The RSS state of a pair of traffic participants
+ */
+struct RssAllPairsResult
+{
+  /*!
+   * The index of the participant taking the role of the ego vehicle; the lower index of the pair
+   */
+  std::size_t egoParticipant{0u};
+
+  /*!
+   * The index of the other participant of the pair
+   */
+  std::size_t otherParticipant{0u};
+
+  /*!
+   * The situation type: SameDirection or OppositeDirection
+   */
+  situation::SituationType situationType{situation::SituationType::NotRelevant};
+
+  /*!
+   * The RSS state of the pair from the view of the ego participant
+   */
+  state::RssState rssState;
+};
+
+/**
+ * @brief RssAllPairsCheck
+ *
+ * Evaluates RSS for every pair of traffic participants on a common road area, e.g. for infrastructure based
+ * monitoring or the analysis of simulations, instead of the ego vehicle centric view of the RssCheck.
+ *
+ * The positions of all participants on the road area are calculated once and shared by all of their pairs. Pairs are
+ * pruned by a sweep along the longitudinal axis of the road area: a pair is only evaluated if the longitudinal gap
+ * between the participants is not larger than the sum of the distances both can travel until standing still after
+ * their response time with maximum acceleration and minimum braking. All other pairs are longitudinally safe and
+ * therefore never dangerous. The remaining pairs are converted into situations by the RssSituationExtraction and
+ * checked by the RssSituationChecking, distributed over a pool of threads.
+ *
+ * Intersections are not supported: the situations are of type SameDirection or OppositeDirection, depending on the
+ * driving directions of the participants.
+ */
+class RssAllPairsCheck
+{
+public:
+  /**
+   * @brief constructor
+   *
+   * @param [in] numberOfThreads - the number of threads evaluating the pairs including the calling thread;
+   *   0 uses the number of hardware threads
+   */
+  explicit RssAllPairsCheck(std::size_t const numberOfThreads = 1u);
+
+  /**
+   * @brief destructor
+   */
+  ~RssAllPairsCheck();
+
+  RssAllPairsCheck(RssAllPairsCheck const &other) = delete;
+  RssAllPairsCheck &operator=(RssAllPairsCheck const &other) = delete;
+
+  /**
+   * @brief checkAllPairs
+   *
+   * @param [in] worldModel - the participants on the common road area
+   * @param [out] pairResults - the RSS states of the pairs not pruned, ordered by egoParticipant and otherParticipant
+   *
+   * @returns false if the input is invalid or an error occurred during the evaluation, true otherwise.
+   */
+  bool checkAllPairs(RssAllPairsWorldModel const &worldModel, std::vector<RssAllPairsResult> &pairResults);
+
+  /**
+   * @returns the number of pairs evaluated by the last checkAllPairs() call
+   */
+  std::size_t getNumberOfEvaluatedPairs() const;
+
+  /**
+   * @returns the number of pairs pruned by the last checkAllPairs() call
+   */
+  std::size_t getNumberOfPrunedPairs() const;
+
+private:
+  bool findCandidatePairs(RssAllPairsWorldModel const &worldModel,
+                          std::vector<world::ObjectDimensions> const &dimensions);
+  void updateSituationIds(RssAllPairsWorldModel const &worldModel);
+
+  std::unique_ptr<RssThreadPool> mThreadPool;
+  RssSituationExtraction mSituationExtraction;
+  RssSituationChecking mSituationChecking;
+  RssSituationCheckingState mSituationCheckingState;
+
+  // the situation ids of the pairs of the last call, by the object ids of ego and other participant
+  std::map<std::pair<world::ObjectId, world::ObjectId>, situation::SituationId> mSituationIds;
+  situation::SituationId mNextSituationId;
+
+  // the data of the current call
+  std::vector<double> mReach;
+  std::vector<std::pair<std::size_t, std::size_t>> mCandidatePairs;
+  std::vector<situation::SituationId> mCandidateSituationIds;
+  std::size_t mNumberOfPrunedPairs;
+};
+
+} // namespace core
+} // namespace ad_rss
@@ -34,9 +34,20 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <vector>
+#include "ad_rss/core/RssCycleState.hpp"
+#include "ad_rss/core/RssRoadRegistry.hpp"
+#include "ad_rss/core/RssSituationChecking.hpp"
+#include "ad_rss/core/RssSituationExtraction.hpp"
+#include "ad_rss/situation/SituationSnapshot.hpp"
+#include "ad_rss/state/ProperResponse.hpp"
+#include "ad_rss/state/RssStateSnapshot.hpp"
 #include "ad_rss/world/AccelerationRestriction.hpp"
 #include "ad_rss/world/WorldModel.hpp"
+#include "ad_rss/world/WorldModelView.hpp"
 
 /*!
  * @brief namespace ad_rss
@@ -49,8 +60,6 @@ namespace ad_rss {
 namespace core {
 
 class RssResponseResolving;
-class RssSituationChecking;
-class RssSituationExtraction;
 
 /**
  * @brief RssCheck
@@ -62,10 +71,80 @@ class RssSituationExtraction;
 class RssCheck
 {
 public:
+  /**
+   * @brief Enum ExecutionMode
+   *
+   * Defines how the individual processing steps of the RSS check sequence are executed.
+   */
+  enum class ExecutionMode
+  {
+    /*!
+     * All situations are extracted into a SituationSnapshot, then all of them are checked into a RssStateSnapshot
+     * before the proper response is resolved out of it.
+     */
+    Staged,
+    /*!
+     * Each situation is extracted, checked and folded into the proper response in one go.
+     * The snapshots are only created if explicitly requested. The results are identical to the Staged mode.
+     */
+    Fused
+  };
+
+  /**
+   * @brief Enum SkippedSituationPolicy
+   *
+   * Defines how the situations not evaluated within the time budget of calculateAccelerationRestrictionWithinBudget()
+   * are considered in the proper response. In any case, a skipped situation is considered as dangerous.
+   */
+  enum class SkippedSituationPolicy
+  {
+    /*!
+     * The longitudinal response and the lateral responses of both sides are BrakeMin.
+     */
+    BrakeMin,
+    /*!
+     * The longitudinal response is BrakeMin, the lateral responses are None.
+     */
+    LongitudinalBrakeMin
+  };
+
+  /**
+   * @brief Statistics of a calculation within a time budget
+   *
+   * The statistics are only provided if the calculation succeeds; otherwise all members keep their default values.
+   */
+  struct BudgetStatistics
+  {
+    /*!
+     * true if not all situations could be evaluated within the time budget
+     */
+    bool isPartial{false};
+    /*!
+     * the number of situations evaluated within the time budget
+     */
+    std::size_t evaluatedSituations{0u};
+    /*!
+     * the number of situations skipped, as the time budget was exceeded
+     */
+    std::size_t skippedSituations{0u};
+  };
+
+  /**
+   * @brief EvaluationMode
+   *
+   * Defines which parts of the rss states are evaluated, see RssSituationChecking::EvaluationMode.
+   * The resulting acceleration restrictions and proper responses are identical in all evaluation modes.
+   */
+  typedef RssSituationChecking::EvaluationMode EvaluationMode;
+
   /**
    * @brief constructor
+   *
+   * @param[in] executionMode the execution mode of the RSS check sequence
+   * @param[in] evaluationMode the evaluation mode of the situation checks
    */
-  RssCheck();
+  explicit RssCheck(ExecutionMode const executionMode = ExecutionMode::Staged,
+                    EvaluationMode const evaluationMode = EvaluationMode::Full);
 
   ~RssCheck();
 
@@ -80,7 +159,397 @@ public:
   bool calculateAccelerationRestriction(world::WorldModel const &worldModel,
                                         world::AccelerationRestriction &accelerationRestriction);
 
+  /**
+   * @brief calculateAccelerationRestriction
+   *
+   * @param [in] worldModel - the current world model information
+   * \param [out] accelerationRestriction - The restrictions on the vehicle acceleration to become RSS safe.
+   * \param [out] properResponse - The proper response the acceleration restrictions are derived from.
+   * \param [out] situationSnapshot - If not nullptr, the situations extracted from the world model.
+   * \param [out] rssStateSnapshot - If not nullptr, the rss states of the individual situations.
+   *
+   * @return return true if the acceleration restrictions could be calculated, false otherwise.
+   */
+  bool calculateAccelerationRestriction(world::WorldModel const &worldModel,
+                                        world::AccelerationRestriction &accelerationRestriction,
+                                        state::ProperResponse &properResponse,
+                                        situation::SituationSnapshot *situationSnapshot = nullptr,
+                                        state::RssStateSnapshot *rssStateSnapshot = nullptr);
+
+  /**
+   * @brief calculateAccelerationRestriction
+   *
+   * @param [in] worldModel - the current world model information referencing the roads of getRoadRegistry()
+   * \param [out] accelerationRestriction - The restrictions on the vehicle acceleration to become RSS safe.
+   *
+   * @return return true if the acceleration restrictions could be calculated, false otherwise.
+   */
+  bool calculateAccelerationRestriction(RegisteredRoadWorldModel const &worldModel,
+                                        world::AccelerationRestriction &accelerationRestriction);
+
+  /**
+   * @brief calculateAccelerationRestriction
+   *
+   * @param [in] worldModel - the current world model information referencing the roads of getRoadRegistry()
+   * \param [out] accelerationRestriction - The restrictions on the vehicle acceleration to become RSS safe.
+   * \param [out] properResponse - The proper response the acceleration restrictions are derived from.
+   * \param [out] situationSnapshot - If not nullptr, the situations extracted from the world model.
+   * \param [out] rssStateSnapshot - If not nullptr, the rss states of the individual situations.
+   *
+   * @return return true if the acceleration restrictions could be calculated, false otherwise.
+   */
+  bool calculateAccelerationRestriction(RegisteredRoadWorldModel const &worldModel,
+                                        world::AccelerationRestriction &accelerationRestriction,
+                                        state::ProperResponse &properResponse,
+                                        situation::SituationSnapshot *situationSnapshot = nullptr,
+                                        state::RssStateSnapshot *rssStateSnapshot = nullptr);
+
+  /**
+   * @brief calculateAccelerationRestriction
+   *
+   * @param [in] worldModel - the view on the current world model information; the viewed data is only read
+   * \param [out] accelerationRestriction - The restrictions on the vehicle acceleration to become RSS safe.
+   *
+   * @return return true if the acceleration restrictions could be calculated, false otherwise.
+   */
+  bool calculateAccelerationRestriction(world::WorldModelView const &worldModel,
+                                        world::AccelerationRestriction &accelerationRestriction);
+
+  /**
+   * @brief calculateAccelerationRestriction
+   *
+   * @param [in] worldModel - the view on the current world model information; the viewed data is only read
+   * \param [out] accelerationRestriction - The restrictions on the vehicle acceleration to become RSS safe.
+   * \param [out] properResponse - The proper response the acceleration restrictions are derived from.
+   * \param [out] situationSnapshot - If not nullptr, the situations extracted from the world model.
+   * \param [out] rssStateSnapshot - If not nullptr, the rss states of the individual situations.
+   *
+   * @return return true if the acceleration restrictions could be calculated, false otherwise.
+   */
+  bool calculateAccelerationRestriction(world::WorldModelView const &worldModel,
+                                        world::AccelerationRestriction &accelerationRestriction,
+                                        state::ProperResponse &properResponse,
+                                        situation::SituationSnapshot *situationSnapshot = nullptr,
+                                        state::RssStateSnapshot *rssStateSnapshot = nullptr);
+
+  /**
+   * @brief calculateAccelerationRestriction
+   *
+   * Re-entrant variant of the RSS check sequence: the history of the previous cycles is not taken from this
+   * RssCheck, but from the given cycle state; the member cycle state of this object is neither used nor modified.
+   * Therefore, this function can be called concurrently and the same cycle state can be continued in several ways.
+   *
+   * @param [in] worldModel - the current world model information
+   * @param [in] cycleState - the state resulting from the previous cycle
+   * \param [out] nextCycleState - the state resulting from this cycle; may be the same object as cycleState
+   * \param [out] accelerationRestriction - The restrictions on the vehicle acceleration to become RSS safe.
+   * \param [out] properResponse - The proper response the acceleration restrictions are derived from.
+   * \param [out] situationSnapshot - If not nullptr, the situations extracted from the world model.
+   * \param [out] rssStateSnapshot - If not nullptr, the rss states of the individual situations.
+   *
+   * @return return true if the acceleration restrictions could be calculated, false otherwise.
+   */
+  bool calculateAccelerationRestriction(world::WorldModel const &worldModel,
+                                        RssCycleState const &cycleState,
+                                        RssCycleState &nextCycleState,
+                                        world::AccelerationRestriction &accelerationRestriction,
+                                        state::ProperResponse &properResponse,
+                                        situation::SituationSnapshot *situationSnapshot = nullptr,
+                                        state::RssStateSnapshot *rssStateSnapshot = nullptr) const;
+
+  /**
+   * @brief calculateAccelerationRestriction
+   *
+   * Re-entrant variant of the RSS check sequence: the history of the previous cycles is not taken from this
+   * RssCheck, but from the given cycle state; the member cycle state of this object is neither used nor modified.
+   * Therefore, this function can be called concurrently and the same cycle state can be continued in several ways.
+   *
+   * @param [in] worldModel - the current world model information
+   * @param [in] cycleState - the state resulting from the previous cycle
+   * \param [out] nextCycleState - the state resulting from this cycle; may be the same object as cycleState
+   * \param [out] accelerationRestriction - The restrictions on the vehicle acceleration to become RSS safe.
+   * \param [out] properResponse - The proper response the acceleration restrictions are derived from.
+   * \param [out] situationSnapshot - If not nullptr, the situations extracted from the world model.
+   * \param [out] rssStateSnapshot - If not nullptr, the rss states of the individual situations.
+   *
+   * @return return true if the acceleration restrictions could be calculated, false otherwise.
+   */
+  bool calculateAccelerationRestriction(RegisteredRoadWorldModel const &worldModel,
+                                        RssCycleState const &cycleState,
+                                        RssCycleState &nextCycleState,
+                                        world::AccelerationRestriction &accelerationRestriction,
+                                        state::ProperResponse &properResponse,
+                                        situation::SituationSnapshot *situationSnapshot = nullptr,
+                                        state::RssStateSnapshot *rssStateSnapshot = nullptr) const;
+
+  /**
+   * @brief calculateAccelerationRestriction
+   *
+   * Re-entrant variant of the RSS check sequence: the history of the previous cycles is not taken from this
+   * RssCheck, but from the given cycle state; the member cycle state of this object is neither used nor modified.
+   * Therefore, this function can be called concurrently and the same cycle state can be continued in several ways.
+   *
+   * @param [in] worldModel - the current world model information
+   * @param [in] cycleState - the state resulting from the previous cycle
+   * \param [out] nextCycleState - the state resulting from this cycle; may be the same object as cycleState
+   * \param [out] accelerationRestriction - The restrictions on the vehicle acceleration to become RSS safe.
+   * \param [out] properResponse - The proper response the acceleration restrictions are derived from.
+   * \param [out] situationSnapshot - If not nullptr, the situations extracted from the world model.
+   * \param [out] rssStateSnapshot - If not nullptr, the rss states of the individual situations.
+   *
+   * @return return true if the acceleration restrictions could be calculated, false otherwise.
+   */
+  bool calculateAccelerationRestriction(world::WorldModelView const &worldModel,
+                                        RssCycleState const &cycleState,
+                                        RssCycleState &nextCycleState,
+                                        world::AccelerationRestriction &accelerationRestriction,
+                                        state::ProperResponse &properResponse,
+                                        situation::SituationSnapshot *situationSnapshot = nullptr,
+                                        state::RssStateSnapshot *rssStateSnapshot = nullptr) const;
+
+  /**
+   * @brief extractSituationSnapshot
+   *
+   * First stage of the RSS check sequence in ExecutionMode::Staged: the situations are extracted from the world
+   * model. Only the situation id assignment of the cycle state (RssCycleState::situationIdState) is used and updated.
+   *
+   * @param [in] worldModel - the current world model information
+   * \param [in,out] cycleState - the cycle state continued by the extraction
+   * \param [out] situationSnapshot - the situations extracted from the world model
+   *
+   * @return return true if the situations could be extracted, false otherwise.
+   */
+  bool extractSituationSnapshot(world::WorldModel const &worldModel,
+                                RssCycleState &cycleState,
+                                situation::SituationSnapshot &situationSnapshot) const;
+
+  /**
+   * @brief checkSituationSnapshot
+   *
+   * Second stage of the RSS check sequence in ExecutionMode::Staged: the situations extracted by
+   * extractSituationSnapshot() are checked, the proper response is resolved and transformed into the acceleration
+   * restrictions. Only the histories of the situation checks and of the response resolving of the cycle state
+   * (RssCycleState::situationCheckingState, RssCycleState::responseResolvingState) are used and updated.
+   *
+   * As the two stages operate on disjoint parts of the cycle state, the extraction of a world model can be performed
+   * concurrently to the checks of the previous world model on the same cycle state. The results are identical to the
+   * stateful calculateAccelerationRestriction() as long as each stage processes the world models in order.
+   *
+   * @param [in] situationSnapshot - the situations extracted from the current world model
+   * @param [in] egoVehicleRssDynamics - the RSS dynamics of the ego vehicle of the current world model
+   * \param [in,out] cycleState - the cycle state continued by the checks
+   * \param [out] accelerationRestriction - The restrictions on the vehicle acceleration to become RSS safe.
+   * \param [out] properResponse - The proper response the acceleration restrictions are derived from.
+   * \param [out] rssStateSnapshot - If not nullptr, the rss states of the individual situations.
+   *
+   * @return return true if the acceleration restrictions could be calculated, false otherwise.
+   */
+  bool checkSituationSnapshot(situation::SituationSnapshot const &situationSnapshot,
+                              world::RssDynamics const &egoVehicleRssDynamics,
+                              RssCycleState &cycleState,
+                              world::AccelerationRestriction &accelerationRestriction,
+                              state::ProperResponse &properResponse,
+                              state::RssStateSnapshot *rssStateSnapshot = nullptr) const;
+
+  /**
+   * @returns the state resulting from the previous cycle of the stateful calculateAccelerationRestriction() calls
+   */
+  RssCycleState const &getCycleState() const;
+
+  /**
+   * @brief setCycleState
+   *
+   * @param [in] cycleState - the state the next stateful calculateAccelerationRestriction() call continues from
+   */
+  void setCycleState(RssCycleState const &cycleState);
+
+  /**
+   * @brief saveCheckpoint
+   *
+   * Serializes the current cycle state into a compact binary checkpoint, see serializeCycleState().
+   * Restoring the checkpoint into another RssCheck makes it continue with results identical to this one.
+   *
+   * The checkpoint does not contain the road registry (see getRoadRegistry()): the road areas are static input data
+   * and not part of the history. Before a RegisteredRoadWorldModel is processed after restoring the checkpoint, the
+   * road areas have to be registered again. Handles are assigned in the order of registration, so registering the
+   * same road areas in the same order at an empty registry reproduces the handles of the original RssCheck.
+   *
+   * \param [out] checkpoint - the binary checkpoint
+   *
+   * @return return true if the checkpoint could be created, false otherwise.
+   */
+  bool saveCheckpoint(std::vector<std::uint8_t> &checkpoint) const;
+
+  /**
+   * @brief restoreCheckpoint
+   *
+   * @param [in] checkpoint - the binary checkpoint created by saveCheckpoint() or serializeCycleState()
+   *
+   * @return return true if the checkpoint was valid and the cycle state was restored, false otherwise.
+   * On failure the cycle state is unchanged. The road registry is never modified, see saveCheckpoint().
+   */
+  bool restoreCheckpoint(std::vector<std::uint8_t> const &checkpoint);
+
+  /**
+   * @brief calculateAccelerationRestrictionWithinBudget
+   *
+   * Anytime variant of the RSS check sequence: all situations are extracted and ordered by a cheap criticality
+   * estimate (see situation::orderSituationsByCriticality()); then they are checked in that order as long as the
+   * time budget is not exceeded. The remaining situations are skipped and considered according to the
+   * SkippedSituationPolicy. If the time budget is sufficient, the results are identical to the Staged execution mode.
+   *
+   * The budget is only enforced while checking the situations: the extraction and the ordering of the situations are
+   * always completed, although their duration counts against the budget. If they already exceed the budget, all
+   * situations are skipped. The budget therefore has to cover at least the duration of the situation extraction.
+   *
+   * @param [in] worldModel - the current world model information
+   * @param [in] timeBudget - the time budget of the calculation, starting with the call
+   * \param [out] accelerationRestriction - The restrictions on the vehicle acceleration to become RSS safe.
+   * \param [out] properResponse - The proper response the acceleration restrictions are derived from.
+   * \param [out] budgetStatistics - The number of situations evaluated and skipped; default values on failure.
+   *
+   * @return return true if the acceleration restrictions could be calculated, false otherwise.
+   */
+  bool calculateAccelerationRestrictionWithinBudget(world::WorldModel const &worldModel,
+                                                    std::chrono::steady_clock::duration const &timeBudget,
+                                                    world::AccelerationRestriction &accelerationRestriction,
+                                                    state::ProperResponse &properResponse,
+                                                    BudgetStatistics &budgetStatistics);
+
+  /**
+   * @brief setSkippedSituationPolicy
+   *
+   * @param [in] skippedSituationPolicy - the policy applied to the situations skipped by
+   * calculateAccelerationRestrictionWithinBudget(); default is SkippedSituationPolicy::BrakeMin
+   */
+  void setSkippedSituationPolicy(SkippedSituationPolicy const skippedSituationPolicy);
+
+  /**
+   * @returns the policy applied to the situations skipped by calculateAccelerationRestrictionWithinBudget()
+   */
+  SkippedSituationPolicy getSkippedSituationPolicy() const;
+
+  /**
+   * @returns the registry of the roads a RegisteredRoadWorldModel can refer to
+   */
+  RssRoadRegistry &getRoadRegistry();
+
+  /**
+   * @returns the registry of the roads a RegisteredRoadWorldModel can refer to
+   */
+  RssRoadRegistry const &getRoadRegistry() const;
+
+  /**
+   * @brief calculateRssStateInformation
+   *
+   * Calculates the diagnostic information of a rss state on request; required in EvaluationMode::DecisionOnly only.
+   * See RssSituationChecking::calculateRssStateInformation().
+   *
+   * @param [in] situation - the situation the rss state was created for
+   * \param [in,out] rssState - the rss state of the situation to be completed
+   *
+   * @return return true if the information could be calculated, false otherwise.
+   */
+  bool calculateRssStateInformation(situation::Situation const &situation, state::RssState &rssState) const;
+
+  /**
+   * @brief setFormulaProvider
+   *
+   * Sets the provider of the RSS formulas evaluated by the situation checks, see
+   * RssSituationChecking::setFormulaProvider(). The formula provider has to outlive the RssCheck.
+   *
+   * @param [in] formulaProvider - the formula provider to be used
+   *
+   * @return return true if the formula provider could be set, false otherwise.
+   */
+  bool setFormulaProvider(situation::RssFormulaProvider const &formulaProvider);
+
+  /**
+   * @returns the execution mode of the RSS check sequence
+   */
+  ExecutionMode getExecutionMode() const;
+
+  /**
+   * @returns the evaluation mode of the situation checks
+   */
+  EvaluationMode getEvaluationMode() const;
+
 private:
+  template <class WorldModelType>
+  bool calculateAccelerationRestrictionT(WorldModelType const &worldModel,
+                                         RssCycleState &cycleState,
+                                         world::AccelerationRestriction &accelerationRestriction,
+                                         state::ProperResponse &properResponse,
+                                         situation::SituationSnapshot *situationSnapshot,
+                                         state::RssStateSnapshot *rssStateSnapshot) const;
+
+  template <class WorldModelType>
+  bool calculateNextCycleStateT(WorldModelType const &worldModel,
+                                RssCycleState const &cycleState,
+                                RssCycleState &nextCycleState,
+                                world::AccelerationRestriction &accelerationRestriction,
+                                state::ProperResponse &properResponse,
+                                situation::SituationSnapshot *situationSnapshot,
+                                state::RssStateSnapshot *rssStateSnapshot) const;
+
+  template <class WorldModelType>
+  bool calculateProperResponseStaged(WorldModelType const &worldModel,
+                                     RssCycleState &cycleState,
+                                     state::ProperResponse &properResponse,
+                                     situation::SituationSnapshot *situationSnapshot,
+                                     state::RssStateSnapshot *rssStateSnapshot) const;
+
+  template <class WorldModelType>
+  bool calculateProperResponseFused(WorldModelType const &worldModel,
+                                    RssCycleState &cycleState,
+                                    state::ProperResponse &properResponse,
+                                    situation::SituationSnapshot *situationSnapshot,
+                                    state::RssStateSnapshot *rssStateSnapshot) const;
+
+  bool resolveProperResponse(situation::SituationSnapshot const &situationSnapshot,
+                             RssCycleState &cycleState,
+                             state::ProperResponse &properResponse,
+                             state::RssStateSnapshot *rssStateSnapshot) const;
+
+  bool calculateProperResponseWithinBudget(world::WorldModel const &worldModel,
+                                           std::chrono::steady_clock::duration const &timeBudget,
+                                           RssCycleState &cycleState,
+                                           state::ProperResponse &properResponse,
+                                           BudgetStatistics &budgetStatistics) const;
+
+  bool extractSituations(world::WorldModel const &worldModel,
+                         RssCycleState &cycleState,
+                         situation::SituationSnapshot &situationSnapshot) const;
+  bool extractSituations(RegisteredRoadWorldModel const &worldModel,
+                         RssCycleState &cycleState,
+                         situation::SituationSnapshot &situationSnapshot) const;
+  bool extractSituations(world::WorldModelView const &worldModel,
+                         RssCycleState &cycleState,
+                         situation::SituationSnapshot &situationSnapshot) const;
+  bool groupScenesBySituation(world::WorldModel const &worldModel,
+                              RssCycleState &cycleState,
+                              RssSituationExtraction::SituationScenesVector &situationScenesVector) const;
+  bool groupScenesBySituation(RegisteredRoadWorldModel const &worldModel,
+                              RssCycleState &cycleState,
+                              RssSituationExtraction::SituationScenesVector &situationScenesVector) const;
+  bool groupScenesBySituation(world::WorldModelView const &worldModel,
+                              RssCycleState &cycleState,
+                              RssSituationExtraction::SituationScenesVector &situationScenesVector) const;
+  bool extractSituation(world::WorldModel const &worldModel,
+                        RssSituationExtraction::SituationScenes const &situationScenes,
+                        situation::Situation &situation) const;
+  bool extractSituation(RegisteredRoadWorldModel const &worldModel,
+                        RssSituationExtraction::SituationScenes const &situationScenes,
+                        situation::Situation &situation) const;
+  bool extractSituation(world::WorldModelView const &worldModel,
+                        RssSituationExtraction::SituationScenes const &situationScenes,
+                        situation::Situation &situation) const;
+
+  ExecutionMode mExecutionMode;
+  EvaluationMode mEvaluationMode;
+  SkippedSituationPolicy mSkippedSituationPolicy;
+  RssRoadRegistry mRoadRegistry;
+  RssCycleState mCycleState;
   std::unique_ptr<RssResponseResolving> mResponseResolving;
   std::unique_ptr<RssSituationChecking> mSituationChecking;
   std::unique_ptr<RssSituationExtraction> mSituationExtraction;
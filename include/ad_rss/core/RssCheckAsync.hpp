@@ -0,0 +1,252 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include "ad_rss/core/RssCheck.hpp"
+#include "ad_rss/core/RssCheckResultPublisher.hpp"
+#include "ad_rss/situation/SituationSnapshot.hpp"
+#include "ad_rss/world/WorldModel.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief RssCheckAsync
+ *
+ * Asynchronous front end of the RSS check sequence. World models are submitted into a bounded queue and processed
+ * by a pipeline of two workers running the stages of RssCheck: the situation extraction of a world model
+ * (RssCheck::extractSituationSnapshot()) is performed while the situation checks and the response resolving of the
+ * previous world model (RssCheck::checkSituationSnapshot()) are still ongoing. Both stages continue a single
+ * RssCycleState. Each worker processes the world models strictly in submission order, so the cycle state is updated
+ * in the same order as by the sequential RssCheck. The results are identical to RssCheck::ExecutionMode::Staged.
+ *
+ * The results are provided either via a std::future or a callback. Callbacks are executed within the worker thread
+ * performing the situation checks and should return quickly.
+ */
+class RssCheckAsync
+{
+public:
+  /**
+   * @brief Enum BackpressurePolicy
+   *
+   * Defines the behavior of submit() if the submission queue is full.
+   */
+  enum class BackpressurePolicy
+  {
+    /*!
+     * submit() blocks until there is space in the submission queue.
+     */
+    Block,
+    /*!
+     * The oldest world model not yet processed is dropped from the submission queue; its result is provided with
+     * status Dropped.
+     */
+    DropOldest
+  };
+
+  /**
+   * @brief Enum ResultStatus
+   */
+  enum class ResultStatus
+  {
+    /*!
+     * The result was calculated successfully.
+     */
+    Success,
+    /*!
+     * An error occurred during the calculation, e.g. the world model was invalid.
+     */
+    Failed,
+    /*!
+     * The world model was dropped from the submission queue before it was processed.
+     */
+    Dropped,
+    /*!
+     * The processing was stopped before the world model was processed.
+     */
+    Stopped
+  };
+
+  /**
+   * @brief The result of an asynchronous RSS check
+   */
+  struct Result
+  {
+    /*!
+     * The status of the result; the checkResult is valid only on status Success.
+     */
+    ResultStatus status{ResultStatus::Failed};
+
+    /*!
+     * The result of the RSS check sequence
+     */
+    RssCheckResult checkResult;
+  };
+
+  /**
+   * @brief Callback receiving the result of an asynchronous RSS check
+   */
+  typedef std::function<void(Result const &)> ResultCallback;
+
+  /**
+   * @brief constructor
+   *
+   * Starts the worker threads.
+   *
+   * @param[in] queueCapacity the maximum number of world models waiting in the submission queue (at least 1)
+   * @param[in] backpressurePolicy the behavior of submit() if the submission queue is full
+   * @param[in] evaluationMode the evaluation mode of the situation checks
+   */
+  explicit RssCheckAsync(std::size_t const queueCapacity = 4u,
+                         BackpressurePolicy const backpressurePolicy = BackpressurePolicy::Block,
+                         RssCheck::EvaluationMode const evaluationMode = RssCheck::EvaluationMode::Full);
+
+  /**
+   * @brief destructor
+   *
+   * Stops the processing, see stop().
+   */
+  ~RssCheckAsync();
+
+  RssCheckAsync(RssCheckAsync const &other) = delete;
+  RssCheckAsync &operator=(RssCheckAsync const &other) = delete;
+
+  /**
+   * @brief submit a world model for asynchronous processing
+   *
+   * @param [in] worldModel - the world model to be processed
+   * \param [out] result - the future providing the result of the processing
+   *
+   * @return true if the world model was submitted, false if the processing is stopped or not available.
+   */
+  bool submit(world::WorldModel const &worldModel, std::future<Result> &result);
+
+  /**
+   * @brief submit a world model for asynchronous processing
+   *
+   * @param [in] worldModel - the world model to be processed
+   * \param [in] callback - the callback receiving the result of the processing
+   *
+   * @return true if the world model was submitted, false if the processing is stopped or not available.
+   */
+  bool submit(world::WorldModel const &worldModel, ResultCallback const &callback);
+
+  /**
+   * @brief wait until all submitted world models are processed
+   */
+  void waitUntilIdle();
+
+  /**
+   * @brief stop the processing
+   *
+   * World models not yet processed are finished with status Stopped. Afterwards, no further world models are
+   * accepted. Blocks until the worker threads have finished.
+   */
+  void stop();
+
+  /**
+   * @returns the number of world models dropped from the submission queue so far
+   */
+  std::size_t getNumberOfDroppedWorldModels() const;
+
+  /**
+   * @returns the backpressure policy of the submission queue
+   */
+  BackpressurePolicy getBackpressurePolicy() const;
+
+private:
+  struct Request
+  {
+    std::promise<Result> promise;
+    bool hasPromise{false};
+    ResultCallback callback;
+  };
+
+  struct SubmittedRequest
+  {
+    world::WorldModel worldModel;
+    Request request;
+  };
+
+  struct ExtractedRequest
+  {
+    bool extractionResult{false};
+    situation::SituationSnapshot situationSnapshot;
+    world::RssDynamics egoVehicleRssDynamics;
+    Request request;
+  };
+
+  bool submitRequest(world::WorldModel const &worldModel, Request &request);
+  void extractionWorker();
+  void checkingWorker();
+  void finishRequest(Request &request, Result const &result);
+
+  std::size_t mQueueCapacity;
+  BackpressurePolicy mBackpressurePolicy;
+  RssCheck mRssCheck;
+  RssCycleState mCycleState;
+
+  mutable std::mutex mMutex;
+  std::condition_variable mSubmissionNotEmpty;
+  std::condition_variable mSubmissionNotFull;
+  std::condition_variable mExtractedNotEmpty;
+  std::condition_variable mExtractedNotFull;
+  std::condition_variable mIdle;
+  std::deque<SubmittedRequest> mSubmissionQueue;
+  std::deque<ExtractedRequest> mExtractedQueue;
+  std::size_t mPendingRequests;
+  std::size_t mDroppedWorldModels;
+  bool mStopped;
+
+  std::thread mExtractionThread;
+  std::thread mCheckingThread;
+};
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,165 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "ad_rss/core/RssCheck.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+class RssThreadPool;
+
+/*!
+ * @brief An entry of a batch: the world model of a single RssCheck instance
+ */
+struct RssCheckBatchEntry
+{
+  /*!
+   * The id of the RssCheck instance, e.g. the id of the simulated ego vehicle
+   */
+  std::uint64_t instanceId{0u};
+
+  /*!
+   * The world model to be checked by the instance; has to stay valid until the batch is processed
+   */
+  world::WorldModel const *worldModel{nullptr};
+};
+
+/*!
+ * @brief The result of an entry of a batch
+ */
+struct RssCheckBatchResult
+{
+  /*!
+   * True if the RssCheck of the entry succeeded; the other members are only valid in this case
+   */
+  bool isValid{false};
+
+  /*!
+   * The proper response of the entry
+   */
+  state::ProperResponse properResponse;
+
+  /*!
+   * The acceleration restriction of the entry
+   */
+  world::AccelerationRestriction accelerationRestriction;
+};
+
+/**
+ * @brief RssCheckBatch
+ *
+ * Evaluates many independent world models per cycle, e.g. of the simulated egos of a traffic simulation.
+ *
+ * Each instance id is bound to its own RssCheck instance which keeps the history of that instance across the calls
+ * of calculateAccelerationRestrictions(); the instance is created on the first use of the id. The entries of a batch
+ * are distributed over the calling thread and a pool of worker threads. Each thread processes its share of the entries
+ * and steals the pending entries of the other threads once its share is done, so the load is balanced also if the
+ * world models differ largely in complexity.
+ *
+ * The results of an instance are identical to calling its RssCheck sequentially.
+ */
+class RssCheckBatch
+{
+public:
+  /**
+   * @brief constructor
+   *
+   * @param [in] numberOfThreads - the number of threads processing a batch including the calling thread;
+   *   0 uses the number of hardware threads
+   */
+  explicit RssCheckBatch(std::size_t const numberOfThreads = 0u);
+
+  /**
+   * @brief destructor; stops the worker threads
+   */
+  ~RssCheckBatch();
+
+  RssCheckBatch(RssCheckBatch const &other) = delete;
+  RssCheckBatch &operator=(RssCheckBatch const &other) = delete;
+
+  /**
+   * @returns the number of threads processing a batch including the calling thread
+   */
+  std::size_t getNumberOfThreads() const;
+
+  /**
+   * @brief calculateAccelerationRestrictions
+   *
+   * Performs the RssCheck of each entry with the RssCheck instance of its instance id. Must not be called concurrently.
+   *
+   * @param [in] entries - the entries of the batch; each instance id may occur only once
+   * @param [out] results - the results in the order of the entries
+   *
+   * @returns false if the batch itself is invalid (duplicate instance id, missing world model) or an internal error
+   *   occurred, true otherwise. The success of the individual entries is provided by RssCheckBatchResult::isValid.
+   */
+  bool calculateAccelerationRestrictions(std::vector<RssCheckBatchEntry> const &entries,
+                                         std::vector<RssCheckBatchResult> &results);
+
+  /**
+   * @returns the number of RssCheck instances
+   */
+  std::size_t getNumberOfInstances() const;
+
+  /**
+   * @brief removes the RssCheck instance of an id, e.g. if the simulated ego vehicle left the simulation
+   *
+   * @param [in] instanceId - the id of the instance
+   *
+   * @returns true if the instance existed
+   */
+  bool removeInstance(std::uint64_t const instanceId);
+
+private:
+  std::unique_ptr<RssThreadPool> mThreadPool;
+  std::unordered_map<std::uint64_t, std::unique_ptr<RssCheck>> mInstances;
+  std::vector<RssCheck *> mEntryInstances;
+};
+
+} // namespace core
+} // namespace ad_rss
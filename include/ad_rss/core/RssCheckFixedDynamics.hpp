@@ -0,0 +1,226 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <utility>
+#include "ad_rss/core/RssCheck.hpp"
+#include "ad_rss/situation/RssFixedDynamicsFormulaProvider.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief RssCheckFixedDynamics
+ *
+ * RssCheck specialized for a fixed ego vehicle dynamics profile and a fixed set of object dynamics profiles known at
+ * compile time (see world::RssDynamicsProfileTraits). The situation checks evaluate the RSS formulas by the
+ * situation::RssFixedDynamicsFormulaProvider of these profiles. Objects with dynamics not matching any of the
+ * profiles are still supported and evaluated with their runtime dynamics.
+ *
+ * The world models passed are expected to use world::createRssDynamics<EgoProfile>() as egoVehicleRssDynamics.
+ *
+ * The class holds the RssCheck it forwards to; the functions have the semantics of the respective RssCheck functions.
+ * The formula provider is fixed, therefore RssCheck::setFormulaProvider() is not provided.
+ */
+template <typename EgoProfile, typename... ObjectProfiles> class RssCheckFixedDynamics
+{
+public:
+  typedef RssCheck::ExecutionMode ExecutionMode;
+  typedef RssCheck::EvaluationMode EvaluationMode;
+
+  /**
+   * @brief constructor
+   *
+   * @param[in] executionMode the execution mode of the RSS check sequence
+   * @param[in] evaluationMode the evaluation mode of the situation checks
+   */
+  explicit RssCheckFixedDynamics(ExecutionMode const executionMode = ExecutionMode::Staged,
+                                 EvaluationMode const evaluationMode = EvaluationMode::Full)
+    : mRssCheck(executionMode, evaluationMode)
+  {
+    mRssCheck.setFormulaProvider(mFormulaProvider);
+  }
+
+  RssCheckFixedDynamics(RssCheckFixedDynamics const &other) = delete;
+  RssCheckFixedDynamics &operator=(RssCheckFixedDynamics const &other) = delete;
+
+  /**
+   * @brief calculateAccelerationRestriction
+   *
+   * See the overloads of RssCheck::calculateAccelerationRestriction().
+   */
+  template <typename... Arguments> bool calculateAccelerationRestriction(Arguments &&... arguments)
+  {
+    return mRssCheck.calculateAccelerationRestriction(std::forward<Arguments>(arguments)...);
+  }
+
+  /**
+   * @brief calculateAccelerationRestriction
+   *
+   * See the stateless overloads of RssCheck::calculateAccelerationRestriction().
+   */
+  template <typename... Arguments> bool calculateAccelerationRestriction(Arguments &&... arguments) const
+  {
+    return mRssCheck.calculateAccelerationRestriction(std::forward<Arguments>(arguments)...);
+  }
+
+  /**
+   * @brief calculateAccelerationRestrictionWithinBudget
+   *
+   * See RssCheck::calculateAccelerationRestrictionWithinBudget().
+   */
+  bool calculateAccelerationRestrictionWithinBudget(world::WorldModel const &worldModel,
+                                                    std::chrono::steady_clock::duration const &timeBudget,
+                                                    world::AccelerationRestriction &accelerationRestriction,
+                                                    state::ProperResponse &properResponse,
+                                                    RssCheck::BudgetStatistics &budgetStatistics)
+  {
+    return mRssCheck.calculateAccelerationRestrictionWithinBudget(
+      worldModel, timeBudget, accelerationRestriction, properResponse, budgetStatistics);
+  }
+
+  /**
+   * @returns the state resulting from the previous cycle of the stateful calculateAccelerationRestriction() calls
+   */
+  RssCycleState const &getCycleState() const
+  {
+    return mRssCheck.getCycleState();
+  }
+
+  /**
+   * @brief setCycleState
+   *
+   * @param [in] cycleState - the state the next stateful calculateAccelerationRestriction() call continues from
+   */
+  void setCycleState(RssCycleState const &cycleState)
+  {
+    mRssCheck.setCycleState(cycleState);
+  }
+
+  /**
+   * @brief saveCheckpoint
+   *
+   * See RssCheck::saveCheckpoint().
+   */
+  bool saveCheckpoint(std::vector<std::uint8_t> &checkpoint) const
+  {
+    return mRssCheck.saveCheckpoint(checkpoint);
+  }
+
+  /**
+   * @brief restoreCheckpoint
+   *
+   * See RssCheck::restoreCheckpoint().
+   */
+  bool restoreCheckpoint(std::vector<std::uint8_t> const &checkpoint)
+  {
+    return mRssCheck.restoreCheckpoint(checkpoint);
+  }
+
+  /**
+   * @brief setSkippedSituationPolicy
+   *
+   * See RssCheck::setSkippedSituationPolicy().
+   */
+  void setSkippedSituationPolicy(RssCheck::SkippedSituationPolicy const skippedSituationPolicy)
+  {
+    mRssCheck.setSkippedSituationPolicy(skippedSituationPolicy);
+  }
+
+  /**
+   * @returns the policy applied to the situations skipped by calculateAccelerationRestrictionWithinBudget()
+   */
+  RssCheck::SkippedSituationPolicy getSkippedSituationPolicy() const
+  {
+    return mRssCheck.getSkippedSituationPolicy();
+  }
+
+  /**
+   * @returns the registry of the roads a RegisteredRoadWorldModel can refer to
+   */
+  RssRoadRegistry &getRoadRegistry()
+  {
+    return mRssCheck.getRoadRegistry();
+  }
+
+  /**
+   * @returns the registry of the roads a RegisteredRoadWorldModel can refer to
+   */
+  RssRoadRegistry const &getRoadRegistry() const
+  {
+    return mRssCheck.getRoadRegistry();
+  }
+
+  /**
+   * @brief calculateRssStateInformation
+   *
+   * See RssCheck::calculateRssStateInformation().
+   */
+  bool calculateRssStateInformation(situation::Situation const &situation, state::RssState &rssState) const
+  {
+    return mRssCheck.calculateRssStateInformation(situation, rssState);
+  }
+
+  /**
+   * @returns the execution mode of the RSS check sequence
+   */
+  ExecutionMode getExecutionMode() const
+  {
+    return mRssCheck.getExecutionMode();
+  }
+
+  /**
+   * @returns the evaluation mode of the situation checks
+   */
+  EvaluationMode getEvaluationMode() const
+  {
+    return mRssCheck.getEvaluationMode();
+  }
+
+private:
+  // declared first: the formula provider is referenced by the RssCheck and has to outlive it
+  situation::RssFixedDynamicsFormulaProvider<EgoProfile, ObjectProfiles...> mFormulaProvider;
+  RssCheck mRssCheck;
+};
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,163 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include "ad_rss/physics/TimeIndex.hpp"
+#include "ad_rss/state/ProperResponse.hpp"
+#include "ad_rss/world/AccelerationRestriction.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/*!
+ * @brief The result of one cycle of the RSS check sequence
+ */
+struct RssCheckResult
+{
+  /*!
+   * The time index of the world model the result was calculated for
+   */
+  physics::TimeIndex timeIndex{0u};
+
+  /*!
+   * The restrictions of the ego vehicle acceleration
+   */
+  world::AccelerationRestriction accelerationRestriction;
+
+  /*!
+   * The proper response the acceleration restrictions are derived from
+   */
+  state::ProperResponse properResponse;
+};
+
+/*!
+ * @brief class RssCheckResultPublisher
+ *
+ * Publishes the results of the RSS check sequence from the thread performing the RssCheck to a consumer thread,
+ * e.g. the actuator control polling the latest acceleration restrictions at a higher rate.
+ *
+ * The publication is implemented as triple buffer: the publishing thread fills a back buffer and exchanges it with
+ * the shared middle buffer, the reading thread exchanges its front buffer with the middle buffer if a newer result
+ * is available. Both sides require a single atomic exchange only; neither of them waits for the other.
+ * acquireLatest() provides the front buffer to the reader without copying and is wait-free. readLatest() copies the
+ * front buffer into the object of the caller, which allocates if the capacity of the dangerous objects vector of the
+ * caller is insufficient; it's wait-free only if the caller reuses its result object with sufficient capacity.
+ * The publisher supports one publishing and one reading thread at a time.
+ */
+class RssCheckResultPublisher
+{
+public:
+  /*!
+   * @brief constructor
+   */
+  RssCheckResultPublisher();
+
+  /*!
+   * @brief destructor
+   */
+  ~RssCheckResultPublisher() = default;
+
+  RssCheckResultPublisher(RssCheckResultPublisher const &other) = delete;
+  RssCheckResultPublisher &operator=(RssCheckResultPublisher const &other) = delete;
+
+  /*!
+   * @brief Publish the result of a cycle of the RSS check sequence. To be called by the publishing thread only.
+   *
+   * @param [in] accelerationRestriction the acceleration restrictions of the cycle
+   * @param [in] properResponse the proper response of the cycle
+   *
+   * @return true if the result was published, false if the time indices of the inputs are invalid (zero,
+   * inconsistent or not increasing compared to the previously published result). Like within the RssCheck, the
+   * overflow of the time index is considered: a time index is increasing if it is ahead by less than half of the
+   * value range.
+   */
+  bool publish(world::AccelerationRestriction const &accelerationRestriction,
+               state::ProperResponse const &properResponse);
+
+  /*!
+   * @brief Acquire the latest published result without copying it. To be called by the reading thread only.
+   *
+   * The result provided stays valid and unchanged until the next call of acquireLatest() or readLatest().
+   *
+   * @return the latest published result, nullptr if nothing has been published yet
+   */
+  RssCheckResult const *acquireLatest();
+
+  /*!
+   * @brief Read the latest published result. To be called by the reading thread only.
+   *
+   * The result is copied into the object of the caller, see the class description.
+   *
+   * @param [out] result the latest published result
+   *
+   * @return true if a result was available, false if nothing has been published yet
+   */
+  bool readLatest(RssCheckResult &result);
+
+  /*!
+   * @brief Check if a result newer than the one returned by the last readLatest() call is available.
+   *
+   * @return true if a newer result is available
+   */
+  bool hasNewResult() const;
+
+  /*!
+   * @return the time index of the latest published result. To be called by the publishing thread only.
+   */
+  physics::TimeIndex getPublishedTimeIndex() const;
+
+private:
+  static const uint8_t cIndexMask = 0x03u;
+  static const uint8_t cNewResultFlag = 0x04u;
+
+  RssCheckResult mBuffers[3];
+  std::atomic<uint8_t> mMiddleState;
+  uint8_t mBackIndex;
+  uint8_t mFrontIndex;
+  bool mFrontValid;
+  physics::TimeIndex mPublishedTimeIndex;
+};
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,221 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include "ad_rss/physics/TimeIndex.hpp"
+#include "ad_rss/situation/SituationId.hpp"
+#include "ad_rss/situation/SituationType.hpp"
+#include "ad_rss/world/LaneSegmentId.hpp"
+#include "ad_rss/world/ObjectId.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace situation
+ */
+namespace situation {
+
+/*!
+ * \brief Enum IntersectionState
+ *
+ * Enumeration defining the possible states of an intersection situation
+ *
+ * Be aware: there has to be a strict order of the enumeration values according to
+ * the strictness of the response
+ */
+enum class IntersectionState : std::uint32_t
+{
+  NonPrioAbleToBreak = 0u,       /*!< NonPrio-Vehicle can stop in front intersection */
+  SafeLongitudinalDistance = 1u, /*!< There is a safe longitudinal distance  between the vehicles*/
+  NoTimeOverlap = 2u             /*!< There is no time overlap between the paths of the two vehicles */
+};
+
+} // namespace situation
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/*!
+ * @brief The history of the situation id assignment, see world::RssSituationIdProvider
+ */
+struct RssSituationIdState
+{
+  /*!
+   * @brief The data of a situation required to recognize it in the next point in time
+   */
+  struct SituationData
+  {
+    /*!
+     * @brief the time index the situation was seen last
+     */
+    physics::TimeIndex timeIndex{0u};
+    /*!
+     * @brief the type of the situation
+     */
+    situation::SituationType situationType{situation::SituationType::NotRelevant};
+    /*!
+     * @brief the id assigned to the situation
+     */
+    situation::SituationId situationId{0u};
+    /*!
+     * @brief the intersection lane segments of the ego vehicle road (intersection situations only)
+     */
+    std::set<world::LaneSegmentId> egoVehicleIntersectionArea;
+    /*!
+     * @brief the intersection lane segments of the object road (intersection situations only)
+     */
+    std::set<world::LaneSegmentId> objectIntersectionArea;
+  };
+
+  /*!
+   * @brief the time index of the current point in time
+   */
+  physics::TimeIndex currentTime{0u};
+  /*!
+   * @brief the time index of the previous point in time
+   */
+  physics::TimeIndex lastTime{0u};
+  /*!
+   * @brief the last situation id assigned
+   */
+  situation::SituationId nextSituationId{0u};
+  /*!
+   * @brief the situations of the current and the previous point in time per object
+   */
+  std::multimap<world::ObjectId, SituationData> situationData;
+};
+
+/*!
+ * @brief The history of the intersection checks, see situation::calculateRssStateIntersection()
+ */
+struct RssIntersectionCheckingState
+{
+  /*!
+   * @brief typedef for the map of the last safe IntersectionState of the situations
+   */
+  typedef std::map<situation::SituationId, situation::IntersectionState> IntersectionStateMap;
+
+  /*!
+   * @brief last safe IntersectionState of each situation of previous time step
+   */
+  IntersectionStateMap lastSafeStates;
+  /*!
+   * @brief last safe IntersectionState of each situation of current time step
+   */
+  IntersectionStateMap currentSafeStates;
+  /*!
+   * @brief time index of the current processing step
+   */
+  physics::TimeIndex currentTimeIndex{0u};
+};
+
+/*!
+ * @brief The history of the situation checks, see RssSituationChecking
+ */
+struct RssSituationCheckingState
+{
+  /*!
+   * @brief the time index of the situations checked last
+   */
+  physics::TimeIndex currentTimeIndex{0u};
+  /*!
+   * @brief the history of the intersection checks
+   */
+  RssIntersectionCheckingState intersectionCheckingState;
+};
+
+/*!
+ * @brief The history of the response resolving, see RssResponseResolving
+ */
+struct RssResponseResolvingState
+{
+  /*!
+   * @brief The safe axes of a situation before the danger threshold time
+   */
+  struct RssSafeState
+  {
+    /*!
+     * @brief true if the situation was longitudinal safe
+     */
+    bool longitudinalSafe{false};
+    /*!
+     * @brief true if the situation was lateral safe
+     */
+    bool lateralSafe{false};
+  };
+
+  /*!
+   * @brief typedef for the map of the safe states before the danger threshold time of the situations
+   */
+  typedef std::map<situation::SituationId, RssSafeState> RssSafeStateMap;
+
+  /*!
+   * @brief the safe states before the danger threshold time of the situations
+   */
+  RssSafeStateMap statesBeforeDangerThresholdTime;
+};
+
+/*!
+ * @brief The complete history of the RSS check sequence carried from one point in time to the next
+ *
+ * The state is a plain value: it can be copied to fork the evaluation, e.g. for speculative evaluations or
+ * simulations, and moved cheaply. See RssCheck::calculateAccelerationRestriction().
+ */
+struct RssCycleState
+{
+  /*!
+   * @brief the history of the situation id assignment
+   */
+  RssSituationIdState situationIdState;
+  /*!
+   * @brief the history of the situation checks
+   */
+  RssSituationCheckingState situationCheckingState;
+  /*!
+   * @brief the history of the response resolving
+   */
+  RssResponseResolvingState responseResolvingState;
+};
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,91 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ad_rss/core/RssCycleState.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief serializeCycleState
+ *
+ * Serializes the cycle state into a compact, platform independent binary checkpoint: all integers are stored as
+ * variable length quantities and the ordered keys of the maps and sets as differences to their predecessor.
+ * The road areas registered at a RssRoadRegistry are not part of the cycle state and therefore not serialized.
+ *
+ * @param [in] cycleState - the cycle state to be serialized
+ * \param [out] checkpoint - the binary checkpoint; the previous content is replaced
+ *
+ * @return return true if the cycle state could be serialized, false otherwise.
+ */
+bool serializeCycleState(RssCycleState const &cycleState, std::vector<std::uint8_t> &checkpoint);
+
+/**
+ * @brief deserializeCycleState
+ *
+ * Restores a cycle state from a binary checkpoint created by serializeCycleState(). The checkpoint is validated
+ * completely before the cycle state is touched.
+ *
+ * @param [in] data - the begin of the binary checkpoint
+ * @param [in] size - the size of the binary checkpoint in bytes
+ * \param [out] cycleState - the restored cycle state; unchanged on failure
+ *
+ * @return return true if the checkpoint was valid and the cycle state could be restored, false otherwise.
+ */
+bool deserializeCycleState(std::uint8_t const *data, std::size_t const size, RssCycleState &cycleState);
+
+/**
+ * @brief deserializeCycleState
+ *
+ * @param [in] checkpoint - the binary checkpoint created by serializeCycleState()
+ * \param [out] cycleState - the restored cycle state; unchanged on failure
+ *
+ * @return return true if the checkpoint was valid and the cycle state could be restored, false otherwise.
+ */
+bool deserializeCycleState(std::vector<std::uint8_t> const &checkpoint, RssCycleState &cycleState);
+
+} // namespace core
+} // namespace ad_rss
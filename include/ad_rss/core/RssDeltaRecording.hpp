@@ -0,0 +1,313 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "ad_rss/state/ProperResponse.hpp"
+#include "ad_rss/world/AccelerationRestriction.hpp"
+#include "ad_rss/world/WorldModel.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/*!
+ * @brief A frame of a delta coded RSS recording
+ */
+struct RssDeltaRecordFrame
+{
+  /*!
+   * The recorded world model
+   */
+  world::WorldModel worldModel;
+
+  /*!
+   * True if the results of the RSS check were recorded together with the world model
+   */
+  bool hasResult{false};
+
+  /*!
+   * The recorded proper response; only valid if hasResult is true
+   */
+  state::ProperResponse properResponse;
+
+  /*!
+   * The recorded acceleration restriction; only valid if hasResult is true
+   */
+  world::AccelerationRestriction accelerationRestriction;
+};
+
+/*!
+ * @brief A keyframe of a delta coded RSS recording: decoding can start at any keyframe
+ */
+struct RssDeltaRecordKeyframe
+{
+  /*!
+   * The number of the frame within the recording, starting with 0
+   */
+  std::uint64_t frameNumber{0u};
+
+  /*!
+   * The time index of the world model of the frame
+   */
+  physics::TimeIndex timeIndex{0u};
+
+  /*!
+   * The position of the frame within the recording file
+   */
+  std::uint64_t fileOffset{0u};
+};
+
+/**
+ * @brief RssDeltaRecordWriter
+ *
+ * Writes world models and optionally the results of the RSS check into a delta coded recording file.
+ *
+ * In contrast to the RssRecordWriter, the frames are not self-contained: every keyframeInterval frames a keyframe is
+ * written, all other frames only store the differences to their predecessor. The scenes of a frame refer to the scene
+ * of the same object within the previous frame and only the changed parts are stored; road areas are stored once per
+ * keyframe interval and referenced by content afterwards. All numeric fields are stored as zig-zag coded variable
+ * length differences to their reference value; floating point values as differences of their bit patterns, so the
+ * coding is lossless and platform independent.
+ *
+ * On close, an index of the keyframes is appended, which allows the RssDeltaRecordReader to seek within the
+ * recording. A recording without index (e.g. not closed properly) is still readable up to the last complete frame.
+ */
+class RssDeltaRecordWriter
+{
+public:
+  /**
+   * @brief constructor
+   *
+   * @param [in] keyframeInterval - the number of frames after which a keyframe is written; 0 is treated as 1
+   */
+  explicit RssDeltaRecordWriter(std::size_t const keyframeInterval = 100u);
+
+  /**
+   * @brief destructor; closes the recording
+   */
+  ~RssDeltaRecordWriter();
+
+  /**
+   * @brief open
+   *
+   * Creates the recording file and writes the file header. An already open recording is closed before.
+   *
+   * @param [in] fileName - the name of the recording file
+   *
+   * @return return true if the recording could be created, false otherwise.
+   */
+  bool open(std::string const &fileName);
+
+  /**
+   * @returns true if the recording is open
+   */
+  bool isOpen() const;
+
+  /**
+   * @brief writeFrame
+   *
+   * @param [in] worldModel - the world model to be recorded
+   *
+   * @return return true if the frame could be written, false otherwise.
+   */
+  bool writeFrame(world::WorldModel const &worldModel);
+
+  /**
+   * @brief writeFrame
+   *
+   * @param [in] worldModel - the world model to be recorded
+   * @param [in] properResponse - the proper response calculated for the world model
+   * @param [in] accelerationRestriction - the acceleration restriction calculated for the world model
+   *
+   * @return return true if the frame could be written, false otherwise.
+   */
+  bool writeFrame(world::WorldModel const &worldModel,
+                  state::ProperResponse const &properResponse,
+                  world::AccelerationRestriction const &accelerationRestriction);
+
+  /**
+   * @brief close
+   *
+   * Writes the keyframe index, flushes and closes the recording.
+   *
+   * @return return true if all data was written successfully, false otherwise.
+   */
+  bool close();
+
+private:
+  bool writeFrameInternal(world::WorldModel const &worldModel,
+                          state::ProperResponse const *properResponse,
+                          world::AccelerationRestriction const *accelerationRestriction);
+  bool writeRecord(std::uint8_t const recordType);
+
+  std::size_t const mKeyframeInterval;
+  std::ofstream mStream;
+  std::uint64_t mFileOffset{0u};
+  std::uint64_t mFrameNumber{0u};
+  bool mForceKeyframe{true};
+  RssDeltaRecordFrame mPreviousFrame;
+  std::vector<world::RoadArea> mRoadAreas;
+  std::unordered_multimap<std::uint64_t, std::size_t> mRoadAreaIndex;
+  std::vector<RssDeltaRecordKeyframe> mKeyframes;
+  std::vector<std::uint8_t> mBuffer;
+};
+
+/**
+ * @brief RssDeltaRecordReader
+ *
+ * Reads the frames of a recording created by the RssDeltaRecordWriter. The file is read sequentially; the keyframes
+ * allow to start decoding at any position of the recording.
+ */
+class RssDeltaRecordReader
+{
+public:
+  /**
+   * @brief constructor
+   */
+  RssDeltaRecordReader();
+
+  /**
+   * @brief destructor; closes the recording
+   */
+  ~RssDeltaRecordReader();
+
+  /**
+   * @brief open
+   *
+   * Opens the recording and reads the keyframe index. If the recording has no valid index, the keyframes are
+   * collected by scanning the recording; the recording ends with the last complete frame.
+   *
+   * @param [in] fileName - the name of the recording file
+   *
+   * @return return true if the recording could be opened, false otherwise.
+   */
+  bool open(std::string const &fileName);
+
+  /**
+   * @returns true if the recording is open
+   */
+  bool isOpen() const;
+
+  /**
+   * @brief close the recording
+   */
+  void close();
+
+  /**
+   * @brief readNextFrame
+   *
+   * Decodes the next frame of the recording, which becomes available by getFrame().
+   *
+   * @return return true if the next frame could be decoded, false at the end of the recording or if the frame is
+   * corrupted.
+   */
+  bool readNextFrame();
+
+  /**
+   * @returns the frame decoded last
+   */
+  RssDeltaRecordFrame const &getFrame() const;
+
+  /**
+   * @returns the number of the frame decoded last
+   */
+  std::uint64_t getFrameNumber() const;
+
+  /**
+   * @returns true if all frames of the recording were read
+   */
+  bool isAtEnd() const;
+
+  /**
+   * @returns the keyframes of the recording
+   */
+  std::vector<RssDeltaRecordKeyframe> const &getKeyframes() const;
+
+  /**
+   * @brief seekKeyframe
+   *
+   * Decodes the given keyframe, which becomes available by getFrame(); readNextFrame() continues behind it.
+   *
+   * @param [in] keyframeIndex - the index of the keyframe within getKeyframes()
+   *
+   * @return return true if the keyframe could be decoded, false otherwise.
+   */
+  bool seekKeyframe(std::size_t const keyframeIndex);
+
+  /**
+   * @brief seekTimeIndex
+   *
+   * Decodes the first frame with a time index not smaller than the given one, starting at the closest preceding
+   * keyframe. The frame becomes available by getFrame(); readNextFrame() continues behind it.
+   *
+   * @param [in] timeIndex - the time index to seek
+   *
+   * @return return true if such a frame could be decoded, false otherwise.
+   */
+  bool seekTimeIndex(physics::TimeIndex const timeIndex);
+
+private:
+  bool readIndex();
+  bool scanKeyframes();
+  bool readRecordHeader(std::uint8_t &recordType, std::uint64_t &recordSize);
+
+  std::ifstream mStream;
+  std::uint64_t mFramesBegin{0u};
+  std::uint64_t mFramesEnd{0u};
+  std::uint64_t mPosition{0u};
+  std::uint64_t mFrameNumber{0u};
+  std::uint64_t mNextFrameNumber{0u};
+  bool mHasReference{false};
+  RssDeltaRecordFrame mFrame;
+  RssDeltaRecordFrame mNextFrame;
+  std::vector<world::RoadArea> mRoadAreas;
+  std::vector<RssDeltaRecordKeyframe> mKeyframes;
+  std::vector<std::uint8_t> mBuffer;
+};
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,228 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+#include "ad_rss/core/RssSituationExtraction.hpp"
+#include "ad_rss/physics/Distance.hpp"
+#include "ad_rss/physics/TimeIndex.hpp"
+#include "ad_rss/world/RssDynamics.hpp"
+#include "ad_rss/world/WorldModel.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+class RssThreadPool;
+
+/*!
+ * @brief A configuration of the RSS dynamics evaluated by the RssDynamicsSweep
+ */
+struct RssDynamicsConfiguration
+{
+  /*!
+   * The dynamics of the ego vehicle; replaces world::WorldModel::egoVehicleRssDynamics
+   */
+  world::RssDynamics egoDynamics;
+
+  /*!
+   * The dynamics of all objects; replaces world::Scene::objectRssDynamics of all scenes
+   */
+  world::RssDynamics objectDynamics;
+};
+
+/*!
+ * @brief The parameters of the RSS dynamics a sweep axis can vary
+ */
+enum class RssDynamicsParameter
+{
+  ResponseTime,            /*!< world::RssDynamics::responseTime */
+  AlphaLonAccelMax,        /*!< world::RssDynamics::alphaLon.accelMax */
+  AlphaLonBrakeMax,        /*!< world::RssDynamics::alphaLon.brakeMax */
+  AlphaLonBrakeMin,        /*!< world::RssDynamics::alphaLon.brakeMin */
+  AlphaLonBrakeMinCorrect, /*!< world::RssDynamics::alphaLon.brakeMinCorrect */
+  AlphaLatAccelMax,        /*!< world::RssDynamics::alphaLat.accelMax */
+  AlphaLatBrakeMin         /*!< world::RssDynamics::alphaLat.brakeMin */
+};
+
+/*!
+ * @brief An axis of a grid of RSS dynamics configurations, see createDynamicsGrid()
+ */
+struct RssDynamicsSweepAxis
+{
+  /*!
+   * The parameter varied along the axis
+   */
+  RssDynamicsParameter parameter{RssDynamicsParameter::ResponseTime};
+
+  /*!
+   * If true, the parameter of the ego dynamics is varied
+   */
+  bool applyToEgo{true};
+
+  /*!
+   * If true, the parameter of the object dynamics is varied
+   */
+  bool applyToObjects{false};
+
+  /*!
+   * The values of the parameter along the axis in SI units (s, m/s^2)
+   */
+  std::vector<double> values;
+};
+
+/*!
+ * @brief The statistics of a configuration over the evaluated frames
+ */
+struct RssDynamicsSweepStatistics
+{
+  /*!
+   * The number of evaluated frames
+   */
+  std::uint64_t numberOfFrames{0u};
+
+  /*!
+   * The number of frames with at least one dangerous situation
+   */
+  std::uint64_t numberOfUnsafeFrames{0u};
+
+  /*!
+   * The number of dangerous situations summed up over all frames
+   */
+  std::uint64_t numberOfDangerousSituations{0u};
+
+  /*!
+   * The minimum margin of all situations of all frames. The margin of a situation is the difference of the current
+   * and the safe distance of the longitudinal axis or, if the vehicles don't overlap laterally, the larger one of
+   * both axes; it is positive if the situation is safe.
+   */
+  physics::Distance minimumMargin{std::numeric_limits<physics::Distance>::max()};
+
+  /*!
+   * The time index of the frame with the minimum margin (the earliest one on equal margins), 0 if there is none
+   */
+  physics::TimeIndex minimumMarginTimeIndex{0u};
+
+  /**
+   * @returns the rate of the unsafe frames, 0 if no frame was evaluated
+   */
+  double getUnsafeFrameRate() const
+  {
+    return (numberOfFrames > 0u) ? static_cast<double>(numberOfUnsafeFrames) / static_cast<double>(numberOfFrames)
+                                 : 0.;
+  }
+};
+
+/**
+ * @brief create the configurations of a grid of RSS dynamics
+ * The configurations are the cartesian product of the values of all axes, applied to the base configuration.
+ * The first axis varies slowest, the last axis fastest.
+ * @param [in] baseConfiguration - the configuration providing the parameters not varied by the axes
+ * @param [in] axes - the axes of the grid
+ * @param [out] configurations - the configurations of the grid
+ * @returns false if an axis has no values or a configuration is not within the valid input range, true otherwise.
+ */
+bool createDynamicsGrid(RssDynamicsConfiguration const &baseConfiguration,
+                        std::vector<RssDynamicsSweepAxis> const &axes,
+                        std::vector<RssDynamicsConfiguration> &configurations);
+
+/**
+ * @brief RssDynamicsSweep
+ * Evaluates the frames of recorded scenes under many RSS dynamics configurations, e.g. to calibrate the dynamics.
+ * Since the situations don't depend on the dynamics, they are extracted only once per frame; then the RSS formulas
+ * of each situation are evaluated for all configurations at once. The formulas of the non intersection situations are
+ * evaluated in closed form on contiguous arrays across the configurations, so the compiler is able to vectorize the
+ * loops; intersection situations are evaluated per configuration. The frames are distributed over a pool of threads.
+ *
+ * A frame is unsafe for a configuration if any of its situations is dangerous in the sense of the situation checks.
+ * The frames are evaluated independently of each other, i.e. without the history of a RssCheck; the responses
+ * resolved with that history are not part of the statistics. The results are independent of the number of threads.
+ */
+class RssDynamicsSweep
+{
+public:
+  /**
+   * @brief constructor
+   * @param [in] numberOfThreads - the number of threads evaluating the frames including the calling thread;
+   *   0 uses the number of hardware threads
+   */
+  explicit RssDynamicsSweep(std::size_t const numberOfThreads = 0u);
+
+  /**
+   * @brief destructor; stops the worker threads
+   */
+  ~RssDynamicsSweep();
+
+  RssDynamicsSweep(RssDynamicsSweep const &other) = delete;
+  RssDynamicsSweep &operator=(RssDynamicsSweep const &other) = delete;
+
+  /**
+   * @returns the number of threads evaluating the frames including the calling thread
+   */
+  std::size_t getNumberOfThreads() const;
+
+  /**
+   * @brief evaluate frames under all configurations
+   * The statistics of the frames are added to the given statistics, so a long recording can be evaluated in chunks of
+   * frames. Must not be called concurrently.
+   * @param [in] frames - the world models of the frames; they are not copied, the dynamics of the configurations are
+   *   passed to the situation extraction instead of the dynamics of the world models
+   * @param [in] configurations - the dynamics configurations to evaluate
+   * @param [in,out] statistics - the statistics in the order of the configurations; if empty, it is initialized
+   * @returns false if the input is invalid (e.g. a world model or configuration not within the valid input range,
+   *   statistics not matching the configurations) or an internal error occurred, true otherwise. In case of an error,
+   *   the statistics are left untouched.
+   */
+  bool evaluate(std::vector<world::WorldModel> const &frames,
+                std::vector<RssDynamicsConfiguration> const &configurations,
+                std::vector<RssDynamicsSweepStatistics> &statistics);
+
+private:
+  std::unique_ptr<RssThreadPool> mThreadPool;
+  RssSituationExtraction mSituationExtraction;
+};
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,330 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "ad_rss/state/ProperResponse.hpp"
+#include "ad_rss/world/AccelerationRestriction.hpp"
+#include "ad_rss/world/WorldModel.hpp"
+#include "ad_rss/world/WorldModelView.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+class MappedFile;
+
+/*!
+ * @brief Read-only view on a recorded proper response
+ *
+ * Equivalent to state::ProperResponse, but the dangerous objects are referenced instead of being owned.
+ */
+struct ProperResponseView
+{
+  /*!
+   * The time index of the proper response
+   */
+  physics::TimeIndex timeIndex{0u};
+
+  /*!
+   * Flag to indicate if the state is safe
+   */
+  bool isSafe{false};
+
+  /*!
+   * The dangerous objects
+   */
+  world::ArrayView<world::ObjectId> dangerousObjects;
+
+  /*!
+   * The longitudinal response
+   */
+  state::LongitudinalResponse longitudinalResponse{state::LongitudinalResponse::None};
+
+  /*!
+   * The lateral response at the right side
+   */
+  state::LateralResponse lateralResponseRight{state::LateralResponse::None};
+
+  /*!
+   * The lateral response at the left side
+   */
+  state::LateralResponse lateralResponseLeft{state::LateralResponse::None};
+};
+
+/**
+ * @brief Create a proper response out of its view
+ *
+ * @param[in] properResponseView the view on the proper response
+ *
+ * @returns the proper response
+ */
+state::ProperResponse createProperResponse(ProperResponseView const &properResponseView);
+
+/*!
+ * @brief A frame read from a RSS recording
+ *
+ * All views reference the memory of the RssRecordReader and stay valid until the next frame is read or the reader is
+ * closed.
+ */
+struct RssRecordFrame
+{
+  /*!
+   * The recorded world model
+   */
+  world::WorldModelView worldModel;
+
+  /*!
+   * True if the results of the RSS check were recorded together with the world model
+   */
+  bool hasResult{false};
+
+  /*!
+   * The recorded proper response; only valid if hasResult is true
+   */
+  ProperResponseView properResponse;
+
+  /*!
+   * The recorded acceleration restriction; only valid if hasResult is true
+   */
+  world::AccelerationRestriction accelerationRestriction;
+};
+
+/**
+ * @brief RssRecordWriter
+ *
+ * Writes world models and optionally the results of the RSS check into a binary recording file.
+ *
+ * The recording consists of a versioned file header followed by one self-contained frame per world model. The
+ * elements of the world model arrays (occupied regions, lane segments, road segment offsets) and the RSS dynamics are
+ * stored in their in-memory representation and 8 byte aligned, so the RssRecordReader can reference them in place.
+ * Therefore, the file header records the byte order and the layout of these types; recordings can only be read on
+ * platforms sharing that layout.
+ */
+class RssRecordWriter
+{
+public:
+  /**
+   * @brief constructor
+   */
+  RssRecordWriter();
+
+  /**
+   * @brief destructor; closes the recording
+   */
+  ~RssRecordWriter();
+
+  /**
+   * @brief open
+   *
+   * Creates the recording file and writes the file header. An already open recording is closed before.
+   *
+   * @param [in] fileName - the name of the recording file
+   *
+   * @return return true if the recording could be created, false otherwise.
+   */
+  bool open(std::string const &fileName);
+
+  /**
+   * @returns true if the recording is open
+   */
+  bool isOpen() const;
+
+  /**
+   * @brief writeFrame
+   *
+   * @param [in] worldModel - the world model to be recorded
+   *
+   * @return return true if the frame could be written, false otherwise.
+   */
+  bool writeFrame(world::WorldModel const &worldModel);
+
+  /**
+   * @brief writeFrame
+   *
+   * @param [in] worldModel - the world model to be recorded
+   * @param [in] properResponse - the proper response calculated for the world model
+   * @param [in] accelerationRestriction - the acceleration restriction calculated for the world model
+   *
+   * @return return true if the frame could be written, false otherwise.
+   */
+  bool writeFrame(world::WorldModel const &worldModel,
+                  state::ProperResponse const &properResponse,
+                  world::AccelerationRestriction const &accelerationRestriction);
+
+  /**
+   * @brief writeFrame
+   *
+   * @param [in] worldModel - the view on the world model to be recorded
+   *
+   * @return return true if the frame could be written, false otherwise.
+   */
+  bool writeFrame(world::WorldModelView const &worldModel);
+
+  /**
+   * @brief writeFrame
+   *
+   * @param [in] worldModel - the view on the world model to be recorded
+   * @param [in] properResponse - the proper response calculated for the world model
+   * @param [in] accelerationRestriction - the acceleration restriction calculated for the world model
+   *
+   * @return return true if the frame could be written, false otherwise.
+   */
+  bool writeFrame(world::WorldModelView const &worldModel,
+                  state::ProperResponse const &properResponse,
+                  world::AccelerationRestriction const &accelerationRestriction);
+
+  /**
+   * @brief close
+   *
+   * Flushes and closes the recording.
+   *
+   * @return return true if all data was written successfully, false otherwise.
+   */
+  bool close();
+
+private:
+  template <class WorldModelType>
+  bool writeFrameT(WorldModelType const &worldModel,
+                   state::ProperResponse const *properResponse,
+                   world::AccelerationRestriction const *accelerationRestriction);
+
+  std::ofstream mStream;
+  std::vector<std::uint8_t> mFrameBuffer;
+};
+
+/**
+ * @brief RssRecordReader
+ *
+ * Reads the frames of a recording created by the RssRecordWriter. The recording file is memory mapped, if supported by
+ * the platform, otherwise read at once. The frames are provided as views into that memory: the arrays of the world
+ * model are not copied and no memory is allocated per frame, apart from growing the internal scene view buffer to the
+ * largest number of scenes.
+ */
+class RssRecordReader
+{
+public:
+  /**
+   * @brief constructor
+   */
+  RssRecordReader();
+
+  /**
+   * @brief destructor; closes the recording
+   */
+  ~RssRecordReader();
+
+  RssRecordReader(RssRecordReader const &other) = delete;
+  RssRecordReader &operator=(RssRecordReader const &other) = delete;
+
+  /**
+   * @brief open
+   *
+   * Memory maps or reads the recording file and checks the file header. An already open recording is closed before.
+   *
+   * @param [in] fileName - the name of the recording file
+   *
+   * @return return true if the recording could be opened, false otherwise.
+   */
+  bool open(std::string const &fileName);
+
+  /**
+   * @brief open
+   *
+   * Reads a recording already available in memory; the memory has to stay valid until the reader is closed.
+   * The data has to be 8 byte aligned.
+   *
+   * @param [in] data - the begin of the recording
+   * @param [in] size - the size of the recording in bytes
+   *
+   * @return return true if the recording could be opened, false otherwise.
+   */
+  bool open(std::uint8_t const *data, std::size_t const size);
+
+  /**
+   * @returns true if the recording is open
+   */
+  bool isOpen() const;
+
+  /**
+   * @brief close the recording; all views provided before become invalid
+   */
+  void close();
+
+  /**
+   * @brief readNextFrame
+   *
+   * The structure of the frame is checked; the content of the world model is validated by the RSS check.
+   *
+   * @param [out] frame - the next frame of the recording
+   *
+   * @return return true if the next frame could be read, false at the end of the recording or if the frame is
+   * corrupted.
+   */
+  bool readNextFrame(RssRecordFrame &frame);
+
+  /**
+   * @returns true if all frames of the recording were read
+   */
+  bool isAtEnd() const;
+
+  /**
+   * @brief continue reading with the first frame of the recording
+   */
+  void rewind();
+
+private:
+  bool openData();
+
+  std::uint8_t const *mData{nullptr};
+  std::size_t mSize{0u};
+  std::size_t mPosition{0u};
+  std::unique_ptr<MappedFile> mFile;
+  std::vector<world::SceneView> mScenes;
+};
+
+} // namespace core
+} // namespace ad_rss
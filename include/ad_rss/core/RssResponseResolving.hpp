@@ -34,7 +34,7 @@
 
 #pragma once
 
-#include <map>
+#include "ad_rss/core/RssCycleState.hpp"
 #include "ad_rss/state/ProperResponse.hpp"
 #include "ad_rss/state/RssStateSnapshot.hpp"
 
@@ -76,6 +76,129 @@ public:
    */
   bool provideProperResponse(state::RssStateSnapshot const &currentStateSnapshot, state::ProperResponse &response);
 
+  /**
+   * @brief Calculate the proper response out of the current responses based on an explicit history
+   *
+   * In contrast to provideProperResponse(state::RssStateSnapshot const &, state::ProperResponse &), the history of
+   * the response resolving is not taken from this object but passed explicitly; the function is re-entrant.
+   *
+   * @param[in]  currentStateSnapshot all the rss states gathered for the current situations
+   * @param[in,out] responseResolvingState the history of the response resolving to be used and updated
+   * @param[out] response the proper overall response state
+   *
+   * @return true if response could be calculated, false otherwise
+   * If false is returned the responseResolvingState has not been updated
+   */
+  bool provideProperResponse(state::RssStateSnapshot const &currentStateSnapshot,
+                             RssResponseResolvingState &responseResolvingState,
+                             state::ProperResponse &response) const;
+
+  /**
+   * @brief Start the calculation of the proper response of a new point in time
+   *
+   * Allows to fold the rss states one by one into the proper response by addRssState() without the need
+   * of a complete RssStateSnapshot. The calculation has to be completed by finishProperResponse().
+   *
+   * @param[in]  timeIndex the time index of the rss states to be added
+   * @param[out] response the proper overall response state to be initialized
+   *
+   * @return true if the calculation could be started, false otherwise
+   */
+  bool startProperResponse(physics::TimeIndex const &timeIndex, state::ProperResponse &response);
+
+  /**
+   * @brief Start the calculation of the proper response of a new point in time based on an explicit history
+   *
+   * The rss states are folded into the proper response by addRssState() with explicit history. Instead of calling
+   * finishProperResponse(), the caller replaces the history by nextResponseResolvingState once all rss states are
+   * added successfully.
+   *
+   * @param[in]  timeIndex the time index of the rss states to be added
+   * @param[out] nextResponseResolvingState the history of the response resolving for the next point in time
+   * @param[out] response the proper overall response state to be initialized
+   *
+   * @return true if the calculation could be started, false otherwise
+   */
+  bool startProperResponse(physics::TimeIndex const &timeIndex,
+                           RssResponseResolvingState &nextResponseResolvingState,
+                           state::ProperResponse &response) const;
+
+  /**
+   * @brief Add an individual rss state of the current point in time to the proper response
+   *
+   * @param[in]     currentState the rss state to be considered
+   * @param[in,out] response the proper overall response state to be updated
+   *
+   * @return true if the rss state could be considered, false otherwise
+   */
+  bool addRssState(state::RssState const &currentState, state::ProperResponse &response);
+
+  /**
+   * @brief Add an individual rss state of the current point in time to the proper response based on an explicit
+   * history
+   *
+   * @param[in]     currentState the rss state to be considered
+   * @param[in]     responseResolvingState the history of the response resolving of the previous point in time
+   * @param[in,out] nextResponseResolvingState the history of the response resolving for the next point in time
+   * @param[in,out] response the proper overall response state to be updated
+   *
+   * @return true if the rss state could be considered, false otherwise
+   */
+  bool addRssState(state::RssState const &currentState,
+                   RssResponseResolvingState const &responseResolvingState,
+                   RssResponseResolvingState &nextResponseResolvingState,
+                   state::ProperResponse &response) const;
+
+  /**
+   * @brief Add a situation of the current point in time not evaluated to the proper response
+   *
+   * The situation is considered as dangerous: the given responses are combined into the proper response and the
+   * state before the danger threshold time of the situation is kept for the next point in time.
+   *
+   * @param[in]     situationId the id of the situation not evaluated
+   * @param[in]     objectId the id of the object of the situation
+   * @param[in]     longitudinalResponse the longitudinal response to be applied for the situation
+   * @param[in]     lateralResponse the lateral response to be applied for both sides of the situation
+   * @param[in,out] response the proper overall response state to be updated
+   *
+   * @return true if the situation could be considered, false otherwise
+   */
+  bool addSkippedSituation(situation::SituationId const &situationId,
+                           world::ObjectId const &objectId,
+                           state::LongitudinalResponse const &longitudinalResponse,
+                           state::LateralResponse const &lateralResponse,
+                           state::ProperResponse &response);
+
+  /**
+   * @brief Add a situation of the current point in time not evaluated to the proper response based on an explicit
+   * history
+   *
+   * @param[in]     situationId the id of the situation not evaluated
+   * @param[in]     objectId the id of the object of the situation
+   * @param[in]     longitudinalResponse the longitudinal response to be applied for the situation
+   * @param[in]     lateralResponse the lateral response to be applied for both sides of the situation
+   * @param[in]     responseResolvingState the history of the response resolving of the previous point in time
+   * @param[in,out] nextResponseResolvingState the history of the response resolving for the next point in time
+   * @param[in,out] response the proper overall response state to be updated
+   *
+   * @return true if the situation could be considered, false otherwise
+   */
+  bool addSkippedSituation(situation::SituationId const &situationId,
+                           world::ObjectId const &objectId,
+                           state::LongitudinalResponse const &longitudinalResponse,
+                           state::LateralResponse const &lateralResponse,
+                           RssResponseResolvingState const &responseResolvingState,
+                           RssResponseResolvingState &nextResponseResolvingState,
+                           state::ProperResponse &response) const;
+
+  /**
+   * @brief Finish the calculation of the proper response of the current point in time
+   *
+   * @param[in] commit if true, the internal state is updated for the next point in time;
+   *   otherwise the internal state remains untouched
+   */
+  void finishProperResponse(bool const commit);
+
 private:
   /**
    * @brief determine the resulting RSS response
@@ -99,23 +222,34 @@ private:
     return newResponse;
   }
 
-  struct RssSafeState
-  {
-    bool longitudinalSafe{false};
-    bool lateralSafe{false};
-  };
-
   /**
-   * @brief typedef for the mapping of object id to the corresponding RssSafeState before the danger threshold time
+   * @brief Add an individual rss state of the current point in time to the proper response
+   *
+   * @param[in]     currentState the rss state to be considered
+   * @param[in]     responseResolvingState the history of the response resolving of the previous point in time
+   * @param[in,out] nextResponseResolvingState the history of the response resolving for the next point in time
+   * @param[in,out] response the proper overall response state to be updated
+   *
+   * @return true if the rss state could be considered, false otherwise
    */
-  typedef std::map<situation::SituationId, RssSafeState> RssSafeStateBeforeDangerThresholdTimeMap;
+  bool addRssStateInputRangeChecked(state::RssState const &currentState,
+                                    RssResponseResolvingState const &responseResolvingState,
+                                    RssResponseResolvingState &nextResponseResolvingState,
+                                    state::ProperResponse &response) const;
 
   /**
    * @brief the state of each situation before the danger threshold time
    *
    * Needs to be stored to check which is the proper response required to solve an unclear situation
    */
-  RssSafeStateBeforeDangerThresholdTimeMap mStatesBeforeDangerThresholdTime;
+  RssResponseResolvingState mResponseResolvingState;
+
+  /**
+   * @brief the state of each situation of the point in time currently processed
+   *
+   * Becomes mResponseResolvingState on successful finishProperResponse()
+   */
+  RssResponseResolvingState mNewResponseResolvingState;
 };
 
 } // namespace core
@@ -71,6 +71,23 @@ bool transformProperResponse(world::WorldModel const &worldModel,
                              state::ProperResponse const &response,
                              world::AccelerationRestriction &accelerationRestriction);
 
+/*!
+ * @brief transformProperResponse
+ *
+ * Transform the proper response into restrictions of the acceleration for the actuator control.
+ *
+ * @param [in] timeIndex - The time index of the current world model information.
+ * @param [in] egoVehicleRssDynamics - The RSS dynamics of the ego vehicle of the current world model information.
+ * @param [in] response - The proper overall response to be transformed.
+ * @param [out] accelerationRestriction - The restrictions on the vehicle acceleration to become RSS safe.
+ *
+ * @return return true if the acceleration restrictions could be calculated, false otherwise.
+ */
+bool transformProperResponse(physics::TimeIndex const &timeIndex,
+                             world::RssDynamics const &egoVehicleRssDynamics,
+                             state::ProperResponse const &response,
+                             world::AccelerationRestriction &accelerationRestriction);
+
 } // namespace RssResponseTransformation
 } // namespace core
 } // namespace ad_rss
@@ -0,0 +1,243 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+#include "ad_rss/physics/MetricRange.hpp"
+#include "ad_rss/physics/TimeIndex.hpp"
+#include "ad_rss/situation/SituationType.hpp"
+#include "ad_rss/world/CompactRoadArea.hpp"
+#include "ad_rss/world/Object.hpp"
+#include "ad_rss/world/RoadArea.hpp"
+#include "ad_rss/world/RssDynamics.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/*!
+ * @brief Handle of a road area registered at the RssRoadRegistry
+ *
+ * The handle 0 is reserved and refers to the empty road area.
+ */
+typedef uint64_t RoadHandle;
+
+/*!
+ * @brief A scene referencing the road areas registered at the RssRoadRegistry
+ *
+ * Equivalent to world::Scene, but the roads are referenced by handle instead of being embedded by value.
+ */
+struct RegisteredRoadScene
+{
+  /*!
+   * The type of the current situation
+   */
+  ::ad_rss::situation::SituationType situationType{::ad_rss::situation::SituationType::SameDirection};
+
+  /*!
+   * The ego vehicle with its occupied regions within the ego vehicle road of the current cycle
+   */
+  ::ad_rss::world::Object egoVehicle;
+
+  /*!
+   * The object with its occupied regions of the current cycle
+   */
+  ::ad_rss::world::Object object;
+
+  /*!
+   * The RSS dynamics of the object
+   */
+  ::ad_rss::world::RssDynamics objectRssDynamics;
+
+  /*!
+   * The handle of the intersecting road; 0 if there is no intersecting road
+   */
+  RoadHandle intersectingRoad{0u};
+
+  /*!
+   * The handle of the road of the ego vehicle
+   */
+  RoadHandle egoVehicleRoad{0u};
+};
+
+/*!
+ * @brief A world model consisting of scenes referencing the road areas registered at the RssRoadRegistry
+ *
+ * Equivalent to world::WorldModel, but based on RegisteredRoadScene.
+ */
+struct RegisteredRoadWorldModel
+{
+  /*!
+   * The time index the world model is referring to
+   */
+  ::ad_rss::physics::TimeIndex timeIndex{0u};
+
+  /*!
+   * The RSS dynamics of the ego vehicle
+   */
+  ::ad_rss::world::RssDynamics egoVehicleRssDynamics;
+
+  /*!
+   * The scenes of the world model
+   */
+  std::vector<RegisteredRoadScene> scenes;
+};
+
+/**
+ * @brief RssRoadRegistry
+ *
+ * Class providing a registry of static road areas. A road area is registered once and gets a stable handle
+ * the scenes can refer to. The geometry derived from the road area that is required by the situation extraction
+ * is calculated once at registration.
+ */
+class RssRoadRegistry
+{
+public:
+  /*!
+   * @brief A registered road area together with its derived geometry
+   */
+  struct RegisteredRoad
+  {
+    /*!
+     * @brief the road area
+     */
+    ::ad_rss::world::RoadArea roadArea;
+
+    /*!
+     * @brief the compact representation of the road area the situation extraction operates on
+     */
+    ::ad_rss::world::CompactRoadArea compactRoadArea;
+
+    /*!
+     * @brief the minimum and maximum lateral distance to the begin of each lane segment column of the road area
+     */
+    std::vector<::ad_rss::physics::MetricRange> lateralRanges;
+
+    /*!
+     * @brief the ids of the lane segments of the road area being part of an intersection
+     */
+    std::set<::ad_rss::world::LaneSegmentId> intersectionArea;
+  };
+
+  /*!
+   * @brief constructor
+   */
+  RssRoadRegistry();
+
+  /*!
+   * @brief destructor
+   */
+  ~RssRoadRegistry();
+
+  /**
+   * @brief Register a road area
+   *
+   * @param [in] roadArea - the road area to be registered
+   * @param [out] roadHandle - the handle of the registered road area
+   *
+   * @return true if the road area could be registered, false if the road area is not valid or an error occurred.
+   */
+  bool registerRoad(::ad_rss::world::RoadArea const &roadArea, RoadHandle &roadHandle);
+
+  /**
+   * @brief Unregister a road area
+   *
+   * @param [in] roadHandle - the handle of the road area to be unregistered
+   *
+   * @return true if the road area was unregistered, false if the handle was not registered.
+   */
+  bool unregisterRoad(RoadHandle const &roadHandle);
+
+  /**
+   * @brief Unregister all road areas
+   */
+  void clear();
+
+  /**
+   * @returns the number of registered road areas
+   */
+  std::size_t size() const;
+
+  /**
+   * @brief Get a registered road area
+   *
+   * @param [in] roadHandle - the handle of the road area
+   *
+   * @return the registered road area, nullptr if the handle is not registered.
+   *         The returned road area stays valid until it is unregistered.
+   */
+  RegisteredRoad const *getRegisteredRoad(RoadHandle const &roadHandle) const;
+
+private:
+  typedef std::map<RoadHandle, RegisteredRoad> RegisteredRoadMap;
+
+  RegisteredRoad mEmptyRoad;
+  RegisteredRoadMap mRegisteredRoads;
+  RoadHandle mLastRoadHandle{0u};
+};
+
+} // namespace core
+} // namespace ad_rss
+
+/*!
+ * \brief check if the given RegisteredRoadScene is within valid input range
+ *
+ * \param[in] input the RegisteredRoadScene as an input value
+ *
+ * \returns \c true if RegisteredRoadScene is considered to be within the specified input range
+ *
+ * \note the road areas are checked on registration
+ */
+bool withinValidInputRange(::ad_rss::core::RegisteredRoadScene const &input);
+
+/*!
+ * \brief check if the given RegisteredRoadWorldModel is within valid input range
+ *
+ * \param[in] input the RegisteredRoadWorldModel as an input value
+ *
+ * \returns \c true if RegisteredRoadWorldModel is considered to be within the specified input range
+ *
+ * \note the road areas are checked on registration
+ */
+bool withinValidInputRange(::ad_rss::core::RegisteredRoadWorldModel const &input);
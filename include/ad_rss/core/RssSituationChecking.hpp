@@ -34,7 +34,10 @@
 
 #pragma once
 
-#include <memory>
+#include <vector>
+#include "ad_rss/core/RssCycleState.hpp"
+#include "ad_rss/physics/Duration.hpp"
+#include "ad_rss/situation/RssFormulaProvider.hpp"
 #include "ad_rss/situation/SituationSnapshot.hpp"
 #include "ad_rss/state/RssStateSnapshot.hpp"
 
@@ -43,13 +46,6 @@
  */
 namespace ad_rss {
 
-/*!
- * @brief Forward declaration
- */
-namespace situation {
-class RssIntersectionChecker;
-} // namespace situation
-
 /*!
  * @brief namespace core
  */
@@ -63,10 +59,31 @@ namespace core {
 class RssSituationChecking
 {
 public:
+  /**
+   * @brief Enum EvaluationMode
+   *
+   * Defines which parts of the RssState are evaluated by the situation checks.
+   */
+  enum class EvaluationMode
+  {
+    /*!
+     * The RssState is evaluated completely, including the diagnostic RssStateInformation of all axes.
+     */
+    Full,
+    /*!
+     * Only the parts of the RssState required to resolve the proper response (isSafe and response of all axes)
+     * are provided. The RssStateInformation of all axes is left empty (evaluator None, distances maximal) and can be
+     * calculated on request by calculateRssStateInformation().
+     */
+    DecisionOnly
+  };
+
   /*!
    * @brief constructor
+   *
+   * @param[in] evaluationMode the evaluation mode of the situation checks
    */
-  RssSituationChecking();
+  explicit RssSituationChecking(EvaluationMode const evaluationMode = EvaluationMode::Full);
 
   /*!
    * @brief destructor
@@ -84,6 +101,172 @@ public:
   bool checkSituations(situation::SituationSnapshot const &situationSnapshot,
                        state::RssStateSnapshot &rssStateSnapshot);
 
+  /*!
+   * @brief Checks if the current situations are safe based on an explicit history.
+   *
+   * In contrast to checkSituations(situation::SituationSnapshot const &, state::RssStateSnapshot &), the history of
+   * the situation checks is not taken from this object but passed explicitly; the function is re-entrant.
+   *
+   * @param [in] situationSnapshot the situation snapshot in time that should be analyzed
+   * @param [in,out] situationCheckingState the history of the situation checks to be used and updated
+   * @param[out] rssStateSnapshot the rss state snapshot of these situations
+   *
+   * @return true if the situations could be analyzed, false if an error occurred during evaluation.
+   */
+  bool checkSituations(situation::SituationSnapshot const &situationSnapshot,
+                       RssSituationCheckingState &situationCheckingState,
+                       state::RssStateSnapshot &rssStateSnapshot) const;
+
+  /*!
+   * @brief Checks if the current situations are safe and how long they stay safe at least.
+   *
+   * In addition to checkSituations(situation::SituationSnapshot const &, state::RssStateSnapshot &), the time to
+   * danger of each situation is provided, see calculateTimeToDanger(). Intended for callers re-checking situations at
+   * different rates: a situation doesn't have to be checked again before its time to danger has passed.
+   *
+   * @param [in] situationSnapshot the situation snapshot in time that should be analyzed
+   * @param[out] rssStateSnapshot the rss state snapshot of these situations
+   * @param[out] timesToDanger the time to danger of the situations, in the order of the individual responses
+   *
+   * @return true if the situations could be analyzed, false if an error occurred during evaluation.
+   */
+  bool checkSituations(situation::SituationSnapshot const &situationSnapshot,
+                       state::RssStateSnapshot &rssStateSnapshot,
+                       std::vector<physics::Duration> &timesToDanger);
+
+  /*!
+   * @brief Checks if the current situations are safe and how long they stay safe at least based on an explicit
+   * history.
+   *
+   * @param [in] situationSnapshot the situation snapshot in time that should be analyzed
+   * @param [in,out] situationCheckingState the history of the situation checks to be used and updated
+   * @param[out] rssStateSnapshot the rss state snapshot of these situations
+   * @param[out] timesToDanger the time to danger of the situations, in the order of the individual responses
+   *
+   * @return true if the situations could be analyzed, false if an error occurred during evaluation.
+   */
+  bool checkSituations(situation::SituationSnapshot const &situationSnapshot,
+                       RssSituationCheckingState &situationCheckingState,
+                       state::RssStateSnapshot &rssStateSnapshot,
+                       std::vector<physics::Duration> &timesToDanger) const;
+
+  /*!
+   * @brief Start the checks of the situations of a new point in time.
+   *
+   * Has to be called once before the individual situations of that point in time are passed to checkSituation().
+   * checkSituations() performs this implicitly.
+   *
+   * @param [in] timeIndex the time index of the situations to be checked
+   *
+   * @return true if the time index is valid and increasing consistently, false otherwise.
+   */
+  bool startSituationChecks(physics::TimeIndex const &timeIndex);
+
+  /*!
+   * @brief Start the checks of the situations of a new point in time based on an explicit history.
+   *
+   * @param [in] timeIndex the time index of the situations to be checked
+   * @param [in,out] situationCheckingState the history of the situation checks to be used and updated
+   *
+   * @return true if the time index is valid and increasing consistently, false otherwise.
+   */
+  bool startSituationChecks(physics::TimeIndex const &timeIndex,
+                            RssSituationCheckingState &situationCheckingState) const;
+
+  /*!
+   * @brief Checks if an individual situation of the current point in time is safe.
+   *
+   * @param [in] situation the situation that should be analyzed
+   * @param [out] rssState the rss state of the situation
+   *
+   * @return true if the situation could be analyzed, false if an error occurred during evaluation.
+   */
+  bool checkSituation(situation::Situation const &situation, state::RssState &rssState);
+
+  /*!
+   * @brief Checks if an individual situation of the current point in time is safe based on an explicit history.
+   *
+   * @param [in] situation the situation that should be analyzed
+   * @param [in,out] situationCheckingState the history of the situation checks to be used and updated
+   * @param [out] rssState the rss state of the situation
+   *
+   * @return true if the situation could be analyzed, false if an error occurred during evaluation.
+   */
+  bool checkSituation(situation::Situation const &situation,
+                      RssSituationCheckingState &situationCheckingState,
+                      state::RssState &rssState) const;
+
+  /*!
+   * @brief Skips the check of an individual situation of the current point in time.
+   *
+   * The history of the situation required to resolve the responses of the next points in time is kept as if the
+   * situation was not changed since the last check.
+   *
+   * @param [in] situation the situation that is not analyzed
+   *
+   * @return true if the situation could be skipped, false if an error occurred.
+   */
+  bool skipSituation(situation::Situation const &situation);
+
+  /*!
+   * @brief Skips the check of an individual situation of the current point in time based on an explicit history.
+   *
+   * @param [in] situation the situation that is not analyzed
+   * @param [in,out] situationCheckingState the history of the situation checks to be used and updated
+   *
+   * @return true if the situation could be skipped, false if an error occurred.
+   */
+  bool skipSituation(situation::Situation const &situation, RssSituationCheckingState &situationCheckingState) const;
+
+  /*!
+   * @brief Calculates the diagnostic RssStateInformation of all axes of a rss state.
+   *
+   * Intended to provide the information of rss states created in EvaluationMode::DecisionOnly on request,
+   * e.g. for logging. The decision parts of the rss state (isSafe and response) are not touched.
+   * This function doesn't influence the internal state of the situation checks.
+   *
+   * @param [in] situation the situation the rss state was created for
+   * @param [in,out] rssState the rss state of the situation to be completed
+   *
+   * @return true if the information could be calculated, false if an error occurred during evaluation.
+   */
+  bool calculateRssStateInformation(situation::Situation const &situation, state::RssState &rssState) const;
+
+  /*!
+   * @brief Calculates a lower bound of the time an individual situation stays safe in the worst case.
+   *
+   * The bound is based on the formula provider of the situation checks and the RssDynamics of the situation,
+   * see situation::calculateTimeToDanger(). This function doesn't influence the internal state of the situation
+   * checks.
+   *
+   * @param [in] situation the situation to be evaluated
+   * @param [out] timeToDanger the time the situation stays safe at least, 0 if it is dangerous already
+   *
+   * @return true if the time could be calculated, false if an error occurred during evaluation.
+   */
+  bool calculateTimeToDanger(situation::Situation const &situation, physics::Duration &timeToDanger) const;
+
+  /**
+   * @returns the evaluation mode of the situation checks
+   */
+  EvaluationMode getEvaluationMode() const;
+
+  /*!
+   * @brief Set the provider of the RSS formulas evaluated by the situation checks.
+   *
+   * The formula provider is referenced, not copied; it has to outlive the situation checks.
+   * By default the formulas are evaluated with the RssDynamics of the situations given at runtime,
+   * see situation::getDefaultFormulaProvider().
+   *
+   * @param [in] formulaProvider the formula provider to be used
+   */
+  void setFormulaProvider(situation::RssFormulaProvider const &formulaProvider);
+
+  /**
+   * @returns the provider of the RSS formulas evaluated by the situation checks
+   */
+  situation::RssFormulaProvider const &getFormulaProvider() const;
+
 private:
   /*!
    * @brief Check if the current situation is safe.
@@ -95,6 +278,45 @@ private:
    */
   bool checkSituationInputRangeChecked(situation::Situation const &situation, state::RssState &rssState);
 
+  /*!
+   * @brief Check if the current situation is safe based on an explicit history.
+   *
+   * @param[in] situation      the Situation that should be analyzed
+   * @param[in,out] situationCheckingState the history of the situation checks
+   * @param[out] rssState      the rssState state for the current situation
+   *
+   * @return true if situation could be analyzed, false if there was an error during evaluation
+   */
+  bool checkSituationInputRangeChecked(situation::Situation const &situation,
+                                       RssSituationCheckingState &situationCheckingState,
+                                       state::RssState &rssState) const;
+
+  /*!
+   * @brief Calculate the complete rss state of the situation including the diagnostic RssStateInformation.
+   *
+   * @param[in] situation      the Situation that should be analyzed
+   * @param[in,out] situationCheckingState the history of the situation checks
+   * @param[in,out] rssState   the rssState state for the current situation
+   *
+   * @return true if situation could be analyzed, false if there was an error during evaluation
+   */
+  bool calculateRssState(situation::Situation const &situation,
+                         RssSituationCheckingState &situationCheckingState,
+                         state::RssState &rssState) const;
+
+  /*!
+   * @brief Calculate only the decision parts (isSafe and response) of the rss state of the situation.
+   *
+   * @param[in] situation      the Situation that should be analyzed
+   * @param[in,out] situationCheckingState the history of the situation checks
+   * @param[in,out] rssState   the rssState state for the current situation
+   *
+   * @return true if situation could be analyzed, false if there was an error during evaluation
+   */
+  bool calculateRssDecision(situation::Situation const &situation,
+                            RssSituationCheckingState &situationCheckingState,
+                            state::RssState &rssState) const;
+
   /*!
    * @brief check to ensure time index is consistent
    *
@@ -104,8 +326,20 @@ private:
    */
   bool checkTimeIncreasingConsistently(physics::TimeIndex const &nextTimeIndex);
 
-  std::unique_ptr<ad_rss::situation::RssIntersectionChecker> mIntersectionChecker;
-  physics::TimeIndex mCurrentTimeIndex{0u};
+  /*!
+   * @brief check to ensure time index is consistent based on an explicit history
+   *
+   * @param[in,out] situationCheckingState the history of the situation checks
+   * @param[in] nextTimeIndex   the new time index
+   *
+   * @return true if the time is constantly increasing
+   */
+  static bool checkTimeIncreasingConsistently(RssSituationCheckingState &situationCheckingState,
+                                              physics::TimeIndex const &nextTimeIndex);
+
+  EvaluationMode mEvaluationMode;
+  situation::RssFormulaProvider const *mFormulaProvider;
+  RssSituationCheckingState mSituationCheckingState;
 };
 } // namespace core
 } // namespace ad_rss
@@ -34,8 +34,12 @@
 
 #pragma once
 
+#include <vector>
+#include "ad_rss/core/RssCycleState.hpp"
+#include "ad_rss/core/RssRoadRegistry.hpp"
 #include "ad_rss/situation/SituationSnapshot.hpp"
 #include "ad_rss/world/WorldModel.hpp"
+#include "ad_rss/world/WorldModelView.hpp"
 
 /*!
  * @brief namespace ad_rss
@@ -47,11 +51,25 @@ namespace ad_rss {
  */
 namespace world {
 /*!
- * @brief forward declaration of class RssSituationIdProvider
+ * @brief forward declaration of struct SceneReference
  */
-class RssSituationIdProvider;
+struct SceneReference;
+/*!
+ * @brief forward declaration of class ObjectDimensions
+ */
+class ObjectDimensions;
 } // namespace world
 
+/*!
+ * @brief namespace situation
+ */
+namespace situation {
+/*!
+ * @brief forward declaration of struct RelativePositionBatch
+ */
+struct RelativePositionBatch;
+} // namespace situation
+
 /*!
  * @brief namespace core
  */
@@ -85,24 +103,441 @@ public:
    */
   bool extractSituations(world::WorldModel const &worldModel, situation::SituationSnapshot &situationSnapshot);
 
+  /**
+   * @brief Extract all RSS situations to be checked from the world model based on an explicit history.
+   *
+   * In contrast to extractSituations(world::WorldModel const &, situation::SituationSnapshot &), the history of the
+   * situation id assignment is not taken from this object but passed explicitly; the function is re-entrant.
+   *
+   * @param [in] worldModel - the current world model information
+   * @param [in,out] situationIdState - the history of the situation id assignment to be used and updated
+   * @param [out] situationSnapshot - the vector of situations to be analyzed with RSS
+   *
+   * @return true if the situations could be created, false if there was an error during the operation.
+   */
+  bool extractSituations(world::WorldModel const &worldModel,
+                         RssSituationIdState &situationIdState,
+                         situation::SituationSnapshot &situationSnapshot) const;
+
+  /**
+   * @brief Extract all RSS situations to be checked from the world model with replaced RSS dynamics based on an
+   * explicit history.
+   *
+   * Equivalent to extractSituations(world::WorldModel const &, RssSituationIdState &, situation::SituationSnapshot &)
+   * of a copy of the world model with the egoVehicleRssDynamics and the objectRssDynamics of all scenes replaced by
+   * the given dynamics, but without copying the world model. The world model itself has to be within the valid input
+   * range, too.
+   *
+   * @param [in] worldModel - the current world model information
+   * @param [in] egoVehicleRssDynamics - the RSS dynamics of the ego vehicle replacing those of the world model
+   * @param [in] objectRssDynamics - the RSS dynamics replacing those of the objects of all scenes
+   * @param [in,out] situationIdState - the history of the situation id assignment to be used and updated
+   * @param [out] situationSnapshot - the vector of situations to be analyzed with RSS
+   *
+   * @return true if the situations could be created, false if there was an error during the operation.
+   */
+  bool extractSituations(world::WorldModel const &worldModel,
+                         world::RssDynamics const &egoVehicleRssDynamics,
+                         world::RssDynamics const &objectRssDynamics,
+                         RssSituationIdState &situationIdState,
+                         situation::SituationSnapshot &situationSnapshot) const;
+
+  /*!
+   * @brief The scenes of a world model describing the same situation
+   */
+  struct SituationScenes
+  {
+    /*!
+     * @brief the situation id assigned to all of the scenes
+     */
+    situation::SituationId situationId;
+
+    /*!
+     * @brief the indices of the scenes within world::WorldModel::scenes in ascending order
+     */
+    std::vector<std::size_t> sceneIndices;
+  };
+
+  /*!
+   * @brief typedef for the vector of SituationScenes
+   */
+  typedef std::vector<SituationScenes> SituationScenesVector;
+
+  /**
+   * @brief Assign the situation ids to all scenes of the world model and group the relevant scenes by situation.
+   *
+   * This is the first step of extractSituations(): the situations are ordered by the first occurrence of the
+   * situation id within the scenes. Each of the groups can afterwards be converted by extractSituation().
+   *
+   * @param [in] worldModel - the current world model information
+   * @param [out] situationScenesVector - the relevant scenes of the world model grouped by situation
+   *
+   * @return true if the situation ids could be assigned, false if there was an error during the operation.
+   */
+  bool groupScenesBySituation(world::WorldModel const &worldModel, SituationScenesVector &situationScenesVector);
+
+  /**
+   * @brief Assign the situation ids to all scenes of the world model based on an explicit history and group the
+   * relevant scenes by situation.
+   *
+   * See groupScenesBySituation(world::WorldModel const &, SituationScenesVector &).
+   *
+   * @param [in] worldModel - the current world model information
+   * @param [in,out] situationIdState - the history of the situation id assignment to be used and updated
+   * @param [out] situationScenesVector - the relevant scenes of the world model grouped by situation
+   *
+   * @return true if the situation ids could be assigned, false if there was an error during the operation.
+   */
+  bool groupScenesBySituation(world::WorldModel const &worldModel,
+                              RssSituationIdState &situationIdState,
+                              SituationScenesVector &situationScenesVector) const;
+
+  /**
+   * @brief Extract the RSS situation described by a group of scenes.
+   *
+   * All scenes of the group are converted and merged into the worst-case situation.
+   *
+   * @param [in] worldModel - the world model the group of scenes was created from by groupScenesBySituation()
+   * @param [in] situationScenes - the scenes describing the situation
+   * @param [out] situation - the situation to be analyzed with RSS
+   *
+   * @return true if the situation could be created, false if there was an error during the operation.
+   */
+  bool extractSituation(world::WorldModel const &worldModel,
+                        SituationScenes const &situationScenes,
+                        situation::Situation &situation) const;
+
+  /**
+   * @brief Extract all RSS situations to be checked from the world model referencing registered roads.
+   *
+   * @param [in] worldModel - the current world model information
+   * @param [in] roadRegistry - the registry of the roads the world model is referencing
+   * @param [out] situationSnapshot - the vector of situations to be analyzed with RSS
+   *
+   * @return true if the situations could be created, false if there was an error during the operation.
+   */
+  bool extractSituations(RegisteredRoadWorldModel const &worldModel,
+                         RssRoadRegistry const &roadRegistry,
+                         situation::SituationSnapshot &situationSnapshot);
+
+  /**
+   * @brief Extract all RSS situations to be checked from the world model referencing registered roads based on an
+   * explicit history.
+   *
+   * @param [in] worldModel - the current world model information
+   * @param [in] roadRegistry - the registry of the roads the world model is referencing
+   * @param [in,out] situationIdState - the history of the situation id assignment to be used and updated
+   * @param [out] situationSnapshot - the vector of situations to be analyzed with RSS
+   *
+   * @return true if the situations could be created, false if there was an error during the operation.
+   */
+  bool extractSituations(RegisteredRoadWorldModel const &worldModel,
+                         RssRoadRegistry const &roadRegistry,
+                         RssSituationIdState &situationIdState,
+                         situation::SituationSnapshot &situationSnapshot) const;
+
+  /**
+   * @brief Assign the situation ids to all scenes of the world model referencing registered roads and group the
+   * relevant scenes by situation.
+   *
+   * See groupScenesBySituation(world::WorldModel const &, SituationScenesVector &).
+   *
+   * @param [in] worldModel - the current world model information
+   * @param [in] roadRegistry - the registry of the roads the world model is referencing
+   * @param [out] situationScenesVector - the relevant scenes of the world model grouped by situation
+   *
+   * @return true if the situation ids could be assigned, false if there was an error during the operation.
+   */
+  bool groupScenesBySituation(RegisteredRoadWorldModel const &worldModel,
+                              RssRoadRegistry const &roadRegistry,
+                              SituationScenesVector &situationScenesVector);
+
+  /**
+   * @brief Assign the situation ids to all scenes of the world model referencing registered roads based on an
+   * explicit history and group the relevant scenes by situation.
+   *
+   * @param [in] worldModel - the current world model information
+   * @param [in] roadRegistry - the registry of the roads the world model is referencing
+   * @param [in,out] situationIdState - the history of the situation id assignment to be used and updated
+   * @param [out] situationScenesVector - the relevant scenes of the world model grouped by situation
+   *
+   * @return true if the situation ids could be assigned, false if there was an error during the operation.
+   */
+  bool groupScenesBySituation(RegisteredRoadWorldModel const &worldModel,
+                              RssRoadRegistry const &roadRegistry,
+                              RssSituationIdState &situationIdState,
+                              SituationScenesVector &situationScenesVector) const;
+
+  /**
+   * @brief Extract the RSS situation described by a group of scenes referencing registered roads.
+   *
+   * See extractSituation(world::WorldModel const &, SituationScenes const &, situation::Situation &).
+   *
+   * @param [in] worldModel - the world model the group of scenes was created from by groupScenesBySituation()
+   * @param [in] roadRegistry - the registry of the roads the world model is referencing
+   * @param [in] situationScenes - the scenes describing the situation
+   * @param [out] situation - the situation to be analyzed with RSS
+   *
+   * @return true if the situation could be created, false if there was an error during the operation.
+   */
+  bool extractSituation(RegisteredRoadWorldModel const &worldModel,
+                        RssRoadRegistry const &roadRegistry,
+                        SituationScenes const &situationScenes,
+                        situation::Situation &situation) const;
+
+  /**
+   * @brief Extract all RSS situations to be checked from the view on a world model.
+   *
+   * The data referenced by the view is only read and has to stay valid during the call.
+   *
+   * @param [in] worldModel - the view on the current world model information
+   * @param [out] situationSnapshot - the vector of situations to be analyzed with RSS
+   *
+   * @return true if the situations could be created, false if there was an error during the operation.
+   */
+  bool extractSituations(world::WorldModelView const &worldModel, situation::SituationSnapshot &situationSnapshot);
+
+  /**
+   * @brief Extract all RSS situations to be checked from the view on a world model based on an explicit history.
+   *
+   * @param [in] worldModel - the view on the current world model information
+   * @param [in,out] situationIdState - the history of the situation id assignment to be used and updated
+   * @param [out] situationSnapshot - the vector of situations to be analyzed with RSS
+   *
+   * @return true if the situations could be created, false if there was an error during the operation.
+   */
+  bool extractSituations(world::WorldModelView const &worldModel,
+                         RssSituationIdState &situationIdState,
+                         situation::SituationSnapshot &situationSnapshot) const;
+
+  /**
+   * @brief Assign the situation ids to all scenes of the view on a world model and group the relevant scenes by
+   * situation.
+   *
+   * See groupScenesBySituation(world::WorldModel const &, SituationScenesVector &).
+   *
+   * @param [in] worldModel - the view on the current world model information
+   * @param [out] situationScenesVector - the relevant scenes of the world model grouped by situation
+   *
+   * @return true if the situation ids could be assigned, false if there was an error during the operation.
+   */
+  bool groupScenesBySituation(world::WorldModelView const &worldModel, SituationScenesVector &situationScenesVector);
+
+  /**
+   * @brief Assign the situation ids to all scenes of the view on a world model based on an explicit history and group
+   * the relevant scenes by situation.
+   *
+   * @param [in] worldModel - the view on the current world model information
+   * @param [in,out] situationIdState - the history of the situation id assignment to be used and updated
+   * @param [out] situationScenesVector - the relevant scenes of the world model grouped by situation
+   *
+   * @return true if the situation ids could be assigned, false if there was an error during the operation.
+   */
+  bool groupScenesBySituation(world::WorldModelView const &worldModel,
+                              RssSituationIdState &situationIdState,
+                              SituationScenesVector &situationScenesVector) const;
+
+  /**
+   * @brief Extract the RSS situation described by a group of scenes of the view on a world model.
+   *
+   * See extractSituation(world::WorldModel const &, SituationScenes const &, situation::Situation &).
+   *
+   * @param [in] worldModel - the view the group of scenes was created from by groupScenesBySituation()
+   * @param [in] situationScenes - the scenes describing the situation
+   * @param [out] situation - the situation to be analyzed with RSS
+   *
+   * @return true if the situation could be created, false if there was an error during the operation.
+   */
+  bool extractSituation(world::WorldModelView const &worldModel,
+                        SituationScenes const &situationScenes,
+                        situation::Situation &situation) const;
+
+  /**
+   * @brief Create the non intersection RSS situation of a pair of objects with already calculated positions.
+   *
+   * Allows to share the position calculation of an object between all of its situations, e.g. if all pairs of
+   * objects on a common road area are evaluated. The positions have to be given in the situation coordinate system,
+   * i.e. the longitudinal axis points into the driving direction of the ego vehicle. The object types are not checked.
+   *
+   * @param [in] situationId - the situation id of the pair
+   * @param [in] situationType - the type of the situation: SameDirection or OppositeDirection
+   * @param [in] egoVehicle - the object taking the role of the ego vehicle
+   * @param [in] egoVehicleRssDynamics - the RSS dynamics of the ego vehicle
+   * @param [in] egoVehicleDimensions - the position of the ego vehicle
+   * @param [in] object - the other object
+   * @param [in] objectRssDynamics - the RSS dynamics of the other object
+   * @param [in] objectDimensions - the position of the other object
+   * @param [out] situation - the situation to be analyzed with RSS
+   *
+   * @return true if the situation could be created, false if there was an error during the operation.
+   */
+  bool convertObjectsToSituation(situation::SituationId const &situationId,
+                                 situation::SituationType const &situationType,
+                                 world::ObjectView const &egoVehicle,
+                                 world::RssDynamics const &egoVehicleRssDynamics,
+                                 world::ObjectDimensions const &egoVehicleDimensions,
+                                 world::ObjectView const &object,
+                                 world::RssDynamics const &objectRssDynamics,
+                                 world::ObjectDimensions const &objectDimensions,
+                                 situation::Situation &situation) const;
+
 private:
   void calcluateRelativeLongitudinalPosition(physics::MetricRange const &egoMetricRange,
                                              physics::MetricRange const &otherMetricRange,
                                              situation::LongitudinalRelativePosition &longitudinalPosition,
-                                             physics::Distance &longitudinalDistance);
+                                             physics::Distance &longitudinalDistance) const;
   void calcluateRelativeLongitudinalPositionIntersection(physics::MetricRange const &egoMetricRange,
                                                          physics::MetricRange const &otherMetricRange,
                                                          situation::LongitudinalRelativePosition &longitudinalPosition,
-                                                         physics::Distance &longitudinalDistance);
+                                                         physics::Distance &longitudinalDistance) const;
   void calcluateRelativeLateralPosition(physics::MetricRange const &egoMetricRange,
                                         physics::MetricRange const &otherMetricRange,
                                         situation::LateralRelativePosition &lateralPosition,
-                                        physics::Distance &lateralDistance);
-  bool convertObjectsNonIntersection(world::Scene const &currentScene, situation::Situation &situation);
+                                        physics::Distance &lateralDistance) const;
+  bool convertObjectsNonIntersection(world::SceneReference const &currentScene, situation::Situation &situation) const;
+  void convertObjectDimensionsNonIntersection(situation::SituationType const &situationType,
+                                              world::ObjectDimensions const &egoVehicleDimension,
+                                              world::ObjectDimensions const &objectDimension,
+                                              situation::Situation &situation) const;
+  void initializeSituation(situation::SituationId const &situationId,
+                           situation::SituationType const &situationType,
+                           world::ObjectView const &egoVehicle,
+                           world::RssDynamics const &egoVehicleRssDynamics,
+                           world::ObjectView const &object,
+                           world::RssDynamics const &objectRssDynamics,
+                           situation::Situation &situation) const;
   void convertToIntersectionCentric(physics::MetricRange const &objectDimension,
                                     physics::MetricRange const &intersectionPosition,
-                                    physics::MetricRange &dimensionsIntersection);
-  bool convertObjectsIntersection(world::Scene const &currentScene, situation::Situation &situation);
+                                    physics::MetricRange &dimensionsIntersection) const;
+  bool convertObjectsIntersection(world::SceneReference const &currentScene, situation::Situation &situation) const;
+  void convertLaneInformationNonIntersection(situation::SituationType const &situationType,
+                                             world::ObjectDimensions const &egoVehicleDimension,
+                                             world::ObjectDimensions const &objectDimension,
+                                             situation::Situation &situation) const;
+  bool convertObjectStatesIntersection(world::SceneReference const &currentScene,
+                                       situation::Situation &situation,
+                                       physics::MetricRange &egoDimensionsIntersection,
+                                       physics::MetricRange &objectDimensionsIntersection) const;
+
+  /**
+   * @brief Check the semantic consistency of the ego vehicle and the object to be checked.
+   *
+   * @param [in] currentScene the information on the current scene with the object to be checked
+   *
+   * @return true if the scene is consistent, false otherwise.
+   */
+  bool isSceneConsistent(world::SceneReference const &currentScene) const;
+
+  /**
+   * @brief Convert the scene into the RSS situation of the ego vehicle and the object to be checked.
+   *
+   * @param [in] situationId the situation id assigned to the scene
+   * @param [in] egoVehicleRssDynamics the RSS dynamics of the ego vehicle
+   * @param [in] currentScene the information on the current scene with the object to be checked
+   * @param [out] situation the situation to be analyzed with RSS
+   *
+   * @return true if the situation could be created, false if there was an error during the operation.
+   */
+  bool convertSceneToSituation(situation::SituationId const &situationId,
+                               world::RssDynamics const &egoVehicleRssDynamics,
+                               world::SceneReference const &currentScene,
+                               situation::Situation &situation) const;
+
+  /**
+   * @brief Convert the scene into the RSS situation except for the relative position.
+   *
+   * The metric ranges the relative position is calculated from are stored into the batches at the given index
+   * instead, so the relative positions of all scenes can be calculated at once.
+   *
+   * @param [in] situationId the situation id assigned to the scene
+   * @param [in] egoVehicleRssDynamics the RSS dynamics of the ego vehicle
+   * @param [in] currentScene the information on the current scene with the object to be checked
+   * @param [out] situation the situation to be analyzed with RSS without the relative position
+   * @param [in] batchIndex the index of the scene within the batches
+   * @param [in,out] longitudinalBatch the batch of the longitudinal metric ranges
+   * @param [in,out] lateralBatch the batch of the lateral metric ranges
+   *
+   * @return true if the situation could be created, false if there was an error during the operation.
+   */
+  bool prepareSceneConversion(situation::SituationId const &situationId,
+                              world::RssDynamics const &egoVehicleRssDynamics,
+                              world::SceneReference const &currentScene,
+                              situation::Situation &situation,
+                              std::size_t const batchIndex,
+                              situation::RelativePositionBatch &longitudinalBatch,
+                              situation::RelativePositionBatch &lateralBatch) const;
+
+  /**
+   * @brief Create the reference to a scene referencing registered roads.
+   *
+   * @param [in] scene the scene
+   * @param [in] roadRegistry the registry of the roads the scene is referencing
+   * @param [out] sceneReference the reference to the scene
+   *
+   * Not relevant scenes are never evaluated on their roads: unknown roads of these scenes are accepted and left empty
+   * within the scene reference.
+   *
+   * @return true if the scene reference could be created, false if a relevant scene references an unknown road.
+   */
+  bool createSceneReference(RegisteredRoadScene const &scene,
+                            RssRoadRegistry const &roadRegistry,
+                            world::SceneReference &sceneReference) const;
+
+  /**
+   * @brief Implementation of groupScenesBySituation() for any scene representation.
+   *
+   * @param [in] timeIndex the time index of the scenes
+   * @param [in] numberOfScenes the number of scenes
+   * @param [in] getSceneReference callable bool(std::size_t sceneIndex, world::SceneReference &sceneReference)
+   * providing the references to the scenes
+   * @param [in,out] situationIdState the history of the situation id assignment
+   * @param [out] situationScenesVector the relevant scenes grouped by situation
+   *
+   * @return true if the situation ids could be assigned, false if there was an error during the operation.
+   */
+  template <class SceneReferenceAccess>
+  bool groupSceneReferencesBySituation(physics::TimeIndex const &timeIndex,
+                                       std::size_t const numberOfScenes,
+                                       SceneReferenceAccess const &getSceneReference,
+                                       RssSituationIdState &situationIdState,
+                                       SituationScenesVector &situationScenesVector) const;
+
+  /**
+   * @brief Implementation of extractSituation() for any scene representation.
+   *
+   * @param [in] egoVehicleRssDynamics the RSS dynamics of the ego vehicle
+   * @param [in] getSceneReference callable bool(std::size_t sceneIndex, world::SceneReference &sceneReference)
+   * providing the references to the scenes
+   * @param [in] situationScenes the scenes describing the situation
+   * @param [out] situation the situation to be analyzed with RSS
+   *
+   * @return true if the situation could be created, false if there was an error during the operation.
+   */
+  template <class SceneReferenceAccess>
+  bool extractSituationFromSceneReferences(world::RssDynamics const &egoVehicleRssDynamics,
+                                           SceneReferenceAccess const &getSceneReference,
+                                           SituationScenes const &situationScenes,
+                                           situation::Situation &situation) const;
+
+  /**
+   * @brief Implementation of extractSituations() for any scene representation.
+   *
+   * The scenes of all groups are converted first, the relative positions of all scenes are classified afterwards in
+   * one batch before the scenes of each group are merged into the situation.
+   *
+   * @param [in] egoVehicleRssDynamics the RSS dynamics of the ego vehicle
+   * @param [in] getSceneReference callable bool(std::size_t sceneIndex, world::SceneReference &sceneReference)
+   * providing the references to the scenes
+   * @param [in] situationScenesVector the relevant scenes grouped by situation
+   * @param [out] situationSnapshot the vector of situations to be analyzed with RSS
+   *
+   * @return true if the situations could be created, false if there was an error during the operation.
+   */
+  template <class SceneReferenceAccess>
+  bool extractSituationsFromSceneReferences(world::RssDynamics const &egoVehicleRssDynamics,
+                                            SceneReferenceAccess const &getSceneReference,
+                                            SituationScenesVector const &situationScenesVector,
+                                            situation::SituationSnapshot &situationSnapshot) const;
 
   /**
    * @brief Extract the RSS situation of the ego vehicle and the object to be checked.
@@ -125,10 +560,10 @@ private:
   };
   bool mergeVehicleStates(MergeMode const &mergeMode,
                           situation::VehicleState const &otherVehicleState,
-                          situation::VehicleState &mergedVehicleState);
-  bool mergeSituations(situation::Situation const &otherSituation, situation::Situation &mergedSituation);
+                          situation::VehicleState &mergedVehicleState) const;
+  bool mergeSituations(situation::Situation const &otherSituation, situation::Situation &mergedSituation) const;
 
-  std::unique_ptr<ad_rss::world::RssSituationIdProvider> mSituationIdProvider;
+  RssSituationIdState mSituationIdState;
 };
 
 } // namespace core
@@ -0,0 +1,135 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <limits>
+#include <vector>
+#include "ad_rss/physics/Acceleration.hpp"
+#include "ad_rss/physics/Distance.hpp"
+#include "ad_rss/situation/SituationSnapshot.hpp"
+#include "ad_rss/situation/VelocityRange.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace situation
+ */
+namespace situation {
+
+/*!
+ * @brief struct EgoMotionCandidate
+ *
+ * A candidate motion of the ego vehicle to be evaluated by evaluateEgoMotionCandidates().
+ */
+struct EgoMotionCandidate
+{
+  /*!
+   * The velocity of the ego vehicle. Replaces the ego velocity of all situations of the snapshot.
+   */
+  VelocityRange velocity;
+
+  /*!
+   * The maximum longitudinal acceleration the ego vehicle applies during the response time. It replaces the
+   * alphaLon.accelMax of the ego dynamics if smaller; braking candidates (negative values) are evaluated as 0.
+   */
+  physics::Acceleration accelerationLon{std::numeric_limits<physics::Acceleration>::max()};
+};
+
+/*!
+ * @brief struct EgoMotionCandidateResult
+ *
+ * The result of the evaluation of an EgoMotionCandidate against all situations of a snapshot.
+ *
+ * The margins are the difference of the current and the safe distance, so a distance is safe if its margin is
+ * positive. They are provided for the most critical situation: the dangerous situation with the lowest margin or, if
+ * no situation is dangerous, the situation with the lowest margin.
+ */
+struct EgoMotionCandidateResult
+{
+  /*!
+   * true if none of the situations is dangerous for the candidate
+   */
+  bool isSafe{true};
+
+  /*!
+   * the number of dangerous situations for the candidate
+   */
+  std::size_t numberOfDangerousSituations{0u};
+
+  /*!
+   * the index of the most critical situation within the snapshot, the number of situations if there is none
+   */
+  std::size_t criticalSituationIndex{0u};
+
+  /*!
+   * the longitudinal margin of the most critical situation
+   */
+  physics::Distance longitudinalMargin{std::numeric_limits<physics::Distance>::max()};
+
+  /*!
+   * the lateral margin of the most critical situation
+   */
+  physics::Distance lateralMargin{std::numeric_limits<physics::Distance>::max()};
+};
+
+/**
+ * @brief Evaluate candidate motions of the ego vehicle against the situations of a snapshot.
+ *
+ * Intended for motion planners querying many candidate ego velocities against the same surroundings: the situations
+ * are extracted once (e.g. by RssCheck::calculateAccelerationRestriction()) and all candidates are evaluated in a
+ * single pass over the situations. The non intersection situations are evaluated for all candidates at once by the
+ * batch versions of the RSS formulas.
+ *
+ * The evaluation is free of side effects: no history of the situation checks is used or updated. Therefore only the
+ * safety of the candidates is provided, not the proper response (which depends on the history). The default RSS
+ * formulas are evaluated; a candidate is safe if the RssSituationChecking would not consider any situation dangerous.
+ * For intersection situations the longitudinal margin of the deciding intersection check is reported (0 if the
+ * vehicles do not overlap in time) and the lateral margin is always 0, since lateral overlap is assumed.
+ *
+ * @param[in]  situationSnapshot the situations to evaluate the candidates against
+ * @param[in]  candidates the candidate motions of the ego vehicle
+ * @param[out] candidateResults the results of the candidates, in the order of the candidates
+ *
+ * @returns false if a failure occurred during calculations (e.g. invalid input), true otherwise
+ */
+bool evaluateEgoMotionCandidates(SituationSnapshot const &situationSnapshot,
+                                 std::vector<EgoMotionCandidate> const &candidates,
+                                 std::vector<EgoMotionCandidateResult> &candidateResults);
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,367 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "ad_rss/physics/DistanceValidInputRange.hpp"
+#include "ad_rss/situation/RssFormulaProvider.hpp"
+#include "ad_rss/situation/VelocityRangeValidInputRange.hpp"
+#include "ad_rss/world/RssDynamicsProfile.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace situation
+ */
+namespace situation {
+
+/*!
+ * @brief namespace fixed_dynamics
+ *
+ * Implementation details of the RssFixedDynamicsFormulaProvider
+ */
+namespace fixed_dynamics {
+
+/*!
+ * @brief distance covered by a vehicle applying the longitudinal stated braking pattern with alphaLon.brakeMin
+ */
+template <typename Profile> struct LongitudinalStatedBrakingDistance
+{
+  static double calculate(double const currentSpeed)
+  {
+    typedef world::RssDynamicsProfileTraits<Profile> Traits;
+    double const resultingSpeed = currentSpeed + Traits::cLonResponseSpeedOffset;
+    return (currentSpeed * Profile::cResponseTime) + Traits::cLonResponseDistanceOffset
+      + (resultingSpeed * resultingSpeed * Traits::cLonBrakeMinStoppingFactor);
+  }
+};
+
+/*!
+ * @brief distance covered by a vehicle applying the longitudinal stated braking pattern with
+ * alphaLon.brakeMinCorrect
+ */
+template <typename Profile> struct LongitudinalStatedBrakingCorrectDistance
+{
+  static double calculate(double const currentSpeed)
+  {
+    typedef world::RssDynamicsProfileTraits<Profile> Traits;
+    double const resultingSpeed = currentSpeed + Traits::cLonResponseSpeedOffset;
+    return (currentSpeed * Profile::cResponseTime) + Traits::cLonResponseDistanceOffset
+      + (resultingSpeed * resultingSpeed * Traits::cLonBrakeMinCorrectStoppingFactor);
+  }
+};
+
+/*!
+ * @brief distance covered by a vehicle braking longitudinally with alphaLon.brakeMax until it stops
+ */
+template <typename Profile> struct LongitudinalStoppingDistanceBrakeMax
+{
+  static double calculate(double const currentSpeed)
+  {
+    typedef world::RssDynamicsProfileTraits<Profile> Traits;
+    return currentSpeed * std::fabs(currentSpeed) * Traits::cLonBrakeMaxStoppingFactor;
+  }
+};
+
+/*!
+ * @brief lateral distance offset of the left vehicle applying the lateral stated braking pattern
+ */
+template <typename Profile> struct LateralStatedBrakingDistanceLeft
+{
+  static double calculate(double const currentSpeed)
+  {
+    typedef world::RssDynamicsProfileTraits<Profile> Traits;
+    double const resultingSpeed = currentSpeed + Traits::cLatResponseSpeedOffset;
+    double distanceOffset = (currentSpeed * Profile::cResponseTime) + Traits::cLatResponseDistanceOffset;
+    if (std::signbit(resultingSpeed) == std::signbit(Profile::cLatAccelMax))
+    {
+      // further braking to full stop in the moving direction has to be added
+      distanceOffset += resultingSpeed * std::fabs(resultingSpeed) * Traits::cLatBrakeMinStoppingFactor;
+    }
+    return distanceOffset;
+  }
+};
+
+/*!
+ * @brief lateral distance offset of the right vehicle applying the lateral stated braking pattern
+ */
+template <typename Profile> struct LateralStatedBrakingDistanceRight
+{
+  static double calculate(double const currentSpeed)
+  {
+    typedef world::RssDynamicsProfileTraits<Profile> Traits;
+    double const resultingSpeed = currentSpeed - Traits::cLatResponseSpeedOffset;
+    double distanceOffset = (currentSpeed * Profile::cResponseTime) - Traits::cLatResponseDistanceOffset;
+    if (std::signbit(resultingSpeed) == std::signbit(-Profile::cLatAccelMax))
+    {
+      // further braking to full stop in the moving direction has to be added
+      distanceOffset += resultingSpeed * std::fabs(resultingSpeed) * Traits::cLatBrakeMinStoppingFactor;
+    }
+    return distanceOffset;
+  }
+};
+
+/*!
+ * @brief selects the profile matching the dynamics of a vehicle and evaluates a distance term of this profile
+ */
+template <typename... Profiles> struct ProfileSelection;
+
+template <> struct ProfileSelection<>
+{
+  template <template <typename> class Term>
+  static bool calculate(world::RssDynamics const &, double const, double &)
+  {
+    return false;
+  }
+};
+
+template <typename Profile, typename... OtherProfiles> struct ProfileSelection<Profile, OtherProfiles...>
+{
+  template <template <typename> class Term>
+  static bool calculate(world::RssDynamics const &dynamics, double const currentSpeed, double &distance)
+  {
+    if (world::RssDynamicsProfileTraits<Profile>::matches(dynamics))
+    {
+      distance = Term<Profile>::calculate(currentSpeed);
+      return true;
+    }
+    return ProfileSelection<OtherProfiles...>::template calculate<Term>(dynamics, currentSpeed, distance);
+  }
+};
+
+/*!
+ * @brief check the members of the vehicle state not covered by the dynamics profile for validity
+ */
+inline bool vehicleStateWithinValidInputRange(VehicleState const &vehicleState)
+{
+  if (!withinValidInputRange(vehicleState.velocity)
+      || !withinValidInputRange(vehicleState.distanceToEnterIntersection)
+      || !withinValidInputRange(vehicleState.distanceToLeaveIntersection))
+  {
+    return false;
+  }
+  if ((vehicleState.distanceToEnterIntersection < physics::Distance(0.))
+      || (vehicleState.distanceToLeaveIntersection < vehicleState.distanceToEnterIntersection)
+      || (physics::Distance(1e4) < vehicleState.distanceToLeaveIntersection))
+  {
+    return false;
+  }
+  if (vehicleState.velocity.speedLon.minimum < physics::Speed(0.))
+  {
+    return false;
+  }
+  return true;
+}
+
+} // namespace fixed_dynamics
+
+/*!
+ * @brief class RssFixedDynamicsFormulaProvider
+ *
+ * RssFormulaProvider specialized for a fixed set of dynamics profiles known at compile time
+ * (see world::RssDynamicsProfileTraits). The profile constants, the derived products and reciprocals of the formulas
+ * and the input range checks of the dynamics are folded by the compiler. The dynamics of a vehicle state select the
+ * matching profile at runtime by exact comparison; vehicle states with dynamics not matching any of the profiles are
+ * evaluated by the default implementation with the runtime dynamics.
+ *
+ * The results are identical to the default implementation up to floating point rounding.
+ */
+template <typename... Profiles> class RssFixedDynamicsFormulaProvider : public RssFormulaProvider
+{
+public:
+  bool checkSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehicle,
+                                                  VehicleState const &followingVehicle,
+                                                  physics::Distance const &vehicleDistance,
+                                                  physics::Distance &safeDistance,
+                                                  bool &isDistanceSafe) const override
+  {
+    double distanceStatedBraking = 0.;
+    double distanceMaxBrake = 0.;
+    if (!Selection::template calculate<fixed_dynamics::LongitudinalStatedBrakingDistance>(
+          followingVehicle.dynamics,
+          static_cast<double>(followingVehicle.velocity.speedLon.maximum),
+          distanceStatedBraking)
+        || !Selection::template calculate<fixed_dynamics::LongitudinalStoppingDistanceBrakeMax>(
+             leadingVehicle.dynamics,
+             static_cast<double>(leadingVehicle.velocity.speedLon.minimum),
+             distanceMaxBrake))
+    {
+      return RssFormulaProvider::checkSafeLongitudinalDistanceSameDirection(
+        leadingVehicle, followingVehicle, vehicleDistance, safeDistance, isDistanceSafe);
+    }
+    bool const result = fixed_dynamics::vehicleStateWithinValidInputRange(leadingVehicle)
+      && fixed_dynamics::vehicleStateWithinValidInputRange(followingVehicle);
+    return checkSafeDistance(
+      result, std::max(distanceStatedBraking - distanceMaxBrake, 0.), vehicleDistance, safeDistance, isDistanceSafe);
+  }
+
+  bool isSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehicle,
+                                               VehicleState const &followingVehicle,
+                                               physics::Distance const &vehicleDistance,
+                                               bool &isDistanceSafe) const override
+  {
+    // the folded formulas are cheap enough to be evaluated completely
+    physics::Distance safeDistance;
+    return checkSafeLongitudinalDistanceSameDirection(
+      leadingVehicle, followingVehicle, vehicleDistance, safeDistance, isDistanceSafe);
+  }
+
+  bool checkSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctVehicle,
+                                                      VehicleState const &oppositeVehicle,
+                                                      physics::Distance const &vehicleDistance,
+                                                      physics::Distance &safeDistance,
+                                                      bool &isDistanceSafe) const override
+  {
+    double distanceStatedBrakingCorrect = 0.;
+    double distanceStatedBrakingOpposite = 0.;
+    if (!Selection::template calculate<fixed_dynamics::LongitudinalStatedBrakingCorrectDistance>(
+          correctVehicle.dynamics,
+          static_cast<double>(correctVehicle.velocity.speedLon.maximum),
+          distanceStatedBrakingCorrect)
+        || !Selection::template calculate<fixed_dynamics::LongitudinalStatedBrakingDistance>(
+             oppositeVehicle.dynamics,
+             static_cast<double>(oppositeVehicle.velocity.speedLon.maximum),
+             distanceStatedBrakingOpposite))
+    {
+      return RssFormulaProvider::checkSafeLongitudinalDistanceOppositeDirection(
+        correctVehicle, oppositeVehicle, vehicleDistance, safeDistance, isDistanceSafe);
+    }
+    bool const result = fixed_dynamics::vehicleStateWithinValidInputRange(correctVehicle)
+      && fixed_dynamics::vehicleStateWithinValidInputRange(oppositeVehicle);
+    return checkSafeDistance(result,
+                             distanceStatedBrakingCorrect + distanceStatedBrakingOpposite,
+                             vehicleDistance,
+                             safeDistance,
+                             isDistanceSafe);
+  }
+
+  bool isSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctVehicle,
+                                                   VehicleState const &oppositeVehicle,
+                                                   physics::Distance const &vehicleDistance,
+                                                   bool &isDistanceSafe) const override
+  {
+    physics::Distance safeDistance;
+    return checkSafeLongitudinalDistanceOppositeDirection(
+      correctVehicle, oppositeVehicle, vehicleDistance, safeDistance, isDistanceSafe);
+  }
+
+  bool checkStopInFrontIntersection(VehicleState const &vehicle,
+                                    physics::Distance &safeDistance,
+                                    bool &isDistanceSafe) const override
+  {
+    double distanceStatedBraking = 0.;
+    if (!Selection::template calculate<fixed_dynamics::LongitudinalStatedBrakingDistance>(
+          vehicle.dynamics, static_cast<double>(vehicle.velocity.speedLon.maximum), distanceStatedBraking))
+    {
+      return RssFormulaProvider::checkStopInFrontIntersection(vehicle, safeDistance, isDistanceSafe);
+    }
+    if (!fixed_dynamics::vehicleStateWithinValidInputRange(vehicle))
+    {
+      return false;
+    }
+    isDistanceSafe = false;
+    safeDistance = physics::Distance(distanceStatedBraking);
+    if (safeDistance < vehicle.distanceToEnterIntersection)
+    {
+      isDistanceSafe = true;
+    }
+    return true;
+  }
+
+  bool checkSafeLateralDistance(VehicleState const &leftVehicle,
+                                VehicleState const &rightVehicle,
+                                physics::Distance const &vehicleDistance,
+                                physics::Distance &safeDistance,
+                                bool &isDistanceSafe) const override
+  {
+    double distanceOffsetStatedBrakingLeft = 0.;
+    double distanceOffsetStatedBrakingRight = 0.;
+    if (!Selection::template calculate<fixed_dynamics::LateralStatedBrakingDistanceLeft>(
+          leftVehicle.dynamics,
+          static_cast<double>(leftVehicle.velocity.speedLat.maximum),
+          distanceOffsetStatedBrakingLeft)
+        || !Selection::template calculate<fixed_dynamics::LateralStatedBrakingDistanceRight>(
+             rightVehicle.dynamics,
+             static_cast<double>(rightVehicle.velocity.speedLat.minimum),
+             distanceOffsetStatedBrakingRight))
+    {
+      return RssFormulaProvider::checkSafeLateralDistance(
+        leftVehicle, rightVehicle, vehicleDistance, safeDistance, isDistanceSafe);
+    }
+    bool const result = fixed_dynamics::vehicleStateWithinValidInputRange(leftVehicle)
+      && fixed_dynamics::vehicleStateWithinValidInputRange(rightVehicle);
+    return checkSafeDistance(result,
+                             std::max(distanceOffsetStatedBrakingLeft - distanceOffsetStatedBrakingRight, 0.),
+                             vehicleDistance,
+                             safeDistance,
+                             isDistanceSafe);
+  }
+
+private:
+  typedef fixed_dynamics::ProfileSelection<Profiles...> Selection;
+
+  static bool checkSafeDistance(bool const calculationValid,
+                                double const calculatedSafeDistance,
+                                physics::Distance const &vehicleDistance,
+                                physics::Distance &safeDistance,
+                                bool &isDistanceSafe)
+  {
+    if (vehicleDistance < physics::Distance(0.))
+    {
+      return false;
+    }
+
+    isDistanceSafe = false;
+    safeDistance = std::numeric_limits<physics::Distance>::max();
+    if (calculationValid)
+    {
+      safeDistance = physics::Distance(calculatedSafeDistance);
+    }
+
+    if (vehicleDistance > safeDistance)
+    {
+      isDistanceSafe = true;
+    }
+    return calculationValid;
+  }
+};
+
+} // namespace situation
+} // namespace ad_rss
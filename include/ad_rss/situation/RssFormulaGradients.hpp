@@ -0,0 +1,235 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include "ad_rss/physics/Acceleration.hpp"
+#include "ad_rss/physics/Distance.hpp"
+#include "ad_rss/physics/Duration.hpp"
+#include "ad_rss/physics/Speed.hpp"
+#include "ad_rss/situation/VehicleState.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace situation
+ */
+namespace situation {
+
+/*!
+ * @brief struct VehicleStateGradient
+ *
+ * The partial derivatives of a value with respect to the inputs of a vehicle state used by the RSS formulas.
+ * The derivative with respect to an input is given in the unit of the value per unit of the input,
+ * e.g. m / (m/s) for a distance with respect to a speed.
+ */
+struct VehicleStateGradient
+{
+  /*!
+   * derivative with respect to velocity.speedLon.minimum
+   */
+  double speedLonMinimum{0.};
+  /*!
+   * derivative with respect to velocity.speedLon.maximum
+   */
+  double speedLonMaximum{0.};
+  /*!
+   * derivative with respect to velocity.speedLat.minimum
+   */
+  double speedLatMinimum{0.};
+  /*!
+   * derivative with respect to velocity.speedLat.maximum
+   */
+  double speedLatMaximum{0.};
+  /*!
+   * derivative with respect to dynamics.responseTime
+   */
+  double responseTime{0.};
+  /*!
+   * derivative with respect to dynamics.alphaLon.accelMax
+   */
+  double alphaLonAccelMax{0.};
+  /*!
+   * derivative with respect to dynamics.alphaLon.brakeMax
+   */
+  double alphaLonBrakeMax{0.};
+  /*!
+   * derivative with respect to dynamics.alphaLon.brakeMin
+   */
+  double alphaLonBrakeMin{0.};
+  /*!
+   * derivative with respect to dynamics.alphaLon.brakeMinCorrect
+   */
+  double alphaLonBrakeMinCorrect{0.};
+  /*!
+   * derivative with respect to dynamics.alphaLat.accelMax
+   */
+  double alphaLatAccelMax{0.};
+  /*!
+   * derivative with respect to dynamics.alphaLat.brakeMin
+   */
+  double alphaLatBrakeMin{0.};
+};
+
+/*!
+ * @brief struct SafeDistanceGradient
+ *
+ * A safe distance between two vehicles together with its gradient with respect to the inputs of both vehicles.
+ */
+struct SafeDistanceGradient
+{
+  /*!
+   * the safe distance
+   */
+  physics::Distance safeDistance{0.};
+
+  /*!
+   * the derivatives of the safe distance with respect to the inputs of the first vehicle
+   */
+  VehicleStateGradient firstVehicle;
+
+  /*!
+   * the derivatives of the safe distance with respect to the inputs of the second vehicle
+   */
+  VehicleStateGradient secondVehicle;
+};
+
+/*!
+ * @brief struct TimeToCoverDistanceGradient
+ *
+ * The time to cover a distance together with its derivatives with respect to the inputs.
+ */
+struct TimeToCoverDistanceGradient
+{
+  /*!
+   * the time to cover the distance
+   */
+  physics::Duration requiredTime{0.};
+
+  /*!
+   * derivative with respect to the current speed
+   */
+  double currentSpeed{0.};
+  /*!
+   * derivative with respect to the response time
+   */
+  double responseTime{0.};
+  /*!
+   * derivative with respect to the acceleration
+   */
+  double acceleration{0.};
+  /*!
+   * derivative with respect to the deceleration
+   */
+  double deceleration{0.};
+  /*!
+   * derivative with respect to the distance to cover
+   */
+  double distanceToCover{0.};
+};
+
+/*
+ * The gradients are evaluated in forward mode together with the values in a single pass. The values are identical to
+ * the ones of the RSS formulas. The formulas are piecewise defined (e.g. stopping within the response time or the
+ * clamping of the safe distance at zero): at the switching points the derivatives of the branch taken by the formula
+ * are provided, within a clamped region the derivatives are zero.
+ */
+
+/**
+ * @brief Calculate the safe longitudinal distance of two vehicles driving in the same direction and its gradient.
+ *
+ * @param[in]  leadingVehicle    the state of the leading vehicle, the first vehicle of the gradient
+ * @param[in]  followingVehicle  the state of the following vehicle, the second vehicle of the gradient
+ * @param[out] gradient          the safe distance and its gradient
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateSafeLongitudinalDistanceSameDirectionGradient(VehicleState const &leadingVehicle,
+                                                            VehicleState const &followingVehicle,
+                                                            SafeDistanceGradient &gradient);
+
+/**
+ * @brief Calculate the safe longitudinal distance of two vehicles driving in opposite direction and its gradient.
+ *
+ * @param[in]  correctVehicle    the state of the vehicle driving in the correct lane, the first vehicle of the gradient
+ * @param[in]  oppositeVehicle   the state of the vehicle driving in the wrong lane, the second vehicle of the gradient
+ * @param[out] gradient          the safe distance and its gradient
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateSafeLongitudinalDistanceOppositeDirectionGradient(VehicleState const &correctVehicle,
+                                                                VehicleState const &oppositeVehicle,
+                                                                SafeDistanceGradient &gradient);
+
+/**
+ * @brief Calculate the safe lateral distance of two vehicles and its gradient.
+ *
+ * @param[in]  leftVehicle    the state of the left vehicle, the first vehicle of the gradient
+ * @param[in]  rightVehicle   the state of the right vehicle, the second vehicle of the gradient
+ * @param[out] gradient       the safe distance and its gradient
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateSafeLateralDistanceGradient(VehicleState const &leftVehicle,
+                                          VehicleState const &rightVehicle,
+                                          SafeDistanceGradient &gradient);
+
+/**
+ * @brief Calculate the time needed to cover a distance and its gradient.
+ *
+ * The time is calculated as by the intersection checks: accelerating during the response time, then braking till
+ * zero velocity. If the distance is not covered, the time is std::numeric_limits<physics::Duration>::max() and the
+ * derivatives are zero.
+ *
+ * @param[in]  currentSpeed     starting velocity
+ * @param[in]  responseTime     the response time
+ * @param[in]  acceleration     acceleration during response time
+ * @param[in]  deceleration     deceleration after response time
+ * @param[in]  distanceToCover  distance that should be covered
+ * @param[out] gradient         the time to cover the distance and its gradient
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool calculateTimeToCoverDistanceGradient(physics::Speed const &currentSpeed,
+                                          physics::Duration const &responseTime,
+                                          physics::Acceleration const &acceleration,
+                                          physics::Acceleration const &deceleration,
+                                          physics::Distance const &distanceToCover,
+                                          TimeToCoverDistanceGradient &gradient);
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,182 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include "ad_rss/physics/Distance.hpp"
+#include "ad_rss/situation/VehicleState.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace situation
+ */
+namespace situation {
+
+/*!
+ * @brief class RssFormulaProvider
+ *
+ * Provides the RSS formulas evaluated by the situation checks. The default implementation evaluates the formulas with
+ * the RssDynamics of the vehicle states given at runtime. Derived classes can provide specialized implementations of
+ * the formulas (e.g. RssFixedDynamicsFormulaProvider), which have to produce the same results.
+ *
+ * For the documentation of the individual formulas see RssFormulas.hpp.
+ */
+class RssFormulaProvider
+{
+public:
+  /*!
+   * @brief constructor
+   */
+  RssFormulaProvider() = default;
+
+  /*!
+   * @brief destructor
+   */
+  virtual ~RssFormulaProvider() = default;
+
+  /**
+   * @brief Check if the longitudinal distance between the two vehicles driving in the same direction is safe.
+   *
+   * @param[in]  leadingVehicle    the state of the leading vehicle
+   * @param[in]  followingVehicle  the state of the following vehicle
+   * @param[in]  vehicleDistance   the (positive) longitudinal distance between the two vehicles
+   * @param[out] safeDistance      the safe distance according to the RSS definition
+   * @param[out] isDistanceSafe    true if the distance is safe, false if not
+   *
+   * @return true on successful calculation, false otherwise
+   */
+  virtual bool checkSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehicle,
+                                                          VehicleState const &followingVehicle,
+                                                          physics::Distance const &vehicleDistance,
+                                                          physics::Distance &safeDistance,
+                                                          bool &isDistanceSafe) const;
+
+  /**
+   * @brief Check if the longitudinal distance between the two vehicles driving in the same direction is safe without
+   * providing the safe distance.
+   *
+   * Used by the situation checks in decision only mode. Has to provide the same decision as
+   * checkSafeLongitudinalDistanceSameDirection(), but is allowed to skip the parts of the formula not required for it.
+   *
+   * @param[in]  leadingVehicle    the state of the leading vehicle
+   * @param[in]  followingVehicle  the state of the following vehicle
+   * @param[in]  vehicleDistance   the (positive) longitudinal distance between the two vehicles
+   * @param[out] isDistanceSafe    true if the distance is safe, false if not
+   *
+   * @return true on successful calculation, false otherwise
+   */
+  virtual bool isSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehicle,
+                                                       VehicleState const &followingVehicle,
+                                                       physics::Distance const &vehicleDistance,
+                                                       bool &isDistanceSafe) const;
+
+  /**
+   * @brief Check if the longitudinal distance between the two vehicles driving in opposite direction is safe.
+   *
+   * @param[in]  correctVehicle    the state of the vehicle driving in the correct lane
+   * @param[in]  oppositeVehicle   the state of the vehicle driving in the wrong lane
+   * @param[in]  vehicleDistance   the (positive) longitudinal distance between the two vehicles
+   * @param[out] safeDistance      the safe distance according to the RSS definition
+   * @param[out] isDistanceSafe    true if the distance is safe, false if not
+   *
+   * @return true on successful calculation, false otherwise
+   */
+  virtual bool checkSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctVehicle,
+                                                              VehicleState const &oppositeVehicle,
+                                                              physics::Distance const &vehicleDistance,
+                                                              physics::Distance &safeDistance,
+                                                              bool &isDistanceSafe) const;
+
+  /**
+   * @brief Check if the longitudinal distance between the two vehicles driving in opposite direction is safe without
+   * providing the safe distance.
+   *
+   * Used by the situation checks in decision only mode. Has to provide the same decision as
+   * checkSafeLongitudinalDistanceOppositeDirection(), but is allowed to skip the parts of the formula not required for
+   * it.
+   *
+   * @param[in]  correctVehicle    the state of the vehicle driving in the correct lane
+   * @param[in]  oppositeVehicle   the state of the vehicle driving in the wrong lane
+   * @param[in]  vehicleDistance   the (positive) longitudinal distance between the two vehicles
+   * @param[out] isDistanceSafe    true if the distance is safe, false if not
+   *
+   * @return true on successful calculation, false otherwise
+   */
+  virtual bool isSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctVehicle,
+                                                           VehicleState const &oppositeVehicle,
+                                                           physics::Distance const &vehicleDistance,
+                                                           bool &isDistanceSafe) const;
+
+  /**
+   * @brief Check if the vehicle can safely break longitudinaly in front of the intersection.
+   *
+   * @param[in]  vehicle         the state of the vehicle
+   * @param[out] safeDistance    the safe distance according to the RSS definition
+   * @param[out] isDistanceSafe  true if the distance is safe, false if not
+   *
+   * @return true on successful calculation, false otherwise
+   */
+  virtual bool checkStopInFrontIntersection(VehicleState const &vehicle,
+                                            physics::Distance &safeDistance,
+                                            bool &isDistanceSafe) const;
+
+  /**
+   * @brief Check if the lateral distance between to vehicles is safe
+   *
+   * @param[in]  leftVehicle     the state of the left vehicle
+   * @param[in]  rightVehicle    the state of the right vehicle
+   * @param[in]  vehicleDistance the (positive) lateral distance between the two vehicles
+   * @param[out] safeDistance    the safe distance according to the RSS definition
+   * @param[out] isDistanceSafe  true if the distance is safe, false if not
+   *
+   * @return true on successful calculation, false otherwise
+   */
+  virtual bool checkSafeLateralDistance(VehicleState const &leftVehicle,
+                                        VehicleState const &rightVehicle,
+                                        physics::Distance const &vehicleDistance,
+                                        physics::Distance &safeDistance,
+                                        bool &isDistanceSafe) const;
+};
+
+/*!
+ * @returns the default RssFormulaProvider evaluating the formulas with the runtime RssDynamics
+ */
+RssFormulaProvider const &getDefaultFormulaProvider();
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,163 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <limits>
+#include <map>
+#include <vector>
+#include "ad_rss/physics/Acceleration.hpp"
+#include "ad_rss/physics/Duration.hpp"
+#include "ad_rss/situation/SituationSnapshot.hpp"
+#include "ad_rss/world/ObjectId.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace situation
+ */
+namespace situation {
+
+/*!
+ * @brief struct PredictedAcceleration
+ *
+ * The constant acceleration a vehicle is predicted to keep during the horizon, in its lane coordinate system.
+ */
+struct PredictedAcceleration
+{
+  /*!
+   * the longitudinal acceleration; on deceleration the vehicle stops and does not drive backwards
+   */
+  physics::Acceleration accelerationLon{0.};
+
+  /*!
+   * the lateral acceleration
+   */
+  physics::Acceleration accelerationLat{0.};
+};
+
+/*!
+ * @brief struct HorizonRolloutParameters
+ *
+ * The parameters of calculateHorizonRollout(). The situations are evaluated at the time steps k * timeStep with
+ * k = 0 .. numberOfTimeSteps, where time step 0 is the current situation.
+ */
+struct HorizonRolloutParameters
+{
+  /*!
+   * the duration between two evaluated time steps
+   */
+  physics::Duration timeStep{0.1};
+
+  /*!
+   * the number of time steps to evaluate after the current one, i.e. the horizon is numberOfTimeSteps * timeStep
+   */
+  std::size_t numberOfTimeSteps{20u};
+
+  /*!
+   * the predicted acceleration of the ego vehicle
+   */
+  PredictedAcceleration egoAcceleration;
+
+  /*!
+   * the predicted accelerations of the objects; objects not contained keep their current speed
+   */
+  std::map<world::ObjectId, PredictedAcceleration> objectAccelerations;
+};
+
+/*!
+ * @brief struct HorizonRolloutResult
+ *
+ * The result of the rollout of a single situation.
+ */
+struct HorizonRolloutResult
+{
+  /*!
+   * the id of the situation
+   */
+  SituationId situationId{0u};
+
+  /*!
+   * the id of the other object of the situation
+   */
+  world::ObjectId objectId{0u};
+
+  /*!
+   * true if the situation becomes dangerous within the horizon (including the current time step)
+   */
+  bool isDangerous{false};
+
+  /*!
+   * the first time step the situation is dangerous, numberOfTimeSteps + 1 if it stays safe within the horizon
+   */
+  std::size_t firstDangerousTimeStep{0u};
+
+  /*!
+   * the time until the situation becomes dangerous, std::numeric_limits<physics::Duration>::max() if it stays safe
+   * within the horizon
+   */
+  physics::Duration timeToDanger{std::numeric_limits<physics::Duration>::max()};
+};
+
+/**
+ * @brief Check whether the situations of a snapshot stay safe within a time horizon.
+ *
+ * The ego vehicle and the objects are moved along the kinematic model of the RSS formulas with their predicted
+ * constant accelerations: the speed ranges are advanced by physics::calculateSpeedAfterResponseTime() and the
+ * distances by physics::calculateDistanceOffsetAfterResponseTime(). The kinematics of all time steps are calculated
+ * in one batch per vehicle (the ego trajectory is shared by all situations), the rolled out situations are then
+ * evaluated with the same logic as the RssSituationChecking until the first dangerous time step.
+ *
+ * The rollout is conservative with respect to the speed ranges: a distance between the vehicles shrinks with the
+ * maximum speed of the approaching and grows with the minimum speed of the receding vehicle. Once the vehicles
+ * overlap longitudinally or laterally they keep overlapping on that axis, since the vehicle dimensions are not part
+ * of the situation. Within intersections the distances to enter and to leave the intersection are reduced
+ * accordingly. As with evaluateEgoMotionCandidates() no history of the situation checks is used or updated, so only
+ * the safety is provided, not the proper response.
+ *
+ * @param[in]  situationSnapshot the situations to roll out
+ * @param[in]  parameters the time steps and the predicted accelerations of the vehicles
+ * @param[out] rolloutResults the results, in the order of the situations of the snapshot
+ *
+ * @returns false if a failure occurred during calculations (e.g. invalid input), true otherwise
+ */
+bool calculateHorizonRollout(SituationSnapshot const &situationSnapshot,
+                             HorizonRolloutParameters const &parameters,
+                             std::vector<HorizonRolloutResult> &rolloutResults);
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,157 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "ad_rss/physics/Speed.hpp"
+#include "ad_rss/situation/SituationSnapshot.hpp"
+#include "ad_rss/world/ObjectId.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace situation
+ */
+namespace situation {
+
+/*!
+ * @brief struct MonteCarloParameters
+ *
+ * The parameters of calculateDangerProbabilities(). The velocity and the dynamics of the other vehicle of a situation
+ * are sampled uniformly; the ego vehicle keeps its state.
+ */
+struct MonteCarloParameters
+{
+  /*!
+   * the number of samples per situation
+   */
+  std::uint32_t numberOfSamples{10000u};
+
+  /*!
+   * the seed of the random numbers; the samples of a situation only depend on the seed, the situation id, the object
+   * id and the sample index, so the results are reproducible and extending the number of samples keeps the previous
+   * samples
+   */
+  std::uint64_t seed{0u};
+
+  /*!
+   * the longitudinal speed is sampled within the longitudinal speed range of the vehicle widened by this uncertainty
+   * on both sides; negative speeds are limited to 0
+   */
+  physics::Speed speedLonUncertainty{0.};
+
+  /*!
+   * the lateral speed is sampled within the lateral speed range of the vehicle widened by this uncertainty on both
+   * sides
+   */
+  physics::Speed speedLatUncertainty{0.};
+
+  /*!
+   * the relative uncertainty of the response time within [0, 1): the response time is scaled by a factor sampled
+   * within [1 - uncertainty, 1 + uncertainty]
+   */
+  double responseTimeUncertainty{0.};
+
+  /*!
+   * the relative uncertainty of the maximum longitudinal and lateral accelerations within [0, 1)
+   */
+  double accelerationUncertainty{0.};
+
+  /*!
+   * the relative uncertainty of the braking decelerations within [0, 1); all decelerations of a sample are scaled by
+   * the same factor, so their order is kept
+   */
+  double decelerationUncertainty{0.};
+};
+
+/*!
+ * @brief struct MonteCarloResult
+ *
+ * The result of the sampling of a single situation.
+ */
+struct MonteCarloResult
+{
+  /*!
+   * the id of the situation
+   */
+  SituationId situationId{0u};
+
+  /*!
+   * the id of the other object of the situation
+   */
+  world::ObjectId objectId{0u};
+
+  /*!
+   * the number of evaluated samples
+   */
+  std::uint32_t numberOfSamples{0u};
+
+  /*!
+   * the number of samples the situation is dangerous for
+   */
+  std::uint32_t numberOfDangerousSamples{0u};
+
+  /*!
+   * the empirical probability of the situation being dangerous, i.e. numberOfDangerousSamples / numberOfSamples
+   */
+  double dangerProbability{0.};
+};
+
+/**
+ * @brief Estimate the probability of the situations of a snapshot being dangerous under uncertain velocities and
+ * dynamics of the other vehicles.
+ *
+ * For every situation the samples of the other vehicle are drawn by a counter based random number generator into
+ * arrays per input of the RSS formulas. The non intersection situations are then evaluated for all samples at once
+ * by the batch versions of the RSS formulas, the intersection situations sample by sample with the same logic as the
+ * RssSituationChecking. As with evaluateEgoMotionCandidates() no history of the situation checks is used or updated.
+ * Situations which are not relevant are never dangerous.
+ *
+ * @param[in]  situationSnapshot the situations to evaluate
+ * @param[in]  parameters the number of samples and the uncertainties
+ * @param[out] monteCarloResults the results, in the order of the situations of the snapshot
+ *
+ * @returns false if a failure occurred during calculations (e.g. invalid input), true otherwise
+ */
+bool calculateDangerProbabilities(SituationSnapshot const &situationSnapshot,
+                                  MonteCarloParameters const &parameters,
+                                  std::vector<MonteCarloResult> &monteCarloResults);
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,102 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <vector>
+#include "ad_rss/physics/Duration.hpp"
+#include "ad_rss/situation/RssFormulaProvider.hpp"
+#include "ad_rss/situation/SituationSnapshot.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace situation
+ */
+namespace situation {
+
+/**
+ * @brief Estimate the time until the vehicles of a situation might get into conflict.
+ *
+ * This is a cheap criticality estimate without evaluating the RSS formulas: the current longitudinal distance is
+ * divided by the maximal closing speed of the two vehicles. In intersection situations the later of both times to
+ * enter the intersection is used. Braking and the lateral distance are not considered.
+ *
+ * @param[in] situation the situation to be estimated
+ *
+ * @returns the estimated time until conflict, 0 if the vehicles are already overlapping longitudinally and
+ * std::numeric_limits<physics::Duration>::max() if the vehicles are not approaching each other
+ */
+physics::Duration estimateTimeToConflict(Situation const &situation);
+
+/**
+ * @brief Order the situations of a situation snapshot by their criticality.
+ *
+ * The situations are ordered ascending by estimateTimeToConflict(), then by their longitudinal distance. Situations
+ * with identical criticality keep their order within the snapshot.
+ *
+ * @param[in]  situationSnapshot the situations to be ordered
+ * @param[out] situationOrder the indices of the situations within situationSnapshot.situations, most critical first
+ *
+ * @returns false if a failure occurred during calculations, true otherwise
+ */
+bool orderSituationsByCriticality(SituationSnapshot const &situationSnapshot, std::vector<std::size_t> &situationOrder);
+
+/**
+ * @brief Calculate a lower bound of the time the situation stays safe in the worst case.
+ *
+ * In contrast to estimateTimeToConflict() the bound is conservative: whatever the vehicles do within their RSS
+ * dynamics (accelerating with at most accelMax towards each other, braking with at most brakeMax), the situation
+ * checks will not consider the situation dangerous before this time has passed. The current distances and safe
+ * distances are evaluated with the given formula provider; the decrease of the margin between both is bounded with
+ * the speeds and the RssDynamics of the vehicle states. A situation is dangerous only if all of its safe criteria are
+ * violated, so the bound is the latest of the bounds of the currently fulfilled criteria. The time overlap criterion
+ * of intersections is not bounded and is considered as violated immediately.
+ *
+ * @param[in]  situation the situation to be evaluated
+ * @param[in]  formulaProvider the formulas to evaluate the safe distances with
+ * @param[out] timeToDanger the lower bound of the time the situation stays safe: 0 if it is dangerous already,
+ *             std::numeric_limits<physics::Duration>::max() if it never gets dangerous (e.g. not relevant situations)
+ *
+ * @returns false if a failure occurred during calculations, true otherwise
+ */
+bool calculateTimeToDanger(Situation const &situation,
+                           RssFormulaProvider const &formulaProvider,
+                           physics::Duration &timeToDanger);
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,168 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <limits>
+#include <vector>
+#include "ad_rss/physics/Speed.hpp"
+#include "ad_rss/situation/SituationSnapshot.hpp"
+#include "ad_rss/world/ObjectId.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace situation
+ */
+namespace situation {
+
+/*!
+ * @brief struct SituationSpeedLimits
+ *
+ * The ego speeds which are safe within a single situation, while the other vehicle keeps its state.
+ *
+ * The longitudinal distance is safe if speedLonMin < egoVehicleState.velocity.speedLon.minimum and
+ * egoVehicleState.velocity.speedLon.maximum < speedLonMax; the lateral distance accordingly with the lateral
+ * limits. Unrestricted limits are std::numeric_limits<physics::Speed>::lowest() and max(). If no ego speed is safe on
+ * an axis, the interval of that axis is empty (e.g. speedLatMin > speedLatMax if the vehicles overlap laterally).
+ */
+struct SituationSpeedLimits
+{
+  /*!
+   * the id of the situation
+   */
+  SituationId situationId{0u};
+
+  /*!
+   * the id of the other object of the situation
+   */
+  world::ObjectId objectId{0u};
+
+  /*!
+   * the lower limit of the ego longitudinal speed
+   */
+  physics::Speed speedLonMin{std::numeric_limits<physics::Speed>::lowest()};
+
+  /*!
+   * the upper limit of the ego longitudinal speed
+   */
+  physics::Speed speedLonMax{std::numeric_limits<physics::Speed>::max()};
+
+  /*!
+   * the lower limit of the ego lateral speed
+   */
+  physics::Speed speedLatMin{std::numeric_limits<physics::Speed>::lowest()};
+
+  /*!
+   * the upper limit of the ego lateral speed
+   */
+  physics::Speed speedLatMax{std::numeric_limits<physics::Speed>::max()};
+
+  /*!
+   * true if the longitudinal distance is safe at the current ego velocity
+   */
+  bool isLongitudinalSafe{true};
+
+  /*!
+   * true if the lateral distance is safe at the current ego velocity
+   */
+  bool isLateralSafe{true};
+};
+
+/*!
+ * @brief struct SpeedEnvelope
+ *
+ * The ego speeds which are safe within all situations of a snapshot.
+ *
+ * A situation is safe if it is longitudinally or laterally safe. Therefore the longitudinal limits are aggregated
+ * over all situations which are not laterally safe at the current ego velocity and the lateral limits over all
+ * situations which are not longitudinally safe at the current ego velocity: keeping the ego speed of one axis, the
+ * limits of the other axis keep all situations safe.
+ */
+struct SpeedEnvelope
+{
+  /*!
+   * the lower limit of the ego longitudinal speed
+   */
+  physics::Speed speedLonMin{std::numeric_limits<physics::Speed>::lowest()};
+
+  /*!
+   * the upper limit of the ego longitudinal speed
+   */
+  physics::Speed speedLonMax{std::numeric_limits<physics::Speed>::max()};
+
+  /*!
+   * the lower limit of the ego lateral speed
+   */
+  physics::Speed speedLatMin{std::numeric_limits<physics::Speed>::lowest()};
+
+  /*!
+   * the upper limit of the ego lateral speed
+   */
+  physics::Speed speedLatMax{std::numeric_limits<physics::Speed>::max()};
+
+  /*!
+   * the objects of the situations which are dangerous at the current ego velocity
+   */
+  std::vector<world::ObjectId> dangerousObjects;
+
+  /*!
+   * the limits of the individual situations, in the order of the situations of the snapshot
+   */
+  std::vector<SituationSpeedLimits> situationLimits;
+};
+
+/**
+ * @brief Calculate the ego speeds which are safe within the situations of a snapshot.
+ *
+ * Instead of searching for the safe ego speeds by repeated evaluation of the situations, the RSS formulas of the
+ * safe distances are inverted analytically: the stated braking pattern distance
+ *   d(v) = v * t + a * t^2 / 2 + (v + a * t)^2 / (2 * b)
+ * is solved for the speed v at which d(v) reaches the available distance. Within the same and opposite direction
+ * situations the limits are exact. Within intersection situations only the upper longitudinal limit is provided
+ * (stopping in front of the intersection or keeping the distance to the vehicle in front); this is conservative, since
+ * the other ways of an intersection to become safe are not considered. The other vehicles keep their states.
+ *
+ * @param[in]  situationSnapshot the situations to calculate the envelope for
+ * @param[out] speedEnvelope the envelope of the safe ego speeds
+ *
+ * @returns false if a failure occurred during calculations (e.g. invalid input), true otherwise
+ */
+bool calculateSpeedEnvelope(SituationSnapshot const &situationSnapshot, SpeedEnvelope &speedEnvelope);
+
+} // namespace situation
+} // namespace ad_rss
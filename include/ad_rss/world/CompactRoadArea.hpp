@@ -0,0 +1,131 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "ad_rss/physics/Distance.hpp"
+#include "ad_rss/world/RoadArea.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace world
+ */
+namespace world {
+
+/*!
+ * @brief Compact representation of a RoadArea
+ *
+ * The lane segments of all road segments are stored row by row in one contiguous array; the road segments are
+ * described by their offsets into that array (compressed sparse row layout). The lengths and widths of the lane
+ * segments are additionally provided as separate columns to enable the dimension calculations to operate on
+ * contiguous memory.
+ *
+ * Use convertToCompactRoadArea() to create the compact representation out of a RoadArea.
+ */
+struct CompactRoadArea
+{
+  /*!
+   * @brief the lane segments of all road segments in consecutive order
+   */
+  std::vector<LaneSegment> laneSegments;
+
+  /*!
+   * @brief the offset of the first lane segment of each road segment within laneSegments
+   *
+   * Contains one additional entry at the end holding the total number of lane segments.
+   */
+  std::vector<std::size_t> roadSegmentOffsets;
+
+  /*!
+   * @brief the minimum length of each lane segment
+   */
+  std::vector<physics::Distance> lengthMinimum;
+
+  /*!
+   * @brief the maximum length of each lane segment
+   */
+  std::vector<physics::Distance> lengthMaximum;
+
+  /*!
+   * @brief the minimum width of each lane segment
+   */
+  std::vector<physics::Distance> widthMinimum;
+
+  /*!
+   * @brief the maximum width of each lane segment
+   */
+  std::vector<physics::Distance> widthMaximum;
+
+  /*!
+   * @returns the number of road segments
+   */
+  std::size_t getNumberOfRoadSegments() const
+  {
+    return roadSegmentOffsets.empty() ? 0u : roadSegmentOffsets.size() - 1u;
+  }
+
+  /*!
+   * @returns the number of lane segments of the given road segment
+   */
+  std::size_t getNumberOfLaneSegments(std::size_t roadSegmentIndex) const
+  {
+    return roadSegmentOffsets[roadSegmentIndex + 1u] - roadSegmentOffsets[roadSegmentIndex];
+  }
+
+  /*!
+   * @returns the index of the given lane segment within the lane segment array and the columns
+   */
+  std::size_t getIndex(std::size_t roadSegmentIndex, std::size_t laneSegmentIndex) const
+  {
+    return roadSegmentOffsets[roadSegmentIndex] + laneSegmentIndex;
+  }
+};
+
+/**
+ * @brief Convert a RoadArea into its compact representation
+ *
+ * @param[in] roadArea the road area to be converted
+ * @param[out] compactRoadArea the compact representation of the road area
+ *
+ * @returns false if an error occurred, true otherwise.
+ */
+bool convertToCompactRoadArea(RoadArea const &roadArea, CompactRoadArea &compactRoadArea);
+
+} // namespace world
+} // namespace ad_rss
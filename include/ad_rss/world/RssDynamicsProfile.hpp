@@ -0,0 +1,178 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include "ad_rss/world/RssDynamics.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace world
+ */
+namespace world {
+
+/*!
+ * @brief Compile-time constant RssDynamics
+ *
+ * A dynamics profile is a type providing the RssDynamics values as static constexpr double members:
+ *
+ *   struct MyProfile
+ *   {
+ *     static constexpr double cLonAccelMax = 3.5;
+ *     static constexpr double cLonBrakeMax = 8.;
+ *     static constexpr double cLonBrakeMin = 4.;
+ *     static constexpr double cLonBrakeMinCorrect = 3.;
+ *     static constexpr double cLatAccelMax = 0.2;
+ *     static constexpr double cLatBrakeMin = 0.8;
+ *     static constexpr double cLateralFluctuationMargin = 0.;
+ *     static constexpr double cResponseTime = 1.;
+ *   };
+ *
+ * The values are given in SI units. RssDynamicsProfileTraits validates the profile at compile time against the
+ * input ranges of RssDynamics and provides the derived constants required by the RSS formulas.
+ */
+template <typename Profile> struct RssDynamicsProfileTraits
+{
+  static_assert((0. <= Profile::cLonAccelMax) && (Profile::cLonAccelMax <= 1e2),
+                "RssDynamicsProfile: alphaLon.accelMax out of valid input range");
+  static_assert((0. < Profile::cLonBrakeMinCorrect) && (Profile::cLonBrakeMinCorrect <= Profile::cLonBrakeMin),
+                "RssDynamicsProfile: alphaLon.brakeMinCorrect out of valid input range");
+  static_assert((Profile::cLonBrakeMin <= Profile::cLonBrakeMax),
+                "RssDynamicsProfile: alphaLon.brakeMin out of valid input range");
+  static_assert((Profile::cLonBrakeMax <= 1e2), "RssDynamicsProfile: alphaLon.brakeMax out of valid input range");
+  static_assert((0. <= Profile::cLatAccelMax) && (Profile::cLatAccelMax <= 1e2),
+                "RssDynamicsProfile: alphaLat.accelMax out of valid input range");
+  static_assert((0. < Profile::cLatBrakeMin) && (Profile::cLatBrakeMin <= 1e2),
+                "RssDynamicsProfile: alphaLat.brakeMin out of valid input range");
+  static_assert((0. <= Profile::cLateralFluctuationMargin) && (Profile::cLateralFluctuationMargin <= 1.),
+                "RssDynamicsProfile: lateralFluctuationMargin out of valid input range");
+  static_assert((0. < Profile::cResponseTime) && (Profile::cResponseTime <= 10.),
+                "RssDynamicsProfile: responseTime out of valid input range");
+
+  /*!
+   * Longitudinal speed gained while accelerating with alphaLon.accelMax during the response time
+   */
+  static constexpr double cLonResponseSpeedOffset = Profile::cLonAccelMax * Profile::cResponseTime;
+
+  /*!
+   * Longitudinal distance covered in addition to the initial speed while accelerating during the response time
+   */
+  static constexpr double cLonResponseDistanceOffset
+    = 0.5 * Profile::cLonAccelMax * Profile::cResponseTime * Profile::cResponseTime;
+
+  /*!
+   * Reciprocal of 2 * alphaLon.brakeMax, the stopping distance factor of the squared speed
+   */
+  static constexpr double cLonBrakeMaxStoppingFactor = 1. / (2. * Profile::cLonBrakeMax);
+
+  /*!
+   * Reciprocal of 2 * alphaLon.brakeMin, the stopping distance factor of the squared speed
+   */
+  static constexpr double cLonBrakeMinStoppingFactor = 1. / (2. * Profile::cLonBrakeMin);
+
+  /*!
+   * Reciprocal of 2 * alphaLon.brakeMinCorrect, the stopping distance factor of the squared speed
+   */
+  static constexpr double cLonBrakeMinCorrectStoppingFactor = 1. / (2. * Profile::cLonBrakeMinCorrect);
+
+  /*!
+   * Lateral speed gained while accelerating with alphaLat.accelMax during the response time
+   */
+  static constexpr double cLatResponseSpeedOffset = Profile::cLatAccelMax * Profile::cResponseTime;
+
+  /*!
+   * Lateral distance covered in addition to the initial speed while accelerating during the response time
+   */
+  static constexpr double cLatResponseDistanceOffset
+    = 0.5 * Profile::cLatAccelMax * Profile::cResponseTime * Profile::cResponseTime;
+
+  /*!
+   * Reciprocal of 2 * alphaLat.brakeMin, the stopping distance factor of the squared speed
+   */
+  static constexpr double cLatBrakeMinStoppingFactor = 1. / (2. * Profile::cLatBrakeMin);
+
+  /*!
+   * @brief check if the given dynamics equal the profile exactly
+   *
+   * @param[in] dynamics the dynamics to check
+   *
+   * @returns true if all values of the dynamics are identical to the profile values
+   */
+  static bool matches(RssDynamics const &dynamics)
+  {
+    return isProfileValue(static_cast<double>(dynamics.responseTime), Profile::cResponseTime)
+      && isProfileValue(static_cast<double>(dynamics.alphaLon.accelMax), Profile::cLonAccelMax)
+      && isProfileValue(static_cast<double>(dynamics.alphaLon.brakeMax), Profile::cLonBrakeMax)
+      && isProfileValue(static_cast<double>(dynamics.alphaLon.brakeMin), Profile::cLonBrakeMin)
+      && isProfileValue(static_cast<double>(dynamics.alphaLon.brakeMinCorrect), Profile::cLonBrakeMinCorrect)
+      && isProfileValue(static_cast<double>(dynamics.alphaLat.accelMax), Profile::cLatAccelMax)
+      && isProfileValue(static_cast<double>(dynamics.alphaLat.brakeMin), Profile::cLatBrakeMin)
+      && isProfileValue(static_cast<double>(dynamics.lateralFluctuationMargin), Profile::cLateralFluctuationMargin);
+  }
+
+private:
+  static bool isProfileValue(double const value, double const profileValue)
+  {
+    // exact comparison without precision: only identical values are covered by the profile
+    return (value <= profileValue) && (value >= profileValue);
+  }
+};
+
+/*!
+ * @brief create the RssDynamics of a dynamics profile
+ *
+ * @returns the RssDynamics holding the values of the profile
+ */
+template <typename Profile> RssDynamics createRssDynamics()
+{
+  // the traits are instantiated to validate the profile
+  static_assert(sizeof(RssDynamicsProfileTraits<Profile>) > 0u, "RssDynamicsProfile: invalid profile");
+  RssDynamics dynamics;
+  dynamics.alphaLon.accelMax = physics::Acceleration(Profile::cLonAccelMax);
+  dynamics.alphaLon.brakeMax = physics::Acceleration(Profile::cLonBrakeMax);
+  dynamics.alphaLon.brakeMin = physics::Acceleration(Profile::cLonBrakeMin);
+  dynamics.alphaLon.brakeMinCorrect = physics::Acceleration(Profile::cLonBrakeMinCorrect);
+  dynamics.alphaLat.accelMax = physics::Acceleration(Profile::cLatAccelMax);
+  dynamics.alphaLat.brakeMin = physics::Acceleration(Profile::cLatBrakeMin);
+  dynamics.lateralFluctuationMargin = physics::Distance(Profile::cLateralFluctuationMargin);
+  dynamics.responseTime = physics::Duration(Profile::cResponseTime);
+  return dynamics;
+}
+
+} // namespace world
+} // namespace ad_rss
@@ -0,0 +1,68 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <string>
+#include "ad_rss/world/WorldModel.hpp"
+
+/*!
+ * \brief check if the given WorldModel is within valid input range by fused checks of all members
+ *
+ * The ranges, the orderings and the validity of all members are checked in place in a single traversal of the world
+ * model, without function calls per member and without any allocation. This is an optional faster alternative to the
+ * generated check; the library itself keeps on using withinValidInputRange().
+ *
+ * \param[in] input the WorldModel as an input value
+ *
+ * \returns \c true if WorldModel is considered to be within the specified input range; the result equals
+ *   withinValidInputRange(::ad_rss::world::WorldModel const &)
+ */
+bool withinValidInputRangeFused(::ad_rss::world::WorldModel const &input);
+
+/*!
+ * \brief check if the given WorldModel is within valid input range by fused checks of all members and report the
+ * member violating the input range
+ *
+ * If the world model is not within valid input range, the members are traversed a second time to locate the first
+ * violation.
+ *
+ * \param[in] input the WorldModel as an input value
+ * \param[out] invalidMember the path of the first member violating the input range, e.g.
+ *   "scenes[1].object.velocity.speedLon". If the order of two members is violated, the path of the second one.
+ *   Empty if the WorldModel is within valid input range.
+ *
+ * \returns \c true if WorldModel is considered to be within the specified input range
+ */
+bool withinValidInputRangeFused(::ad_rss::world::WorldModel const &input, std::string &invalidMember);
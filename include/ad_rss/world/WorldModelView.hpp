@@ -0,0 +1,335 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "ad_rss/physics/TimeIndex.hpp"
+#include "ad_rss/situation/SituationType.hpp"
+#include "ad_rss/world/CompactRoadArea.hpp"
+#include "ad_rss/world/Object.hpp"
+#include "ad_rss/world/RssDynamics.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace world
+ */
+namespace world {
+
+/*!
+ * @brief Read-only view on a contiguous sequence of elements owned by someone else
+ *
+ * The viewed memory has to stay valid as long as the view is in use.
+ */
+template <typename T> class ArrayView
+{
+public:
+  /*!
+   * @brief iterator type of the view
+   */
+  typedef T const *const_iterator;
+
+  /*!
+   * @brief constructor of an empty view
+   */
+  ArrayView() = default;
+
+  /*!
+   * @brief constructor
+   *
+   * @param[in] data pointer to the first element
+   * @param[in] size number of elements
+   */
+  ArrayView(T const *data, std::size_t size)
+    : mData(data)
+    , mSize(size)
+  {
+  }
+
+  /*!
+   * @brief constructor of a view on the elements of a vector
+   */
+  ArrayView(std::vector<T> const &vector)
+    : mData(vector.data())
+    , mSize(vector.size())
+  {
+  }
+
+  /*!
+   * @returns the pointer to the first element
+   */
+  T const *data() const
+  {
+    return mData;
+  }
+
+  /*!
+   * @returns the number of elements
+   */
+  std::size_t size() const
+  {
+    return mSize;
+  }
+
+  /*!
+   * @returns true if the view does not contain any element
+   */
+  bool empty() const
+  {
+    return mSize == 0u;
+  }
+
+  /*!
+   * @returns the element at the given index; the index is not checked
+   */
+  T const &operator[](std::size_t index) const
+  {
+    return mData[index];
+  }
+
+  /*!
+   * @returns the iterator to the first element
+   */
+  const_iterator begin() const
+  {
+    return mData;
+  }
+
+  /*!
+   * @returns the iterator behind the last element
+   */
+  const_iterator end() const
+  {
+    return mData + mSize;
+  }
+
+private:
+  T const *mData{nullptr};
+  std::size_t mSize{0u};
+};
+
+/*!
+ * @brief Read-only view on an object
+ *
+ * Equivalent to Object, but the occupied regions are referenced instead of being owned.
+ */
+struct ObjectView
+{
+  /*!
+   * The unique id of the object
+   */
+  ObjectId objectId;
+
+  /*!
+   * The type of the object
+   */
+  ObjectType objectType{ObjectType::Invalid};
+
+  /*!
+   * The occupied regions of the object
+   */
+  ArrayView<OccupiedRegion> occupiedRegions;
+
+  /*!
+   * The velocity of the object
+   */
+  Velocity velocity;
+};
+
+/*!
+ * @brief Read-only view on a road area
+ *
+ * The road area is described in the compressed sparse row layout of CompactRoadArea: the lane segments of all road
+ * segments in consecutive order and the offset of the first lane segment of each road segment plus one additional
+ * entry holding the total number of lane segments. An empty view describes an empty road area.
+ */
+struct RoadAreaView
+{
+  /*!
+   * The lane segments of all road segments in consecutive order
+   */
+  ArrayView<LaneSegment> laneSegments;
+
+  /*!
+   * The offset of the first lane segment of each road segment within laneSegments plus the end offset
+   */
+  ArrayView<std::size_t> roadSegmentOffsets;
+
+  /*!
+   * @returns the number of road segments
+   */
+  std::size_t getNumberOfRoadSegments() const
+  {
+    return roadSegmentOffsets.empty() ? 0u : roadSegmentOffsets.size() - 1u;
+  }
+
+  /*!
+   * @returns the number of lane segments of the given road segment
+   */
+  std::size_t getNumberOfLaneSegments(std::size_t roadSegmentIndex) const
+  {
+    return roadSegmentOffsets[roadSegmentIndex + 1u] - roadSegmentOffsets[roadSegmentIndex];
+  }
+
+  /*!
+   * @returns the index of the given lane segment within laneSegments
+   */
+  std::size_t getIndex(std::size_t roadSegmentIndex, std::size_t laneSegmentIndex) const
+  {
+    return roadSegmentOffsets[roadSegmentIndex] + laneSegmentIndex;
+  }
+};
+
+/*!
+ * @brief Read-only view on a scene
+ *
+ * Equivalent to Scene, but all data is referenced instead of being owned.
+ */
+struct SceneView
+{
+  /*!
+   * The type of the current situation
+   */
+  situation::SituationType situationType{situation::SituationType::NotRelevant};
+
+  /*!
+   * The ego vehicle
+   */
+  ObjectView egoVehicle;
+
+  /*!
+   * The object
+   */
+  ObjectView object;
+
+  /*!
+   * The RSS dynamics of the object; must not be nullptr
+   */
+  RssDynamics const *objectRssDynamics{nullptr};
+
+  /*!
+   * The intersecting road; empty if there is no intersecting road
+   */
+  RoadAreaView intersectingRoad;
+
+  /*!
+   * The road of the ego vehicle
+   */
+  RoadAreaView egoVehicleRoad;
+};
+
+/*!
+ * @brief Read-only view on a world model
+ *
+ * Equivalent to WorldModel, but the scenes are referenced instead of being owned.
+ */
+struct WorldModelView
+{
+  /*!
+   * The time index the world model is referring to
+   */
+  physics::TimeIndex timeIndex{0u};
+
+  /*!
+   * The RSS dynamics of the ego vehicle
+   */
+  RssDynamics egoVehicleRssDynamics;
+
+  /*!
+   * The scenes of the world model
+   */
+  ArrayView<SceneView> scenes;
+};
+
+/**
+ * @brief Create the view on an object
+ *
+ * @param[in] object the object to be viewed
+ *
+ * @returns the view on the object
+ */
+ObjectView createObjectView(Object const &object);
+
+/**
+ * @brief Create the view on a compact road area
+ *
+ * @param[in] roadArea the road area to be viewed
+ *
+ * @returns the view on the road area
+ */
+RoadAreaView createRoadAreaView(CompactRoadArea const &roadArea);
+
+} // namespace world
+} // namespace ad_rss
+
+/*!
+ * \brief check if the given ObjectView is within valid input range
+ *
+ * \param[in] input the ObjectView as an input value
+ *
+ * \returns \c true if ObjectView is considered to be within the specified input range
+ */
+bool withinValidInputRange(::ad_rss::world::ObjectView const &input);
+
+/*!
+ * \brief check if the given RoadAreaView is within valid input range
+ *
+ * \param[in] input the RoadAreaView as an input value
+ *
+ * \returns \c true if RoadAreaView is considered to be within the specified input range and the road segment offsets
+ *   are consistent with the lane segments
+ */
+bool withinValidInputRange(::ad_rss::world::RoadAreaView const &input);
+
+/*!
+ * \brief check if the given SceneView is within valid input range
+ *
+ * \param[in] input the SceneView as an input value
+ *
+ * \returns \c true if SceneView is considered to be within the specified input range
+ */
+bool withinValidInputRange(::ad_rss::world::SceneView const &input);
+
+/*!
+ * \brief check if the given WorldModelView is within valid input range
+ *
+ * \param[in] input the WorldModelView as an input value
+ *
+ * \returns \c true if WorldModelView is considered to be within the specified input range
+ */
+bool withinValidInputRange(::ad_rss::world::WorldModelView const &input);
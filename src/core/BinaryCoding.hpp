@@ -0,0 +1,211 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/*
+ * Platform independent binary coding shared by the checkpoints and the recordings: unsigned integers are stored as
+ * variable length quantities (7 bits per byte, least significant group first), differences as zig-zag coded variable
+ * length quantities and floating point values as differences of their bit patterns, which is lossless.
+ */
+
+/*!
+ * @brief Appends binary coded values to a byte buffer
+ */
+class BinaryEncoder
+{
+public:
+  explicit BinaryEncoder(std::vector<std::uint8_t> &buffer)
+    : mBuffer(buffer)
+  {
+  }
+
+  void writeByte(std::uint8_t const value)
+  {
+    mBuffer.push_back(value);
+  }
+
+  void writeUnsigned(std::uint64_t value)
+  {
+    while (value >= 0x80u)
+    {
+      mBuffer.push_back(static_cast<std::uint8_t>((value & 0x7Fu) | 0x80u));
+      value >>= 7u;
+    }
+    mBuffer.push_back(static_cast<std::uint8_t>(value));
+  }
+
+  /**
+   * @brief write the difference of the value to the reference; small differences in both directions are short
+   */
+  void writeDelta(std::uint64_t const value, std::uint64_t const reference)
+  {
+    std::uint64_t const difference = value - reference;
+    writeUnsigned((difference << 1u) ^ (std::uint64_t(0u) - (difference >> 63u)));
+  }
+
+  void writeDelta(double const value, double const reference)
+  {
+    writeDelta(getBits(value), getBits(reference));
+  }
+
+  static std::uint64_t getBits(double const value)
+  {
+    std::uint64_t bits = 0u;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+  }
+
+private:
+  std::vector<std::uint8_t> &mBuffer;
+};
+
+/*!
+ * @brief Reads binary coded values from a byte range; all functions return false if the data is exhausted or invalid
+ */
+class BinaryDecoder
+{
+public:
+  BinaryDecoder(std::uint8_t const *data, std::size_t const size)
+    : mCurrent(data)
+    , mEnd(data + size)
+  {
+  }
+
+  bool atEnd() const
+  {
+    return mCurrent == mEnd;
+  }
+
+  std::size_t getRemainingSize() const
+  {
+    return static_cast<std::size_t>(mEnd - mCurrent);
+  }
+
+  bool readByte(std::uint8_t &value)
+  {
+    if (atEnd())
+    {
+      return false;
+    }
+    value = *mCurrent;
+    ++mCurrent;
+    return true;
+  }
+
+  bool readUnsigned(std::uint64_t &value)
+  {
+    value = 0u;
+    for (std::uint32_t shift = 0u; shift < 64u; shift += 7u)
+    {
+      std::uint8_t byte = 0u;
+      if (!readByte(byte))
+      {
+        return false;
+      }
+      std::uint64_t const bits = static_cast<std::uint64_t>(byte & 0x7Fu);
+      if ((shift == 63u) && (bits > 1u))
+      {
+        // value exceeds 64 bits
+        return false;
+      }
+      value |= (bits << shift);
+      if ((byte & 0x80u) == 0u)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief read the number of elements of a container
+   *
+   * Each element occupies at least one byte, so larger numbers cannot be valid and are rejected before allocating.
+   */
+  bool readCount(std::size_t &count)
+  {
+    std::uint64_t value = 0u;
+    if (!readUnsigned(value) || (value > static_cast<std::uint64_t>(getRemainingSize())))
+    {
+      return false;
+    }
+    count = static_cast<std::size_t>(value);
+    return true;
+  }
+
+  bool readDelta(std::uint64_t const reference, std::uint64_t &value)
+  {
+    std::uint64_t coded = 0u;
+    if (!readUnsigned(coded))
+    {
+      return false;
+    }
+    std::uint64_t const difference = (coded >> 1u) ^ (std::uint64_t(0u) - (coded & 1u));
+    value = reference + difference;
+    return true;
+  }
+
+  bool readDelta(double const reference, double &value)
+  {
+    std::uint64_t bits = 0u;
+    if (!readDelta(BinaryEncoder::getBits(reference), bits))
+    {
+      return false;
+    }
+    std::memcpy(&value, &bits, sizeof(value));
+    return true;
+  }
+
+private:
+  std::uint8_t const *mCurrent;
+  std::uint8_t const *const mEnd;
+};
+
+} // namespace core
+} // namespace ad_rss
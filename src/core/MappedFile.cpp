@@ -0,0 +1,154 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "core/MappedFile.hpp"
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define AD_RSS_MAPPED_FILE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define AD_RSS_MAPPED_FILE_MMAP 0
+#endif
+
+namespace ad_rss {
+namespace core {
+
+MappedFile::MappedFile()
+  : mData(nullptr)
+  , mSize(0u)
+  , mMapping(nullptr)
+{
+}
+
+MappedFile::~MappedFile()
+{
+  close();
+}
+
+bool MappedFile::open(std::string const &fileName)
+{
+  close();
+  bool const result = map(fileName) || read(fileName);
+  if (!result)
+  {
+    close();
+  }
+  return result;
+}
+
+void MappedFile::close()
+{
+#if AD_RSS_MAPPED_FILE_MMAP
+  if (mMapping != nullptr)
+  {
+    ::munmap(mMapping, mSize);
+  }
+#endif
+  mMapping = nullptr;
+  mData = nullptr;
+  mSize = 0u;
+  std::vector<std::uint64_t>().swap(mBuffer);
+}
+
+std::uint8_t const *MappedFile::getData() const
+{
+  return mData;
+}
+
+std::size_t MappedFile::getSize() const
+{
+  return mSize;
+}
+
+#if AD_RSS_MAPPED_FILE_MMAP
+bool MappedFile::map(std::string const &fileName)
+{
+  int const fileDescriptor = ::open(fileName.c_str(), O_RDONLY);
+  if (fileDescriptor < 0)
+  {
+    return false;
+  }
+
+  struct stat fileStatus;
+  if ((::fstat(fileDescriptor, &fileStatus) == 0) && (fileStatus.st_size > 0))
+  {
+    std::size_t const size = static_cast<std::size_t>(fileStatus.st_size);
+    void *mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    if (mapping != MAP_FAILED)
+    {
+      // the files are read front to back
+      ::madvise(mapping, size, MADV_SEQUENTIAL);
+      mMapping = mapping;
+      mData = static_cast<std::uint8_t const *>(mapping);
+      mSize = size;
+    }
+  }
+  // the mapping stays valid after closing the file
+  ::close(fileDescriptor);
+  return mData != nullptr;
+}
+#else
+bool MappedFile::map(std::string const &)
+{
+  return false;
+}
+#endif
+
+bool MappedFile::read(std::string const &fileName)
+{
+  std::ifstream stream(fileName, std::ios::in | std::ios::binary | std::ios::ate);
+  if (!stream.is_open())
+  {
+    return false;
+  }
+  std::streamoff const size = stream.tellg();
+  if (size <= 0)
+  {
+    return false;
+  }
+  // the buffer of 64 bit words provides the alignment of the data
+  mBuffer.resize((static_cast<std::size_t>(size) + sizeof(std::uint64_t) - 1u) / sizeof(std::uint64_t));
+  stream.seekg(0, std::ios::beg);
+  if (!stream.read(reinterpret_cast<char *>(mBuffer.data()), static_cast<std::streamsize>(size)))
+  {
+    return false;
+  }
+  mData = reinterpret_cast<std::uint8_t const *>(mBuffer.data());
+  mSize = static_cast<std::size_t>(size);
+  return true;
+}
+
+} // namespace core
+} // namespace ad_rss
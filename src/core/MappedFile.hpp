@@ -0,0 +1,109 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief MappedFile
+ *
+ * Read-only access to the content of a file. On POSIX systems the file is memory mapped; otherwise, or if the mapping
+ * fails, the file is read into an internal buffer. In both cases the data is 8 byte aligned.
+ */
+class MappedFile
+{
+public:
+  /**
+   * @brief constructor
+   */
+  MappedFile();
+
+  /**
+   * @brief destructor; closes the file
+   */
+  ~MappedFile();
+
+  MappedFile(MappedFile const &other) = delete;
+  MappedFile &operator=(MappedFile const &other) = delete;
+
+  /**
+   * @brief open the file; an already open file is closed before
+   *
+   * @param [in] fileName - the name of the file
+   *
+   * @returns true if the file could be opened and isn't empty, false otherwise.
+   */
+  bool open(std::string const &fileName);
+
+  /**
+   * @brief close the file; the data provided before becomes invalid
+   */
+  void close();
+
+  /**
+   * @returns the begin of the file content, nullptr if no file is open
+   */
+  std::uint8_t const *getData() const;
+
+  /**
+   * @returns the size of the file content in bytes
+   */
+  std::size_t getSize() const;
+
+private:
+  bool map(std::string const &fileName);
+  bool read(std::string const &fileName);
+
+  std::uint8_t const *mData;
+  std::size_t mSize;
+  void *mMapping;
+  std::vector<std::uint64_t> mBuffer;
+};
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,309 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/core/RssAllPairsCheck.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <unordered_set>
+#include "ad_rss/world/ObjectValidInputRange.hpp"
+#include "ad_rss/world/RoadAreaValidInputRange.hpp"
+#include "ad_rss/world/RssDynamicsValidInputRange.hpp"
+#include "core/RssThreadPool.hpp"
+#include "situation/RssFormulas.hpp"
+#include "world/RssSituationCoordinateSystemConversion.hpp"
+#include "world/SceneReference.hpp"
+
+namespace ad_rss {
+namespace core {
+
+namespace {
+
+// the number of pairs evaluated within a single task of the thread pool
+std::size_t const cPairsPerTask = 64u;
+
+/**
+ * @brief the position of a participant viewed in the opposite direction of the road area
+ */
+world::ObjectDimensions getMirroredDimensions(world::ObjectDimensions const &dimensions)
+{
+  world::ObjectDimensions mirroredDimensions = dimensions;
+  mirroredDimensions.longitudinalDimensions.minimum = -dimensions.longitudinalDimensions.maximum;
+  mirroredDimensions.longitudinalDimensions.maximum = -dimensions.longitudinalDimensions.minimum;
+  mirroredDimensions.lateralDimensions.minimum = -dimensions.lateralDimensions.maximum;
+  mirroredDimensions.lateralDimensions.maximum = -dimensions.lateralDimensions.minimum;
+  mirroredDimensions.onPositiveLane = dimensions.onNegativeLane;
+  mirroredDimensions.onNegativeLane = dimensions.onPositiveLane;
+  return mirroredDimensions;
+}
+
+/**
+ * @brief the maximum longitudinal distance a participant covers until standing still
+ *
+ * Upper bound of the contribution of the participant to any longitudinal safe distance: the participant accelerates
+ * with its maximum acceleration during the response time and brakes afterwards with its weakest braking deceleration.
+ */
+bool calculateReach(RssAllPairsParticipant const &participant, double &reach)
+{
+  world::LongitudinalRssAccelerationValues const &alphaLon = participant.rssDynamics.alphaLon;
+  physics::Acceleration const weakestBraking
+    = std::min(physics::Acceleration(std::fabs(static_cast<double>(alphaLon.brakeMin))),
+               physics::Acceleration(std::fabs(static_cast<double>(alphaLon.brakeMinCorrect))));
+  physics::Distance distanceOffset(0.);
+  bool const result = situation::calculateDistanceOffsetAfterStatedBrakingPattern(
+    physics::CoordinateSystemAxis::Longitudinal,
+    physics::Speed(std::fabs(static_cast<double>(participant.object.velocity.speedLon))),
+    participant.rssDynamics.responseTime,
+    alphaLon.accelMax,
+    weakestBraking,
+    distanceOffset);
+  reach = static_cast<double>(distanceOffset);
+  return result;
+}
+
+} // namespace
+
+RssAllPairsCheck::RssAllPairsCheck(std::size_t const numberOfThreads)
+  : mNextSituationId(1u)
+  , mNumberOfPrunedPairs(0u)
+{
+  try
+  {
+    mThreadPool = std::unique_ptr<RssThreadPool>(new RssThreadPool(numberOfThreads));
+  }
+  catch (...)
+  {
+    mThreadPool = nullptr;
+  }
+}
+
+RssAllPairsCheck::~RssAllPairsCheck()
+{
+}
+
+std::size_t RssAllPairsCheck::getNumberOfEvaluatedPairs() const
+{
+  return mCandidatePairs.size();
+}
+
+std::size_t RssAllPairsCheck::getNumberOfPrunedPairs() const
+{
+  return mNumberOfPrunedPairs;
+}
+
+bool RssAllPairsCheck::checkAllPairs(RssAllPairsWorldModel const &worldModel,
+                                     std::vector<RssAllPairsResult> &pairResults)
+{
+  if (!mThreadPool)
+  {
+    return false;
+  }
+
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    mCandidatePairs.clear();
+    mNumberOfPrunedPairs = 0u;
+    pairResults.clear();
+
+    std::unordered_set<world::ObjectId> objectIds;
+    result = withinValidInputRange(worldModel.roadArea)
+      && mSituationChecking.startSituationChecks(worldModel.timeIndex, mSituationCheckingState);
+    for (auto const &participant : worldModel.participants)
+    {
+      result = result && withinValidInputRange(participant.object)
+        && withinValidInputRange(participant.rssDynamics)
+        && objectIds.insert(participant.object.objectId).second;
+    }
+
+    // the positions of all participants are calculated within a single pass over the road area
+    std::vector<world::ObjectView> objectViews;
+    std::vector<world::ObjectView const *> objects;
+    std::vector<world::ObjectDimensions> dimensions;
+    if (result)
+    {
+      objectViews.reserve(worldModel.participants.size());
+      for (auto const &participant : worldModel.participants)
+      {
+        objectViews.push_back(world::createObjectView(participant.object));
+        objects.push_back(&objectViews.back());
+      }
+      world::RoadAreaReference roadAreaReference;
+      roadAreaReference.roadArea = &worldModel.roadArea;
+      result = objects.empty() || world::calculateObjectDimensions(objects, roadAreaReference, dimensions);
+    }
+
+    result = result && findCandidatePairs(worldModel, dimensions);
+    if (result)
+    {
+      updateSituationIds(worldModel);
+    }
+
+    if (result)
+    {
+      std::vector<world::ObjectDimensions> mirroredDimensions;
+      for (auto const &participantDimensions : dimensions)
+      {
+        mirroredDimensions.push_back(getMirroredDimensions(participantDimensions));
+      }
+
+      pairResults.resize(mCandidatePairs.size());
+      std::size_t const numberOfTasks = (mCandidatePairs.size() + cPairsPerTask - 1u) / cPairsPerTask;
+      result = mThreadPool->run(
+        numberOfTasks,
+        [this, &worldModel, &objectViews, &dimensions, &mirroredDimensions, &pairResults](std::size_t const taskIndex,
+                                                                                          std::size_t) {
+          // the non intersection checks do not access the checking state
+          RssSituationCheckingState checkingState = mSituationCheckingState;
+          std::size_t const end = std::min(mCandidatePairs.size(), (taskIndex + 1u) * cPairsPerTask);
+          for (std::size_t p = taskIndex * cPairsPerTask; p < end; ++p)
+          {
+            std::size_t const egoIndex = mCandidatePairs[p].first;
+            std::size_t const otherIndex = mCandidatePairs[p].second;
+            RssAllPairsParticipant const &ego = worldModel.participants[egoIndex];
+            RssAllPairsParticipant const &other = worldModel.participants[otherIndex];
+
+            // the situation coordinate system follows the driving direction of the ego participant
+            std::vector<world::ObjectDimensions> const &view
+              = ego.drivesInRoadDirection ? dimensions : mirroredDimensions;
+            RssAllPairsResult &pairResult = pairResults[p];
+            pairResult.egoParticipant = egoIndex;
+            pairResult.otherParticipant = otherIndex;
+            pairResult.situationType = (ego.drivesInRoadDirection == other.drivesInRoadDirection)
+              ? situation::SituationType::SameDirection
+              : situation::SituationType::OppositeDirection;
+
+            situation::Situation pairSituation;
+            if (!mSituationExtraction.convertObjectsToSituation(mCandidateSituationIds[p],
+                                                                pairResult.situationType,
+                                                                objectViews[egoIndex],
+                                                                ego.rssDynamics,
+                                                                view[egoIndex],
+                                                                objectViews[otherIndex],
+                                                                other.rssDynamics,
+                                                                view[otherIndex],
+                                                                pairSituation)
+                || !mSituationChecking.checkSituation(pairSituation, checkingState, pairResult.rssState))
+            {
+              return false;
+            }
+          }
+          return true;
+        });
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  if (!result)
+  {
+    pairResults.clear();
+  }
+  return result;
+}
+
+bool RssAllPairsCheck::findCandidatePairs(RssAllPairsWorldModel const &worldModel,
+                                          std::vector<world::ObjectDimensions> const &dimensions)
+{
+  std::size_t const numberOfParticipants = worldModel.participants.size();
+  mReach.resize(numberOfParticipants);
+  double maximumReach = 0.;
+  for (std::size_t i = 0u; i < numberOfParticipants; ++i)
+  {
+    if (!calculateReach(worldModel.participants[i], mReach[i]))
+    {
+      return false;
+    }
+    maximumReach = std::max(maximumReach, mReach[i]);
+  }
+
+  // sweep along the longitudinal axis of the road area
+  std::vector<std::size_t> order(numberOfParticipants);
+  for (std::size_t i = 0u; i < numberOfParticipants; ++i)
+  {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [&dimensions](std::size_t const left, std::size_t const right) {
+    return dimensions[left].longitudinalDimensions.minimum < dimensions[right].longitudinalDimensions.minimum;
+  });
+
+  for (std::size_t a = 0u; a < numberOfParticipants; ++a)
+  {
+    std::size_t const i = order[a];
+    double const lonMaximum = static_cast<double>(dimensions[i].longitudinalDimensions.maximum);
+    double const sweepEnd = lonMaximum + mReach[i] + maximumReach;
+    for (std::size_t b = a + 1u; b < numberOfParticipants; ++b)
+    {
+      std::size_t const j = order[b];
+      double const lonMinimum = static_cast<double>(dimensions[j].longitudinalDimensions.minimum);
+      if (lonMinimum > sweepEnd)
+      {
+        break;
+      }
+      // participant j does not start before participant i, so this is the gap between both
+      double const gap = std::max(0., lonMinimum - lonMaximum);
+      if (gap <= mReach[i] + mReach[j])
+      {
+        mCandidatePairs.push_back(std::make_pair(std::min(i, j), std::max(i, j)));
+      }
+    }
+  }
+  std::sort(mCandidatePairs.begin(), mCandidatePairs.end());
+
+  std::size_t const numberOfPairs
+    = (numberOfParticipants > 1u) ? ((numberOfParticipants * (numberOfParticipants - 1u)) / 2u) : 0u;
+  mNumberOfPrunedPairs = numberOfPairs - mCandidatePairs.size();
+  return true;
+}
+
+void RssAllPairsCheck::updateSituationIds(RssAllPairsWorldModel const &worldModel)
+{
+  // pairs keep their situation id as long as they are evaluated in consecutive calls
+  std::map<std::pair<world::ObjectId, world::ObjectId>, situation::SituationId> situationIds;
+  mCandidateSituationIds.resize(mCandidatePairs.size());
+  for (std::size_t p = 0u; p < mCandidatePairs.size(); ++p)
+  {
+    world::ObjectId const firstId = worldModel.participants[mCandidatePairs[p].first].object.objectId;
+    world::ObjectId const secondId = worldModel.participants[mCandidatePairs[p].second].object.objectId;
+    std::pair<world::ObjectId, world::ObjectId> const key(std::min(firstId, secondId), std::max(firstId, secondId));
+    auto const previous = mSituationIds.find(key);
+    situation::SituationId const situationId
+      = (previous != mSituationIds.end()) ? previous->second : mNextSituationId++;
+    situationIds[key] = situationId;
+    mCandidateSituationIds[p] = situationId;
+  }
+  mSituationIds.swap(situationIds);
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -30,21 +30,26 @@
 // ----------------- END LICENSE BLOCK -----------------------------------
 
 #include "ad_rss/core/RssCheck.hpp"
+#include "ad_rss/core/RssCycleStateSerialization.hpp"
 #include "ad_rss/core/RssResponseResolving.hpp"
 #include "ad_rss/core/RssResponseTransformation.hpp"
 #include "ad_rss/core/RssSituationChecking.hpp"
 #include "ad_rss/core/RssSituationExtraction.hpp"
+#include "ad_rss/situation/RssSituationCriticality.hpp"
 
 namespace ad_rss {
 
 namespace core {
 
-RssCheck::RssCheck()
+RssCheck::RssCheck(ExecutionMode const executionMode, EvaluationMode const evaluationMode)
+  : mExecutionMode(executionMode)
+  , mEvaluationMode(evaluationMode)
+  , mSkippedSituationPolicy(SkippedSituationPolicy::BrakeMin)
 {
   try
   {
     mResponseResolving = std::unique_ptr<RssResponseResolving>(new RssResponseResolving());
-    mSituationChecking = std::unique_ptr<RssSituationChecking>(new RssSituationChecking());
+    mSituationChecking = std::unique_ptr<RssSituationChecking>(new RssSituationChecking(mEvaluationMode));
     mSituationExtraction = std::unique_ptr<RssSituationExtraction>(new RssSituationExtraction());
   }
   catch (...)
@@ -59,8 +64,318 @@ RssCheck::~RssCheck()
 {
 }
 
-bool RssCheck::calculateAccelerationRestriction(world::WorldModel const &worldModel,
-                                                world::AccelerationRestriction &accelerationRestriction)
+RssCheck::ExecutionMode RssCheck::getExecutionMode() const
+{
+  return mExecutionMode;
+}
+
+RssCheck::EvaluationMode RssCheck::getEvaluationMode() const
+{
+  return mEvaluationMode;
+}
+
+RssCheck::SkippedSituationPolicy RssCheck::getSkippedSituationPolicy() const
+{
+  return mSkippedSituationPolicy;
+}
+
+void RssCheck::setSkippedSituationPolicy(SkippedSituationPolicy const skippedSituationPolicy)
+{
+  mSkippedSituationPolicy = skippedSituationPolicy;
+}
+
+bool RssCheck::calculateRssStateInformation(situation::Situation const &situation, state::RssState &rssState) const
+{
+  if (!static_cast<bool>(mSituationChecking))
+  {
+    return false;
+  }
+  return mSituationChecking->calculateRssStateInformation(situation, rssState);
+}
+
+bool RssCheck::setFormulaProvider(situation::RssFormulaProvider const &formulaProvider)
+{
+  if (!static_cast<bool>(mSituationChecking))
+  {
+    return false;
+  }
+  mSituationChecking->setFormulaProvider(formulaProvider);
+  return true;
+}
+
+bool RssCheck::extractSituations(world::WorldModel const &worldModel,
+                                 RssCycleState &cycleState,
+                                 situation::SituationSnapshot &situationSnapshot) const
+{
+  return mSituationExtraction->extractSituations(worldModel, cycleState.situationIdState, situationSnapshot);
+}
+
+bool RssCheck::extractSituations(RegisteredRoadWorldModel const &worldModel,
+                                 RssCycleState &cycleState,
+                                 situation::SituationSnapshot &situationSnapshot) const
+{
+  return mSituationExtraction->extractSituations(
+    worldModel, mRoadRegistry, cycleState.situationIdState, situationSnapshot);
+}
+
+bool RssCheck::extractSituations(world::WorldModelView const &worldModel,
+                                 RssCycleState &cycleState,
+                                 situation::SituationSnapshot &situationSnapshot) const
+{
+  return mSituationExtraction->extractSituations(worldModel, cycleState.situationIdState, situationSnapshot);
+}
+
+bool RssCheck::groupScenesBySituation(world::WorldModel const &worldModel,
+                                      RssCycleState &cycleState,
+                                      RssSituationExtraction::SituationScenesVector &situationScenesVector) const
+{
+  return mSituationExtraction->groupScenesBySituation(worldModel, cycleState.situationIdState, situationScenesVector);
+}
+
+bool RssCheck::groupScenesBySituation(RegisteredRoadWorldModel const &worldModel,
+                                      RssCycleState &cycleState,
+                                      RssSituationExtraction::SituationScenesVector &situationScenesVector) const
+{
+  return mSituationExtraction->groupScenesBySituation(
+    worldModel, mRoadRegistry, cycleState.situationIdState, situationScenesVector);
+}
+
+bool RssCheck::groupScenesBySituation(world::WorldModelView const &worldModel,
+                                      RssCycleState &cycleState,
+                                      RssSituationExtraction::SituationScenesVector &situationScenesVector) const
+{
+  return mSituationExtraction->groupScenesBySituation(worldModel, cycleState.situationIdState, situationScenesVector);
+}
+
+bool RssCheck::extractSituation(world::WorldModel const &worldModel,
+                                RssSituationExtraction::SituationScenes const &situationScenes,
+                                situation::Situation &situation) const
+{
+  return mSituationExtraction->extractSituation(worldModel, situationScenes, situation);
+}
+
+bool RssCheck::extractSituation(RegisteredRoadWorldModel const &worldModel,
+                                RssSituationExtraction::SituationScenes const &situationScenes,
+                                situation::Situation &situation) const
+{
+  return mSituationExtraction->extractSituation(worldModel, mRoadRegistry, situationScenes, situation);
+}
+
+bool RssCheck::extractSituation(world::WorldModelView const &worldModel,
+                                RssSituationExtraction::SituationScenes const &situationScenes,
+                                situation::Situation &situation) const
+{
+  return mSituationExtraction->extractSituation(worldModel, situationScenes, situation);
+}
+
+template <class WorldModelType>
+bool RssCheck::calculateProperResponseStaged(WorldModelType const &worldModel,
+                                             RssCycleState &cycleState,
+                                             state::ProperResponse &properResponse,
+                                             situation::SituationSnapshot *situationSnapshot,
+                                             state::RssStateSnapshot *rssStateSnapshot) const
+{
+  situation::SituationSnapshot localSituationSnapshot;
+  situation::SituationSnapshot &usedSituationSnapshot
+    = (situationSnapshot != nullptr) ? *situationSnapshot : localSituationSnapshot;
+  bool result = extractSituations(worldModel, cycleState, usedSituationSnapshot);
+
+  if (result)
+  {
+    result = resolveProperResponse(usedSituationSnapshot, cycleState, properResponse, rssStateSnapshot);
+  }
+
+  return result;
+}
+
+bool RssCheck::resolveProperResponse(situation::SituationSnapshot const &situationSnapshot,
+                                     RssCycleState &cycleState,
+                                     state::ProperResponse &properResponse,
+                                     state::RssStateSnapshot *rssStateSnapshot) const
+{
+  state::RssStateSnapshot localRssStateSnapshot;
+  state::RssStateSnapshot &usedRssStateSnapshot
+    = (rssStateSnapshot != nullptr) ? *rssStateSnapshot : localRssStateSnapshot;
+  bool result
+    = mSituationChecking->checkSituations(situationSnapshot, cycleState.situationCheckingState, usedRssStateSnapshot);
+
+  if (result)
+  {
+    result = mResponseResolving->provideProperResponse(
+      usedRssStateSnapshot, cycleState.responseResolvingState, properResponse);
+  }
+
+  return result;
+}
+
+template <class WorldModelType>
+bool RssCheck::calculateProperResponseFused(WorldModelType const &worldModel,
+                                            RssCycleState &cycleState,
+                                            state::ProperResponse &properResponse,
+                                            situation::SituationSnapshot *situationSnapshot,
+                                            state::RssStateSnapshot *rssStateSnapshot) const
+{
+  RssSituationExtraction::SituationScenesVector situationScenesVector;
+  bool result = groupScenesBySituation(worldModel, cycleState, situationScenesVector);
+
+  if (result)
+  {
+    result = mSituationChecking->startSituationChecks(worldModel.timeIndex, cycleState.situationCheckingState);
+  }
+
+  RssResponseResolvingState nextResponseResolvingState;
+  if (result)
+  {
+    result = mResponseResolving->startProperResponse(worldModel.timeIndex, nextResponseResolvingState, properResponse);
+  }
+
+  if (result)
+  {
+    if (situationSnapshot != nullptr)
+    {
+      situationSnapshot->timeIndex = worldModel.timeIndex;
+      situationSnapshot->situations.clear();
+    }
+    if (rssStateSnapshot != nullptr)
+    {
+      rssStateSnapshot->timeIndex = worldModel.timeIndex;
+      rssStateSnapshot->individualResponses.clear();
+    }
+
+    // extract, check and resolve each situation while its data is still at hand
+    for (auto situationScenes = situationScenesVector.begin();
+         result && (situationScenes != situationScenesVector.end());
+         ++situationScenes)
+    {
+      situation::Situation situation;
+      result = extractSituation(worldModel, *situationScenes, situation);
+
+      state::RssState rssState;
+      result = result && mSituationChecking->checkSituation(situation, cycleState.situationCheckingState, rssState);
+      result = result
+        && mResponseResolving->addRssState(
+             rssState, cycleState.responseResolvingState, nextResponseResolvingState, properResponse);
+
+      if (result && (situationSnapshot != nullptr))
+      {
+        situationSnapshot->situations.push_back(situation);
+      }
+      if (result && (rssStateSnapshot != nullptr))
+      {
+        rssStateSnapshot->individualResponses.push_back(rssState);
+      }
+    }
+
+    if (result)
+    {
+      cycleState.responseResolvingState = std::move(nextResponseResolvingState);
+    }
+  }
+
+  return result;
+}
+
+bool RssCheck::calculateProperResponseWithinBudget(world::WorldModel const &worldModel,
+                                                  std::chrono::steady_clock::duration const &timeBudget,
+                                                  RssCycleState &cycleState,
+                                                  state::ProperResponse &properResponse,
+                                                  BudgetStatistics &budgetStatistics) const
+{
+  std::chrono::steady_clock::time_point const startTime = std::chrono::steady_clock::now();
+  budgetStatistics = BudgetStatistics();
+
+  situation::SituationSnapshot situationSnapshot;
+  bool result = extractSituations(worldModel, cycleState, situationSnapshot);
+
+  std::vector<std::size_t> situationOrder;
+  if (result)
+  {
+    result = situation::orderSituationsByCriticality(situationSnapshot, situationOrder);
+  }
+
+  if (result)
+  {
+    result = mSituationChecking->startSituationChecks(situationSnapshot.timeIndex, cycleState.situationCheckingState);
+  }
+
+  // the situations are checked in the order of their criticality
+  std::vector<state::RssState> rssStates(situationSnapshot.situations.size());
+  std::vector<bool> evaluated(situationSnapshot.situations.size(), false);
+  for (auto situationIndex = situationOrder.begin(); result && (situationIndex != situationOrder.end());
+       ++situationIndex)
+  {
+    situation::Situation const &situation = situationSnapshot.situations[*situationIndex];
+    if ((std::chrono::steady_clock::now() - startTime) < timeBudget)
+    {
+      result = mSituationChecking->checkSituation(
+        situation, cycleState.situationCheckingState, rssStates[*situationIndex]);
+      evaluated[*situationIndex] = true;
+      budgetStatistics.evaluatedSituations++;
+    }
+    else
+    {
+      result = mSituationChecking->skipSituation(situation, cycleState.situationCheckingState);
+      budgetStatistics.skippedSituations++;
+    }
+  }
+
+  RssResponseResolvingState nextResponseResolvingState;
+  if (result)
+  {
+    result = mResponseResolving->startProperResponse(
+      situationSnapshot.timeIndex, nextResponseResolvingState, properResponse);
+  }
+
+  if (result)
+  {
+    state::LongitudinalResponse const skippedLongitudinalResponse = state::LongitudinalResponse::BrakeMin;
+    state::LateralResponse const skippedLateralResponse = (mSkippedSituationPolicy == SkippedSituationPolicy::BrakeMin)
+      ? state::LateralResponse::BrakeMin
+      : state::LateralResponse::None;
+
+    // the responses are resolved in the order of the situations to provide the same results as the Staged mode
+    for (std::size_t i = 0u; result && (i < situationSnapshot.situations.size()); ++i)
+    {
+      if (evaluated[i])
+      {
+        result = mResponseResolving->addRssState(
+          rssStates[i], cycleState.responseResolvingState, nextResponseResolvingState, properResponse);
+      }
+      else
+      {
+        result = mResponseResolving->addSkippedSituation(situationSnapshot.situations[i].situationId,
+                                                         situationSnapshot.situations[i].objectId,
+                                                         skippedLongitudinalResponse,
+                                                         skippedLateralResponse,
+                                                         cycleState.responseResolvingState,
+                                                         nextResponseResolvingState,
+                                                         properResponse);
+      }
+    }
+    if (result)
+    {
+      cycleState.responseResolvingState = std::move(nextResponseResolvingState);
+    }
+  }
+
+  if (result)
+  {
+    budgetStatistics.isPartial = (budgetStatistics.skippedSituations > 0u);
+  }
+  else
+  {
+    budgetStatistics = BudgetStatistics();
+  }
+  return result;
+}
+
+template <class WorldModelType>
+bool RssCheck::calculateAccelerationRestrictionT(WorldModelType const &worldModel,
+                                                 RssCycleState &cycleState,
+                                                 world::AccelerationRestriction &accelerationRestriction,
+                                                 state::ProperResponse &properResponse,
+                                                 situation::SituationSnapshot *situationSnapshot,
+                                                 state::RssStateSnapshot *rssStateSnapshot) const
 {
   bool result = false;
   // global try catch block to ensure this library call doesn't throw an exception
@@ -72,24 +387,243 @@ bool RssCheck::calculateAccelerationRestriction(world::WorldModel const &worldMo
       return false;
     }
 
-    situation::SituationSnapshot situationSnapshot;
-    result = mSituationExtraction->extractSituations(worldModel, situationSnapshot);
+    if (mExecutionMode == ExecutionMode::Fused)
+    {
+      result
+        = calculateProperResponseFused(worldModel, cycleState, properResponse, situationSnapshot, rssStateSnapshot);
+    }
+    else
+    {
+      result
+        = calculateProperResponseStaged(worldModel, cycleState, properResponse, situationSnapshot, rssStateSnapshot);
+    }
 
-    state::RssStateSnapshot rssStateSnapshot;
     if (result)
     {
-      result = mSituationChecking->checkSituations(situationSnapshot, rssStateSnapshot);
+      // the world model is already validated by the situation extraction
+      result = RssResponseTransformation::transformProperResponse(
+        worldModel.timeIndex, worldModel.egoVehicleRssDynamics, properResponse, accelerationRestriction);
+    }
+  }
+  // LCOV_EXCL_START: unreachable code, keep to be on the safe side
+  catch (...)
+  {
+    result = false;
+  }
+  // LCOV_EXCL_STOP: unreachable code, keep to be on the safe side
+  return result;
+}
+
+template <class WorldModelType>
+bool RssCheck::calculateNextCycleStateT(WorldModelType const &worldModel,
+                                        RssCycleState const &cycleState,
+                                        RssCycleState &nextCycleState,
+                                        world::AccelerationRestriction &accelerationRestriction,
+                                        state::ProperResponse &properResponse,
+                                        situation::SituationSnapshot *situationSnapshot,
+                                        state::RssStateSnapshot *rssStateSnapshot) const
+{
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    if (&nextCycleState != &cycleState)
+    {
+      nextCycleState = cycleState;
+    }
+    result = calculateAccelerationRestrictionT(
+      worldModel, nextCycleState, accelerationRestriction, properResponse, situationSnapshot, rssStateSnapshot);
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+bool RssCheck::calculateAccelerationRestriction(world::WorldModel const &worldModel,
+                                                world::AccelerationRestriction &accelerationRestriction)
+{
+  state::ProperResponse properResponse;
+  return calculateAccelerationRestriction(worldModel, accelerationRestriction, properResponse);
+}
+
+bool RssCheck::calculateAccelerationRestriction(world::WorldModel const &worldModel,
+                                                world::AccelerationRestriction &accelerationRestriction,
+                                                state::ProperResponse &properResponse,
+                                                situation::SituationSnapshot *situationSnapshot,
+                                                state::RssStateSnapshot *rssStateSnapshot)
+{
+  return calculateAccelerationRestrictionT(
+    worldModel, mCycleState, accelerationRestriction, properResponse, situationSnapshot, rssStateSnapshot);
+}
+
+bool RssCheck::calculateAccelerationRestriction(RegisteredRoadWorldModel const &worldModel,
+                                                world::AccelerationRestriction &accelerationRestriction)
+{
+  state::ProperResponse properResponse;
+  return calculateAccelerationRestriction(worldModel, accelerationRestriction, properResponse);
+}
+
+bool RssCheck::calculateAccelerationRestriction(RegisteredRoadWorldModel const &worldModel,
+                                                world::AccelerationRestriction &accelerationRestriction,
+                                                state::ProperResponse &properResponse,
+                                                situation::SituationSnapshot *situationSnapshot,
+                                                state::RssStateSnapshot *rssStateSnapshot)
+{
+  return calculateAccelerationRestrictionT(
+    worldModel, mCycleState, accelerationRestriction, properResponse, situationSnapshot, rssStateSnapshot);
+}
+
+bool RssCheck::calculateAccelerationRestriction(world::WorldModelView const &worldModel,
+                                                world::AccelerationRestriction &accelerationRestriction)
+{
+  state::ProperResponse properResponse;
+  return calculateAccelerationRestriction(worldModel, accelerationRestriction, properResponse);
+}
+
+bool RssCheck::calculateAccelerationRestriction(world::WorldModelView const &worldModel,
+                                                world::AccelerationRestriction &accelerationRestriction,
+                                                state::ProperResponse &properResponse,
+                                                situation::SituationSnapshot *situationSnapshot,
+                                                state::RssStateSnapshot *rssStateSnapshot)
+{
+  return calculateAccelerationRestrictionT(
+    worldModel, mCycleState, accelerationRestriction, properResponse, situationSnapshot, rssStateSnapshot);
+}
+
+bool RssCheck::calculateAccelerationRestriction(world::WorldModel const &worldModel,
+                                                RssCycleState const &cycleState,
+                                                RssCycleState &nextCycleState,
+                                                world::AccelerationRestriction &accelerationRestriction,
+                                                state::ProperResponse &properResponse,
+                                                situation::SituationSnapshot *situationSnapshot,
+                                                state::RssStateSnapshot *rssStateSnapshot) const
+{
+  return calculateNextCycleStateT(worldModel,
+                                  cycleState,
+                                  nextCycleState,
+                                  accelerationRestriction,
+                                  properResponse,
+                                  situationSnapshot,
+                                  rssStateSnapshot);
+}
+
+bool RssCheck::calculateAccelerationRestriction(RegisteredRoadWorldModel const &worldModel,
+                                                RssCycleState const &cycleState,
+                                                RssCycleState &nextCycleState,
+                                                world::AccelerationRestriction &accelerationRestriction,
+                                                state::ProperResponse &properResponse,
+                                                situation::SituationSnapshot *situationSnapshot,
+                                                state::RssStateSnapshot *rssStateSnapshot) const
+{
+  return calculateNextCycleStateT(worldModel,
+                                  cycleState,
+                                  nextCycleState,
+                                  accelerationRestriction,
+                                  properResponse,
+                                  situationSnapshot,
+                                  rssStateSnapshot);
+}
+
+bool RssCheck::calculateAccelerationRestriction(world::WorldModelView const &worldModel,
+                                                RssCycleState const &cycleState,
+                                                RssCycleState &nextCycleState,
+                                                world::AccelerationRestriction &accelerationRestriction,
+                                                state::ProperResponse &properResponse,
+                                                situation::SituationSnapshot *situationSnapshot,
+                                                state::RssStateSnapshot *rssStateSnapshot) const
+{
+  return calculateNextCycleStateT(worldModel,
+                                  cycleState,
+                                  nextCycleState,
+                                  accelerationRestriction,
+                                  properResponse,
+                                  situationSnapshot,
+                                  rssStateSnapshot);
+}
+
+bool RssCheck::extractSituationSnapshot(world::WorldModel const &worldModel,
+                                        RssCycleState &cycleState,
+                                        situation::SituationSnapshot &situationSnapshot) const
+{
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    if (!static_cast<bool>(mSituationExtraction))
+    {
+      return false;
     }
 
-    state::ProperResponse properResponse;
+    result = extractSituations(worldModel, cycleState, situationSnapshot);
+  }
+  // LCOV_EXCL_START: unreachable code, keep to be on the safe side
+  catch (...)
+  {
+    result = false;
+  }
+  // LCOV_EXCL_STOP: unreachable code, keep to be on the safe side
+  return result;
+}
+
+bool RssCheck::checkSituationSnapshot(situation::SituationSnapshot const &situationSnapshot,
+                                      world::RssDynamics const &egoVehicleRssDynamics,
+                                      RssCycleState &cycleState,
+                                      world::AccelerationRestriction &accelerationRestriction,
+                                      state::ProperResponse &properResponse,
+                                      state::RssStateSnapshot *rssStateSnapshot) const
+{
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    if (!static_cast<bool>(mResponseResolving) || !static_cast<bool>(mSituationChecking))
+    {
+      return false;
+    }
+
+    result = resolveProperResponse(situationSnapshot, cycleState, properResponse, rssStateSnapshot);
+
     if (result)
     {
-      result = mResponseResolving->provideProperResponse(rssStateSnapshot, properResponse);
+      result = RssResponseTransformation::transformProperResponse(
+        situationSnapshot.timeIndex, egoVehicleRssDynamics, properResponse, accelerationRestriction);
     }
+  }
+  // LCOV_EXCL_START: unreachable code, keep to be on the safe side
+  catch (...)
+  {
+    result = false;
+  }
+  // LCOV_EXCL_STOP: unreachable code, keep to be on the safe side
+  return result;
+}
+
+bool RssCheck::calculateAccelerationRestrictionWithinBudget(world::WorldModel const &worldModel,
+                                                            std::chrono::steady_clock::duration const &timeBudget,
+                                                            world::AccelerationRestriction &accelerationRestriction,
+                                                            state::ProperResponse &properResponse,
+                                                            BudgetStatistics &budgetStatistics)
+{
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    budgetStatistics = BudgetStatistics();
+    if (!static_cast<bool>(mResponseResolving) || !static_cast<bool>(mSituationChecking)
+        || !static_cast<bool>(mSituationExtraction))
+    {
+      return false;
+    }
+
+    result = calculateProperResponseWithinBudget(worldModel, timeBudget, mCycleState, properResponse, budgetStatistics);
 
     if (result)
     {
-      result = RssResponseTransformation::transformProperResponse(worldModel, properResponse, accelerationRestriction);
+      // the world model is already validated by the situation extraction
+      result = RssResponseTransformation::transformProperResponse(
+        worldModel.timeIndex, worldModel.egoVehicleRssDynamics, properResponse, accelerationRestriction);
     }
   }
   // LCOV_EXCL_START: unreachable code, keep to be on the safe side
@@ -98,8 +632,42 @@ bool RssCheck::calculateAccelerationRestriction(world::WorldModel const &worldMo
     result = false;
   }
   // LCOV_EXCL_STOP: unreachable code, keep to be on the safe side
+  if (!result)
+  {
+    budgetStatistics = BudgetStatistics();
+  }
   return result;
 }
 
+RssCycleState const &RssCheck::getCycleState() const
+{
+  return mCycleState;
+}
+
+void RssCheck::setCycleState(RssCycleState const &cycleState)
+{
+  mCycleState = cycleState;
+}
+
+bool RssCheck::saveCheckpoint(std::vector<std::uint8_t> &checkpoint) const
+{
+  return serializeCycleState(mCycleState, checkpoint);
+}
+
+bool RssCheck::restoreCheckpoint(std::vector<std::uint8_t> const &checkpoint)
+{
+  return deserializeCycleState(checkpoint, mCycleState);
+}
+
+RssRoadRegistry &RssCheck::getRoadRegistry()
+{
+  return mRoadRegistry;
+}
+
+RssRoadRegistry const &RssCheck::getRoadRegistry() const
+{
+  return mRoadRegistry;
+}
+
 } // namespace core
 } // namespace ad_rss
@@ -0,0 +1,295 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/core/RssCheckAsync.hpp"
+#include <algorithm>
+
+namespace ad_rss {
+namespace core {
+
+RssCheckAsync::RssCheckAsync(std::size_t const queueCapacity,
+                             BackpressurePolicy const backpressurePolicy,
+                             RssCheck::EvaluationMode const evaluationMode)
+  : mQueueCapacity(std::max(queueCapacity, std::size_t(1u)))
+  , mBackpressurePolicy(backpressurePolicy)
+  , mRssCheck(RssCheck::ExecutionMode::Staged, evaluationMode)
+  , mPendingRequests(0u)
+  , mDroppedWorldModels(0u)
+  , mStopped(false)
+{
+  try
+  {
+    mExtractionThread = std::thread(&RssCheckAsync::extractionWorker, this);
+    mCheckingThread = std::thread(&RssCheckAsync::checkingWorker, this);
+  }
+  catch (...)
+  {
+    stop();
+  }
+}
+
+RssCheckAsync::~RssCheckAsync()
+{
+  stop();
+}
+
+RssCheckAsync::BackpressurePolicy RssCheckAsync::getBackpressurePolicy() const
+{
+  return mBackpressurePolicy;
+}
+
+std::size_t RssCheckAsync::getNumberOfDroppedWorldModels() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mDroppedWorldModels;
+}
+
+bool RssCheckAsync::submit(world::WorldModel const &worldModel, std::future<Result> &result)
+{
+  bool submitted = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    Request request;
+    request.hasPromise = true;
+    std::future<Result> future = request.promise.get_future();
+    submitted = submitRequest(worldModel, request);
+    if (submitted)
+    {
+      result = std::move(future);
+    }
+  }
+  catch (...)
+  {
+    submitted = false;
+  }
+  return submitted;
+}
+
+bool RssCheckAsync::submit(world::WorldModel const &worldModel, ResultCallback const &callback)
+{
+  bool submitted = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    Request request;
+    request.callback = callback;
+    submitted = submitRequest(worldModel, request);
+  }
+  catch (...)
+  {
+    submitted = false;
+  }
+  return submitted;
+}
+
+bool RssCheckAsync::submitRequest(world::WorldModel const &worldModel, Request &request)
+{
+  SubmittedRequest submittedRequest;
+  submittedRequest.worldModel = worldModel;
+  submittedRequest.request = std::move(request);
+
+  std::deque<SubmittedRequest> droppedRequests;
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    if (mBackpressurePolicy == BackpressurePolicy::Block)
+    {
+      mSubmissionNotFull.wait(lock, [this] { return mStopped || (mSubmissionQueue.size() < mQueueCapacity); });
+    }
+    if (mStopped)
+    {
+      return false;
+    }
+    while (mSubmissionQueue.size() >= mQueueCapacity)
+    {
+      droppedRequests.push_back(std::move(mSubmissionQueue.front()));
+      mSubmissionQueue.pop_front();
+      mDroppedWorldModels++;
+    }
+    mSubmissionQueue.push_back(std::move(submittedRequest));
+    mPendingRequests++;
+  }
+  mSubmissionNotEmpty.notify_one();
+
+  Result droppedResult;
+  droppedResult.status = ResultStatus::Dropped;
+  for (auto &droppedRequest : droppedRequests)
+  {
+    finishRequest(droppedRequest.request, droppedResult);
+  }
+  return true;
+}
+
+void RssCheckAsync::extractionWorker()
+{
+  while (true)
+  {
+    SubmittedRequest submittedRequest;
+    {
+      std::unique_lock<std::mutex> lock(mMutex);
+      mSubmissionNotEmpty.wait(lock, [this] { return mStopped || !mSubmissionQueue.empty(); });
+      if (mStopped)
+      {
+        return;
+      }
+      submittedRequest = std::move(mSubmissionQueue.front());
+      mSubmissionQueue.pop_front();
+    }
+    mSubmissionNotFull.notify_one();
+
+    // the extraction only continues the situation id assignment of the cycle state
+    ExtractedRequest extractedRequest;
+    extractedRequest.extractionResult = mRssCheck.extractSituationSnapshot(
+      submittedRequest.worldModel, mCycleState, extractedRequest.situationSnapshot);
+    extractedRequest.egoVehicleRssDynamics = submittedRequest.worldModel.egoVehicleRssDynamics;
+    extractedRequest.request = std::move(submittedRequest.request);
+
+    {
+      // a single extracted world model is buffered: the extraction runs at most one world model ahead
+      std::unique_lock<std::mutex> lock(mMutex);
+      mExtractedNotFull.wait(lock, [this] { return mStopped || mExtractedQueue.empty(); });
+      mExtractedQueue.push_back(std::move(extractedRequest));
+      if (mStopped)
+      {
+        return;
+      }
+    }
+    mExtractedNotEmpty.notify_one();
+  }
+}
+
+void RssCheckAsync::checkingWorker()
+{
+  while (true)
+  {
+    ExtractedRequest extractedRequest;
+    {
+      std::unique_lock<std::mutex> lock(mMutex);
+      mExtractedNotEmpty.wait(lock, [this] { return mStopped || !mExtractedQueue.empty(); });
+      if (mStopped)
+      {
+        return;
+      }
+      extractedRequest = std::move(mExtractedQueue.front());
+      mExtractedQueue.pop_front();
+    }
+    mExtractedNotFull.notify_one();
+
+    // the checks only continue the histories of the situation checks and the response resolving of the cycle state
+    Result result;
+    result.status = ResultStatus::Failed;
+    if (extractedRequest.extractionResult
+        && mRssCheck.checkSituationSnapshot(extractedRequest.situationSnapshot,
+                                            extractedRequest.egoVehicleRssDynamics,
+                                            mCycleState,
+                                            result.checkResult.accelerationRestriction,
+                                            result.checkResult.properResponse))
+    {
+      result.status = ResultStatus::Success;
+      result.checkResult.timeIndex = extractedRequest.situationSnapshot.timeIndex;
+    }
+    finishRequest(extractedRequest.request, result);
+  }
+}
+
+void RssCheckAsync::finishRequest(Request &request, Result const &result)
+{
+  try
+  {
+    if (request.hasPromise)
+    {
+      request.promise.set_value(result);
+    }
+    if (static_cast<bool>(request.callback))
+    {
+      request.callback(result);
+    }
+  }
+  catch (...)
+  {
+    // exceptions of the callbacks must not terminate the processing
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mPendingRequests--;
+  }
+  mIdle.notify_all();
+}
+
+void RssCheckAsync::waitUntilIdle()
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  mIdle.wait(lock, [this] { return mPendingRequests == 0u; });
+}
+
+void RssCheckAsync::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mStopped = true;
+  }
+  mSubmissionNotEmpty.notify_all();
+  mSubmissionNotFull.notify_all();
+  mExtractedNotEmpty.notify_all();
+  mExtractedNotFull.notify_all();
+
+  if (mExtractionThread.joinable())
+  {
+    mExtractionThread.join();
+  }
+  if (mCheckingThread.joinable())
+  {
+    mCheckingThread.join();
+  }
+
+  std::deque<SubmittedRequest> submissionQueue;
+  std::deque<ExtractedRequest> extractedQueue;
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    submissionQueue.swap(mSubmissionQueue);
+    extractedQueue.swap(mExtractedQueue);
+  }
+
+  Result stoppedResult;
+  stoppedResult.status = ResultStatus::Stopped;
+  for (auto &extractedRequest : extractedQueue)
+  {
+    finishRequest(extractedRequest.request, stoppedResult);
+  }
+  for (auto &submittedRequest : submissionQueue)
+  {
+    finishRequest(submittedRequest.request, stoppedResult);
+  }
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,121 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/core/RssCheckBatch.hpp"
+#include "core/RssThreadPool.hpp"
+
+namespace ad_rss {
+namespace core {
+
+RssCheckBatch::RssCheckBatch(std::size_t const numberOfThreads)
+{
+  try
+  {
+    mThreadPool = std::unique_ptr<RssThreadPool>(new RssThreadPool(numberOfThreads));
+  }
+  catch (...)
+  {
+    mThreadPool = nullptr;
+  }
+}
+
+RssCheckBatch::~RssCheckBatch()
+{
+}
+
+std::size_t RssCheckBatch::getNumberOfThreads() const
+{
+  return mThreadPool ? mThreadPool->getNumberOfThreads() : 0u;
+}
+
+std::size_t RssCheckBatch::getNumberOfInstances() const
+{
+  return mInstances.size();
+}
+
+bool RssCheckBatch::removeInstance(std::uint64_t const instanceId)
+{
+  return mInstances.erase(instanceId) > 0u;
+}
+
+bool RssCheckBatch::calculateAccelerationRestrictions(std::vector<RssCheckBatchEntry> const &entries,
+                                                      std::vector<RssCheckBatchResult> &results)
+{
+  if (!mThreadPool)
+  {
+    return false;
+  }
+
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    std::unordered_map<std::uint64_t, std::size_t> entryOfInstance;
+    for (std::size_t i = 0u; i < entries.size(); ++i)
+    {
+      if ((entries[i].worldModel == nullptr)
+          || !entryOfInstance.insert(std::make_pair(entries[i].instanceId, i)).second)
+      {
+        return false;
+      }
+    }
+
+    // resolve the instances in advance, the instance map must not be modified while the batch is processed
+    mEntryInstances.resize(entries.size());
+    for (std::size_t i = 0u; i < entries.size(); ++i)
+    {
+      std::unique_ptr<RssCheck> &instance = mInstances[entries[i].instanceId];
+      if (!instance)
+      {
+        instance = std::unique_ptr<RssCheck>(new RssCheck());
+      }
+      mEntryInstances[i] = instance.get();
+    }
+    results.assign(entries.size(), RssCheckBatchResult());
+
+    // the failure of an entry is reported within its result
+    mThreadPool->run(entries.size(), [this, &entries, &results](std::size_t const entryIndex, std::size_t) {
+      RssCheckBatchResult &entryResult = results[entryIndex];
+      entryResult.isValid = mEntryInstances[entryIndex]->calculateAccelerationRestriction(
+        *entries[entryIndex].worldModel, entryResult.accelerationRestriction, entryResult.properResponse);
+      return true;
+    });
+    result = true;
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,147 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/core/RssCheckResultPublisher.hpp"
+#include <limits>
+
+namespace ad_rss {
+namespace core {
+
+static_assert(ATOMIC_CHAR_LOCK_FREE == 2, "RssCheckResultPublisher requires lock-free atomic exchange");
+
+namespace {
+
+bool isTimeIndexIncreasing(physics::TimeIndex const &previousTimeIndex, physics::TimeIndex const &nextTimeIndex)
+{
+  if (previousTimeIndex == 0u)
+  {
+    // nothing published yet
+    return true;
+  }
+  // consider the overflow of the time index
+  physics::TimeIndex const deltaTimeIndex = nextTimeIndex - previousTimeIndex;
+  return (deltaTimeIndex != 0u) && (deltaTimeIndex < (std::numeric_limits<physics::TimeIndex>::max() / 2));
+}
+
+} // namespace
+
+RssCheckResultPublisher::RssCheckResultPublisher()
+  : mMiddleState(1u)
+  , mBackIndex(0u)
+  , mFrontIndex(2u)
+  , mFrontValid(false)
+  , mPublishedTimeIndex(0u)
+{
+}
+
+bool RssCheckResultPublisher::publish(world::AccelerationRestriction const &accelerationRestriction,
+                                      state::ProperResponse const &properResponse)
+{
+  if ((accelerationRestriction.timeIndex == 0u) || (accelerationRestriction.timeIndex != properResponse.timeIndex)
+      || !isTimeIndexIncreasing(mPublishedTimeIndex, accelerationRestriction.timeIndex))
+  {
+    return false;
+  }
+
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    RssCheckResult &backBuffer = mBuffers[mBackIndex];
+    backBuffer.timeIndex = accelerationRestriction.timeIndex;
+    backBuffer.accelerationRestriction = accelerationRestriction;
+    backBuffer.properResponse = properResponse;
+
+    // release the back buffer to the reader, the previous middle buffer becomes the new back buffer
+    uint8_t const previousMiddleState
+      = mMiddleState.exchange(static_cast<uint8_t>(mBackIndex | cNewResultFlag), std::memory_order_acq_rel);
+    mBackIndex = static_cast<uint8_t>(previousMiddleState & cIndexMask);
+    mPublishedTimeIndex = accelerationRestriction.timeIndex;
+    result = true;
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+RssCheckResult const *RssCheckResultPublisher::acquireLatest()
+{
+  if ((mMiddleState.load(std::memory_order_acquire) & cNewResultFlag) != 0u)
+  {
+    // acquire the latest middle buffer, the previous front buffer is handed back to the publisher
+    uint8_t const previousMiddleState = mMiddleState.exchange(mFrontIndex, std::memory_order_acq_rel);
+    mFrontIndex = static_cast<uint8_t>(previousMiddleState & cIndexMask);
+    mFrontValid = true;
+  }
+
+  if (!mFrontValid)
+  {
+    return nullptr;
+  }
+  return &mBuffers[mFrontIndex];
+}
+
+bool RssCheckResultPublisher::readLatest(RssCheckResult &result)
+{
+  RssCheckResult const *const latestResult = acquireLatest();
+  if (latestResult == nullptr)
+  {
+    return false;
+  }
+
+  bool readResult = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    result = *latestResult;
+    readResult = true;
+  }
+  catch (...)
+  {
+    readResult = false;
+  }
+  return readResult;
+}
+
+bool RssCheckResultPublisher::hasNewResult() const
+{
+  return (mMiddleState.load(std::memory_order_acquire) & cNewResultFlag) != 0u;
+}
+
+physics::TimeIndex RssCheckResultPublisher::getPublishedTimeIndex() const
+{
+  return mPublishedTimeIndex;
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,350 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/core/RssCycleStateSerialization.hpp"
+#include <limits>
+#include <stdexcept>
+#include "ad_rss/situation/SituationTypeValidInputRange.hpp"
+#include "core/BinaryCoding.hpp"
+
+namespace ad_rss {
+namespace core {
+
+namespace {
+
+/*!
+ * @brief identification of the checkpoint format and its version
+ */
+std::uint8_t const cCheckpointMagic[] = {'R', 'S', 'S', 'C'};
+std::uint8_t const cCheckpointVersion = 1u;
+
+std::uint8_t const cLongitudinalSafeFlag = 1u;
+std::uint8_t const cLateralSafeFlag = 2u;
+
+class CheckpointWriter : public BinaryEncoder
+{
+public:
+  explicit CheckpointWriter(std::vector<std::uint8_t> &checkpoint)
+    : BinaryEncoder(checkpoint)
+  {
+  }
+
+  void writeSituationType(situation::SituationType const situationType)
+  {
+    writeUnsigned(static_cast<std::uint32_t>(situationType));
+  }
+
+  void writeLaneSegmentIds(std::set<world::LaneSegmentId> const &laneSegmentIds)
+  {
+    writeUnsigned(laneSegmentIds.size());
+    world::LaneSegmentId previousId = 0u;
+    for (auto const laneSegmentId : laneSegmentIds)
+    {
+      writeUnsigned(laneSegmentId - previousId);
+      previousId = laneSegmentId;
+    }
+  }
+
+  void writeIntersectionStates(RssIntersectionCheckingState::IntersectionStateMap const &intersectionStates)
+  {
+    writeUnsigned(intersectionStates.size());
+    situation::SituationId previousId = 0u;
+    for (auto const &intersectionState : intersectionStates)
+    {
+      writeUnsigned(intersectionState.first - previousId);
+      writeUnsigned(static_cast<std::uint32_t>(intersectionState.second));
+      previousId = intersectionState.first;
+    }
+  }
+};
+
+class CheckpointReader : public BinaryDecoder
+{
+public:
+  CheckpointReader(std::uint8_t const *data, std::size_t const size)
+    : BinaryDecoder(data, size)
+  {
+  }
+
+  /**
+   * @brief read a key stored as difference to its predecessor
+   *
+   * @param [in] strictlyIncreasing - if true, equal keys are rejected (maps and sets)
+   */
+  bool readKey(std::uint64_t const previousKey, bool const strictlyIncreasing, bool const isFirst, std::uint64_t &key)
+  {
+    std::uint64_t delta = 0u;
+    if (!readUnsigned(delta) || (delta > std::numeric_limits<std::uint64_t>::max() - previousKey))
+    {
+      return false;
+    }
+    if (strictlyIncreasing && !isFirst && (delta == 0u))
+    {
+      return false;
+    }
+    key = previousKey + delta;
+    return true;
+  }
+
+  bool readSituationType(situation::SituationType &situationType)
+  {
+    std::uint64_t value = 0u;
+    if (!readUnsigned(value) || (value > static_cast<std::uint64_t>(std::numeric_limits<std::int32_t>::max())))
+    {
+      return false;
+    }
+    situationType = static_cast<situation::SituationType>(value);
+    return withinValidInputRange(situationType);
+  }
+
+  bool readLaneSegmentIds(std::set<world::LaneSegmentId> &laneSegmentIds)
+  {
+    std::size_t count = 0u;
+    if (!readCount(count))
+    {
+      return false;
+    }
+    world::LaneSegmentId laneSegmentId = 0u;
+    for (std::size_t i = 0u; i < count; ++i)
+    {
+      if (!readKey(laneSegmentId, true, i == 0u, laneSegmentId))
+      {
+        return false;
+      }
+      laneSegmentIds.emplace_hint(laneSegmentIds.end(), laneSegmentId);
+    }
+    return true;
+  }
+
+  bool readIntersectionStates(RssIntersectionCheckingState::IntersectionStateMap &intersectionStates)
+  {
+    std::size_t count = 0u;
+    if (!readCount(count))
+    {
+      return false;
+    }
+    situation::SituationId situationId = 0u;
+    for (std::size_t i = 0u; i < count; ++i)
+    {
+      std::uint64_t state = 0u;
+      if (!readKey(situationId, true, i == 0u, situationId) || !readUnsigned(state)
+          || (state > static_cast<std::uint64_t>(situation::IntersectionState::NoTimeOverlap)))
+      {
+        return false;
+      }
+      intersectionStates.emplace_hint(
+        intersectionStates.end(), situationId, static_cast<situation::IntersectionState>(state));
+    }
+    return true;
+  }
+};
+
+void writeSituationIdState(CheckpointWriter &writer, RssSituationIdState const &situationIdState)
+{
+  writer.writeUnsigned(situationIdState.currentTime);
+  writer.writeUnsigned(situationIdState.lastTime);
+  writer.writeUnsigned(situationIdState.nextSituationId);
+  writer.writeUnsigned(situationIdState.situationData.size());
+  world::ObjectId previousObjectId = 0u;
+  for (auto const &situationData : situationIdState.situationData)
+  {
+    writer.writeUnsigned(situationData.first - previousObjectId);
+    writer.writeUnsigned(situationData.second.timeIndex);
+    writer.writeSituationType(situationData.second.situationType);
+    writer.writeUnsigned(situationData.second.situationId);
+    writer.writeLaneSegmentIds(situationData.second.egoVehicleIntersectionArea);
+    writer.writeLaneSegmentIds(situationData.second.objectIntersectionArea);
+    previousObjectId = situationData.first;
+  }
+}
+
+bool readSituationIdState(CheckpointReader &reader, RssSituationIdState &situationIdState)
+{
+  std::size_t count = 0u;
+  if (!reader.readUnsigned(situationIdState.currentTime) || !reader.readUnsigned(situationIdState.lastTime)
+      || !reader.readUnsigned(situationIdState.nextSituationId) || !reader.readCount(count))
+  {
+    return false;
+  }
+  world::ObjectId objectId = 0u;
+  for (std::size_t i = 0u; i < count; ++i)
+  {
+    RssSituationIdState::SituationData situationData;
+    // multiple situations per object are allowed
+    if (!reader.readKey(objectId, false, i == 0u, objectId) || !reader.readUnsigned(situationData.timeIndex)
+        || !reader.readSituationType(situationData.situationType) || !reader.readUnsigned(situationData.situationId)
+        || !reader.readLaneSegmentIds(situationData.egoVehicleIntersectionArea)
+        || !reader.readLaneSegmentIds(situationData.objectIntersectionArea))
+    {
+      return false;
+    }
+    // inserting at the end keeps the order of the situations of the same object
+    situationIdState.situationData.emplace_hint(situationIdState.situationData.end(), objectId, situationData);
+  }
+  return true;
+}
+
+void writeSituationCheckingState(CheckpointWriter &writer, RssSituationCheckingState const &situationCheckingState)
+{
+  writer.writeUnsigned(situationCheckingState.currentTimeIndex);
+  writer.writeUnsigned(situationCheckingState.intersectionCheckingState.currentTimeIndex);
+  writer.writeIntersectionStates(situationCheckingState.intersectionCheckingState.lastSafeStates);
+  writer.writeIntersectionStates(situationCheckingState.intersectionCheckingState.currentSafeStates);
+}
+
+bool readSituationCheckingState(CheckpointReader &reader, RssSituationCheckingState &situationCheckingState)
+{
+  return reader.readUnsigned(situationCheckingState.currentTimeIndex)
+    && reader.readUnsigned(situationCheckingState.intersectionCheckingState.currentTimeIndex)
+    && reader.readIntersectionStates(situationCheckingState.intersectionCheckingState.lastSafeStates)
+    && reader.readIntersectionStates(situationCheckingState.intersectionCheckingState.currentSafeStates);
+}
+
+void writeResponseResolvingState(CheckpointWriter &writer, RssResponseResolvingState const &responseResolvingState)
+{
+  writer.writeUnsigned(responseResolvingState.statesBeforeDangerThresholdTime.size());
+  situation::SituationId previousId = 0u;
+  for (auto const &safeState : responseResolvingState.statesBeforeDangerThresholdTime)
+  {
+    writer.writeUnsigned(safeState.first - previousId);
+    std::uint8_t flags = 0u;
+    if (safeState.second.longitudinalSafe)
+    {
+      flags = static_cast<std::uint8_t>(flags | cLongitudinalSafeFlag);
+    }
+    if (safeState.second.lateralSafe)
+    {
+      flags = static_cast<std::uint8_t>(flags | cLateralSafeFlag);
+    }
+    writer.writeByte(flags);
+    previousId = safeState.first;
+  }
+}
+
+bool readResponseResolvingState(CheckpointReader &reader, RssResponseResolvingState &responseResolvingState)
+{
+  std::size_t count = 0u;
+  if (!reader.readCount(count))
+  {
+    return false;
+  }
+  situation::SituationId situationId = 0u;
+  for (std::size_t i = 0u; i < count; ++i)
+  {
+    std::uint8_t flags = 0u;
+    if (!reader.readKey(situationId, true, i == 0u, situationId) || !reader.readByte(flags)
+        || ((flags & ~(cLongitudinalSafeFlag | cLateralSafeFlag)) != 0))
+    {
+      return false;
+    }
+    RssResponseResolvingState::RssSafeState safeState;
+    safeState.longitudinalSafe = ((flags & cLongitudinalSafeFlag) != 0u);
+    safeState.lateralSafe = ((flags & cLateralSafeFlag) != 0u);
+    responseResolvingState.statesBeforeDangerThresholdTime.emplace_hint(
+      responseResolvingState.statesBeforeDangerThresholdTime.end(), situationId, safeState);
+  }
+  return true;
+}
+
+} // namespace
+
+bool serializeCycleState(RssCycleState const &cycleState, std::vector<std::uint8_t> &checkpoint)
+{
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    checkpoint.clear();
+    CheckpointWriter writer(checkpoint);
+    for (auto const magic : cCheckpointMagic)
+    {
+      writer.writeByte(magic);
+    }
+    writer.writeByte(cCheckpointVersion);
+    writeSituationIdState(writer, cycleState.situationIdState);
+    writeSituationCheckingState(writer, cycleState.situationCheckingState);
+    writeResponseResolvingState(writer, cycleState.responseResolvingState);
+    result = true;
+  }
+  catch (...)
+  {
+    checkpoint.clear();
+    result = false;
+  }
+  return result;
+}
+
+bool deserializeCycleState(std::uint8_t const *data, std::size_t const size, RssCycleState &cycleState)
+{
+  if ((data == nullptr) && (size > 0u))
+  {
+    return false;
+  }
+
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    CheckpointReader reader(data, size);
+    result = true;
+    for (auto const magic : cCheckpointMagic)
+    {
+      std::uint8_t byte = 0u;
+      result = result && reader.readByte(byte) && (byte == magic);
+    }
+    std::uint8_t version = 0u;
+    result = result && reader.readByte(version) && (version == cCheckpointVersion);
+
+    RssCycleState restoredCycleState;
+    result = result && readSituationIdState(reader, restoredCycleState.situationIdState);
+    result = result && readSituationCheckingState(reader, restoredCycleState.situationCheckingState);
+    result = result && readResponseResolvingState(reader, restoredCycleState.responseResolvingState);
+    result = result && reader.atEnd();
+
+    if (result)
+    {
+      cycleState = std::move(restoredCycleState);
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+bool deserializeCycleState(std::vector<std::uint8_t> const &checkpoint, RssCycleState &cycleState)
+{
+  return deserializeCycleState(checkpoint.data(), checkpoint.size(), cycleState);
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,1079 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/core/RssDeltaRecording.hpp"
+#include <cstring>
+#include <limits>
+#include <map>
+#include <type_traits>
+#include "core/BinaryCoding.hpp"
+
+namespace ad_rss {
+namespace core {
+
+namespace {
+
+std::uint8_t const cRecordingMagic[] = {'R', 'S', 'S', 'D'};
+std::uint8_t const cRecordingVersion = 1u;
+std::uint8_t const cIndexMagic[] = {'R', 'S', 'S', 'I'};
+/*!
+ * @brief the trailer consists of the file offset of the index record (8 bytes, little endian) and the index magic
+ */
+std::size_t const cTrailerSize = 12u;
+
+std::uint8_t const cKeyframeRecord = 1u;
+std::uint8_t const cDeltaFrameRecord = 2u;
+std::uint8_t const cIndexRecord = 3u;
+
+/*!
+ * @brief flags of the changed parts of a scene with respect to its reference scene
+ */
+std::uint8_t const cSituationTypeChanged = 0x01u;
+std::uint8_t const cEgoVehicleChanged = 0x02u;
+std::uint8_t const cObjectChanged = 0x04u;
+std::uint8_t const cObjectRssDynamicsChanged = 0x08u;
+std::uint8_t const cIntersectingRoadChanged = 0x10u;
+std::uint8_t const cEgoVehicleRoadChanged = 0x20u;
+std::uint8_t const cAllChanged = 0x3Fu;
+
+// the exact comparison of the values compares their memory, which requires the absence of padding
+static_assert(sizeof(world::Velocity) == 2u * sizeof(double), "Velocity must not contain padding");
+static_assert(sizeof(world::OccupiedRegion) == sizeof(world::LaneSegmentId) + 4u * sizeof(double),
+              "OccupiedRegion must not contain padding");
+static_assert(sizeof(world::LaneSegment) == sizeof(world::LaneSegmentId) + 2u * sizeof(std::int32_t)
+                + 4u * sizeof(double),
+              "LaneSegment must not contain padding");
+static_assert(sizeof(world::RssDynamics) == 8u * sizeof(double), "RssDynamics must not contain padding");
+
+/**
+ * @brief exact comparison; the comparison operators of the physics types are fuzzy, which would make the coding lossy
+ */
+template <typename T> bool isIdentical(T const &left, T const &right)
+{
+  static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be compared by memory");
+  return std::memcmp(&left, &right, sizeof(T)) == 0;
+}
+
+template <typename T> bool isIdentical(std::vector<T> const &left, std::vector<T> const &right)
+{
+  static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be compared by memory");
+  return (left.size() == right.size())
+    && (left.empty() || (std::memcmp(left.data(), right.data(), sizeof(T) * left.size()) == 0));
+}
+
+bool isIdentical(world::Object const &left, world::Object const &right)
+{
+  return (left.objectId == right.objectId) && (left.objectType == right.objectType)
+    && isIdentical(left.velocity, right.velocity) && isIdentical(left.occupiedRegions, right.occupiedRegions);
+}
+
+bool isIdentical(world::RoadArea const &left, world::RoadArea const &right)
+{
+  if (left.size() != right.size())
+  {
+    return false;
+  }
+  for (std::size_t i = 0u; i < left.size(); ++i)
+  {
+    if (!isIdentical(left[i], right[i]))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief FNV-1a hash of the content of a road area
+ */
+std::uint64_t hashRoadArea(world::RoadArea const &roadArea)
+{
+  std::uint64_t hash = 14695981039346656037u;
+  auto const hashBytes = [&hash](void const *data, std::size_t const size) {
+    std::uint8_t const *bytes = static_cast<std::uint8_t const *>(data);
+    for (std::size_t i = 0u; i < size; ++i)
+    {
+      hash = (hash ^ bytes[i]) * 1099511628211u;
+    }
+  };
+  for (auto const &roadSegment : roadArea)
+  {
+    std::uint64_t const numberOfLaneSegments = roadSegment.size();
+    hashBytes(&numberOfLaneSegments, sizeof(numberOfLaneSegments));
+    if (!roadSegment.empty())
+    {
+      hashBytes(roadSegment.data(), sizeof(world::LaneSegment) * roadSegment.size());
+    }
+  }
+  return hash;
+}
+
+RssDeltaRecordFrame const &getEmptyFrame()
+{
+  static RssDeltaRecordFrame const emptyFrame = RssDeltaRecordFrame();
+  return emptyFrame;
+}
+
+world::Scene const &getEmptyScene()
+{
+  static world::Scene const emptyScene = world::Scene();
+  return emptyScene;
+}
+
+world::OccupiedRegion const &getEmptyOccupiedRegion()
+{
+  static world::OccupiedRegion const emptyOccupiedRegion = world::OccupiedRegion();
+  return emptyOccupiedRegion;
+}
+
+world::LaneSegment const &getEmptyLaneSegment()
+{
+  static world::LaneSegment const emptyLaneSegment = world::LaneSegment();
+  return emptyLaneSegment;
+}
+
+/*!
+ * @brief Encodes the frames of the recording as differences to their reference frame
+ */
+class DeltaEncoder : public BinaryEncoder
+{
+public:
+  DeltaEncoder(std::vector<std::uint8_t> &buffer,
+               std::vector<world::RoadArea> &roadAreas,
+               std::unordered_multimap<std::uint64_t, std::size_t> &roadAreaIndex)
+    : BinaryEncoder(buffer)
+    , mRoadAreas(roadAreas)
+    , mRoadAreaIndex(roadAreaIndex)
+  {
+  }
+
+  void writeFrame(world::WorldModel const &worldModel,
+                  state::ProperResponse const *properResponse,
+                  world::AccelerationRestriction const *accelerationRestriction,
+                  RssDeltaRecordFrame const &reference)
+  {
+    writeDelta(worldModel.timeIndex, reference.worldModel.timeIndex);
+    writeRssDynamics(worldModel.egoVehicleRssDynamics, reference.worldModel.egoVehicleRssDynamics);
+
+    // the scenes refer to the scene of the same object within the reference frame in order of appearance
+    std::multimap<world::ObjectId, std::size_t> referenceScenes;
+    for (std::size_t i = 0u; i < reference.worldModel.scenes.size(); ++i)
+    {
+      referenceScenes.insert(std::make_pair(reference.worldModel.scenes[i].object.objectId, i));
+    }
+    writeUnsigned(worldModel.scenes.size());
+    for (auto const &scene : worldModel.scenes)
+    {
+      auto referenceScene = referenceScenes.find(scene.object.objectId);
+      if (referenceScene == referenceScenes.end())
+      {
+        writeUnsigned(0u);
+        writeScene(scene, getEmptyScene(), cAllChanged);
+      }
+      else
+      {
+        writeUnsigned(referenceScene->second + 1u);
+        writeScene(scene, reference.worldModel.scenes[referenceScene->second], 0u);
+        referenceScenes.erase(referenceScene);
+      }
+    }
+
+    bool const hasResult = (properResponse != nullptr) && (accelerationRestriction != nullptr);
+    writeByte(hasResult ? 1u : 0u);
+    if (hasResult)
+    {
+      writeDelta(properResponse->timeIndex, worldModel.timeIndex);
+      writeByte(properResponse->isSafe ? 1u : 0u);
+      writeUnsigned(properResponse->dangerousObjects.size());
+      world::ObjectId previousObjectId = 0u;
+      for (auto const objectId : properResponse->dangerousObjects)
+      {
+        writeDelta(objectId, previousObjectId);
+        previousObjectId = objectId;
+      }
+      writeEnum(properResponse->longitudinalResponse);
+      writeEnum(properResponse->lateralResponseRight);
+      writeEnum(properResponse->lateralResponseLeft);
+
+      world::AccelerationRestriction const &referenceRestriction = reference.accelerationRestriction;
+      writeDelta(accelerationRestriction->timeIndex, worldModel.timeIndex);
+      writeValue(accelerationRestriction->lateralLeftRange.minimum, referenceRestriction.lateralLeftRange.minimum);
+      writeValue(accelerationRestriction->lateralLeftRange.maximum, referenceRestriction.lateralLeftRange.maximum);
+      writeValue(accelerationRestriction->longitudinalRange.minimum, referenceRestriction.longitudinalRange.minimum);
+      writeValue(accelerationRestriction->longitudinalRange.maximum, referenceRestriction.longitudinalRange.maximum);
+      writeValue(accelerationRestriction->lateralRightRange.minimum, referenceRestriction.lateralRightRange.minimum);
+      writeValue(accelerationRestriction->lateralRightRange.maximum, referenceRestriction.lateralRightRange.maximum);
+    }
+  }
+
+private:
+  template <typename T> void writeValue(T const &value, T const &reference)
+  {
+    writeDelta(static_cast<double>(value), static_cast<double>(reference));
+  }
+
+  template <typename T> void writeEnum(T const value)
+  {
+    writeUnsigned(static_cast<std::uint32_t>(value));
+  }
+
+  void writeScene(world::Scene const &scene, world::Scene const &reference, std::uint8_t changed)
+  {
+    if (changed != cAllChanged)
+    {
+      changed = static_cast<std::uint8_t>(
+        (scene.situationType != reference.situationType ? cSituationTypeChanged : 0u)
+        | (isIdentical(scene.egoVehicle, reference.egoVehicle) ? 0u : cEgoVehicleChanged)
+        | (isIdentical(scene.object, reference.object) ? 0u : cObjectChanged)
+        | (isIdentical(scene.objectRssDynamics, reference.objectRssDynamics) ? 0u : cObjectRssDynamicsChanged)
+        | (isIdentical(scene.intersectingRoad, reference.intersectingRoad) ? 0u : cIntersectingRoadChanged)
+        | (isIdentical(scene.egoVehicleRoad, reference.egoVehicleRoad) ? 0u : cEgoVehicleRoadChanged));
+      writeByte(changed);
+    }
+    if ((changed & cSituationTypeChanged) != 0u)
+    {
+      writeEnum(scene.situationType);
+    }
+    if ((changed & cEgoVehicleChanged) != 0u)
+    {
+      writeObject(scene.egoVehicle, reference.egoVehicle);
+    }
+    if ((changed & cObjectChanged) != 0u)
+    {
+      writeObject(scene.object, reference.object);
+    }
+    if ((changed & cObjectRssDynamicsChanged) != 0u)
+    {
+      writeRssDynamics(scene.objectRssDynamics, reference.objectRssDynamics);
+    }
+    if ((changed & cIntersectingRoadChanged) != 0u)
+    {
+      writeRoadAreaReference(scene.intersectingRoad);
+    }
+    if ((changed & cEgoVehicleRoadChanged) != 0u)
+    {
+      writeRoadAreaReference(scene.egoVehicleRoad);
+    }
+  }
+
+  void writeObject(world::Object const &object, world::Object const &reference)
+  {
+    writeDelta(object.objectId, reference.objectId);
+    writeEnum(object.objectType);
+    writeValue(object.velocity.speedLon, reference.velocity.speedLon);
+    writeValue(object.velocity.speedLat, reference.velocity.speedLat);
+    writeUnsigned(object.occupiedRegions.size());
+    for (std::size_t i = 0u; i < object.occupiedRegions.size(); ++i)
+    {
+      // additional occupied regions refer to their predecessor
+      world::OccupiedRegion const &referenceRegion = (i < reference.occupiedRegions.size())
+        ? reference.occupiedRegions[i]
+        : ((i > 0u) ? object.occupiedRegions[i - 1u] : getEmptyOccupiedRegion());
+      world::OccupiedRegion const &region = object.occupiedRegions[i];
+      writeDelta(region.segmentId, referenceRegion.segmentId);
+      writeValue(region.lonRange.minimum, referenceRegion.lonRange.minimum);
+      writeValue(region.lonRange.maximum, referenceRegion.lonRange.maximum);
+      writeValue(region.latRange.minimum, referenceRegion.latRange.minimum);
+      writeValue(region.latRange.maximum, referenceRegion.latRange.maximum);
+    }
+  }
+
+  void writeRssDynamics(world::RssDynamics const &rssDynamics, world::RssDynamics const &reference)
+  {
+    writeValue(rssDynamics.alphaLon.accelMax, reference.alphaLon.accelMax);
+    writeValue(rssDynamics.alphaLon.brakeMax, reference.alphaLon.brakeMax);
+    writeValue(rssDynamics.alphaLon.brakeMin, reference.alphaLon.brakeMin);
+    writeValue(rssDynamics.alphaLon.brakeMinCorrect, reference.alphaLon.brakeMinCorrect);
+    writeValue(rssDynamics.alphaLat.accelMax, reference.alphaLat.accelMax);
+    writeValue(rssDynamics.alphaLat.brakeMin, reference.alphaLat.brakeMin);
+    writeValue(rssDynamics.lateralFluctuationMargin, reference.lateralFluctuationMargin);
+    writeValue(rssDynamics.responseTime, reference.responseTime);
+  }
+
+  /**
+   * @brief writes the index of the road area within the road areas of the keyframe interval; new road areas follow
+   */
+  void writeRoadAreaReference(world::RoadArea const &roadArea)
+  {
+    std::uint64_t const hash = hashRoadArea(roadArea);
+    auto const candidates = mRoadAreaIndex.equal_range(hash);
+    for (auto candidate = candidates.first; candidate != candidates.second; ++candidate)
+    {
+      if (isIdentical(mRoadAreas[candidate->second], roadArea))
+      {
+        writeUnsigned(candidate->second);
+        return;
+      }
+    }
+
+    std::size_t const roadAreaIndex = mRoadAreas.size();
+    writeUnsigned(roadAreaIndex);
+    writeUnsigned(roadArea.size());
+    world::LaneSegment const *referenceLaneSegment = &getEmptyLaneSegment();
+    for (auto const &roadSegment : roadArea)
+    {
+      writeUnsigned(roadSegment.size());
+      // the lane segments of a road area are similar, so each one refers to its predecessor
+      for (auto const &laneSegment : roadSegment)
+      {
+        writeDelta(laneSegment.id, referenceLaneSegment->id);
+        writeEnum(laneSegment.type);
+        writeEnum(laneSegment.drivingDirection);
+        writeValue(laneSegment.length.minimum, referenceLaneSegment->length.minimum);
+        writeValue(laneSegment.length.maximum, referenceLaneSegment->length.maximum);
+        writeValue(laneSegment.width.minimum, referenceLaneSegment->width.minimum);
+        writeValue(laneSegment.width.maximum, referenceLaneSegment->width.maximum);
+        referenceLaneSegment = &laneSegment;
+      }
+    }
+    mRoadAreas.push_back(roadArea);
+    mRoadAreaIndex.insert(std::make_pair(hash, roadAreaIndex));
+  }
+
+  std::vector<world::RoadArea> &mRoadAreas;
+  std::unordered_multimap<std::uint64_t, std::size_t> &mRoadAreaIndex;
+};
+
+/*!
+ * @brief Decodes the frames of the recording encoded by the DeltaEncoder
+ */
+class DeltaDecoder : public BinaryDecoder
+{
+public:
+  DeltaDecoder(std::uint8_t const *data, std::size_t const size, std::vector<world::RoadArea> &roadAreas)
+    : BinaryDecoder(data, size)
+    , mRoadAreas(roadAreas)
+  {
+  }
+
+  bool readFrame(RssDeltaRecordFrame const &reference, RssDeltaRecordFrame &frame)
+  {
+    world::WorldModel &worldModel = frame.worldModel;
+    std::size_t numberOfScenes = 0u;
+    if (!readDelta(reference.worldModel.timeIndex, worldModel.timeIndex)
+        || !readRssDynamics(reference.worldModel.egoVehicleRssDynamics, worldModel.egoVehicleRssDynamics)
+        || !readCount(numberOfScenes))
+    {
+      return false;
+    }
+
+    worldModel.scenes.resize(numberOfScenes);
+    std::vector<bool> referenced(reference.worldModel.scenes.size(), false);
+    for (auto &scene : worldModel.scenes)
+    {
+      std::uint64_t referenceIndex = 0u;
+      if (!readUnsigned(referenceIndex) || (referenceIndex > reference.worldModel.scenes.size()))
+      {
+        return false;
+      }
+      if (referenceIndex == 0u)
+      {
+        scene = getEmptyScene();
+        if (!readScene(getEmptyScene(), cAllChanged, scene))
+        {
+          return false;
+        }
+      }
+      else
+      {
+        std::size_t const index = static_cast<std::size_t>(referenceIndex - 1u);
+        std::uint8_t changed = 0u;
+        // each reference scene can only be referred once
+        if (referenced[index] || !readByte(changed) || ((changed & ~cAllChanged) != 0))
+        {
+          return false;
+        }
+        referenced[index] = true;
+        scene = reference.worldModel.scenes[index];
+        if (!readScene(reference.worldModel.scenes[index], changed, scene))
+        {
+          return false;
+        }
+      }
+    }
+
+    std::uint8_t hasResult = 0u;
+    if (!readByte(hasResult) || (hasResult > 1u))
+    {
+      return false;
+    }
+    frame.hasResult = (hasResult == 1u);
+    frame.properResponse = state::ProperResponse();
+    frame.accelerationRestriction = world::AccelerationRestriction();
+    if (frame.hasResult)
+    {
+      state::ProperResponse &properResponse = frame.properResponse;
+      std::uint8_t isSafe = 0u;
+      std::size_t numberOfDangerousObjects = 0u;
+      if (!readDelta(worldModel.timeIndex, properResponse.timeIndex) || !readByte(isSafe) || (isSafe > 1u)
+          || !readCount(numberOfDangerousObjects))
+      {
+        return false;
+      }
+      properResponse.isSafe = (isSafe == 1u);
+      properResponse.dangerousObjects.resize(numberOfDangerousObjects);
+      world::ObjectId previousObjectId = 0u;
+      for (auto &objectId : properResponse.dangerousObjects)
+      {
+        if (!readDelta(previousObjectId, objectId))
+        {
+          return false;
+        }
+        previousObjectId = objectId;
+      }
+
+      world::AccelerationRestriction const &referenceRestriction = reference.accelerationRestriction;
+      world::AccelerationRestriction &accelerationRestriction = frame.accelerationRestriction;
+      return readEnum(properResponse.longitudinalResponse) && readEnum(properResponse.lateralResponseRight)
+        && readEnum(properResponse.lateralResponseLeft)
+        && readDelta(worldModel.timeIndex, accelerationRestriction.timeIndex)
+        && readValue(referenceRestriction.lateralLeftRange.minimum, accelerationRestriction.lateralLeftRange.minimum)
+        && readValue(referenceRestriction.lateralLeftRange.maximum, accelerationRestriction.lateralLeftRange.maximum)
+        && readValue(referenceRestriction.longitudinalRange.minimum, accelerationRestriction.longitudinalRange.minimum)
+        && readValue(referenceRestriction.longitudinalRange.maximum, accelerationRestriction.longitudinalRange.maximum)
+        && readValue(referenceRestriction.lateralRightRange.minimum, accelerationRestriction.lateralRightRange.minimum)
+        && readValue(referenceRestriction.lateralRightRange.maximum,
+                     accelerationRestriction.lateralRightRange.maximum);
+    }
+    return true;
+  }
+
+private:
+  template <typename T> bool readValue(T const &reference, T &value)
+  {
+    double doubleValue = 0.;
+    if (!readDelta(static_cast<double>(reference), doubleValue))
+    {
+      return false;
+    }
+    value = T(doubleValue);
+    return true;
+  }
+
+  template <typename T> bool readEnum(T &value)
+  {
+    std::uint64_t unsignedValue = 0u;
+    if (!readUnsigned(unsignedValue) || (unsignedValue > std::numeric_limits<std::uint32_t>::max()))
+    {
+      return false;
+    }
+    value = static_cast<T>(static_cast<std::int32_t>(static_cast<std::uint32_t>(unsignedValue)));
+    return true;
+  }
+
+  bool readScene(world::Scene const &reference, std::uint8_t const changed, world::Scene &scene)
+  {
+    return (((changed & cSituationTypeChanged) == 0u) || readEnum(scene.situationType))
+      && (((changed & cEgoVehicleChanged) == 0u) || readObject(reference.egoVehicle, scene.egoVehicle))
+      && (((changed & cObjectChanged) == 0u) || readObject(reference.object, scene.object))
+      && (((changed & cObjectRssDynamicsChanged) == 0u)
+          || readRssDynamics(reference.objectRssDynamics, scene.objectRssDynamics))
+      && (((changed & cIntersectingRoadChanged) == 0u) || readRoadAreaReference(scene.intersectingRoad))
+      && (((changed & cEgoVehicleRoadChanged) == 0u) || readRoadAreaReference(scene.egoVehicleRoad));
+  }
+
+  bool readObject(world::Object const &reference, world::Object &object)
+  {
+    std::size_t numberOfOccupiedRegions = 0u;
+    if (!readDelta(reference.objectId, object.objectId) || !readEnum(object.objectType)
+        || !readValue(reference.velocity.speedLon, object.velocity.speedLon)
+        || !readValue(reference.velocity.speedLat, object.velocity.speedLat) || !readCount(numberOfOccupiedRegions))
+    {
+      return false;
+    }
+    object.occupiedRegions.resize(numberOfOccupiedRegions);
+    for (std::size_t i = 0u; i < numberOfOccupiedRegions; ++i)
+    {
+      world::OccupiedRegion const &referenceRegion = (i < reference.occupiedRegions.size())
+        ? reference.occupiedRegions[i]
+        : ((i > 0u) ? object.occupiedRegions[i - 1u] : getEmptyOccupiedRegion());
+      world::OccupiedRegion &region = object.occupiedRegions[i];
+      if (!readDelta(referenceRegion.segmentId, region.segmentId)
+          || !readValue(referenceRegion.lonRange.minimum, region.lonRange.minimum)
+          || !readValue(referenceRegion.lonRange.maximum, region.lonRange.maximum)
+          || !readValue(referenceRegion.latRange.minimum, region.latRange.minimum)
+          || !readValue(referenceRegion.latRange.maximum, region.latRange.maximum))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool readRssDynamics(world::RssDynamics const &reference, world::RssDynamics &rssDynamics)
+  {
+    return readValue(reference.alphaLon.accelMax, rssDynamics.alphaLon.accelMax)
+      && readValue(reference.alphaLon.brakeMax, rssDynamics.alphaLon.brakeMax)
+      && readValue(reference.alphaLon.brakeMin, rssDynamics.alphaLon.brakeMin)
+      && readValue(reference.alphaLon.brakeMinCorrect, rssDynamics.alphaLon.brakeMinCorrect)
+      && readValue(reference.alphaLat.accelMax, rssDynamics.alphaLat.accelMax)
+      && readValue(reference.alphaLat.brakeMin, rssDynamics.alphaLat.brakeMin)
+      && readValue(reference.lateralFluctuationMargin, rssDynamics.lateralFluctuationMargin)
+      && readValue(reference.responseTime, rssDynamics.responseTime);
+  }
+
+  bool readRoadAreaReference(world::RoadArea &roadArea)
+  {
+    std::uint64_t roadAreaIndex = 0u;
+    if (!readUnsigned(roadAreaIndex) || (roadAreaIndex > mRoadAreas.size()))
+    {
+      return false;
+    }
+    if (roadAreaIndex < mRoadAreas.size())
+    {
+      roadArea = mRoadAreas[static_cast<std::size_t>(roadAreaIndex)];
+      return true;
+    }
+
+    std::size_t numberOfRoadSegments = 0u;
+    if (!readCount(numberOfRoadSegments))
+    {
+      return false;
+    }
+    world::RoadArea newRoadArea(numberOfRoadSegments);
+    world::LaneSegment const *referenceLaneSegment = &getEmptyLaneSegment();
+    for (auto &roadSegment : newRoadArea)
+    {
+      std::size_t numberOfLaneSegments = 0u;
+      if (!readCount(numberOfLaneSegments))
+      {
+        return false;
+      }
+      roadSegment.resize(numberOfLaneSegments);
+      for (auto &laneSegment : roadSegment)
+      {
+        if (!readDelta(referenceLaneSegment->id, laneSegment.id) || !readEnum(laneSegment.type)
+            || !readEnum(laneSegment.drivingDirection)
+            || !readValue(referenceLaneSegment->length.minimum, laneSegment.length.minimum)
+            || !readValue(referenceLaneSegment->length.maximum, laneSegment.length.maximum)
+            || !readValue(referenceLaneSegment->width.minimum, laneSegment.width.minimum)
+            || !readValue(referenceLaneSegment->width.maximum, laneSegment.width.maximum))
+        {
+          return false;
+        }
+        referenceLaneSegment = &laneSegment;
+      }
+    }
+    mRoadAreas.push_back(newRoadArea);
+    roadArea = mRoadAreas.back();
+    return true;
+  }
+
+  std::vector<world::RoadArea> &mRoadAreas;
+};
+
+/**
+ * @brief appends the header of a record: its type and the size of its payload
+ */
+void appendRecordHeader(std::uint8_t const recordType, std::size_t const payloadSize, std::vector<std::uint8_t> &header)
+{
+  BinaryEncoder encoder(header);
+  encoder.writeByte(recordType);
+  encoder.writeUnsigned(payloadSize);
+}
+
+} // namespace
+
+RssDeltaRecordWriter::RssDeltaRecordWriter(std::size_t const keyframeInterval)
+  : mKeyframeInterval((keyframeInterval > 0u) ? keyframeInterval : 1u)
+{
+}
+
+RssDeltaRecordWriter::~RssDeltaRecordWriter()
+{
+  close();
+}
+
+bool RssDeltaRecordWriter::open(std::string const &fileName)
+{
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    close();
+    mFileOffset = 0u;
+    mFrameNumber = 0u;
+    mForceKeyframe = true;
+    mKeyframes.clear();
+    mStream.open(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+    mStream.write(reinterpret_cast<char const *>(cRecordingMagic), sizeof(cRecordingMagic));
+    mStream.put(static_cast<char>(cRecordingVersion));
+    mFileOffset = sizeof(cRecordingMagic) + 1u;
+    result = mStream.good();
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+bool RssDeltaRecordWriter::isOpen() const
+{
+  return mStream.is_open();
+}
+
+bool RssDeltaRecordWriter::writeFrame(world::WorldModel const &worldModel)
+{
+  return writeFrameInternal(worldModel, nullptr, nullptr);
+}
+
+bool RssDeltaRecordWriter::writeFrame(world::WorldModel const &worldModel,
+                                      state::ProperResponse const &properResponse,
+                                      world::AccelerationRestriction const &accelerationRestriction)
+{
+  return writeFrameInternal(worldModel, &properResponse, &accelerationRestriction);
+}
+
+bool RssDeltaRecordWriter::writeFrameInternal(world::WorldModel const &worldModel,
+                                              state::ProperResponse const *properResponse,
+                                              world::AccelerationRestriction const *accelerationRestriction)
+{
+  if (!mStream.is_open())
+  {
+    return false;
+  }
+
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    bool const isKeyframe = mForceKeyframe || ((mFrameNumber % mKeyframeInterval) == 0u);
+    if (isKeyframe)
+    {
+      mRoadAreas.clear();
+      mRoadAreaIndex.clear();
+    }
+
+    mBuffer.clear();
+    DeltaEncoder encoder(mBuffer, mRoadAreas, mRoadAreaIndex);
+    encoder.writeFrame(
+      worldModel, properResponse, accelerationRestriction, isKeyframe ? getEmptyFrame() : mPreviousFrame);
+
+    RssDeltaRecordKeyframe keyframe;
+    keyframe.frameNumber = mFrameNumber;
+    keyframe.timeIndex = worldModel.timeIndex;
+    keyframe.fileOffset = mFileOffset;
+    result = writeRecord(isKeyframe ? cKeyframeRecord : cDeltaFrameRecord);
+
+    if (result)
+    {
+      if (isKeyframe)
+      {
+        mKeyframes.push_back(keyframe);
+      }
+      mPreviousFrame.worldModel = worldModel;
+      mPreviousFrame.hasResult = (properResponse != nullptr) && (accelerationRestriction != nullptr);
+      mPreviousFrame.properResponse = mPreviousFrame.hasResult ? *properResponse : state::ProperResponse();
+      mPreviousFrame.accelerationRestriction
+        = mPreviousFrame.hasResult ? *accelerationRestriction : world::AccelerationRestriction();
+      mFrameNumber++;
+    }
+    mForceKeyframe = !result;
+  }
+  catch (...)
+  {
+    // the reference of the next frame is unknown
+    mForceKeyframe = true;
+    result = false;
+  }
+  return result;
+}
+
+bool RssDeltaRecordWriter::writeRecord(std::uint8_t const recordType)
+{
+  std::vector<std::uint8_t> header;
+  appendRecordHeader(recordType, mBuffer.size(), header);
+  mStream.write(reinterpret_cast<char const *>(header.data()), static_cast<std::streamsize>(header.size()));
+  mStream.write(reinterpret_cast<char const *>(mBuffer.data()), static_cast<std::streamsize>(mBuffer.size()));
+  mFileOffset += header.size() + mBuffer.size();
+  return mStream.good();
+}
+
+bool RssDeltaRecordWriter::close()
+{
+  if (!mStream.is_open())
+  {
+    return true;
+  }
+
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    std::uint64_t const indexOffset = mFileOffset;
+    mBuffer.clear();
+    BinaryEncoder encoder(mBuffer);
+    encoder.writeUnsigned(mKeyframes.size());
+    RssDeltaRecordKeyframe previousKeyframe;
+    for (auto const &keyframe : mKeyframes)
+    {
+      encoder.writeDelta(keyframe.frameNumber, previousKeyframe.frameNumber);
+      encoder.writeDelta(keyframe.timeIndex, previousKeyframe.timeIndex);
+      encoder.writeDelta(keyframe.fileOffset, previousKeyframe.fileOffset);
+      previousKeyframe = keyframe;
+    }
+    result = writeRecord(cIndexRecord);
+
+    std::uint8_t trailer[cTrailerSize];
+    for (std::size_t i = 0u; i < 8u; ++i)
+    {
+      trailer[i] = static_cast<std::uint8_t>(indexOffset >> (8u * i));
+    }
+    std::memcpy(&trailer[8u], cIndexMagic, sizeof(cIndexMagic));
+    mStream.write(reinterpret_cast<char const *>(trailer), sizeof(trailer));
+    mStream.flush();
+    result = result && mStream.good();
+    mStream.close();
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+RssDeltaRecordReader::RssDeltaRecordReader()
+{
+}
+
+RssDeltaRecordReader::~RssDeltaRecordReader()
+{
+  close();
+}
+
+bool RssDeltaRecordReader::open(std::string const &fileName)
+{
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    close();
+    mStream.open(fileName, std::ios::in | std::ios::binary);
+    std::uint8_t header[sizeof(cRecordingMagic) + 1u];
+    mStream.read(reinterpret_cast<char *>(header), sizeof(header));
+    result = mStream.good() && (std::memcmp(header, cRecordingMagic, sizeof(cRecordingMagic)) == 0)
+      && (header[sizeof(cRecordingMagic)] == cRecordingVersion);
+    if (result)
+    {
+      mFramesBegin = sizeof(header);
+      result = readIndex() || scanKeyframes();
+    }
+    mPosition = mFramesBegin;
+    mNextFrameNumber = 0u;
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  if (!result)
+  {
+    close();
+  }
+  return result;
+}
+
+bool RssDeltaRecordReader::isOpen() const
+{
+  return mStream.is_open();
+}
+
+void RssDeltaRecordReader::close()
+{
+  if (mStream.is_open())
+  {
+    mStream.close();
+  }
+  mStream.clear();
+  mFramesBegin = 0u;
+  mFramesEnd = 0u;
+  mPosition = 0u;
+  mFrameNumber = 0u;
+  mNextFrameNumber = 0u;
+  mHasReference = false;
+  mRoadAreas.clear();
+  mKeyframes.clear();
+}
+
+bool RssDeltaRecordReader::readRecordHeader(std::uint8_t &recordType, std::uint64_t &recordSize)
+{
+  // the header consists of the record type and at most 10 bytes of payload size
+  std::uint8_t header[11u];
+  std::size_t headerSize = 0u;
+  int character = mStream.get();
+  while ((character != std::char_traits<char>::eof()) && (headerSize < sizeof(header)))
+  {
+    header[headerSize] = static_cast<std::uint8_t>(character);
+    headerSize++;
+    if ((headerSize > 1u) && ((header[headerSize - 1u] & 0x80u) == 0u))
+    {
+      break;
+    }
+    character = mStream.get();
+  }
+
+  BinaryDecoder decoder(header, headerSize);
+  std::uint64_t payloadSize = 0u;
+  if (!decoder.readByte(recordType) || !decoder.readUnsigned(payloadSize) || !decoder.atEnd())
+  {
+    return false;
+  }
+  recordSize = headerSize + payloadSize;
+  return true;
+}
+
+bool RssDeltaRecordReader::readIndex()
+{
+  mStream.clear();
+  mStream.seekg(0, std::ios::end);
+  std::streamoff const fileSize = mStream.tellg();
+  if ((fileSize < 0) || (static_cast<std::uint64_t>(fileSize) < mFramesBegin + cTrailerSize))
+  {
+    return false;
+  }
+  std::uint64_t const trailerOffset = static_cast<std::uint64_t>(fileSize) - cTrailerSize;
+
+  std::uint8_t trailer[cTrailerSize];
+  mStream.seekg(static_cast<std::streamoff>(trailerOffset));
+  mStream.read(reinterpret_cast<char *>(trailer), sizeof(trailer));
+  if (!mStream.good() || (std::memcmp(&trailer[8u], cIndexMagic, sizeof(cIndexMagic)) != 0))
+  {
+    return false;
+  }
+  std::uint64_t indexOffset = 0u;
+  for (std::size_t i = 0u; i < 8u; ++i)
+  {
+    indexOffset |= static_cast<std::uint64_t>(trailer[i]) << (8u * i);
+  }
+  if ((indexOffset < mFramesBegin) || (indexOffset >= trailerOffset))
+  {
+    return false;
+  }
+
+  mStream.seekg(static_cast<std::streamoff>(indexOffset));
+  std::uint8_t recordType = 0u;
+  std::uint64_t recordSize = 0u;
+  if (!readRecordHeader(recordType, recordSize) || (recordType != cIndexRecord)
+      || (recordSize != trailerOffset - indexOffset))
+  {
+    return false;
+  }
+  std::uint64_t const payloadBegin = static_cast<std::uint64_t>(mStream.tellg());
+  mBuffer.resize(static_cast<std::size_t>(trailerOffset - payloadBegin));
+  mStream.read(reinterpret_cast<char *>(mBuffer.data()), static_cast<std::streamsize>(mBuffer.size()));
+  if (!mStream.good())
+  {
+    return false;
+  }
+
+  BinaryDecoder decoder(mBuffer.data(), mBuffer.size());
+  std::size_t numberOfKeyframes = 0u;
+  if (!decoder.readCount(numberOfKeyframes))
+  {
+    return false;
+  }
+  std::vector<RssDeltaRecordKeyframe> keyframes(numberOfKeyframes);
+  RssDeltaRecordKeyframe previousKeyframe;
+  for (std::size_t i = 0u; i < numberOfKeyframes; ++i)
+  {
+    RssDeltaRecordKeyframe &keyframe = keyframes[i];
+    if (!decoder.readDelta(previousKeyframe.frameNumber, keyframe.frameNumber)
+        || !decoder.readDelta(previousKeyframe.timeIndex, keyframe.timeIndex)
+        || !decoder.readDelta(previousKeyframe.fileOffset, keyframe.fileOffset) || (keyframe.fileOffset < mFramesBegin)
+        || (keyframe.fileOffset >= indexOffset) || ((i > 0u) && (keyframe.fileOffset <= previousKeyframe.fileOffset))
+        || ((i > 0u) && (keyframe.frameNumber <= previousKeyframe.frameNumber)))
+    {
+      return false;
+    }
+    previousKeyframe = keyframe;
+  }
+  if (!decoder.atEnd())
+  {
+    return false;
+  }
+
+  mKeyframes.swap(keyframes);
+  mFramesEnd = indexOffset;
+  return true;
+}
+
+bool RssDeltaRecordReader::scanKeyframes()
+{
+  mStream.clear();
+  mStream.seekg(0, std::ios::end);
+  std::streamoff const fileSize = mStream.tellg();
+  if (fileSize < 0)
+  {
+    return false;
+  }
+
+  mKeyframes.clear();
+  std::uint64_t position = mFramesBegin;
+  std::uint64_t frameNumber = 0u;
+  while (true)
+  {
+    mStream.clear();
+    mStream.seekg(static_cast<std::streamoff>(position));
+    std::uint8_t recordType = 0u;
+    std::uint64_t recordSize = 0u;
+    if (!readRecordHeader(recordType, recordSize)
+        || ((recordType != cKeyframeRecord) && (recordType != cDeltaFrameRecord))
+        || (recordSize > static_cast<std::uint64_t>(fileSize) - position))
+    {
+      // end of the recording or incomplete frame
+      break;
+    }
+    if (recordType == cKeyframeRecord)
+    {
+      // the payload of a keyframe starts with the time index
+      std::uint8_t timeIndexData[10u];
+      mStream.read(reinterpret_cast<char *>(timeIndexData), sizeof(timeIndexData));
+      BinaryDecoder decoder(timeIndexData, static_cast<std::size_t>(mStream.gcount()));
+      RssDeltaRecordKeyframe keyframe;
+      keyframe.frameNumber = frameNumber;
+      keyframe.fileOffset = position;
+      if (!decoder.readDelta(getEmptyFrame().worldModel.timeIndex, keyframe.timeIndex))
+      {
+        break;
+      }
+      mKeyframes.push_back(keyframe);
+    }
+    position += recordSize;
+    frameNumber++;
+  }
+  mFramesEnd = position;
+  return true;
+}
+
+bool RssDeltaRecordReader::readNextFrame()
+{
+  if (!isOpen() || isAtEnd())
+  {
+    return false;
+  }
+
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    mStream.clear();
+    mStream.seekg(static_cast<std::streamoff>(mPosition));
+    std::uint8_t recordType = 0u;
+    std::uint64_t recordSize = 0u;
+    result = readRecordHeader(recordType, recordSize) && (recordSize <= mFramesEnd - mPosition)
+      && ((recordType == cKeyframeRecord) || ((recordType == cDeltaFrameRecord) && mHasReference));
+    if (result)
+    {
+      std::uint64_t const payloadBegin = static_cast<std::uint64_t>(mStream.tellg());
+      mBuffer.resize(static_cast<std::size_t>(mPosition + recordSize - payloadBegin));
+      mStream.read(reinterpret_cast<char *>(mBuffer.data()), static_cast<std::streamsize>(mBuffer.size()));
+      result = mStream.good();
+    }
+    if (result)
+    {
+      bool const isKeyframe = (recordType == cKeyframeRecord);
+      if (isKeyframe)
+      {
+        mRoadAreas.clear();
+      }
+      DeltaDecoder decoder(mBuffer.data(), mBuffer.size(), mRoadAreas);
+      result = decoder.readFrame(isKeyframe ? getEmptyFrame() : mFrame, mNextFrame) && decoder.atEnd();
+    }
+    if (result)
+    {
+      std::swap(mFrame, mNextFrame);
+      mFrameNumber = mNextFrameNumber;
+      mNextFrameNumber++;
+      mPosition += recordSize;
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  // a corrupted frame cannot serve as reference
+  mHasReference = result;
+  return result;
+}
+
+RssDeltaRecordFrame const &RssDeltaRecordReader::getFrame() const
+{
+  return mFrame;
+}
+
+std::uint64_t RssDeltaRecordReader::getFrameNumber() const
+{
+  return mFrameNumber;
+}
+
+bool RssDeltaRecordReader::isAtEnd() const
+{
+  return isOpen() && (mPosition >= mFramesEnd);
+}
+
+std::vector<RssDeltaRecordKeyframe> const &RssDeltaRecordReader::getKeyframes() const
+{
+  return mKeyframes;
+}
+
+bool RssDeltaRecordReader::seekKeyframe(std::size_t const keyframeIndex)
+{
+  if (!isOpen() || (keyframeIndex >= mKeyframes.size()))
+  {
+    return false;
+  }
+  mPosition = mKeyframes[keyframeIndex].fileOffset;
+  mNextFrameNumber = mKeyframes[keyframeIndex].frameNumber;
+  mHasReference = false;
+  return readNextFrame();
+}
+
+bool RssDeltaRecordReader::seekTimeIndex(physics::TimeIndex const timeIndex)
+{
+  if (!isOpen() || mKeyframes.empty())
+  {
+    return false;
+  }
+  std::size_t keyframeIndex = 0u;
+  while (((keyframeIndex + 1u) < mKeyframes.size()) && (mKeyframes[keyframeIndex + 1u].timeIndex <= timeIndex))
+  {
+    keyframeIndex++;
+  }
+  bool result = seekKeyframe(keyframeIndex);
+  while (result && (mFrame.worldModel.timeIndex < timeIndex))
+  {
+    result = readNextFrame();
+  }
+  return result;
+}
+
+} // namespace core
+} // namespace ad_rss
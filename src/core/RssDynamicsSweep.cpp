@@ -0,0 +1,405 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/core/RssDynamicsSweep.hpp"
+#include <algorithm>
+#include "ad_rss/core/RssSituationChecking.hpp"
+#include "ad_rss/state/RssStateOperation.hpp"
+#include "ad_rss/world/RssDynamicsValidInputRange.hpp"
+#include "core/RssThreadPool.hpp"
+#include "situation/RssFormulasBatch.hpp"
+
+namespace ad_rss {
+namespace core {
+
+namespace {
+
+/*!
+ * @brief The statistics of the frames evaluated by one thread
+ */
+struct ThreadAccumulator
+{
+  ThreadAccumulator(situation::VehicleStateBatch const &egoDynamics, situation::VehicleStateBatch const &objectDynamics)
+    : numberOfUnsafeFrames(egoDynamics.size(), 0u)
+    , numberOfDangerousSituations(egoDynamics.size(), 0u)
+    , minimumMargin(egoDynamics.size(), static_cast<double>(std::numeric_limits<physics::Distance>::max()))
+    , minimumMarginFrame(egoDynamics.size(), 0u)
+    , frameMargin(egoDynamics.size())
+    , frameUnsafe(egoDynamics.size())
+    , egoVehicle(egoDynamics)
+    , objectVehicle(objectDynamics)
+  {
+  }
+
+  std::vector<std::uint64_t> numberOfUnsafeFrames;
+  std::vector<std::uint64_t> numberOfDangerousSituations;
+  std::vector<double> minimumMargin;
+  std::vector<std::size_t> minimumMarginFrame;
+
+  // scratch buffers of the current frame and situation
+  std::vector<double> frameMargin;
+  std::vector<std::uint8_t> frameUnsafe;
+  situation::VehicleStateBatch egoVehicle;
+  situation::VehicleStateBatch objectVehicle;
+  situation::SituationMarginBatch situationMargin;
+  situation::SituationSnapshot situationSnapshot;
+};
+
+inline bool speedWithinValidInputRange(situation::VehicleState const &vehicleState)
+{
+  // the RSS formulas don't accept negative longitudinal speeds
+  return vehicleState.velocity.speedLon.minimum >= physics::Speed(0.);
+}
+
+/**
+ * @brief evaluate a non intersection situation for all configurations and update the statistics of the frame
+ */
+bool evaluateNonIntersectionSituation(situation::Situation const &situation, ThreadAccumulator &accumulator)
+{
+  if (!speedWithinValidInputRange(situation.egoVehicleState)
+      || !speedWithinValidInputRange(situation.otherVehicleState))
+  {
+    return false;
+  }
+  // the velocities are the same for all configurations, the dynamics differ
+  accumulator.egoVehicle.setVelocity(situation.egoVehicleState);
+  accumulator.objectVehicle.setVelocity(situation.otherVehicleState);
+  if (!situation::calculateSituationMarginBatch(
+        situation, accumulator.egoVehicle, accumulator.objectVehicle, accumulator.situationMargin))
+  {
+    return false;
+  }
+
+  double const *const margin = accumulator.situationMargin.margin.data();
+  std::uint8_t const *const isDangerous = accumulator.situationMargin.isDangerous.data();
+  double *const frameMargin = accumulator.frameMargin.data();
+  std::uint8_t *const frameUnsafe = accumulator.frameUnsafe.data();
+  std::uint64_t *const numberOfDangerousSituations = accumulator.numberOfDangerousSituations.data();
+  std::size_t const size = accumulator.frameMargin.size();
+  for (std::size_t i = 0u; i < size; ++i)
+  {
+    numberOfDangerousSituations[i] += isDangerous[i];
+    frameUnsafe[i] |= isDangerous[i];
+    frameMargin[i] = std::min(frameMargin[i], margin[i]);
+  }
+  return true;
+}
+
+/**
+ * @brief evaluate an intersection situation for all configurations and update the statistics of the frame
+ *
+ * The intersection checks are evaluated per configuration without the history of the previous time steps.
+ */
+bool evaluateIntersectionSituation(RssSituationChecking const &situationChecking,
+                                   physics::TimeIndex const &timeIndex,
+                                   situation::Situation const &situation,
+                                   std::vector<RssDynamicsConfiguration> const &configurations,
+                                   ThreadAccumulator &accumulator)
+{
+  situation::Situation configurationSituation = situation;
+  for (std::size_t i = 0u; i < configurations.size(); ++i)
+  {
+    configurationSituation.egoVehicleState.dynamics = configurations[i].egoDynamics;
+    configurationSituation.otherVehicleState.dynamics = configurations[i].objectDynamics;
+
+    RssSituationCheckingState situationCheckingState;
+    state::RssState rssState;
+    if (!situationChecking.startSituationChecks(timeIndex, situationCheckingState)
+        || !situationChecking.checkSituation(configurationSituation, situationCheckingState, rssState))
+    {
+      return false;
+    }
+    if (state::isDangerous(rssState))
+    {
+      accumulator.numberOfDangerousSituations[i]++;
+      accumulator.frameUnsafe[i] = 1u;
+    }
+  }
+  return true;
+}
+
+void setParameter(RssDynamicsParameter const parameter, double const value, world::RssDynamics &dynamics)
+{
+  switch (parameter)
+  {
+    case RssDynamicsParameter::ResponseTime:
+      dynamics.responseTime = physics::Duration(value);
+      break;
+    case RssDynamicsParameter::AlphaLonAccelMax:
+      dynamics.alphaLon.accelMax = physics::Acceleration(value);
+      break;
+    case RssDynamicsParameter::AlphaLonBrakeMax:
+      dynamics.alphaLon.brakeMax = physics::Acceleration(value);
+      break;
+    case RssDynamicsParameter::AlphaLonBrakeMin:
+      dynamics.alphaLon.brakeMin = physics::Acceleration(value);
+      break;
+    case RssDynamicsParameter::AlphaLonBrakeMinCorrect:
+      dynamics.alphaLon.brakeMinCorrect = physics::Acceleration(value);
+      break;
+    case RssDynamicsParameter::AlphaLatAccelMax:
+      dynamics.alphaLat.accelMax = physics::Acceleration(value);
+      break;
+    case RssDynamicsParameter::AlphaLatBrakeMin:
+      dynamics.alphaLat.brakeMin = physics::Acceleration(value);
+      break;
+    default:
+      break;
+  }
+}
+
+} // namespace
+
+bool createDynamicsGrid(RssDynamicsConfiguration const &baseConfiguration,
+                        std::vector<RssDynamicsSweepAxis> const &axes,
+                        std::vector<RssDynamicsConfiguration> &configurations)
+{
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    configurations.clear();
+    std::size_t numberOfConfigurations = 1u;
+    for (auto const &axis : axes)
+    {
+      if (axis.values.empty() || (!axis.applyToEgo && !axis.applyToObjects))
+      {
+        return false;
+      }
+      numberOfConfigurations *= axis.values.size();
+    }
+
+    configurations.reserve(numberOfConfigurations);
+    // the value indices of the axes, counting with the last axis varying fastest
+    std::vector<std::size_t> valueIndices(axes.size(), 0u);
+    result = true;
+    for (std::size_t n = 0u; result && (n < numberOfConfigurations); ++n)
+    {
+      RssDynamicsConfiguration configuration = baseConfiguration;
+      for (std::size_t axisIndex = 0u; axisIndex < axes.size(); ++axisIndex)
+      {
+        RssDynamicsSweepAxis const &axis = axes[axisIndex];
+        double const value = axis.values[valueIndices[axisIndex]];
+        if (axis.applyToEgo)
+        {
+          setParameter(axis.parameter, value, configuration.egoDynamics);
+        }
+        if (axis.applyToObjects)
+        {
+          setParameter(axis.parameter, value, configuration.objectDynamics);
+        }
+      }
+      result = withinValidInputRange(configuration.egoDynamics) && withinValidInputRange(configuration.objectDynamics);
+      configurations.push_back(configuration);
+
+      for (std::size_t axisIndex = axes.size(); axisIndex > 0u; --axisIndex)
+      {
+        std::size_t &valueIndex = valueIndices[axisIndex - 1u];
+        valueIndex++;
+        if (valueIndex < axes[axisIndex - 1u].values.size())
+        {
+          break;
+        }
+        valueIndex = 0u;
+      }
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  if (!result)
+  {
+    configurations.clear();
+  }
+  return result;
+}
+
+RssDynamicsSweep::RssDynamicsSweep(std::size_t const numberOfThreads)
+{
+  try
+  {
+    mThreadPool = std::unique_ptr<RssThreadPool>(new RssThreadPool(numberOfThreads));
+  }
+  catch (...)
+  {
+    mThreadPool = nullptr;
+  }
+}
+
+RssDynamicsSweep::~RssDynamicsSweep()
+{
+}
+
+std::size_t RssDynamicsSweep::getNumberOfThreads() const
+{
+  return mThreadPool ? mThreadPool->getNumberOfThreads() : 0u;
+}
+
+bool RssDynamicsSweep::evaluate(std::vector<world::WorldModel> const &frames,
+                                std::vector<RssDynamicsConfiguration> const &configurations,
+                                std::vector<RssDynamicsSweepStatistics> &statistics)
+{
+  if (!mThreadPool || configurations.empty()
+      || (!statistics.empty() && (statistics.size() != configurations.size())))
+  {
+    return false;
+  }
+
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    std::size_t const numberOfConfigurations = configurations.size();
+    situation::VehicleStateBatch egoDynamics;
+    situation::VehicleStateBatch objectDynamics;
+    egoDynamics.resize(numberOfConfigurations);
+    objectDynamics.resize(numberOfConfigurations);
+    for (std::size_t i = 0u; i < numberOfConfigurations; ++i)
+    {
+      if (!withinValidInputRange(configurations[i].egoDynamics)
+          || !withinValidInputRange(configurations[i].objectDynamics))
+      {
+        return false;
+      }
+      egoDynamics.setDynamics(i, configurations[i].egoDynamics);
+      objectDynamics.setDynamics(i, configurations[i].objectDynamics);
+    }
+
+    std::vector<ThreadAccumulator> accumulators(mThreadPool->getNumberOfThreads(),
+                                                ThreadAccumulator(egoDynamics, objectDynamics));
+    RssSituationChecking const situationChecking;
+
+    result = mThreadPool->run(
+      frames.size(),
+      [this, &frames, &configurations, &accumulators, &situationChecking](std::size_t const frameIndex,
+                                                                          std::size_t const threadIndex) {
+        // the situations don't depend on the dynamics; the dynamics of the first configuration are applied
+        // nevertheless, so the merging of the situations is the same for all configurations
+        ThreadAccumulator &accumulator = accumulators[threadIndex];
+        RssSituationIdState situationIdState;
+        situation::SituationSnapshot &situationSnapshot = accumulator.situationSnapshot;
+        if (!mSituationExtraction.extractSituations(frames[frameIndex],
+                                                    configurations.front().egoDynamics,
+                                                    configurations.front().objectDynamics,
+                                                    situationIdState,
+                                                    situationSnapshot))
+        {
+          return false;
+        }
+
+        std::fill(accumulator.frameMargin.begin(),
+                  accumulator.frameMargin.end(),
+                  static_cast<double>(std::numeric_limits<physics::Distance>::max()));
+        std::fill(accumulator.frameUnsafe.begin(), accumulator.frameUnsafe.end(), 0u);
+
+        for (auto const &situation : situationSnapshot.situations)
+        {
+          switch (situation.situationType)
+          {
+            case situation::SituationType::NotRelevant:
+              break;
+            case situation::SituationType::SameDirection:
+            case situation::SituationType::OppositeDirection:
+              if (!evaluateNonIntersectionSituation(situation, accumulator))
+              {
+                return false;
+              }
+              break;
+            case situation::SituationType::IntersectionEgoHasPriority:
+            case situation::SituationType::IntersectionObjectHasPriority:
+            case situation::SituationType::IntersectionSamePriority:
+              if (!evaluateIntersectionSituation(
+                    situationChecking, situationSnapshot.timeIndex, situation, configurations, accumulator))
+              {
+                return false;
+              }
+              break;
+            default:
+              return false;
+          }
+        }
+
+        for (std::size_t i = 0u; i < accumulator.frameMargin.size(); ++i)
+        {
+          accumulator.numberOfUnsafeFrames[i] += accumulator.frameUnsafe[i];
+          // the frame order is independent of the thread scheduling
+          if ((accumulator.frameMargin[i] < accumulator.minimumMargin[i])
+              || (!(accumulator.minimumMargin[i] < accumulator.frameMargin[i])
+                  && (frameIndex < accumulator.minimumMarginFrame[i])))
+          {
+            accumulator.minimumMargin[i] = accumulator.frameMargin[i];
+            accumulator.minimumMarginFrame[i] = frameIndex;
+          }
+        }
+        return true;
+      });
+
+    if (result)
+    {
+      statistics.resize(numberOfConfigurations);
+      for (std::size_t i = 0u; i < numberOfConfigurations; ++i)
+      {
+        RssDynamicsSweepStatistics &configurationStatistics = statistics[i];
+        configurationStatistics.numberOfFrames += frames.size();
+
+        double minimumMargin = static_cast<double>(std::numeric_limits<physics::Distance>::max());
+        std::size_t minimumMarginFrame = 0u;
+        for (auto const &accumulator : accumulators)
+        {
+          configurationStatistics.numberOfUnsafeFrames += accumulator.numberOfUnsafeFrames[i];
+          configurationStatistics.numberOfDangerousSituations += accumulator.numberOfDangerousSituations[i];
+          if ((accumulator.minimumMargin[i] < minimumMargin)
+              || (!(minimumMargin < accumulator.minimumMargin[i])
+                  && (accumulator.minimumMarginFrame[i] < minimumMarginFrame)))
+          {
+            minimumMargin = accumulator.minimumMargin[i];
+            minimumMarginFrame = accumulator.minimumMarginFrame[i];
+          }
+        }
+        // on equal margins the statistics of the earlier frames are kept
+        if (minimumMargin < static_cast<double>(configurationStatistics.minimumMargin))
+        {
+          configurationStatistics.minimumMargin = physics::Distance(minimumMargin);
+          configurationStatistics.minimumMarginTimeIndex = frames[minimumMarginFrame].timeIndex;
+        }
+      }
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+} // namespace core
+} // namespace ad_rss
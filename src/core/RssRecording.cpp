@@ -0,0 +1,701 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/core/RssRecording.hpp"
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include "core/MappedFile.hpp"
+
+namespace ad_rss {
+namespace core {
+
+namespace {
+
+/*!
+ * @brief all records and arrays within a frame and the frames themselves are aligned to this value
+ */
+std::size_t const cAlignment = 8u;
+
+std::uint8_t const cRecordingMagic[] = {'R', 'S', 'S', 'R'};
+std::uint32_t const cRecordingVersion = 1u;
+std::uint32_t const cByteOrderMark = 0x01020304u;
+
+static_assert(std::is_trivially_copyable<world::OccupiedRegion>::value, "OccupiedRegion has to be stored in place");
+static_assert(std::is_trivially_copyable<world::LaneSegment>::value, "LaneSegment has to be stored in place");
+static_assert(std::is_trivially_copyable<world::RssDynamics>::value, "RssDynamics has to be stored in place");
+static_assert(std::is_trivially_copyable<world::Velocity>::value, "Velocity has to be stored in place");
+static_assert(std::is_trivially_copyable<world::AccelerationRestriction>::value,
+              "AccelerationRestriction has to be stored in place");
+
+struct FileHeader
+{
+  std::uint8_t magic[4];
+  std::uint32_t version;
+  std::uint32_t byteOrderMark;
+  // layout of the types stored in place
+  std::uint32_t occupiedRegionSize;
+  std::uint32_t laneSegmentSize;
+  std::uint32_t rssDynamicsSize;
+  std::uint32_t velocitySize;
+  std::uint32_t accelerationRestrictionSize;
+  std::uint32_t offsetSize;
+  std::uint32_t reserved;
+};
+
+struct ArrayRecord
+{
+  std::uint64_t offset;
+  std::uint64_t count;
+};
+
+struct ObjectRecord
+{
+  world::ObjectId objectId;
+  std::int32_t objectType;
+  std::uint32_t reserved;
+  world::Velocity velocity;
+  ArrayRecord occupiedRegions;
+};
+
+struct RoadAreaRecord
+{
+  ArrayRecord laneSegments;
+  ArrayRecord roadSegmentOffsets;
+};
+
+struct SceneRecord
+{
+  std::int32_t situationType;
+  std::uint32_t reserved;
+  ObjectRecord egoVehicle;
+  ObjectRecord object;
+  world::RssDynamics objectRssDynamics;
+  RoadAreaRecord intersectingRoad;
+  RoadAreaRecord egoVehicleRoad;
+};
+
+struct ResultRecord
+{
+  world::AccelerationRestriction accelerationRestriction;
+  physics::TimeIndex timeIndex;
+  std::uint32_t isSafe;
+  std::int32_t longitudinalResponse;
+  std::int32_t lateralResponseRight;
+  std::int32_t lateralResponseLeft;
+  ArrayRecord dangerousObjects;
+};
+
+struct FrameHeader
+{
+  std::uint64_t frameSize;
+  physics::TimeIndex timeIndex;
+  ArrayRecord scenes;
+  std::uint64_t resultOffset;
+  world::RssDynamics egoVehicleRssDynamics;
+};
+
+static_assert((sizeof(FileHeader) % cAlignment) == 0u, "FileHeader has to keep the alignment");
+static_assert((sizeof(SceneRecord) % cAlignment) == 0u, "SceneRecord has to keep the alignment");
+static_assert((sizeof(ResultRecord) % cAlignment) == 0u, "ResultRecord has to keep the alignment");
+static_assert((sizeof(FrameHeader) % cAlignment) == 0u, "FrameHeader has to keep the alignment");
+static_assert(alignof(SceneRecord) <= cAlignment, "SceneRecord alignment not supported");
+static_assert(alignof(ResultRecord) <= cAlignment, "ResultRecord alignment not supported");
+static_assert(alignof(FrameHeader) <= cAlignment, "FrameHeader alignment not supported");
+
+FileHeader createFileHeader()
+{
+  FileHeader fileHeader;
+  std::memcpy(fileHeader.magic, cRecordingMagic, sizeof(fileHeader.magic));
+  fileHeader.version = cRecordingVersion;
+  fileHeader.byteOrderMark = cByteOrderMark;
+  fileHeader.occupiedRegionSize = static_cast<std::uint32_t>(sizeof(world::OccupiedRegion));
+  fileHeader.laneSegmentSize = static_cast<std::uint32_t>(sizeof(world::LaneSegment));
+  fileHeader.rssDynamicsSize = static_cast<std::uint32_t>(sizeof(world::RssDynamics));
+  fileHeader.velocitySize = static_cast<std::uint32_t>(sizeof(world::Velocity));
+  fileHeader.accelerationRestrictionSize = static_cast<std::uint32_t>(sizeof(world::AccelerationRestriction));
+  fileHeader.offsetSize = static_cast<std::uint32_t>(sizeof(std::size_t));
+  fileHeader.reserved = 0u;
+  return fileHeader;
+}
+
+std::size_t alignedSize(std::size_t const size)
+{
+  return (size + cAlignment - 1u) & ~(cAlignment - 1u);
+}
+
+/**
+ * @brief Appends the data of frame records and arrays to the frame buffer
+ */
+class FrameEncoder
+{
+public:
+  explicit FrameEncoder(std::vector<std::uint8_t> &buffer)
+    : mBuffer(buffer)
+  {
+  }
+
+  /**
+   * @brief reserve aligned space for a record, initialized with zeros; returns its offset
+   */
+  std::size_t reserve(std::size_t const size)
+  {
+    std::size_t const offset = mBuffer.size();
+    mBuffer.resize(offset + alignedSize(size), 0u);
+    return offset;
+  }
+
+  template <typename T> void store(std::size_t const offset, T const &record)
+  {
+    std::memcpy(&mBuffer[offset], &record, sizeof(T));
+  }
+
+  template <typename T> ArrayRecord appendArray(T const *data, std::size_t const count)
+  {
+    ArrayRecord arrayRecord;
+    arrayRecord.offset = 0u;
+    arrayRecord.count = count;
+    if (count > 0u)
+    {
+      arrayRecord.offset = reserve(sizeof(T) * count);
+      std::memcpy(&mBuffer[static_cast<std::size_t>(arrayRecord.offset)], data, sizeof(T) * count);
+    }
+    return arrayRecord;
+  }
+
+  ObjectRecord appendObject(world::Object const &object)
+  {
+    return appendObject(world::createObjectView(object));
+  }
+
+  ObjectRecord appendObject(world::ObjectView const &object)
+  {
+    ObjectRecord objectRecord;
+    objectRecord.objectId = object.objectId;
+    objectRecord.objectType = static_cast<std::int32_t>(object.objectType);
+    objectRecord.reserved = 0u;
+    objectRecord.velocity = object.velocity;
+    objectRecord.occupiedRegions = appendArray(object.occupiedRegions.data(), object.occupiedRegions.size());
+    return objectRecord;
+  }
+
+  RoadAreaRecord appendRoadArea(world::RoadArea const &roadArea)
+  {
+    RoadAreaRecord roadAreaRecord;
+    roadAreaRecord.laneSegments.offset = 0u;
+    roadAreaRecord.laneSegments.count = 0u;
+    roadAreaRecord.roadSegmentOffsets.offset = 0u;
+    roadAreaRecord.roadSegmentOffsets.count = 0u;
+    if (roadArea.empty())
+    {
+      return roadAreaRecord;
+    }
+
+    std::vector<std::size_t> roadSegmentOffsets;
+    roadSegmentOffsets.reserve(roadArea.size() + 1u);
+    std::size_t numberOfLaneSegments = 0u;
+    for (auto const &roadSegment : roadArea)
+    {
+      roadSegmentOffsets.push_back(numberOfLaneSegments);
+      numberOfLaneSegments += roadSegment.size();
+    }
+    roadSegmentOffsets.push_back(numberOfLaneSegments);
+
+    roadAreaRecord.laneSegments.count = numberOfLaneSegments;
+    if (numberOfLaneSegments > 0u)
+    {
+      roadAreaRecord.laneSegments.offset = reserve(sizeof(world::LaneSegment) * numberOfLaneSegments);
+      std::size_t position = static_cast<std::size_t>(roadAreaRecord.laneSegments.offset);
+      for (auto const &roadSegment : roadArea)
+      {
+        std::size_t const size = sizeof(world::LaneSegment) * roadSegment.size();
+        if (size > 0u)
+        {
+          std::memcpy(&mBuffer[position], roadSegment.data(), size);
+        }
+        position += size;
+      }
+    }
+    roadAreaRecord.roadSegmentOffsets = appendArray(roadSegmentOffsets.data(), roadSegmentOffsets.size());
+    return roadAreaRecord;
+  }
+
+  RoadAreaRecord appendRoadArea(world::RoadAreaView const &roadArea)
+  {
+    RoadAreaRecord roadAreaRecord;
+    roadAreaRecord.laneSegments = appendArray(roadArea.laneSegments.data(), roadArea.laneSegments.size());
+    roadAreaRecord.roadSegmentOffsets
+      = appendArray(roadArea.roadSegmentOffsets.data(), roadArea.roadSegmentOffsets.size());
+    return roadAreaRecord;
+  }
+
+private:
+  std::vector<std::uint8_t> &mBuffer;
+};
+
+world::RssDynamics const &getObjectRssDynamics(world::Scene const &scene)
+{
+  return scene.objectRssDynamics;
+}
+
+world::RssDynamics const &getObjectRssDynamics(world::SceneView const &scene)
+{
+  return *scene.objectRssDynamics;
+}
+
+bool hasObjectRssDynamics(world::Scene const &)
+{
+  return true;
+}
+
+bool hasObjectRssDynamics(world::SceneView const &scene)
+{
+  return scene.objectRssDynamics != nullptr;
+}
+
+/**
+ * @brief checks that the array is placed completely within the frame at a suitable alignment
+ */
+template <typename T> bool isValidArray(ArrayRecord const &arrayRecord, std::size_t const frameSize)
+{
+  if (arrayRecord.count == 0u)
+  {
+    return true;
+  }
+  return ((arrayRecord.offset % alignof(T)) == 0u) && (arrayRecord.offset >= sizeof(FrameHeader))
+    && (arrayRecord.offset <= frameSize) && (arrayRecord.count <= (frameSize - arrayRecord.offset) / sizeof(T));
+}
+
+template <typename T> world::ArrayView<T> createArrayView(std::uint8_t const *frame, ArrayRecord const &arrayRecord)
+{
+  if (arrayRecord.count == 0u)
+  {
+    return world::ArrayView<T>();
+  }
+  return world::ArrayView<T>(reinterpret_cast<T const *>(frame + arrayRecord.offset),
+                             static_cast<std::size_t>(arrayRecord.count));
+}
+
+bool isValidObject(ObjectRecord const &objectRecord, std::size_t const frameSize)
+{
+  return isValidArray<world::OccupiedRegion>(objectRecord.occupiedRegions, frameSize);
+}
+
+bool isValidRoadArea(RoadAreaRecord const &roadAreaRecord, std::size_t const frameSize)
+{
+  return isValidArray<world::LaneSegment>(roadAreaRecord.laneSegments, frameSize)
+    && isValidArray<std::size_t>(roadAreaRecord.roadSegmentOffsets, frameSize);
+}
+
+world::ObjectView createObjectView(std::uint8_t const *frame, ObjectRecord const &objectRecord)
+{
+  world::ObjectView objectView;
+  objectView.objectId = objectRecord.objectId;
+  objectView.objectType = static_cast<world::ObjectType>(objectRecord.objectType);
+  objectView.occupiedRegions = createArrayView<world::OccupiedRegion>(frame, objectRecord.occupiedRegions);
+  objectView.velocity = objectRecord.velocity;
+  return objectView;
+}
+
+world::RoadAreaView createRoadAreaView(std::uint8_t const *frame, RoadAreaRecord const &roadAreaRecord)
+{
+  world::RoadAreaView roadAreaView;
+  roadAreaView.laneSegments = createArrayView<world::LaneSegment>(frame, roadAreaRecord.laneSegments);
+  roadAreaView.roadSegmentOffsets = createArrayView<std::size_t>(frame, roadAreaRecord.roadSegmentOffsets);
+  return roadAreaView;
+}
+
+} // namespace
+
+state::ProperResponse createProperResponse(ProperResponseView const &properResponseView)
+{
+  state::ProperResponse properResponse;
+  properResponse.timeIndex = properResponseView.timeIndex;
+  properResponse.isSafe = properResponseView.isSafe;
+  properResponse.dangerousObjects.assign(properResponseView.dangerousObjects.begin(),
+                                         properResponseView.dangerousObjects.end());
+  properResponse.longitudinalResponse = properResponseView.longitudinalResponse;
+  properResponse.lateralResponseRight = properResponseView.lateralResponseRight;
+  properResponse.lateralResponseLeft = properResponseView.lateralResponseLeft;
+  return properResponse;
+}
+
+RssRecordWriter::RssRecordWriter()
+{
+}
+
+RssRecordWriter::~RssRecordWriter()
+{
+  close();
+}
+
+bool RssRecordWriter::open(std::string const &fileName)
+{
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    close();
+    mStream.open(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+    FileHeader const fileHeader = createFileHeader();
+    mStream.write(reinterpret_cast<char const *>(&fileHeader), sizeof(fileHeader));
+    result = mStream.good();
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+bool RssRecordWriter::isOpen() const
+{
+  return mStream.is_open();
+}
+
+bool RssRecordWriter::close()
+{
+  bool result = true;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    if (mStream.is_open())
+    {
+      mStream.flush();
+      result = mStream.good();
+      mStream.close();
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+bool RssRecordWriter::writeFrame(world::WorldModel const &worldModel)
+{
+  return writeFrameT(worldModel, nullptr, nullptr);
+}
+
+bool RssRecordWriter::writeFrame(world::WorldModel const &worldModel,
+                                 state::ProperResponse const &properResponse,
+                                 world::AccelerationRestriction const &accelerationRestriction)
+{
+  return writeFrameT(worldModel, &properResponse, &accelerationRestriction);
+}
+
+bool RssRecordWriter::writeFrame(world::WorldModelView const &worldModel)
+{
+  return writeFrameT(worldModel, nullptr, nullptr);
+}
+
+bool RssRecordWriter::writeFrame(world::WorldModelView const &worldModel,
+                                 state::ProperResponse const &properResponse,
+                                 world::AccelerationRestriction const &accelerationRestriction)
+{
+  return writeFrameT(worldModel, &properResponse, &accelerationRestriction);
+}
+
+template <class WorldModelType>
+bool RssRecordWriter::writeFrameT(WorldModelType const &worldModel,
+                                  state::ProperResponse const *properResponse,
+                                  world::AccelerationRestriction const *accelerationRestriction)
+{
+  if (!mStream.is_open())
+  {
+    return false;
+  }
+
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    mFrameBuffer.clear();
+    FrameEncoder encoder(mFrameBuffer);
+
+    std::size_t const frameHeaderOffset = encoder.reserve(sizeof(FrameHeader));
+    FrameHeader frameHeader;
+    frameHeader.timeIndex = worldModel.timeIndex;
+    frameHeader.egoVehicleRssDynamics = worldModel.egoVehicleRssDynamics;
+    frameHeader.scenes.count = worldModel.scenes.size();
+    frameHeader.scenes.offset = encoder.reserve(sizeof(SceneRecord) * worldModel.scenes.size());
+    frameHeader.resultOffset = 0u;
+
+    result = true;
+    std::size_t sceneOffset = static_cast<std::size_t>(frameHeader.scenes.offset);
+    for (auto const &scene : worldModel.scenes)
+    {
+      if (!hasObjectRssDynamics(scene))
+      {
+        result = false;
+        break;
+      }
+      SceneRecord sceneRecord;
+      sceneRecord.situationType = static_cast<std::int32_t>(scene.situationType);
+      sceneRecord.reserved = 0u;
+      sceneRecord.egoVehicle = encoder.appendObject(scene.egoVehicle);
+      sceneRecord.object = encoder.appendObject(scene.object);
+      sceneRecord.objectRssDynamics = getObjectRssDynamics(scene);
+      sceneRecord.intersectingRoad = encoder.appendRoadArea(scene.intersectingRoad);
+      sceneRecord.egoVehicleRoad = encoder.appendRoadArea(scene.egoVehicleRoad);
+      encoder.store(sceneOffset, sceneRecord);
+      sceneOffset += sizeof(SceneRecord);
+    }
+
+    if (result && (properResponse != nullptr) && (accelerationRestriction != nullptr))
+    {
+      frameHeader.resultOffset = encoder.reserve(sizeof(ResultRecord));
+      ResultRecord resultRecord;
+      resultRecord.accelerationRestriction = *accelerationRestriction;
+      resultRecord.timeIndex = properResponse->timeIndex;
+      resultRecord.isSafe = properResponse->isSafe ? 1u : 0u;
+      resultRecord.longitudinalResponse = static_cast<std::int32_t>(properResponse->longitudinalResponse);
+      resultRecord.lateralResponseRight = static_cast<std::int32_t>(properResponse->lateralResponseRight);
+      resultRecord.lateralResponseLeft = static_cast<std::int32_t>(properResponse->lateralResponseLeft);
+      resultRecord.dangerousObjects
+        = encoder.appendArray(properResponse->dangerousObjects.data(), properResponse->dangerousObjects.size());
+      encoder.store(static_cast<std::size_t>(frameHeader.resultOffset), resultRecord);
+    }
+
+    if (result)
+    {
+      frameHeader.frameSize = mFrameBuffer.size();
+      encoder.store(frameHeaderOffset, frameHeader);
+      mStream.write(reinterpret_cast<char const *>(mFrameBuffer.data()),
+                    static_cast<std::streamsize>(mFrameBuffer.size()));
+      result = mStream.good();
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+RssRecordReader::RssRecordReader()
+{
+}
+
+RssRecordReader::~RssRecordReader()
+{
+  close();
+}
+
+bool RssRecordReader::open(std::string const &fileName)
+{
+  close();
+
+  bool result = false;
+  try
+  {
+    mFile.reset(new MappedFile());
+    if (mFile->open(fileName))
+    {
+      mData = mFile->getData();
+      mSize = mFile->getSize();
+      result = openData();
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+
+  if (!result)
+  {
+    close();
+  }
+  return result;
+}
+
+bool RssRecordReader::open(std::uint8_t const *data, std::size_t const size)
+{
+  close();
+  if ((data == nullptr) || ((reinterpret_cast<std::uintptr_t>(data) % cAlignment) != 0u))
+  {
+    return false;
+  }
+  mData = data;
+  mSize = size;
+  bool const result = openData();
+  if (!result)
+  {
+    close();
+  }
+  return result;
+}
+
+bool RssRecordReader::openData()
+{
+  if (mSize < sizeof(FileHeader))
+  {
+    return false;
+  }
+  FileHeader fileHeader;
+  std::memcpy(&fileHeader, mData, sizeof(fileHeader));
+  FileHeader const expectedFileHeader = createFileHeader();
+  bool const result = (std::memcmp(fileHeader.magic, expectedFileHeader.magic, sizeof(fileHeader.magic)) == 0)
+    && (fileHeader.version == expectedFileHeader.version)
+    && (fileHeader.byteOrderMark == expectedFileHeader.byteOrderMark)
+    && (fileHeader.occupiedRegionSize == expectedFileHeader.occupiedRegionSize)
+    && (fileHeader.laneSegmentSize == expectedFileHeader.laneSegmentSize)
+    && (fileHeader.rssDynamicsSize == expectedFileHeader.rssDynamicsSize)
+    && (fileHeader.velocitySize == expectedFileHeader.velocitySize)
+    && (fileHeader.accelerationRestrictionSize == expectedFileHeader.accelerationRestrictionSize)
+    && (fileHeader.offsetSize == expectedFileHeader.offsetSize);
+  mPosition = sizeof(FileHeader);
+  return result;
+}
+
+bool RssRecordReader::isOpen() const
+{
+  return mData != nullptr;
+}
+
+void RssRecordReader::close()
+{
+  mFile.reset();
+  mData = nullptr;
+  mSize = 0u;
+  mPosition = 0u;
+}
+
+bool RssRecordReader::isAtEnd() const
+{
+  return isOpen() && (mPosition == mSize);
+}
+
+void RssRecordReader::rewind()
+{
+  if (isOpen())
+  {
+    mPosition = sizeof(FileHeader);
+  }
+}
+
+bool RssRecordReader::readNextFrame(RssRecordFrame &frame)
+{
+  if (!isOpen() || isAtEnd() || ((mSize - mPosition) < sizeof(FrameHeader)))
+  {
+    return false;
+  }
+
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    std::uint8_t const *frameData = mData + mPosition;
+    FrameHeader const &frameHeader = *reinterpret_cast<FrameHeader const *>(frameData);
+    std::size_t const remainingSize = mSize - mPosition;
+    if ((frameHeader.frameSize < sizeof(FrameHeader)) || (frameHeader.frameSize > remainingSize)
+        || ((frameHeader.frameSize % cAlignment) != 0u))
+    {
+      return false;
+    }
+    std::size_t const frameSize = static_cast<std::size_t>(frameHeader.frameSize);
+
+    result = isValidArray<SceneRecord>(frameHeader.scenes, frameSize);
+    if (result && (frameHeader.resultOffset != 0u))
+    {
+      ArrayRecord resultArray;
+      resultArray.offset = frameHeader.resultOffset;
+      resultArray.count = 1u;
+      result = isValidArray<ResultRecord>(resultArray, frameSize);
+    }
+    if (!result)
+    {
+      return false;
+    }
+
+    world::ArrayView<SceneRecord> const sceneRecords = createArrayView<SceneRecord>(frameData, frameHeader.scenes);
+    mScenes.resize(sceneRecords.size());
+    for (std::size_t i = 0u; result && (i < sceneRecords.size()); ++i)
+    {
+      SceneRecord const &sceneRecord = sceneRecords[i];
+      result = isValidObject(sceneRecord.egoVehicle, frameSize) && isValidObject(sceneRecord.object, frameSize)
+        && isValidRoadArea(sceneRecord.intersectingRoad, frameSize)
+        && isValidRoadArea(sceneRecord.egoVehicleRoad, frameSize);
+
+      world::SceneView &scene = mScenes[i];
+      scene.situationType = static_cast<situation::SituationType>(sceneRecord.situationType);
+      scene.egoVehicle = createObjectView(frameData, sceneRecord.egoVehicle);
+      scene.object = createObjectView(frameData, sceneRecord.object);
+      scene.objectRssDynamics = &sceneRecord.objectRssDynamics;
+      scene.intersectingRoad = createRoadAreaView(frameData, sceneRecord.intersectingRoad);
+      scene.egoVehicleRoad = createRoadAreaView(frameData, sceneRecord.egoVehicleRoad);
+    }
+
+    if (result)
+    {
+      frame.worldModel.timeIndex = frameHeader.timeIndex;
+      frame.worldModel.egoVehicleRssDynamics = frameHeader.egoVehicleRssDynamics;
+      frame.worldModel.scenes = world::ArrayView<world::SceneView>(mScenes);
+      frame.hasResult = (frameHeader.resultOffset != 0u);
+      if (frame.hasResult)
+      {
+        ResultRecord const &resultRecord
+          = *reinterpret_cast<ResultRecord const *>(frameData + frameHeader.resultOffset);
+        result = isValidArray<world::ObjectId>(resultRecord.dangerousObjects, frameSize);
+        frame.accelerationRestriction = resultRecord.accelerationRestriction;
+        frame.properResponse.timeIndex = resultRecord.timeIndex;
+        frame.properResponse.isSafe = (resultRecord.isSafe != 0u);
+        frame.properResponse.dangerousObjects
+          = createArrayView<world::ObjectId>(frameData, resultRecord.dangerousObjects);
+        frame.properResponse.longitudinalResponse
+          = static_cast<state::LongitudinalResponse>(resultRecord.longitudinalResponse);
+        frame.properResponse.lateralResponseRight
+          = static_cast<state::LateralResponse>(resultRecord.lateralResponseRight);
+        frame.properResponse.lateralResponseLeft
+          = static_cast<state::LateralResponse>(resultRecord.lateralResponseLeft);
+      }
+      else
+      {
+        frame.properResponse = ProperResponseView();
+        frame.accelerationRestriction = world::AccelerationRestriction();
+      }
+    }
+
+    if (result)
+    {
+      mPosition += frameSize;
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+} // namespace core
+} // namespace ad_rss
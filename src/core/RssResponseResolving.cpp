@@ -43,103 +43,225 @@ RssResponseResolving::RssResponseResolving()
 
 bool RssResponseResolving::provideProperResponse(state::RssStateSnapshot const &currentStateSnapshot,
                                                  state::ProperResponse &response)
+{
+  return provideProperResponse(currentStateSnapshot, mResponseResolvingState, response);
+}
+
+bool RssResponseResolving::provideProperResponse(state::RssStateSnapshot const &currentStateSnapshot,
+                                                 RssResponseResolvingState &responseResolvingState,
+                                                 state::ProperResponse &response) const
 {
   if (!withinValidInputRange(currentStateSnapshot))
   {
     return false;
   }
 
+  RssResponseResolvingState nextResponseResolvingState;
+  bool result = startProperResponse(currentStateSnapshot.timeIndex, nextResponseResolvingState, response);
+  if (result)
+  {
+    for (auto const &currentState : currentStateSnapshot.individualResponses)
+    {
+      bool const addResult
+        = addRssStateInputRangeChecked(currentState, responseResolvingState, nextResponseResolvingState, response);
+      result = result && addResult;
+    }
+    if (result)
+    {
+      responseResolvingState = std::move(nextResponseResolvingState);
+    }
+  }
+
+  return result;
+}
+
+bool RssResponseResolving::startProperResponse(physics::TimeIndex const &timeIndex, state::ProperResponse &response)
+{
+  return startProperResponse(timeIndex, mNewResponseResolvingState, response);
+}
+
+bool RssResponseResolving::startProperResponse(physics::TimeIndex const &timeIndex,
+                                               RssResponseResolvingState &nextResponseResolvingState,
+                                               state::ProperResponse &response) const
+{
+  if (timeIndex == 0u)
+  {
+    return false;
+  }
+
   bool result = true;
   // global try catch block to ensure this library call doesn't throw an exception
   try
   {
-    response.timeIndex = currentStateSnapshot.timeIndex;
+    response.timeIndex = timeIndex;
     response.isSafe = true;
     response.dangerousObjects.clear();
     response.longitudinalResponse = state::LongitudinalResponse::None;
     response.lateralResponseLeft = state::LateralResponse::None;
     response.lateralResponseRight = state::LateralResponse::None;
 
-    RssSafeStateBeforeDangerThresholdTimeMap newStatesBeforeDangerThresholdTime;
-    for (auto const &currentState : currentStateSnapshot.individualResponses)
+    nextResponseResolvingState.statesBeforeDangerThresholdTime.clear();
+  }
+  catch (...)
+  {
+    result = false;
+  }
+
+  return result;
+}
+
+bool RssResponseResolving::addRssState(state::RssState const &currentState, state::ProperResponse &response)
+{
+  return addRssState(currentState, mResponseResolvingState, mNewResponseResolvingState, response);
+}
+
+bool RssResponseResolving::addRssState(state::RssState const &currentState,
+                                       RssResponseResolvingState const &responseResolvingState,
+                                       RssResponseResolvingState &nextResponseResolvingState,
+                                       state::ProperResponse &response) const
+{
+  if (!withinValidInputRange(currentState))
+  {
+    return false;
+  }
+  return addRssStateInputRangeChecked(currentState, responseResolvingState, nextResponseResolvingState, response);
+}
+
+bool RssResponseResolving::addRssStateInputRangeChecked(state::RssState const &currentState,
+                                                        RssResponseResolvingState const &responseResolvingState,
+                                                        RssResponseResolvingState &nextResponseResolvingState,
+                                                        state::ProperResponse &response) const
+{
+  bool result = true;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    // The response belonging to the last state before the danger threshold time
+    RssResponseResolvingState::RssSafeState nonDangerousStateToRemember;
+    if (isDangerous(currentState))
     {
-      // The response belonging to the last state before the danger threshold time
-      RssSafeState nonDangerousStateToRemember;
-      if (isDangerous(currentState))
+      response.isSafe = false;
+      if (std::find(response.dangerousObjects.begin(), response.dangerousObjects.end(), currentState.objectId)
+          == response.dangerousObjects.end())
       {
-        response.isSafe = false;
-        if (std::find(response.dangerousObjects.begin(), response.dangerousObjects.end(), currentState.objectId)
-            == response.dangerousObjects.end())
-        {
-          response.dangerousObjects.push_back(currentState.objectId);
-        }
-        auto const previousNonDangerousState = mStatesBeforeDangerThresholdTime.find(currentState.situationId);
-        if (previousNonDangerousState != mStatesBeforeDangerThresholdTime.end())
-        {
-          if (previousNonDangerousState->second.lateralSafe)
-          {
-            // we might need to check here if left or right is the dangerous side
-            // but for the combineLateralResponse will only respect the more severe response
-            // omitting the check should have the same result
-            //
-            // @todo: Handling of a cut-in by a leading vehicle as stated in definitions 11-13 of the RSS paper v6
-            //        will be handled outside of this function. As a consequence.
-            //        There is currently no response for a cut-in of a leading vehicle
-            response.lateralResponseLeft
-              = combineResponse(currentState.lateralStateLeft.response, response.lateralResponseLeft);
-
-            response.lateralResponseRight
-              = combineResponse(currentState.lateralStateRight.response, response.lateralResponseRight);
-          }
-          if (previousNonDangerousState->second.longitudinalSafe)
-          {
-            response.longitudinalResponse
-              = combineResponse(currentState.longitudinalState.response, response.longitudinalResponse);
-          }
-
-          nonDangerousStateToRemember = previousNonDangerousState->second;
-        }
-        else
+        response.dangerousObjects.push_back(currentState.objectId);
+      }
+      auto const previousNonDangerousState
+        = responseResolvingState.statesBeforeDangerThresholdTime.find(currentState.situationId);
+      if (previousNonDangerousState != responseResolvingState.statesBeforeDangerThresholdTime.end())
+      {
+        if (previousNonDangerousState->second.lateralSafe)
         {
-          // There is a lateral and a longitudinal conflict so both longitudinal and lateral distances became
-          // dangerous at the same time
-          response.longitudinalResponse
-            = combineResponse(currentState.longitudinalState.response, response.longitudinalResponse);
-
           // we might need to check here if left or right is the dangerous side
           // but for the combineLateralResponse will only respect the more severe response
           // omitting the check should have the same result
+          //
+          // @todo: Handling of a cut-in by a leading vehicle as stated in definitions 11-13 of the RSS paper v6
+          //        will be handled outside of this function. As a consequence.
+          //        There is currently no response for a cut-in of a leading vehicle
           response.lateralResponseLeft
             = combineResponse(currentState.lateralStateLeft.response, response.lateralResponseLeft);
 
           response.lateralResponseRight
             = combineResponse(currentState.lateralStateRight.response, response.lateralResponseRight);
         }
+        if (previousNonDangerousState->second.longitudinalSafe)
+        {
+          response.longitudinalResponse
+            = combineResponse(currentState.longitudinalState.response, response.longitudinalResponse);
+        }
+
+        nonDangerousStateToRemember = previousNonDangerousState->second;
       }
       else
       {
-        nonDangerousStateToRemember.longitudinalSafe = isLongitudinalSafe(currentState);
-        nonDangerousStateToRemember.lateralSafe = isLateralSafe(currentState);
-      }
+        // There is a lateral and a longitudinal conflict so both longitudinal and lateral distances became
+        // dangerous at the same time
+        response.longitudinalResponse
+          = combineResponse(currentState.longitudinalState.response, response.longitudinalResponse);
 
-      // store state for the next iteration
-      if (nonDangerousStateToRemember.longitudinalSafe || nonDangerousStateToRemember.lateralSafe)
-      {
-        auto const insertResult = newStatesBeforeDangerThresholdTime.insert(
-          RssSafeStateBeforeDangerThresholdTimeMap::value_type(currentState.situationId, nonDangerousStateToRemember));
+        // we might need to check here if left or right is the dangerous side
+        // but for the combineLateralResponse will only respect the more severe response
+        // omitting the check should have the same result
+        response.lateralResponseLeft
+          = combineResponse(currentState.lateralStateLeft.response, response.lateralResponseLeft);
 
-        if (result)
-        {
-          result = insertResult.second;
-        }
+        response.lateralResponseRight
+          = combineResponse(currentState.lateralStateRight.response, response.lateralResponseRight);
       }
     }
+    else
+    {
+      nonDangerousStateToRemember.longitudinalSafe = isLongitudinalSafe(currentState);
+      nonDangerousStateToRemember.lateralSafe = isLateralSafe(currentState);
+    }
 
-    if (result)
+    // store state for the next iteration
+    if (nonDangerousStateToRemember.longitudinalSafe || nonDangerousStateToRemember.lateralSafe)
+    {
+      auto const insertResult = nextResponseResolvingState.statesBeforeDangerThresholdTime.insert(
+        RssResponseResolvingState::RssSafeStateMap::value_type(currentState.situationId, nonDangerousStateToRemember));
+
+      result = insertResult.second;
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+
+  return result;
+}
+
+bool RssResponseResolving::addSkippedSituation(situation::SituationId const &situationId,
+                                               world::ObjectId const &objectId,
+                                               state::LongitudinalResponse const &longitudinalResponse,
+                                               state::LateralResponse const &lateralResponse,
+                                               state::ProperResponse &response)
+{
+  return addSkippedSituation(situationId,
+                             objectId,
+                             longitudinalResponse,
+                             lateralResponse,
+                             mResponseResolvingState,
+                             mNewResponseResolvingState,
+                             response);
+}
+
+bool RssResponseResolving::addSkippedSituation(situation::SituationId const &situationId,
+                                               world::ObjectId const &objectId,
+                                               state::LongitudinalResponse const &longitudinalResponse,
+                                               state::LateralResponse const &lateralResponse,
+                                               RssResponseResolvingState const &responseResolvingState,
+                                               RssResponseResolvingState &nextResponseResolvingState,
+                                               state::ProperResponse &response) const
+{
+  if (!withinValidInputRange(longitudinalResponse) || !withinValidInputRange(lateralResponse))
+  {
+    return false;
+  }
+
+  bool result = true;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    response.isSafe = false;
+    if (std::find(response.dangerousObjects.begin(), response.dangerousObjects.end(), objectId)
+        == response.dangerousObjects.end())
+    {
+      response.dangerousObjects.push_back(objectId);
+    }
+    response.longitudinalResponse = combineResponse(longitudinalResponse, response.longitudinalResponse);
+    response.lateralResponseLeft = combineResponse(lateralResponse, response.lateralResponseLeft);
+    response.lateralResponseRight = combineResponse(lateralResponse, response.lateralResponseRight);
+
+    // keep the state before the danger threshold time for the next iteration
+    auto const previousNonDangerousState = responseResolvingState.statesBeforeDangerThresholdTime.find(situationId);
+    if (previousNonDangerousState != responseResolvingState.statesBeforeDangerThresholdTime.end())
     {
-      // Determine resulting response
-      mStatesBeforeDangerThresholdTime.clear();
-      mStatesBeforeDangerThresholdTime.swap(newStatesBeforeDangerThresholdTime);
+      auto const insertResult
+        = nextResponseResolvingState.statesBeforeDangerThresholdTime.insert(*previousNonDangerousState);
+      result = insertResult.second;
     }
   }
   catch (...)
@@ -150,5 +272,16 @@ bool RssResponseResolving::provideProperResponse(state::RssStateSnapshot const &
   return result;
 }
 
+void RssResponseResolving::finishProperResponse(bool const commit)
+{
+  if (commit)
+  {
+    // Determine resulting response
+    mResponseResolvingState.statesBeforeDangerThresholdTime.swap(
+      mNewResponseResolvingState.statesBeforeDangerThresholdTime);
+  }
+  mNewResponseResolvingState.statesBeforeDangerThresholdTime.clear();
+}
+
 } // namespace core
 } // namespace ad_rss
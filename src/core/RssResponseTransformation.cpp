@@ -42,12 +42,26 @@ bool transformProperResponse(world::WorldModel const &worldModel,
                              state::ProperResponse const &response,
                              world::AccelerationRestriction &accelerationRestriction)
 {
-  if (!withinValidInputRange(worldModel) || !withinValidInputRange(response))
+  if (!withinValidInputRange(worldModel))
   {
     return false;
   }
 
-  if (worldModel.timeIndex != response.timeIndex)
+  return transformProperResponse(
+    worldModel.timeIndex, worldModel.egoVehicleRssDynamics, response, accelerationRestriction);
+}
+
+bool transformProperResponse(physics::TimeIndex const &timeIndex,
+                             world::RssDynamics const &egoVehicleRssDynamics,
+                             state::ProperResponse const &response,
+                             world::AccelerationRestriction &accelerationRestriction)
+{
+  if ((timeIndex == 0u) || !withinValidInputRange(egoVehicleRssDynamics) || !withinValidInputRange(response))
+  {
+    return false;
+  }
+
+  if (timeIndex != response.timeIndex)
   {
     return false;
   }
@@ -58,18 +72,18 @@ bool transformProperResponse(world::WorldModel const &worldModel,
    * given by the world model
    */
   // LCOV_EXCL_BR_START: unreachable exceptions due to valid input range checks
-  accelerationRestriction.longitudinalRange.minimum = -1. * worldModel.egoVehicleRssDynamics.alphaLon.brakeMax;
+  accelerationRestriction.longitudinalRange.minimum = -1. * egoVehicleRssDynamics.alphaLon.brakeMax;
   switch (response.longitudinalResponse)
   {
     case ::ad_rss::state::LongitudinalResponse::BrakeMin:
-      accelerationRestriction.longitudinalRange.maximum = -1. * worldModel.egoVehicleRssDynamics.alphaLon.brakeMin;
+      accelerationRestriction.longitudinalRange.maximum = -1. * egoVehicleRssDynamics.alphaLon.brakeMin;
       break;
     case ::ad_rss::state::LongitudinalResponse::BrakeMinCorrect:
       accelerationRestriction.longitudinalRange.maximum
-        = -1. * worldModel.egoVehicleRssDynamics.alphaLon.brakeMinCorrect;
+        = -1. * egoVehicleRssDynamics.alphaLon.brakeMinCorrect;
       break;
     case ::ad_rss::state::LongitudinalResponse::None:
-      accelerationRestriction.longitudinalRange.maximum = worldModel.egoVehicleRssDynamics.alphaLon.accelMax;
+      accelerationRestriction.longitudinalRange.maximum = egoVehicleRssDynamics.alphaLon.accelMax;
       break;
     default:
       return false; // LCOV_EXCL_LINE: unreachable code, keep to be on the safe side
@@ -79,12 +93,12 @@ bool transformProperResponse(world::WorldModel const &worldModel,
   switch (response.lateralResponseLeft)
   {
     case ::ad_rss::state::LateralResponse::BrakeMin:
-      accelerationRestriction.lateralLeftRange.maximum = -1. * worldModel.egoVehicleRssDynamics.alphaLat.brakeMin;
+      accelerationRestriction.lateralLeftRange.maximum = -1. * egoVehicleRssDynamics.alphaLat.brakeMin;
       accelerationRestriction.lateralLeftRange.minimum = std::numeric_limits<physics::Acceleration>::lowest();
       break;
     case ::ad_rss::state::LateralResponse::None:
-      accelerationRestriction.lateralLeftRange.maximum = worldModel.egoVehicleRssDynamics.alphaLat.accelMax;
-      accelerationRestriction.lateralLeftRange.minimum = -1. * worldModel.egoVehicleRssDynamics.alphaLat.brakeMin;
+      accelerationRestriction.lateralLeftRange.maximum = egoVehicleRssDynamics.alphaLat.accelMax;
+      accelerationRestriction.lateralLeftRange.minimum = -1. * egoVehicleRssDynamics.alphaLat.brakeMin;
       break;
     default:
       return false; // LCOV_EXCL_LINE: unreachable code, keep to be on the safe side
@@ -94,12 +108,12 @@ bool transformProperResponse(world::WorldModel const &worldModel,
   switch (response.lateralResponseRight)
   {
     case ::ad_rss::state::LateralResponse::BrakeMin:
-      accelerationRestriction.lateralRightRange.maximum = -1. * worldModel.egoVehicleRssDynamics.alphaLat.brakeMin;
+      accelerationRestriction.lateralRightRange.maximum = -1. * egoVehicleRssDynamics.alphaLat.brakeMin;
       accelerationRestriction.lateralRightRange.minimum = std::numeric_limits<physics::Acceleration>::lowest();
       break;
     case ::ad_rss::state::LateralResponse::None:
-      accelerationRestriction.lateralRightRange.maximum = worldModel.egoVehicleRssDynamics.alphaLat.accelMax;
-      accelerationRestriction.lateralRightRange.minimum = -1. * worldModel.egoVehicleRssDynamics.alphaLat.brakeMin;
+      accelerationRestriction.lateralRightRange.maximum = egoVehicleRssDynamics.alphaLat.accelMax;
+      accelerationRestriction.lateralRightRange.minimum = -1. * egoVehicleRssDynamics.alphaLat.brakeMin;
       break;
     default:
       return false; // LCOV_EXCL_LINE: unreachable code, keep to be on the safe side
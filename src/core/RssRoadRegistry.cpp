@@ -0,0 +1,151 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/core/RssRoadRegistry.hpp"
+#include "ad_rss/situation/SituationTypeValidInputRange.hpp"
+#include "ad_rss/world/ObjectValidInputRange.hpp"
+#include "ad_rss/world/RoadAreaValidInputRange.hpp"
+#include "ad_rss/world/RssDynamicsValidInputRange.hpp"
+#include "world/RssSituationCoordinateSystemConversion.hpp"
+#include "world/SceneReference.hpp"
+
+namespace ad_rss {
+namespace core {
+
+RssRoadRegistry::RssRoadRegistry()
+{
+}
+
+RssRoadRegistry::~RssRoadRegistry()
+{
+}
+
+bool RssRoadRegistry::registerRoad(world::RoadArea const &roadArea, RoadHandle &roadHandle)
+{
+  if (!withinValidInputRange(roadArea))
+  {
+    return false;
+  }
+
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    RegisteredRoad registeredRoad;
+    registeredRoad.roadArea = roadArea;
+    result = world::convertToCompactRoadArea(registeredRoad.roadArea, registeredRoad.compactRoadArea)
+      && world::calculateLateralDimensions(registeredRoad.compactRoadArea, registeredRoad.lateralRanges);
+    if (result)
+    {
+      registeredRoad.intersectionArea = world::calculateIntersectionArea(registeredRoad.roadArea);
+
+      // handles are not reused to detect outdated references
+      RoadHandle const newRoadHandle = mLastRoadHandle + 1u;
+      auto const insertResult
+        = mRegisteredRoads.insert(RegisteredRoadMap::value_type(newRoadHandle, std::move(registeredRoad)));
+      result = insertResult.second;
+      if (result)
+      {
+        mLastRoadHandle = newRoadHandle;
+        roadHandle = newRoadHandle;
+      }
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+
+  return result;
+}
+
+bool RssRoadRegistry::unregisterRoad(RoadHandle const &roadHandle)
+{
+  return mRegisteredRoads.erase(roadHandle) > 0u;
+}
+
+void RssRoadRegistry::clear()
+{
+  mRegisteredRoads.clear();
+}
+
+std::size_t RssRoadRegistry::size() const
+{
+  return mRegisteredRoads.size();
+}
+
+RssRoadRegistry::RegisteredRoad const *RssRoadRegistry::getRegisteredRoad(RoadHandle const &roadHandle) const
+{
+  if (roadHandle == 0u)
+  {
+    return &mEmptyRoad;
+  }
+  auto const findResult = mRegisteredRoads.find(roadHandle);
+  if (findResult == mRegisteredRoads.end())
+  {
+    return nullptr;
+  }
+  return &findResult->second;
+}
+
+} // namespace core
+} // namespace ad_rss
+
+bool withinValidInputRange(::ad_rss::core::RegisteredRoadScene const &input)
+{
+  try
+  {
+    return withinValidInputRange(input.situationType) && withinValidInputRange(input.egoVehicle)
+      && withinValidInputRange(input.object) && withinValidInputRange(input.objectRssDynamics);
+  }
+  catch (std::out_of_range &)
+  {
+  }
+  return false;
+}
+
+bool withinValidInputRange(::ad_rss::core::RegisteredRoadWorldModel const &input)
+{
+  try
+  {
+    bool inValidInputRange = withinValidInputRange(input.egoVehicleRssDynamics)
+      && (::ad_rss::physics::TimeIndex(1) <= input.timeIndex) && (input.scenes.size() <= std::size_t(1000));
+    for (auto const &scene : input.scenes)
+    {
+      inValidInputRange = inValidInputRange && withinValidInputRange(scene);
+    }
+    return inValidInputRange;
+  }
+  catch (std::out_of_range &)
+  {
+  }
+  return false;
+}
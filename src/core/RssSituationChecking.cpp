@@ -32,7 +32,9 @@
 #include "ad_rss/core/RssSituationChecking.hpp"
 #include <algorithm>
 #include <memory>
+#include "ad_rss/situation/RssSituationCriticality.hpp"
 #include "ad_rss/situation/SituationSnapshotValidInputRange.hpp"
+#include "ad_rss/state/RssStateOperation.hpp"
 #include "situation/RssIntersectionChecker.hpp"
 #include "situation/RssSituation.hpp"
 
@@ -45,14 +47,20 @@ enum class IsSafe
   No
 };
 
-inline state::RssState
-createRssState(situation::SituationId const &situationId, world::ObjectId const &objectId, IsSafe const &isSafeValue)
+inline state::RssStateInformation createEmptyRssStateInformation()
 {
-  bool const isSafe = (isSafeValue == IsSafe::Yes);
   state::RssStateInformation emptyRssStateInfo;
   emptyRssStateInfo.currentDistance = std::numeric_limits<physics::Distance>::max();
   emptyRssStateInfo.safeDistance = std::numeric_limits<physics::Distance>::max();
   emptyRssStateInfo.evaluator = state::RssStateEvaluator::None;
+  return emptyRssStateInfo;
+}
+
+inline state::RssState
+createRssState(situation::SituationId const &situationId, world::ObjectId const &objectId, IsSafe const &isSafeValue)
+{
+  bool const isSafe = (isSafeValue == IsSafe::Yes);
+  state::RssStateInformation const emptyRssStateInfo = createEmptyRssStateInformation();
 
   state::RssState resultRssState;
   resultRssState.situationId = situationId;
@@ -73,16 +81,10 @@ createRssState(situation::SituationId const &situationId, world::ObjectId const
   return resultRssState;
 }
 
-RssSituationChecking::RssSituationChecking()
+RssSituationChecking::RssSituationChecking(EvaluationMode const evaluationMode)
+  : mEvaluationMode(evaluationMode)
+  , mFormulaProvider(&situation::getDefaultFormulaProvider())
 {
-  try
-  {
-    mIntersectionChecker = std::unique_ptr<situation::RssIntersectionChecker>(new situation::RssIntersectionChecker());
-  }
-  catch (...)
-  {
-    mIntersectionChecker = nullptr;
-  }
 }
 
 RssSituationChecking::~RssSituationChecking()
@@ -91,39 +93,28 @@ RssSituationChecking::~RssSituationChecking()
 
 bool RssSituationChecking::checkSituationInputRangeChecked(situation::Situation const &situation,
                                                            state::RssState &rssState)
+{
+  return checkSituationInputRangeChecked(situation, mSituationCheckingState, rssState);
+}
+
+bool RssSituationChecking::checkSituationInputRangeChecked(situation::Situation const &situation,
+                                                           RssSituationCheckingState &situationCheckingState,
+                                                           state::RssState &rssState) const
 {
   bool result = false;
   // global try catch block to ensure this library call doesn't throw an exception
   try
   {
-    if (!static_cast<bool>(mIntersectionChecker))
-    {
-      return false;
-    }
-
     rssState = createRssState(situation.situationId, situation.objectId, IsSafe::No);
 
-    switch (situation.situationType)
+    if (mEvaluationMode == EvaluationMode::DecisionOnly)
     {
-      case situation::SituationType::NotRelevant:
-        rssState = createRssState(situation.situationId, situation.objectId, IsSafe::Yes);
-        result = true;
-        break;
-      case situation::SituationType::SameDirection:
-        result = calculateRssStateNonIntersectionSameDirection(situation, rssState);
-        break;
-      case situation::SituationType::OppositeDirection:
-        result = calculateRssStateNonIntersectionOppositeDirection(situation, rssState);
-        break;
-
-      case situation::SituationType::IntersectionEgoHasPriority:
-      case situation::SituationType::IntersectionObjectHasPriority:
-      case situation::SituationType::IntersectionSamePriority:
-        result = mIntersectionChecker->calculateRssStateIntersection(mCurrentTimeIndex, situation, rssState);
-        break;
-      default:
-        result = false;
-        break;
+      // the diagnostic information is provided on request only: keep the empty information of the created state
+      result = calculateRssDecision(situation, situationCheckingState, rssState);
+    }
+    else
+    {
+      result = calculateRssState(situation, situationCheckingState, rssState);
     }
   }
   catch (...)
@@ -134,14 +125,89 @@ bool RssSituationChecking::checkSituationInputRangeChecked(situation::Situation
   return result;
 }
 
+bool RssSituationChecking::calculateRssState(situation::Situation const &situation,
+                                             RssSituationCheckingState &situationCheckingState,
+                                             state::RssState &rssState) const
+{
+  bool result = false;
+  switch (situation.situationType)
+  {
+    case situation::SituationType::NotRelevant:
+      rssState = createRssState(situation.situationId, situation.objectId, IsSafe::Yes);
+      result = true;
+      break;
+    case situation::SituationType::SameDirection:
+      result = calculateRssStateNonIntersectionSameDirection(situation, *mFormulaProvider, rssState);
+      break;
+    case situation::SituationType::OppositeDirection:
+      result = calculateRssStateNonIntersectionOppositeDirection(situation, *mFormulaProvider, rssState);
+      break;
+
+    case situation::SituationType::IntersectionEgoHasPriority:
+    case situation::SituationType::IntersectionObjectHasPriority:
+    case situation::SituationType::IntersectionSamePriority:
+      result = situation::calculateRssStateIntersection(situationCheckingState.intersectionCheckingState,
+                                                        situationCheckingState.currentTimeIndex,
+                                                        situation,
+                                                        *mFormulaProvider,
+                                                        rssState);
+      break;
+    default:
+      result = false;
+      break;
+  }
+  return result;
+}
+
+bool RssSituationChecking::calculateRssDecision(situation::Situation const &situation,
+                                                RssSituationCheckingState &situationCheckingState,
+                                                state::RssState &rssState) const
+{
+  bool result = false;
+  switch (situation.situationType)
+  {
+    case situation::SituationType::NotRelevant:
+      rssState = createRssState(situation.situationId, situation.objectId, IsSafe::Yes);
+      result = true;
+      break;
+    case situation::SituationType::SameDirection:
+      result = calculateRssDecisionNonIntersectionSameDirection(situation, *mFormulaProvider, rssState);
+      break;
+    case situation::SituationType::OppositeDirection:
+      result = calculateRssDecisionNonIntersectionOppositeDirection(situation, *mFormulaProvider, rssState);
+      break;
+
+    case situation::SituationType::IntersectionEgoHasPriority:
+    case situation::SituationType::IntersectionObjectHasPriority:
+    case situation::SituationType::IntersectionSamePriority:
+      result = situation::calculateRssDecisionIntersection(situationCheckingState.intersectionCheckingState,
+                                                           situationCheckingState.currentTimeIndex,
+                                                           situation,
+                                                           *mFormulaProvider,
+                                                           rssState);
+      break;
+    default:
+      result = false;
+      break;
+  }
+  return result;
+}
+
 bool RssSituationChecking::checkSituations(situation::SituationSnapshot const &situationSnapshot,
                                            state::RssStateSnapshot &rssStateSnapshot)
+{
+  return checkSituations(situationSnapshot, mSituationCheckingState, rssStateSnapshot);
+}
+
+bool RssSituationChecking::checkSituations(situation::SituationSnapshot const &situationSnapshot,
+                                           RssSituationCheckingState &situationCheckingState,
+                                           state::RssStateSnapshot &rssStateSnapshot) const
 {
   if (!withinValidInputRange(situationSnapshot))
   {
     return false;
   }
-  if (!checkTimeIncreasingConsistently(situationSnapshot.timeIndex))
+  if (!checkTimeIncreasingConsistently(situationCheckingState, situationSnapshot.timeIndex))
   {
     return false;
   }
@@ -154,7 +220,7 @@ bool RssSituationChecking::checkSituations(situation::SituationSnapshot const &s
     for (auto const &situation : situationSnapshot.situations)
     {
       state::RssState rssState;
-      bool const checkResult = checkSituationInputRangeChecked(situation, rssState);
+      bool const checkResult = checkSituationInputRangeChecked(situation, situationCheckingState, rssState);
       if (checkResult)
       {
         rssStateSnapshot.individualResponses.push_back(rssState);
@@ -177,19 +243,203 @@ bool RssSituationChecking::checkSituations(situation::SituationSnapshot const &s
   return result;
 }
 
+bool RssSituationChecking::checkSituations(situation::SituationSnapshot const &situationSnapshot,
+                                           state::RssStateSnapshot &rssStateSnapshot,
+                                           std::vector<physics::Duration> &timesToDanger)
+{
+  return checkSituations(situationSnapshot, mSituationCheckingState, rssStateSnapshot, timesToDanger);
+}
+
+bool RssSituationChecking::checkSituations(situation::SituationSnapshot const &situationSnapshot,
+                                           RssSituationCheckingState &situationCheckingState,
+                                           state::RssStateSnapshot &rssStateSnapshot,
+                                           std::vector<physics::Duration> &timesToDanger) const
+{
+  timesToDanger.clear();
+  bool result = checkSituations(situationSnapshot, situationCheckingState, rssStateSnapshot);
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    timesToDanger.reserve(rssStateSnapshot.individualResponses.size());
+    for (std::size_t i = 0u; result && (i < rssStateSnapshot.individualResponses.size()); ++i)
+    {
+      physics::Duration timeToDanger(0.);
+      // the bound is only required for the situations which are safe
+      if (!state::isDangerous(rssStateSnapshot.individualResponses[i]))
+      {
+        result = situation::calculateTimeToDanger(situationSnapshot.situations[i], *mFormulaProvider, timeToDanger);
+      }
+      timesToDanger.push_back(timeToDanger);
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  if (!result)
+  {
+    rssStateSnapshot.individualResponses.clear();
+    timesToDanger.clear();
+  }
+  return result;
+}
+
+bool RssSituationChecking::startSituationChecks(physics::TimeIndex const &timeIndex)
+{
+  return startSituationChecks(timeIndex, mSituationCheckingState);
+}
+
+bool RssSituationChecking::startSituationChecks(physics::TimeIndex const &timeIndex,
+                                                RssSituationCheckingState &situationCheckingState) const
+{
+  if (timeIndex == 0u)
+  {
+    return false;
+  }
+  return checkTimeIncreasingConsistently(situationCheckingState, timeIndex);
+}
+
+bool RssSituationChecking::checkSituation(situation::Situation const &situation, state::RssState &rssState)
+{
+  return checkSituation(situation, mSituationCheckingState, rssState);
+}
+
+bool RssSituationChecking::checkSituation(situation::Situation const &situation,
+                                          RssSituationCheckingState &situationCheckingState,
+                                          state::RssState &rssState) const
+{
+  if (!withinValidInputRange(situation))
+  {
+    return false;
+  }
+  return checkSituationInputRangeChecked(situation, situationCheckingState, rssState);
+}
+
+bool RssSituationChecking::skipSituation(situation::Situation const &situation)
+{
+  return skipSituation(situation, mSituationCheckingState);
+}
+
+bool RssSituationChecking::skipSituation(situation::Situation const &situation,
+                                         RssSituationCheckingState &situationCheckingState) const
+{
+  if (!withinValidInputRange(situation))
+  {
+    return false;
+  }
+
+  bool result = true;
+  switch (situation.situationType)
+  {
+    case situation::SituationType::IntersectionEgoHasPriority:
+    case situation::SituationType::IntersectionObjectHasPriority:
+    case situation::SituationType::IntersectionSamePriority:
+      result = situation::keepIntersectionState(situationCheckingState.intersectionCheckingState,
+                                                situationCheckingState.currentTimeIndex,
+                                                situation.situationId);
+      break;
+    default:
+      break;
+  }
+  return result;
+}
+
+bool RssSituationChecking::calculateRssStateInformation(situation::Situation const &situation,
+                                                        state::RssState &rssState) const
+{
+  if (!withinValidInputRange(situation))
+  {
+    return false;
+  }
+
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    // the calculations are performed on a separate state to leave the decision parts of the input untouched
+    state::RssState fullRssState = createRssState(situation.situationId, situation.objectId, IsSafe::No);
+
+    switch (situation.situationType)
+    {
+      case situation::SituationType::NotRelevant:
+        result = true;
+        break;
+      case situation::SituationType::SameDirection:
+        result = calculateRssStateNonIntersectionSameDirection(situation, *mFormulaProvider, fullRssState);
+        break;
+      case situation::SituationType::OppositeDirection:
+        result = calculateRssStateNonIntersectionOppositeDirection(situation, *mFormulaProvider, fullRssState);
+        break;
+
+      case situation::SituationType::IntersectionEgoHasPriority:
+      case situation::SituationType::IntersectionObjectHasPriority:
+      case situation::SituationType::IntersectionSamePriority:
+        result = situation::calculateRssStateInformationIntersection(situation, *mFormulaProvider, fullRssState);
+        break;
+      default:
+        result = false;
+        break;
+    }
+
+    if (result)
+    {
+      rssState.longitudinalState.rssStateInformation = fullRssState.longitudinalState.rssStateInformation;
+      rssState.lateralStateLeft.rssStateInformation = fullRssState.lateralStateLeft.rssStateInformation;
+      rssState.lateralStateRight.rssStateInformation = fullRssState.lateralStateRight.rssStateInformation;
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+
+  return result;
+}
+
+bool RssSituationChecking::calculateTimeToDanger(situation::Situation const &situation,
+                                                 physics::Duration &timeToDanger) const
+{
+  if (!withinValidInputRange(situation))
+  {
+    return false;
+  }
+  return situation::calculateTimeToDanger(situation, *mFormulaProvider, timeToDanger);
+}
+
+RssSituationChecking::EvaluationMode RssSituationChecking::getEvaluationMode() const
+{
+  return mEvaluationMode;
+}
+
+void RssSituationChecking::setFormulaProvider(situation::RssFormulaProvider const &formulaProvider)
+{
+  mFormulaProvider = &formulaProvider;
+}
+
+situation::RssFormulaProvider const &RssSituationChecking::getFormulaProvider() const
+{
+  return *mFormulaProvider;
+}
+
 bool RssSituationChecking::checkTimeIncreasingConsistently(physics::TimeIndex const &nextTimeIndex)
+{
+  return checkTimeIncreasingConsistently(mSituationCheckingState, nextTimeIndex);
+}
+
+bool RssSituationChecking::checkTimeIncreasingConsistently(RssSituationCheckingState &situationCheckingState,
+                                                           physics::TimeIndex const &nextTimeIndex)
 {
   bool timeIsIncreasing = false;
-  if (mCurrentTimeIndex != nextTimeIndex)
+  if (situationCheckingState.currentTimeIndex != nextTimeIndex)
   {
     // check for overflow
-    physics::TimeIndex const deltaTimeIndex = nextTimeIndex - mCurrentTimeIndex;
+    physics::TimeIndex const deltaTimeIndex = nextTimeIndex - situationCheckingState.currentTimeIndex;
     if (deltaTimeIndex < (std::numeric_limits<physics::TimeIndex>::max() / 2))
     {
       timeIsIncreasing = true;
     }
   }
-  mCurrentTimeIndex = nextTimeIndex;
+  situationCheckingState.currentTimeIndex = nextTimeIndex;
   return timeIsIncreasing;
 }
 
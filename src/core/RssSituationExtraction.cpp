@@ -31,9 +31,13 @@
 
 #include "ad_rss/core/RssSituationExtraction.hpp"
 #include <algorithm>
+#include "ad_rss/world/RssDynamicsValidInputRange.hpp"
 #include "ad_rss/world/WorldModelValidInputRange.hpp"
+#include "ad_rss/world/WorldModelView.hpp"
+#include "situation/RssRelativePositionBatch.hpp"
 #include "world/RssSituationCoordinateSystemConversion.hpp"
 #include "world/RssSituationIdProvider.hpp"
+#include "world/SceneReference.hpp"
 
 namespace ad_rss {
 namespace core {
@@ -41,18 +45,26 @@ namespace core {
 using physics::Distance;
 using physics::MetricRange;
 
-RssSituationExtraction::RssSituationExtraction()
+namespace {
+
+void setRoadAreaReference(RssRoadRegistry::RegisteredRoad const *registeredRoad,
+                          world::RoadAreaReference &roadAreaReference)
 {
-  try
-  {
-    mSituationIdProvider = std::unique_ptr<world::RssSituationIdProvider>(new world::RssSituationIdProvider());
-  }
-  catch (...)
+  if (registeredRoad != nullptr)
   {
-    mSituationIdProvider = nullptr;
+    roadAreaReference.roadArea = &registeredRoad->roadArea;
+    roadAreaReference.compactRoadArea = &registeredRoad->compactRoadArea;
+    roadAreaReference.lateralRanges = &registeredRoad->lateralRanges;
+    roadAreaReference.intersectionArea = &registeredRoad->intersectionArea;
   }
 }
 
+} // namespace
+
+RssSituationExtraction::RssSituationExtraction()
+{
+}
+
 RssSituationExtraction::~RssSituationExtraction()
 {
 }
@@ -61,7 +73,7 @@ void RssSituationExtraction::calcluateRelativeLongitudinalPosition(
   MetricRange const &egoMetricRange,
   MetricRange const &otherMetricRange,
   situation::LongitudinalRelativePosition &longitudinalPosition,
-  Distance &longitudinalDistance)
+  Distance &longitudinalDistance) const
 {
   if (egoMetricRange.minimum > otherMetricRange.maximum)
   {
@@ -95,7 +107,7 @@ void RssSituationExtraction::calcluateRelativeLongitudinalPositionIntersection(
   MetricRange const &egoMetricRange,
   MetricRange const &otherMetricRange,
   situation::LongitudinalRelativePosition &longitudinalPosition,
-  Distance &longitudinalDistance)
+  Distance &longitudinalDistance) const
 {
   if (egoMetricRange.maximum < otherMetricRange.minimum)
   {
@@ -128,7 +140,7 @@ void RssSituationExtraction::calcluateRelativeLongitudinalPositionIntersection(
 void RssSituationExtraction::calcluateRelativeLateralPosition(MetricRange const &egoMetricRange,
                                                               MetricRange const &otherMetricRange,
                                                               situation::LateralRelativePosition &lateralPosition,
-                                                              Distance &lateralDistance)
+                                                              Distance &lateralDistance) const
 {
   if (egoMetricRange.minimum > otherMetricRange.maximum)
   {
@@ -158,69 +170,114 @@ void RssSituationExtraction::calcluateRelativeLateralPosition(MetricRange const
   }
 }
 
-bool RssSituationExtraction::convertObjectsNonIntersection(world::Scene const &currentScene,
-                                                           situation::Situation &situation)
+bool RssSituationExtraction::convertObjectsNonIntersection(world::SceneReference const &currentScene,
+                                                           situation::Situation &situation) const
 {
-  if (!currentScene.intersectingRoad.empty())
+  if (!world::isEmpty(currentScene.intersectingRoad))
   {
     return false;
   }
 
-  bool result = true;
-
   world::ObjectDimensions egoVehicleDimension;
   world::ObjectDimensions objectToBeCheckedDimension;
-  result = calculateObjectDimensions(currentScene, egoVehicleDimension, objectToBeCheckedDimension);
+  bool const result = calculateObjectDimensions(currentScene.egoVehicle,
+                                                currentScene.object,
+                                                currentScene.egoVehicleRoad,
+                                                egoVehicleDimension,
+                                                objectToBeCheckedDimension);
+  if (result)
+  {
+    convertObjectDimensionsNonIntersection(
+      currentScene.situationType, egoVehicleDimension, objectToBeCheckedDimension, situation);
+  }
+  return result;
+}
 
+void RssSituationExtraction::convertObjectDimensionsNonIntersection(situation::SituationType const &situationType,
+                                                                    world::ObjectDimensions const &egoVehicleDimension,
+                                                                    world::ObjectDimensions const &objectDimension,
+                                                                    situation::Situation &situation) const
+{
   situation::LongitudinalRelativePosition longitudinalPosition;
   Distance longitudinalDistance;
   calcluateRelativeLongitudinalPosition(egoVehicleDimension.longitudinalDimensions,
-                                        objectToBeCheckedDimension.longitudinalDimensions,
+                                        objectDimension.longitudinalDimensions,
                                         longitudinalPosition,
                                         longitudinalDistance);
 
   situation.relativePosition.longitudinalPosition = longitudinalPosition;
   situation.relativePosition.longitudinalDistance = longitudinalDistance;
 
+  convertLaneInformationNonIntersection(situationType, egoVehicleDimension, objectDimension, situation);
+
+  /**
+   * Set lateral restrictions
+   */
+  situation::LateralRelativePosition lateralPosition;
+  Distance lateralDistance;
+  calcluateRelativeLateralPosition(egoVehicleDimension.lateralDimensions,
+                                   objectDimension.lateralDimensions,
+                                   lateralPosition,
+                                   lateralDistance);
+
+  situation.relativePosition.lateralPosition = lateralPosition;
+  situation.relativePosition.lateralDistance = lateralDistance;
+}
+
+void RssSituationExtraction::convertLaneInformationNonIntersection(situation::SituationType const &situationType,
+                                                                   world::ObjectDimensions const &egoVehicleDimension,
+                                                                   world::ObjectDimensions const &objectDimension,
+                                                                   situation::Situation &situation) const
+{
   situation.egoVehicleState.isInCorrectLane = !egoVehicleDimension.onNegativeLane;
 
-  if (currentScene.situationType == ::ad_rss::situation::SituationType::OppositeDirection)
+  if (situationType == ::ad_rss::situation::SituationType::OppositeDirection)
   {
-    situation.otherVehicleState.isInCorrectLane = !objectToBeCheckedDimension.onPositiveLane;
+    situation.otherVehicleState.isInCorrectLane = !objectDimension.onPositiveLane;
   }
   else
   {
-    situation.otherVehicleState.isInCorrectLane = !objectToBeCheckedDimension.onNegativeLane;
-  }
-
-  /**
-   * Set lateral restrictions
-   */
-  if (result)
-  {
-    situation::LateralRelativePosition lateralPosition;
-    Distance lateralDistance;
-    calcluateRelativeLateralPosition(egoVehicleDimension.lateralDimensions,
-                                     objectToBeCheckedDimension.lateralDimensions,
-                                     lateralPosition,
-                                     lateralDistance);
-
-    situation.relativePosition.lateralPosition = lateralPosition;
-    situation.relativePosition.lateralDistance = lateralDistance;
+    situation.otherVehicleState.isInCorrectLane = !objectDimension.onNegativeLane;
   }
-  return result;
 }
 
 void RssSituationExtraction::convertToIntersectionCentric(MetricRange const &objectDimension,
                                                           MetricRange const &intersectionPosition,
-                                                          MetricRange &dimensionsIntersection)
+                                                          MetricRange &dimensionsIntersection) const
 {
   dimensionsIntersection.maximum = intersectionPosition.minimum - objectDimension.minimum;
   dimensionsIntersection.minimum = intersectionPosition.minimum - objectDimension.maximum;
 }
 
-bool RssSituationExtraction::convertObjectsIntersection(world::Scene const &currentScene,
-                                                        situation::Situation &situation)
+bool RssSituationExtraction::convertObjectsIntersection(world::SceneReference const &currentScene,
+                                                        situation::Situation &situation) const
+{
+  MetricRange egoDimensionsIntersection;
+  MetricRange objectDimensionsIntersection;
+  bool const result = convertObjectStatesIntersection(
+    currentScene, situation, egoDimensionsIntersection, objectDimensionsIntersection);
+
+  if (result)
+  {
+    situation::LongitudinalRelativePosition longitudinalPosition;
+    Distance longitudinalDistance;
+    calcluateRelativeLongitudinalPositionIntersection(
+      egoDimensionsIntersection, objectDimensionsIntersection, longitudinalPosition, longitudinalDistance);
+
+    situation.relativePosition.longitudinalPosition = longitudinalPosition;
+    situation.relativePosition.longitudinalDistance = longitudinalDistance;
+
+    situation.relativePosition.lateralPosition = situation::LateralRelativePosition::Overlap;
+    situation.relativePosition.lateralDistance = Distance(0.);
+  }
+
+  return result;
+}
+
+bool RssSituationExtraction::convertObjectStatesIntersection(world::SceneReference const &currentScene,
+                                                             situation::Situation &situation,
+                                                             MetricRange &egoDimensionsIntersection,
+                                                             MetricRange &objectDimensionsIntersection) const
 {
   world::ObjectDimensions egoVehicleDimension;
   world::ObjectDimensions objectDimension;
@@ -236,12 +293,9 @@ bool RssSituationExtraction::convertObjectsIntersection(world::Scene const &curr
 
     // For intersection the lanes don't have the same origin so the positions cannot be directly compared
     // Intersection entry should be the common point so convert the positions to this reference point
-    MetricRange egoDimensionsIntersection;
     convertToIntersectionCentric(
       egoVehicleDimension.longitudinalDimensions, egoVehicleDimension.intersectionPosition, egoDimensionsIntersection);
 
-    MetricRange objectDimensionsIntersection;
-
     convertToIntersectionCentric(
       objectDimension.longitudinalDimensions, objectDimension.intersectionPosition, objectDimensionsIntersection);
 
@@ -253,17 +307,6 @@ bool RssSituationExtraction::convertObjectsIntersection(world::Scene const &curr
       = std::max(Distance(0.), objectDimensionsIntersection.minimum);
     situation.otherVehicleState.distanceToLeaveIntersection
       = objectDimension.intersectionPosition.maximum - objectDimension.longitudinalDimensions.minimum;
-
-    situation::LongitudinalRelativePosition longitudinalPosition;
-    Distance longitudinalDistance;
-    calcluateRelativeLongitudinalPositionIntersection(
-      egoDimensionsIntersection, objectDimensionsIntersection, longitudinalPosition, longitudinalDistance);
-
-    situation.relativePosition.longitudinalPosition = longitudinalPosition;
-    situation.relativePosition.longitudinalDistance = longitudinalDistance;
-
-    situation.relativePosition.lateralPosition = situation::LateralRelativePosition::Overlap;
-    situation.relativePosition.lateralDistance = Distance(0.);
   }
 
   if (currentScene.situationType == situation::SituationType::IntersectionEgoHasPriority)
@@ -290,10 +333,7 @@ bool RssSituationExtraction::convertObjectsIntersection(world::Scene const &curr
   return result;
 }
 
-bool RssSituationExtraction::extractSituationInputRangeChecked(physics::TimeIndex const &timeIndex,
-                                                               world::RssDynamics const &egoVehicleRssDynamics,
-                                                               world::Scene const &currentScene,
-                                                               situation::Situation &situation)
+bool RssSituationExtraction::isSceneConsistent(world::SceneReference const &currentScene) const
 {
   // ensure the object types are semantically correct
   // @toDo: add this restriction to the data type model
@@ -308,33 +348,110 @@ bool RssSituationExtraction::extractSituationInputRangeChecked(physics::TimeInde
   {
     return false;
   }
-  if (!static_cast<bool>(mSituationIdProvider))
+  return true;
+}
+
+bool RssSituationExtraction::extractSituationInputRangeChecked(physics::TimeIndex const &timeIndex,
+                                                               world::RssDynamics const &egoVehicleRssDynamics,
+                                                               world::Scene const &currentScene,
+                                                               situation::Situation &situation)
+{
+  world::SceneReference const sceneReference = world::createSceneReference(currentScene);
+  if (!isSceneConsistent(sceneReference))
   {
     return false;
   }
-
   bool result = false;
 
   try
   {
-    situation.situationId = mSituationIdProvider->getSituationId(timeIndex, currentScene);
-    situation.objectId = currentScene.object.objectId;
-    situation.situationType = currentScene.situationType;
+    situation::SituationId const situationId
+      = world::RssSituationIdProvider::getSituationId(mSituationIdState, timeIndex, sceneReference);
+    result = convertSceneToSituation(situationId, egoVehicleRssDynamics, sceneReference, situation);
+  }
+  catch (...)
+  {
+    result = false;
+  }
 
-    situation.egoVehicleState.hasPriority = false;
-    situation.otherVehicleState.hasPriority = false;
+  return result;
+}
+
+void RssSituationExtraction::initializeSituation(situation::SituationId const &situationId,
+                                                 situation::SituationType const &situationType,
+                                                 world::ObjectView const &egoVehicle,
+                                                 world::RssDynamics const &egoVehicleRssDynamics,
+                                                 world::ObjectView const &object,
+                                                 world::RssDynamics const &objectRssDynamics,
+                                                 situation::Situation &situation) const
+{
+  situation.situationId = situationId;
+  situation.objectId = object.objectId;
+  situation.situationType = situationType;
 
-    situation.egoVehicleState.isInCorrectLane = true;
-    situation.otherVehicleState.isInCorrectLane = true;
+  situation.egoVehicleState.hasPriority = false;
+  situation.otherVehicleState.hasPriority = false;
 
-    situation.egoVehicleState.distanceToEnterIntersection = Distance(0.);
-    situation.egoVehicleState.distanceToLeaveIntersection = Distance(1000.);
+  situation.egoVehicleState.isInCorrectLane = true;
+  situation.otherVehicleState.isInCorrectLane = true;
 
-    situation.otherVehicleState.distanceToEnterIntersection = Distance(0.);
-    situation.otherVehicleState.distanceToLeaveIntersection = Distance(1000.);
+  situation.egoVehicleState.distanceToEnterIntersection = Distance(0.);
+  situation.egoVehicleState.distanceToLeaveIntersection = Distance(1000.);
 
-    convertVehicleStateDynamics(currentScene.egoVehicle, egoVehicleRssDynamics, situation.egoVehicleState);
-    convertVehicleStateDynamics(currentScene.object, currentScene.objectRssDynamics, situation.otherVehicleState);
+  situation.otherVehicleState.distanceToEnterIntersection = Distance(0.);
+  situation.otherVehicleState.distanceToLeaveIntersection = Distance(1000.);
+
+  convertVehicleStateDynamics(egoVehicle, egoVehicleRssDynamics, situation.egoVehicleState);
+  convertVehicleStateDynamics(object, objectRssDynamics, situation.otherVehicleState);
+}
+
+bool RssSituationExtraction::convertObjectsToSituation(situation::SituationId const &situationId,
+                                                       situation::SituationType const &situationType,
+                                                       world::ObjectView const &egoVehicle,
+                                                       world::RssDynamics const &egoVehicleRssDynamics,
+                                                       world::ObjectDimensions const &egoVehicleDimensions,
+                                                       world::ObjectView const &object,
+                                                       world::RssDynamics const &objectRssDynamics,
+                                                       world::ObjectDimensions const &objectDimensions,
+                                                       situation::Situation &situation) const
+{
+  if ((situationType != situation::SituationType::SameDirection)
+      && (situationType != situation::SituationType::OppositeDirection))
+  {
+    return false;
+  }
+
+  bool result = false;
+  try
+  {
+    initializeSituation(
+      situationId, situationType, egoVehicle, egoVehicleRssDynamics, object, objectRssDynamics, situation);
+    convertObjectDimensionsNonIntersection(situationType, egoVehicleDimensions, objectDimensions, situation);
+    result = true;
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+bool RssSituationExtraction::convertSceneToSituation(situation::SituationId const &situationId,
+                                                     world::RssDynamics const &egoVehicleRssDynamics,
+                                                     world::SceneReference const &currentScene,
+                                                     situation::Situation &situation) const
+{
+  bool result = false;
+
+  try
+  {
+    initializeSituation(situationId,
+                        currentScene.situationType,
+                        currentScene.egoVehicle,
+                        egoVehicleRssDynamics,
+                        currentScene.object,
+                        *currentScene.objectRssDynamics,
+                        situation);
 
     switch (currentScene.situationType)
     {
@@ -372,9 +489,84 @@ bool RssSituationExtraction::extractSituationInputRangeChecked(physics::TimeInde
   return result;
 }
 
+bool RssSituationExtraction::prepareSceneConversion(situation::SituationId const &situationId,
+                                                    world::RssDynamics const &egoVehicleRssDynamics,
+                                                    world::SceneReference const &currentScene,
+                                                    situation::Situation &situation,
+                                                    std::size_t const batchIndex,
+                                                    situation::RelativePositionBatch &longitudinalBatch,
+                                                    situation::RelativePositionBatch &lateralBatch) const
+{
+  bool result = false;
+
+  try
+  {
+    initializeSituation(situationId,
+                        currentScene.situationType,
+                        currentScene.egoVehicle,
+                        egoVehicleRssDynamics,
+                        currentScene.object,
+                        *currentScene.objectRssDynamics,
+                        situation);
+
+    switch (currentScene.situationType)
+    {
+      case ad_rss::situation::SituationType::SameDirection:
+      case ad_rss::situation::SituationType::OppositeDirection:
+      {
+        world::ObjectDimensions egoVehicleDimension;
+        world::ObjectDimensions objectDimension;
+        result = world::isEmpty(currentScene.intersectingRoad)
+          && calculateObjectDimensions(currentScene.egoVehicle,
+                                       currentScene.object,
+                                       currentScene.egoVehicleRoad,
+                                       egoVehicleDimension,
+                                       objectDimension);
+        if (result)
+        {
+          convertLaneInformationNonIntersection(
+            currentScene.situationType, egoVehicleDimension, objectDimension, situation);
+          longitudinalBatch.setRanges(
+            batchIndex, egoVehicleDimension.longitudinalDimensions, objectDimension.longitudinalDimensions);
+          lateralBatch.setRanges(batchIndex, egoVehicleDimension.lateralDimensions, objectDimension.lateralDimensions);
+        }
+        break;
+      }
+      case ad_rss::situation::SituationType::IntersectionEgoHasPriority:
+      case ad_rss::situation::SituationType::IntersectionObjectHasPriority:
+      case ad_rss::situation::SituationType::IntersectionSamePriority:
+      {
+        MetricRange egoDimensionsIntersection;
+        MetricRange objectDimensionsIntersection;
+        result = convertObjectStatesIntersection(
+          currentScene, situation, egoDimensionsIntersection, objectDimensionsIntersection);
+        if (result)
+        {
+          longitudinalBatch.setRangesIntersection(
+            batchIndex, egoDimensionsIntersection, objectDimensionsIntersection);
+          lateralBatch.setOverlap(batchIndex);
+        }
+        break;
+      }
+      default:
+      {
+        // not relevant scenes are not part of any situation
+        result = false;
+        break;
+      }
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+
+  return result;
+}
+
 bool RssSituationExtraction::mergeVehicleStates(MergeMode const &mergeMode,
                                                 situation::VehicleState const &otherVehicleState,
-                                                situation::VehicleState &mergedVehicleState)
+                                                situation::VehicleState &mergedVehicleState) const
 {
   // on vehicle states there are only differences in intersection distances allowed due to different road definitions
   if ((otherVehicleState.dynamics.alphaLat.accelMax != mergedVehicleState.dynamics.alphaLat.accelMax)
@@ -418,7 +610,7 @@ bool RssSituationExtraction::mergeVehicleStates(MergeMode const &mergeMode,
 }
 
 bool RssSituationExtraction::mergeSituations(situation::Situation const &otherSituation,
-                                             situation::Situation &mergedSituation)
+                                             situation::Situation &mergedSituation) const
 {
   if ( // basic data has to match
     (otherSituation.situationId != mergedSituation.situationId) || (otherSituation.objectId != mergedSituation.objectId)
@@ -514,44 +706,82 @@ bool RssSituationExtraction::mergeSituations(situation::Situation const &otherSi
   return true;
 }
 
-bool RssSituationExtraction::extractSituations(world::WorldModel const &worldModel,
-                                               situation::SituationSnapshot &situationSnapshot)
+bool RssSituationExtraction::createSceneReference(RegisteredRoadScene const &scene,
+                                                  RssRoadRegistry const &roadRegistry,
+                                                  world::SceneReference &sceneReference) const
 {
-  if (!withinValidInputRange(worldModel))
-  {
-    return false;
-  }
+  auto const egoVehicleRoad = roadRegistry.getRegisteredRoad(scene.egoVehicleRoad);
+  auto const intersectingRoad = roadRegistry.getRegisteredRoad(scene.intersectingRoad);
 
+  sceneReference = world::SceneReference();
+  sceneReference.situationType = scene.situationType;
+  sceneReference.egoVehicle = world::createObjectView(scene.egoVehicle);
+  sceneReference.object = world::createObjectView(scene.object);
+  sceneReference.objectRssDynamics = &scene.objectRssDynamics;
+  setRoadAreaReference(egoVehicleRoad, sceneReference.egoVehicleRoad);
+  setRoadAreaReference(intersectingRoad, sceneReference.intersectingRoad);
+
+  // the roads of not relevant scenes are never accessed
+  return ((egoVehicleRoad != nullptr) && (intersectingRoad != nullptr))
+    || (scene.situationType == situation::SituationType::NotRelevant);
+}
+
+template <class SceneReferenceAccess>
+bool RssSituationExtraction::groupSceneReferencesBySituation(physics::TimeIndex const &timeIndex,
+                                                             std::size_t const numberOfScenes,
+                                                             SceneReferenceAccess const &getSceneReference,
+                                                             RssSituationIdState &situationIdState,
+                                                             SituationScenesVector &situationScenesVector) const
+{
   bool result = true;
   try
   {
-    situationSnapshot.timeIndex = worldModel.timeIndex;
-    situationSnapshot.situations.clear();
-    for (auto const &scene : worldModel.scenes)
+    situationScenesVector.clear();
+    for (std::size_t sceneIndex = 0u; sceneIndex < numberOfScenes; ++sceneIndex)
     {
-      situation::Situation situation;
-      bool const extractResult
-        = extractSituationInputRangeChecked(worldModel.timeIndex, worldModel.egoVehicleRssDynamics, scene, situation);
+      world::SceneReference scene;
+      if (!getSceneReference(sceneIndex, scene))
+      {
+        result = false;
+        continue;
+      }
+      situation::SituationId situationId = 0u;
+      bool sceneResult = isSceneConsistent(scene);
+      if (sceneResult)
+      {
+        // the situation id is requested also for not relevant scenes to keep the id provider history consistent
+        try
+        {
+          situationId = world::RssSituationIdProvider::getSituationId(situationIdState, timeIndex, scene);
+        }
+        catch (...)
+        {
+          sceneResult = false;
+        }
+      }
 
-      // if the situation is relevant, add it to situationSnapshot
+      // if the situation is relevant, add it to the situation groups
       if (scene.situationType != ad_rss::situation::SituationType::NotRelevant)
       {
-        if (extractResult)
+        if (sceneResult)
         {
           // situation id creation might detect that different scenes are representing identical situations
-          // ensure the situationSnapshot is unique while containing the worst-case situation
-          auto findResult = std::find_if(situationSnapshot.situations.begin(),
-                                         situationSnapshot.situations.end(),
-                                         [&situation](ad_rss::situation::Situation const &checkSituation) {
-                                           return checkSituation.situationId == situation.situationId;
+          // ensure these are grouped together to be able to create the worst-case situation out of them
+          auto findResult = std::find_if(situationScenesVector.begin(),
+                                         situationScenesVector.end(),
+                                         [&situationId](SituationScenes const &checkSituationScenes) {
+                                           return checkSituationScenes.situationId == situationId;
                                          });
-          if (findResult == situationSnapshot.situations.end())
+          if (findResult == situationScenesVector.end())
           {
-            situationSnapshot.situations.push_back(situation);
+            SituationScenes situationScenes;
+            situationScenes.situationId = situationId;
+            situationScenes.sceneIndices.push_back(sceneIndex);
+            situationScenesVector.push_back(situationScenes);
           }
-          else if (!mergeSituations(situation, *findResult))
+          else
           {
-            result = false;
+            findResult->sceneIndices.push_back(sceneIndex);
           }
         }
         else
@@ -568,5 +798,382 @@ bool RssSituationExtraction::extractSituations(world::WorldModel const &worldMod
   return result;
 }
 
+template <class SceneReferenceAccess>
+bool RssSituationExtraction::extractSituationFromSceneReferences(world::RssDynamics const &egoVehicleRssDynamics,
+                                                                 SceneReferenceAccess const &getSceneReference,
+                                                                 SituationScenes const &situationScenes,
+                                                                 situation::Situation &situation) const
+{
+  if (situationScenes.sceneIndices.empty())
+  {
+    return false;
+  }
+
+  bool result = true;
+  try
+  {
+    for (auto sceneIndex = situationScenes.sceneIndices.begin();
+         result && (sceneIndex != situationScenes.sceneIndices.end());
+         ++sceneIndex)
+    {
+      world::SceneReference scene;
+      result = getSceneReference(*sceneIndex, scene);
+      if (!result)
+      {
+        break;
+      }
+      if (sceneIndex == situationScenes.sceneIndices.begin())
+      {
+        result = convertSceneToSituation(situationScenes.situationId, egoVehicleRssDynamics, scene, situation);
+      }
+      else
+      {
+        // ensure the situation is containing the worst-case of all scenes
+        situation::Situation otherSituation;
+        result = convertSceneToSituation(situationScenes.situationId, egoVehicleRssDynamics, scene, otherSituation);
+        result = result && mergeSituations(otherSituation, situation);
+      }
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+template <class SceneReferenceAccess>
+bool RssSituationExtraction::extractSituationsFromSceneReferences(world::RssDynamics const &egoVehicleRssDynamics,
+                                                                  SceneReferenceAccess const &getSceneReference,
+                                                                  SituationScenesVector const &situationScenesVector,
+                                                                  situation::SituationSnapshot &situationSnapshot) const
+{
+  bool result = true;
+  try
+  {
+    std::size_t numberOfScenes = 0u;
+    for (auto const &situationScenes : situationScenesVector)
+    {
+      if (situationScenes.sceneIndices.empty())
+      {
+        return false;
+      }
+      numberOfScenes += situationScenes.sceneIndices.size();
+    }
+
+    // convert all scenes collecting the metric ranges of the relative positions
+    std::vector<situation::Situation> sceneSituations(numberOfScenes);
+    situation::RelativePositionBatch longitudinalBatch;
+    situation::RelativePositionBatch lateralBatch;
+    longitudinalBatch.resize(numberOfScenes);
+    lateralBatch.resize(numberOfScenes);
+    std::size_t batchIndex = 0u;
+    for (auto situationScenes = situationScenesVector.begin();
+         result && (situationScenes != situationScenesVector.end());
+         ++situationScenes)
+    {
+      for (auto sceneIndex = situationScenes->sceneIndices.begin();
+           result && (sceneIndex != situationScenes->sceneIndices.end());
+           ++sceneIndex)
+      {
+        world::SceneReference scene;
+        result = getSceneReference(*sceneIndex, scene)
+          && prepareSceneConversion(situationScenes->situationId,
+                                    egoVehicleRssDynamics,
+                                    scene,
+                                    sceneSituations[batchIndex],
+                                    batchIndex,
+                                    longitudinalBatch,
+                                    lateralBatch);
+        ++batchIndex;
+      }
+    }
+
+    // classify the relative positions of all scenes at once
+    result = result && situation::calculateRelativePositionBatch(longitudinalBatch)
+      && situation::calculateRelativePositionBatch(lateralBatch);
+
+    // merge the scenes of each situation into the worst-case
+    batchIndex = 0u;
+    for (auto situationScenes = situationScenesVector.begin();
+         result && (situationScenes != situationScenesVector.end());
+         ++situationScenes)
+    {
+      for (std::size_t i = 0u; result && (i < situationScenes->sceneIndices.size()); ++i)
+      {
+        situation::Situation &sceneSituation = sceneSituations[batchIndex];
+        sceneSituation.relativePosition.longitudinalPosition
+          = situation::toLongitudinalRelativePosition(longitudinalBatch.position[batchIndex]);
+        sceneSituation.relativePosition.longitudinalDistance = Distance(longitudinalBatch.distance[batchIndex]);
+        sceneSituation.relativePosition.lateralPosition
+          = situation::toLateralRelativePosition(lateralBatch.position[batchIndex]);
+        sceneSituation.relativePosition.lateralDistance = Distance(lateralBatch.distance[batchIndex]);
+        if (i == 0u)
+        {
+          situationSnapshot.situations.push_back(sceneSituation);
+        }
+        else
+        {
+          result = mergeSituations(sceneSituation, situationSnapshot.situations.back());
+        }
+        ++batchIndex;
+      }
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+bool RssSituationExtraction::groupScenesBySituation(world::WorldModel const &worldModel,
+                                                    SituationScenesVector &situationScenesVector)
+{
+  return groupScenesBySituation(worldModel, mSituationIdState, situationScenesVector);
+}
+
+bool RssSituationExtraction::groupScenesBySituation(world::WorldModel const &worldModel,
+                                                    RssSituationIdState &situationIdState,
+                                                    SituationScenesVector &situationScenesVector) const
+{
+  if (!withinValidInputRange(worldModel))
+  {
+    return false;
+  }
+
+  return groupSceneReferencesBySituation(
+    worldModel.timeIndex,
+    worldModel.scenes.size(),
+    [&worldModel](std::size_t const sceneIndex, world::SceneReference &sceneReference) {
+      sceneReference = world::createSceneReference(worldModel.scenes[sceneIndex]);
+      return true;
+    },
+    situationIdState,
+    situationScenesVector);
+}
+
+bool RssSituationExtraction::extractSituation(world::WorldModel const &worldModel,
+                                              SituationScenes const &situationScenes,
+                                              situation::Situation &situation) const
+{
+  return extractSituationFromSceneReferences(
+    worldModel.egoVehicleRssDynamics,
+    [&worldModel](std::size_t const sceneIndex, world::SceneReference &sceneReference) {
+      sceneReference = world::createSceneReference(worldModel.scenes.at(sceneIndex));
+      return true;
+    },
+    situationScenes,
+    situation);
+}
+
+bool RssSituationExtraction::groupScenesBySituation(RegisteredRoadWorldModel const &worldModel,
+                                                    RssRoadRegistry const &roadRegistry,
+                                                    SituationScenesVector &situationScenesVector)
+{
+  return groupScenesBySituation(worldModel, roadRegistry, mSituationIdState, situationScenesVector);
+}
+
+bool RssSituationExtraction::groupScenesBySituation(RegisteredRoadWorldModel const &worldModel,
+                                                    RssRoadRegistry const &roadRegistry,
+                                                    RssSituationIdState &situationIdState,
+                                                    SituationScenesVector &situationScenesVector) const
+{
+  if (!withinValidInputRange(worldModel))
+  {
+    return false;
+  }
+
+  return groupSceneReferencesBySituation(
+    worldModel.timeIndex,
+    worldModel.scenes.size(),
+    [this, &worldModel, &roadRegistry](std::size_t const sceneIndex, world::SceneReference &sceneReference) {
+      return createSceneReference(worldModel.scenes[sceneIndex], roadRegistry, sceneReference);
+    },
+    situationIdState,
+    situationScenesVector);
+}
+
+bool RssSituationExtraction::extractSituation(RegisteredRoadWorldModel const &worldModel,
+                                              RssRoadRegistry const &roadRegistry,
+                                              SituationScenes const &situationScenes,
+                                              situation::Situation &situation) const
+{
+  return extractSituationFromSceneReferences(
+    worldModel.egoVehicleRssDynamics,
+    [this, &worldModel, &roadRegistry](std::size_t const sceneIndex, world::SceneReference &sceneReference) {
+      return createSceneReference(worldModel.scenes.at(sceneIndex), roadRegistry, sceneReference);
+    },
+    situationScenes,
+    situation);
+}
+
+bool RssSituationExtraction::groupScenesBySituation(world::WorldModelView const &worldModel,
+                                                    SituationScenesVector &situationScenesVector)
+{
+  return groupScenesBySituation(worldModel, mSituationIdState, situationScenesVector);
+}
+
+bool RssSituationExtraction::groupScenesBySituation(world::WorldModelView const &worldModel,
+                                                    RssSituationIdState &situationIdState,
+                                                    SituationScenesVector &situationScenesVector) const
+{
+  if (!withinValidInputRange(worldModel))
+  {
+    return false;
+  }
+
+  return groupSceneReferencesBySituation(
+    worldModel.timeIndex,
+    worldModel.scenes.size(),
+    [&worldModel](std::size_t const sceneIndex, world::SceneReference &sceneReference) {
+      sceneReference = world::createSceneReference(worldModel.scenes[sceneIndex]);
+      return true;
+    },
+    situationIdState,
+    situationScenesVector);
+}
+
+bool RssSituationExtraction::extractSituation(world::WorldModelView const &worldModel,
+                                              SituationScenes const &situationScenes,
+                                              situation::Situation &situation) const
+{
+  return extractSituationFromSceneReferences(
+    worldModel.egoVehicleRssDynamics,
+    [&worldModel](std::size_t const sceneIndex, world::SceneReference &sceneReference) {
+      if (sceneIndex >= worldModel.scenes.size())
+      {
+        return false;
+      }
+      sceneReference = world::createSceneReference(worldModel.scenes[sceneIndex]);
+      return true;
+    },
+    situationScenes,
+    situation);
+}
+
+bool RssSituationExtraction::extractSituations(world::WorldModel const &worldModel,
+                                               situation::SituationSnapshot &situationSnapshot)
+{
+  return extractSituations(worldModel, mSituationIdState, situationSnapshot);
+}
+
+bool RssSituationExtraction::extractSituations(world::WorldModel const &worldModel,
+                                               RssSituationIdState &situationIdState,
+                                               situation::SituationSnapshot &situationSnapshot) const
+{
+  SituationScenesVector situationScenesVector;
+  bool result = groupScenesBySituation(worldModel, situationIdState, situationScenesVector);
+  if (!result)
+  {
+    return false;
+  }
+
+  situationSnapshot.timeIndex = worldModel.timeIndex;
+  situationSnapshot.situations.clear();
+  return extractSituationsFromSceneReferences(
+    worldModel.egoVehicleRssDynamics,
+    [&worldModel](std::size_t const sceneIndex, world::SceneReference &sceneReference) {
+      sceneReference = world::createSceneReference(worldModel.scenes.at(sceneIndex));
+      return true;
+    },
+    situationScenesVector,
+    situationSnapshot);
+}
+
+bool RssSituationExtraction::extractSituations(world::WorldModel const &worldModel,
+                                               world::RssDynamics const &egoVehicleRssDynamics,
+                                               world::RssDynamics const &objectRssDynamics,
+                                               RssSituationIdState &situationIdState,
+                                               situation::SituationSnapshot &situationSnapshot) const
+{
+  if (!withinValidInputRange(egoVehicleRssDynamics) || !withinValidInputRange(objectRssDynamics))
+  {
+    return false;
+  }
+
+  SituationScenesVector situationScenesVector;
+  bool result = groupScenesBySituation(worldModel, situationIdState, situationScenesVector);
+  if (!result)
+  {
+    return false;
+  }
+
+  situationSnapshot.timeIndex = worldModel.timeIndex;
+  situationSnapshot.situations.clear();
+  return extractSituationsFromSceneReferences(
+    egoVehicleRssDynamics,
+    [&worldModel, &objectRssDynamics](std::size_t const sceneIndex, world::SceneReference &sceneReference) {
+      sceneReference = world::createSceneReference(worldModel.scenes.at(sceneIndex));
+      sceneReference.objectRssDynamics = &objectRssDynamics;
+      return true;
+    },
+    situationScenesVector,
+    situationSnapshot);
+}
+
+bool RssSituationExtraction::extractSituations(RegisteredRoadWorldModel const &worldModel,
+                                               RssRoadRegistry const &roadRegistry,
+                                               situation::SituationSnapshot &situationSnapshot)
+{
+  return extractSituations(worldModel, roadRegistry, mSituationIdState, situationSnapshot);
+}
+
+bool RssSituationExtraction::extractSituations(RegisteredRoadWorldModel const &worldModel,
+                                               RssRoadRegistry const &roadRegistry,
+                                               RssSituationIdState &situationIdState,
+                                               situation::SituationSnapshot &situationSnapshot) const
+{
+  SituationScenesVector situationScenesVector;
+  bool result = groupScenesBySituation(worldModel, roadRegistry, situationIdState, situationScenesVector);
+  if (!result)
+  {
+    return false;
+  }
+
+  situationSnapshot.timeIndex = worldModel.timeIndex;
+  situationSnapshot.situations.clear();
+  return extractSituationsFromSceneReferences(
+    worldModel.egoVehicleRssDynamics,
+    [this, &worldModel, &roadRegistry](std::size_t const sceneIndex, world::SceneReference &sceneReference) {
+      return createSceneReference(worldModel.scenes.at(sceneIndex), roadRegistry, sceneReference);
+    },
+    situationScenesVector,
+    situationSnapshot);
+}
+
+bool RssSituationExtraction::extractSituations(world::WorldModelView const &worldModel,
+                                               situation::SituationSnapshot &situationSnapshot)
+{
+  return extractSituations(worldModel, mSituationIdState, situationSnapshot);
+}
+
+bool RssSituationExtraction::extractSituations(world::WorldModelView const &worldModel,
+                                               RssSituationIdState &situationIdState,
+                                               situation::SituationSnapshot &situationSnapshot) const
+{
+  SituationScenesVector situationScenesVector;
+  bool result = groupScenesBySituation(worldModel, situationIdState, situationScenesVector);
+  if (!result)
+  {
+    return false;
+  }
+
+  situationSnapshot.timeIndex = worldModel.timeIndex;
+  situationSnapshot.situations.clear();
+  return extractSituationsFromSceneReferences(
+    worldModel.egoVehicleRssDynamics,
+    [&worldModel](std::size_t const sceneIndex, world::SceneReference &sceneReference) {
+      if (sceneIndex >= worldModel.scenes.size())
+      {
+        return false;
+      }
+      sceneReference = world::createSceneReference(worldModel.scenes[sceneIndex]);
+      return true;
+    },
+    situationScenesVector,
+    situationSnapshot);
+}
+
 } // namespace core
 } // namespace ad_rss
@@ -0,0 +1,217 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "core/RssThreadPool.hpp"
+#include <algorithm>
+
+namespace ad_rss {
+namespace core {
+
+RssThreadPool::RssThreadPool(std::size_t const numberOfThreads)
+  : mTask(nullptr)
+  , mTasksSucceeded(true)
+  , mBatchNumber(0u)
+  , mActiveWorkers(0u)
+  , mStopped(false)
+{
+  std::size_t threads = numberOfThreads;
+  if (threads == 0u)
+  {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  try
+  {
+    for (std::size_t i = 0u; i < threads; ++i)
+    {
+      mQueues.push_back(std::unique_ptr<WorkQueue>(new WorkQueue()));
+    }
+    // the calling thread is the first of the threads executing a batch
+    for (std::size_t i = 1u; i < threads; ++i)
+    {
+      mThreads.push_back(std::thread(&RssThreadPool::worker, this, i));
+    }
+  }
+  catch (...)
+  {
+    // continue with the threads already started
+  }
+  mQueues.resize(std::min(mQueues.size(), mThreads.size() + 1u));
+}
+
+RssThreadPool::~RssThreadPool()
+{
+  stop();
+}
+
+void RssThreadPool::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mStopped = true;
+  }
+  mBatchStarted.notify_all();
+  for (auto &thread : mThreads)
+  {
+    if (thread.joinable())
+    {
+      thread.join();
+    }
+  }
+  mThreads.clear();
+}
+
+std::size_t RssThreadPool::getNumberOfThreads() const
+{
+  return mQueues.size();
+}
+
+bool RssThreadPool::run(std::size_t const numberOfTasks, Task const &task)
+{
+  if (mQueues.empty())
+  {
+    return false;
+  }
+
+  // each thread starts with a contiguous share of the tasks
+  std::size_t const numberOfQueues = mQueues.size();
+  for (std::size_t q = 0u; q < numberOfQueues; ++q)
+  {
+    std::size_t const begin = (q * numberOfTasks) / numberOfQueues;
+    std::size_t const end = ((q + 1u) * numberOfTasks) / numberOfQueues;
+    std::lock_guard<std::mutex> lock(mQueues[q]->mutex);
+    mQueues[q]->tasks.clear();
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      mQueues[q]->tasks.push_back(i);
+    }
+  }
+
+  mTask = &task;
+  mTasksSucceeded = true;
+  if (numberOfTasks > 1u)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mActiveWorkers = mThreads.size();
+      mBatchNumber++;
+    }
+    mBatchStarted.notify_all();
+  }
+
+  processTasks(0u);
+
+  std::unique_lock<std::mutex> lock(mMutex);
+  mBatchFinished.wait(lock, [this] { return mActiveWorkers == 0u; });
+  mTask = nullptr;
+  return mTasksSucceeded;
+}
+
+void RssThreadPool::worker(std::size_t const threadIndex)
+{
+  std::uint64_t processedBatchNumber = 0u;
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock(mMutex);
+      mBatchStarted.wait(lock, [this, &processedBatchNumber] {
+        return mStopped || (mBatchNumber != processedBatchNumber);
+      });
+      if (mStopped)
+      {
+        return;
+      }
+      processedBatchNumber = mBatchNumber;
+    }
+
+    processTasks(threadIndex);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    mActiveWorkers--;
+    if (mActiveWorkers == 0u)
+    {
+      mBatchFinished.notify_all();
+    }
+  }
+}
+
+void RssThreadPool::processTasks(std::size_t const threadIndex)
+{
+  std::size_t taskIndex = 0u;
+  while (popTask(threadIndex, taskIndex))
+  {
+    bool taskResult = false;
+    try
+    {
+      taskResult = (*mTask)(taskIndex, threadIndex);
+    }
+    catch (...)
+    {
+      taskResult = false;
+    }
+    if (!taskResult)
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mTasksSucceeded = false;
+    }
+  }
+}
+
+bool RssThreadPool::popTask(std::size_t const threadIndex, std::size_t &taskIndex)
+{
+  {
+    WorkQueue &ownQueue = *mQueues[threadIndex];
+    std::lock_guard<std::mutex> lock(ownQueue.mutex);
+    if (!ownQueue.tasks.empty())
+    {
+      taskIndex = ownQueue.tasks.front();
+      ownQueue.tasks.pop_front();
+      return true;
+    }
+  }
+
+  // steal from the end of the share of another thread, where its owner will arrive last
+  for (std::size_t i = 1u; i < mQueues.size(); ++i)
+  {
+    WorkQueue &otherQueue = *mQueues[(threadIndex + i) % mQueues.size()];
+    std::lock_guard<std::mutex> lock(otherQueue.mutex);
+    if (!otherQueue.tasks.empty())
+    {
+      taskIndex = otherQueue.tasks.back();
+      otherQueue.tasks.pop_back();
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace core
+} // namespace ad_rss
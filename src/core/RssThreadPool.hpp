@@ -0,0 +1,136 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/**
+ * @brief RssThreadPool
+ *
+ * Pool of worker threads executing the tasks of a batch together with the calling thread. The tasks are split into
+ * contiguous shares, one per thread; a thread that finished its share steals the pending tasks from the end of the
+ * shares of the other threads.
+ */
+class RssThreadPool
+{
+public:
+  /**
+   * @brief the function executing a task
+   *
+   * @param [in] taskIndex - the index of the task within the batch
+   * @param [in] threadIndex - the index of the executing thread, 0 is the calling thread; allows per thread data
+   *
+   * @returns false if the task failed
+   */
+  typedef std::function<bool(std::size_t taskIndex, std::size_t threadIndex)> Task;
+
+  /**
+   * @brief constructor
+   *
+   * @param [in] numberOfThreads - the number of threads executing a batch including the calling thread;
+   *   0 uses the number of hardware threads
+   */
+  explicit RssThreadPool(std::size_t const numberOfThreads);
+
+  /**
+   * @brief destructor; stops the worker threads
+   */
+  ~RssThreadPool();
+
+  RssThreadPool(RssThreadPool const &other) = delete;
+  RssThreadPool &operator=(RssThreadPool const &other) = delete;
+
+  /**
+   * @returns the number of threads executing a batch including the calling thread
+   */
+  std::size_t getNumberOfThreads() const;
+
+  /**
+   * @brief executes a batch of tasks and returns once all tasks are finished. Must not be called concurrently.
+   *
+   * @param [in] numberOfTasks - the number of tasks of the batch
+   * @param [in] task - the function executing a task; exceptions are treated as failed task
+   *
+   * @returns false if any of the tasks failed, true otherwise.
+   */
+  bool run(std::size_t const numberOfTasks, Task const &task);
+
+private:
+  struct WorkQueue
+  {
+    std::mutex mutex;
+    std::deque<std::size_t> tasks;
+  };
+
+  void worker(std::size_t const threadIndex);
+  void processTasks(std::size_t const threadIndex);
+  bool popTask(std::size_t const threadIndex, std::size_t &taskIndex);
+  void stop();
+
+  std::vector<std::unique_ptr<WorkQueue>> mQueues;
+  std::vector<std::thread> mThreads;
+
+  // the task of the current batch, only valid while a batch is executed
+  Task const *mTask;
+  bool mTasksSucceeded;
+
+  std::mutex mMutex;
+  std::condition_variable mBatchStarted;
+  std::condition_variable mBatchFinished;
+  std::uint64_t mBatchNumber;
+  std::size_t mActiveWorkers;
+  bool mStopped;
+};
+
+} // namespace core
+} // namespace ad_rss
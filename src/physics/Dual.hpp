@@ -0,0 +1,200 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace physics
+ */
+namespace physics {
+
+/*!
+ * @brief Dual number for the forward mode evaluation of derivatives.
+ *
+ * Carries a value together with its partial derivatives with respect to NumberOfVariables input variables.
+ * The arithmetic operators propagate the derivatives according to the chain rule, so a function templated on the
+ * scalar type evaluates its value and gradient in a single pass when instantiated with Dual.
+ */
+template <std::size_t NumberOfVariables> struct Dual
+{
+  /*!
+   * @brief constructor of a constant: all derivatives are zero
+   */
+  Dual(double const constant = 0.)
+    : value(constant)
+  {
+    derivatives.fill(0.);
+  }
+
+  /*!
+   * @brief create the input variable with the given index
+   */
+  static Dual variable(double const variableValue, std::size_t const index)
+  {
+    Dual result(variableValue);
+    result.derivatives[index] = 1.;
+    return result;
+  }
+
+  /*!
+   * the value
+   */
+  double value;
+
+  /*!
+   * the partial derivatives of the value with respect to the input variables
+   */
+  std::array<double, NumberOfVariables> derivatives;
+};
+
+/*!
+ * @returns the value of a dual number
+ */
+template <std::size_t N> double getValue(Dual<N> const &scalar)
+{
+  return scalar.value;
+}
+
+template <std::size_t N> Dual<N> operator-(Dual<N> const &operand)
+{
+  Dual<N> result(-operand.value);
+  for (std::size_t i = 0u; i < N; ++i)
+  {
+    result.derivatives[i] = -operand.derivatives[i];
+  }
+  return result;
+}
+
+template <std::size_t N> Dual<N> operator+(Dual<N> const &left, Dual<N> const &right)
+{
+  Dual<N> result(left.value + right.value);
+  for (std::size_t i = 0u; i < N; ++i)
+  {
+    result.derivatives[i] = left.derivatives[i] + right.derivatives[i];
+  }
+  return result;
+}
+
+template <std::size_t N> Dual<N> operator-(Dual<N> const &left, Dual<N> const &right)
+{
+  return left + (-right);
+}
+
+template <std::size_t N> Dual<N> operator*(Dual<N> const &left, Dual<N> const &right)
+{
+  Dual<N> result(left.value * right.value);
+  for (std::size_t i = 0u; i < N; ++i)
+  {
+    result.derivatives[i] = left.derivatives[i] * right.value + left.value * right.derivatives[i];
+  }
+  return result;
+}
+
+template <std::size_t N> Dual<N> operator/(Dual<N> const &left, Dual<N> const &right)
+{
+  Dual<N> result(left.value / right.value);
+  for (std::size_t i = 0u; i < N; ++i)
+  {
+    result.derivatives[i]
+      = (left.derivatives[i] * right.value - left.value * right.derivatives[i]) / (right.value * right.value);
+  }
+  return result;
+}
+
+template <std::size_t N> Dual<N> operator+(Dual<N> const &left, double const right)
+{
+  return left + Dual<N>(right);
+}
+
+template <std::size_t N> Dual<N> operator+(double const left, Dual<N> const &right)
+{
+  return Dual<N>(left) + right;
+}
+
+template <std::size_t N> Dual<N> operator-(Dual<N> const &left, double const right)
+{
+  return left - Dual<N>(right);
+}
+
+template <std::size_t N> Dual<N> operator-(double const left, Dual<N> const &right)
+{
+  return Dual<N>(left) - right;
+}
+
+template <std::size_t N> Dual<N> operator*(Dual<N> const &left, double const right)
+{
+  return left * Dual<N>(right);
+}
+
+template <std::size_t N> Dual<N> operator*(double const left, Dual<N> const &right)
+{
+  return Dual<N>(left) * right;
+}
+
+template <std::size_t N> Dual<N> operator/(Dual<N> const &left, double const right)
+{
+  return left / Dual<N>(right);
+}
+
+template <std::size_t N> Dual<N> operator/(double const left, Dual<N> const &right)
+{
+  return Dual<N>(left) / right;
+}
+
+template <std::size_t N> Dual<N> sqrt(Dual<N> const &operand)
+{
+  Dual<N> result(std::sqrt(operand.value));
+  for (std::size_t i = 0u; i < N; ++i)
+  {
+    // the derivative at 0 is infinite, keep it finite by treating the root as locally constant
+    result.derivatives[i] = (result.value > 0.) ? (operand.derivatives[i] / (2. * result.value)) : 0.;
+  }
+  return result;
+}
+
+template <std::size_t N> Dual<N> fabs(Dual<N> const &operand)
+{
+  return std::signbit(operand.value) ? -operand : operand;
+}
+
+} // namespace physics
+} // namespace ad_rss
@@ -35,10 +35,13 @@
 
 #pragma once
 
+#include <cmath>
+#include <limits>
 #include "ad_rss/physics/Acceleration.hpp"
 #include "ad_rss/physics/CoordinateSystemAxis.hpp"
 #include "ad_rss/physics/Distance.hpp"
 #include "ad_rss/physics/Duration.hpp"
+#include "ad_rss/physics/Operations.hpp"
 #include "ad_rss/physics/Speed.hpp"
 
 /*!
@@ -130,5 +133,272 @@ bool calculateTimeToCoverDistance(Speed const &currentSpeed,
                                   Distance const &distanceToCover,
                                   Duration &requiredTime);
 
+/*
+ * The implementation of the functions above, templated on the types of the physical quantities. The functions above
+ * instantiate them with the checked physics types. They are instantiated with double or with Dual (see Dual.hpp) to
+ * evaluate the formulas without the checks or together with their derivatives. For all scalar types the branches
+ * are decided by the fuzzy comparison operators of the physics types, so all instantiations take the same branches.
+ * At the switching points of the branches Dual provides the derivatives of the branch taken.
+ */
+
+/*!
+ * @brief the types of the physical quantities of the templated formulas: the checked physics types
+ */
+struct PhysicsTypes
+{
+  typedef physics::Acceleration AccelerationType;
+  typedef physics::Distance DistanceType;
+  typedef physics::Duration DurationType;
+  typedef physics::Speed SpeedType;
+};
+
+/*!
+ * @brief the types of the physical quantities of the templated formulas: the same scalar type for all quantities
+ */
+template <typename Scalar> struct ScalarTypes
+{
+  typedef Scalar AccelerationType;
+  typedef Scalar DistanceType;
+  typedef Scalar DurationType;
+  typedef Scalar SpeedType;
+};
+
+/*!
+ * @returns the value of a physics type or a double
+ */
+template <typename Scalar> double getValue(Scalar const &scalar)
+{
+  return static_cast<double>(scalar);
+}
+
+/*!
+ * @returns the scalar converted to the physics type to be compared by the fuzzy comparison operators
+ */
+template <typename PhysicsType, typename Scalar> PhysicsType toPhysicsType(Scalar const &scalar)
+{
+  return PhysicsType(getValue(scalar));
+}
+
+/**
+ * @brief templated version of the distance offset in a constant accelerated movement
+ */
+template <typename SpeedType, typename AccelerationType, typename DurationType>
+auto calculateDistanceOffsetInAcceleratedMovementT(SpeedType const &speed,
+                                                   AccelerationType const &acceleration,
+                                                   DurationType const &duration)
+  -> decltype((acceleration * 0.5 * duration * duration) + (speed * duration))
+{
+  // s(t) =(a/2) * t^2 + v0 * t
+  return (acceleration * 0.5 * duration * duration) + (speed * duration);
+}
+
+/**
+ * @brief templated version of the speed in a constant accelerated movement
+ */
+template <typename SpeedType, typename AccelerationType, typename DurationType>
+SpeedType calculateSpeedInAcceleratedMovementT(SpeedType const &speed,
+                                               AccelerationType const &acceleration,
+                                               DurationType const &duration)
+{
+  // v(t) =v0 + a * t
+  return speed + acceleration * duration;
+}
+
+/**
+ * @brief templated version of calculateStoppingDistance()
+ */
+template <typename SpeedType, typename AccelerationType, typename DistanceType>
+bool calculateStoppingDistanceT(SpeedType const &currentSpeed,
+                                AccelerationType const &deceleration,
+                                DistanceType &stoppingDistance)
+{
+  using std::fabs;
+  if (toPhysicsType<Acceleration>(deceleration) <= Acceleration(0.))
+  {
+    // deceleration must be positive
+    return false;
+  }
+
+  // s = v^2 / (2 *a)
+  // keep the signbit of the current Speed
+  stoppingDistance = (currentSpeed * fabs(currentSpeed)) / (2.0 * deceleration);
+  return true;
+}
+
+/**
+ * @brief templated version of calculateSpeedAfterResponseTime()
+ */
+template <typename SpeedType, typename AccelerationType, typename DurationType>
+bool calculateSpeedAfterResponseTimeT(CoordinateSystemAxis const &axis,
+                                      SpeedType const &currentSpeed,
+                                      AccelerationType const &acceleration,
+                                      DurationType const &responseTime,
+                                      SpeedType &resultingSpeed)
+{
+  if (toPhysicsType<Duration>(responseTime) < Duration(0.))
+  {
+    // time must not be negative
+    return false;
+  }
+
+  if (axis == CoordinateSystemAxis::Longitudinal)
+  {
+    // in longitudinal direction the speed has to be always >= 0.
+    if (toPhysicsType<Speed>(currentSpeed) < Speed(0.))
+    {
+      return false;
+    }
+  }
+
+  resultingSpeed = calculateSpeedInAcceleratedMovementT(currentSpeed, acceleration, responseTime);
+
+  if ((axis == CoordinateSystemAxis::Longitudinal) && !(Speed(0.) < toPhysicsType<Speed>(resultingSpeed)))
+  {
+    // Only deceleration till stop is allowed
+    resultingSpeed = SpeedType(0.);
+  }
+
+  return true;
+}
+
+/**
+ * @brief templated version of calculateDistanceOffsetAfterResponseTime()
+ */
+template <typename SpeedType, typename AccelerationType, typename DurationType, typename DistanceType>
+bool calculateDistanceOffsetAfterResponseTimeT(CoordinateSystemAxis const &axis,
+                                               SpeedType const &currentSpeed,
+                                               AccelerationType const &acceleration,
+                                               DurationType const &responseTime,
+                                               DistanceType &distanceOffset)
+{
+  if (toPhysicsType<Duration>(responseTime) < Duration(0.))
+  {
+    // time must not be negative
+    return false;
+  }
+
+  DurationType resultingResponseTime = responseTime;
+  if (axis == CoordinateSystemAxis::Longitudinal)
+  {
+    if (toPhysicsType<Speed>(currentSpeed) < Speed(0.))
+    {
+      // in longitudinal direction the speed has to be always >= 0.
+      return false;
+    }
+
+    if (toPhysicsType<Acceleration>(acceleration) < Acceleration(0.))
+    {
+      // on deceleration restrict the time to the time required to stop
+      DurationType const timeToStop = -1. * currentSpeed / acceleration;
+      if (!(toPhysicsType<Duration>(responseTime) < toPhysicsType<Duration>(timeToStop)))
+      {
+        resultingResponseTime = timeToStop;
+      }
+    }
+  }
+
+  distanceOffset = calculateDistanceOffsetInAcceleratedMovementT(currentSpeed, acceleration, resultingResponseTime);
+
+  return true;
+}
+
+/**
+ * @brief templated version of the time required to cover a distance in a constant accelerated movement
+ */
+template <typename SpeedType, typename AccelerationType, typename DistanceType, typename DurationType>
+bool calculateTimeForDistanceT(SpeedType const &currentSpeed,
+                               AccelerationType const &acceleration,
+                               DistanceType const &distanceToCover,
+                               DurationType &requiredTime)
+{
+  using std::sqrt;
+  if (toPhysicsType<Speed>(currentSpeed) < Speed(0.))
+  {
+    return false;
+  }
+
+  if (toPhysicsType<Acceleration>(acceleration) == Acceleration(0.))
+  {
+    // non-accelerated constant movement:
+    // t = s/v
+    if (toPhysicsType<Speed>(currentSpeed) == Speed(0.))
+    {
+      requiredTime = DurationType(static_cast<double>(std::numeric_limits<Duration>::max()));
+    }
+    else
+    {
+      requiredTime = distanceToCover / currentSpeed;
+    }
+  }
+  else
+  {
+    // constant accelerated movement:
+    // t = -v_0/a +- sqrt(v_0^2/a^2 + 2s/a)
+    DurationType const firstPart = -1. * currentSpeed / acceleration;
+    DurationType const secondPart = sqrt((firstPart * firstPart) + (2. * distanceToCover / acceleration));
+    DurationType const t1 = firstPart + secondPart;
+    DurationType const t2 = firstPart - secondPart;
+    requiredTime = (toPhysicsType<Duration>(t2) > Duration(0.)) ? t2 : t1;
+  }
+  return true;
+}
+
+/**
+ * @brief templated version of calculateTimeToCoverDistance()
+ */
+template <typename SpeedType, typename DurationType, typename AccelerationType, typename DistanceType>
+bool calculateTimeToCoverDistanceT(SpeedType const &currentSpeed,
+                                   DurationType const &responseTime,
+                                   AccelerationType const &acceleration,
+                                   AccelerationType const &deceleration,
+                                   DistanceType const &distanceToCover,
+                                   DurationType &requiredTime)
+{
+  if ((toPhysicsType<Speed>(currentSpeed) < Speed(0.))
+      || (toPhysicsType<Acceleration>(deceleration) < Acceleration(0.))
+      || (toPhysicsType<Distance>(distanceToCover) < Distance(0.)))
+  {
+    return false;
+  }
+
+  DistanceType distanceAfterResponseTime(0.);
+  bool result = calculateDistanceOffsetAfterResponseTimeT(
+    CoordinateSystemAxis::Longitudinal, currentSpeed, acceleration, responseTime, distanceAfterResponseTime);
+
+  if (result)
+  {
+    if (toPhysicsType<Distance>(distanceAfterResponseTime) > toPhysicsType<Distance>(distanceToCover))
+    {
+      result = calculateTimeForDistanceT(currentSpeed, acceleration, distanceToCover, requiredTime);
+    }
+    else
+    {
+      SpeedType resultingSpeed(0.);
+      result = calculateSpeedAfterResponseTimeT(
+        CoordinateSystemAxis::Longitudinal, currentSpeed, acceleration, responseTime, resultingSpeed);
+
+      DistanceType stoppingDistance(0.);
+      result = result && calculateStoppingDistanceT(resultingSpeed, deceleration, stoppingDistance);
+
+      if (result)
+      {
+        if (toPhysicsType<Distance>(distanceAfterResponseTime + stoppingDistance)
+            > toPhysicsType<Distance>(distanceToCover))
+        {
+          DistanceType const remainingDistance = distanceToCover - distanceAfterResponseTime;
+          result = calculateTimeForDistanceT(resultingSpeed, deceleration, remainingDistance, requiredTime);
+          requiredTime = requiredTime + responseTime;
+        }
+        else
+        {
+          requiredTime = DurationType(static_cast<double>(std::numeric_limits<Duration>::max()));
+        }
+      }
+    }
+  }
+
+  return result;
+}
+
 } // namespace physics
 } // namespace ad_rss
@@ -0,0 +1,263 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/situation/RssEgoMotionCandidates.hpp"
+#include <algorithm>
+#include <utility>
+#include "ad_rss/situation/SituationSnapshotValidInputRange.hpp"
+#include "situation/RssFormulasBatch.hpp"
+#include "situation/RssIntersectionChecker.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+using physics::Acceleration;
+using physics::Distance;
+
+namespace {
+
+/*
+ * The vehicle states of the candidates as batch for the RSS formulas, one entry per candidate.
+ */
+struct EgoTerms
+{
+  world::RssDynamics dynamics;
+  std::vector<VehicleState> vehicleStates;
+  VehicleStateBatch egoVehicleBatch;
+  // scratch buffers of the evaluation of the non intersection situations
+  VehicleStateBatch otherVehicleBatch;
+  SituationMarginBatch situationMargin;
+};
+
+bool vehicleStateWithinValidInputRange(VehicleState const &vehicleState)
+{
+  return withinValidInputRange(vehicleState) && (vehicleState.velocity.speedLon.minimum >= physics::Speed(0.));
+}
+
+bool calculateEgoTerms(VehicleState const &egoVehicleState,
+                       std::vector<EgoMotionCandidate> const &candidates,
+                       EgoTerms &egoTerms)
+{
+  std::size_t const numberOfCandidates = candidates.size();
+  egoTerms.dynamics = egoVehicleState.dynamics;
+  egoTerms.vehicleStates.resize(numberOfCandidates);
+  egoTerms.egoVehicleBatch.resize(numberOfCandidates);
+
+  bool result = true;
+  for (std::size_t c = 0u; result && (c < numberOfCandidates); ++c)
+  {
+    VehicleState &vehicleState = egoTerms.vehicleStates[c];
+    vehicleState = egoVehicleState;
+    vehicleState.velocity = candidates[c].velocity;
+    vehicleState.dynamics.alphaLon.accelMax = std::max(
+      Acceleration(0.), std::min(egoVehicleState.dynamics.alphaLon.accelMax, candidates[c].accelerationLon));
+
+    result = vehicleStateWithinValidInputRange(vehicleState);
+    egoTerms.egoVehicleBatch.setVelocity(c, vehicleState);
+    egoTerms.egoVehicleBatch.setDynamics(c, vehicleState.dynamics);
+  }
+  return result;
+}
+
+/*
+ * Keep the most critical situation of a candidate: dangerous situations first, then the lowest margin.
+ */
+void updateCandidateResult(std::size_t const situationIndex,
+                           bool const isDangerous,
+                           Distance const &longitudinalMargin,
+                           Distance const &lateralMargin,
+                           std::size_t const numberOfSituations,
+                           EgoMotionCandidateResult &candidateResult)
+{
+  if (isDangerous)
+  {
+    candidateResult.isSafe = false;
+    candidateResult.numberOfDangerousSituations++;
+  }
+  Distance const margin = std::max(longitudinalMargin, lateralMargin);
+  bool isMoreCritical = (candidateResult.criticalSituationIndex == numberOfSituations);
+  if (!isMoreCritical)
+  {
+    Distance const criticalMargin = std::max(candidateResult.longitudinalMargin, candidateResult.lateralMargin);
+    bool const criticalIsDangerous = (candidateResult.numberOfDangerousSituations > (isDangerous ? 1u : 0u));
+    isMoreCritical = (isDangerous && !criticalIsDangerous)
+      || ((isDangerous == criticalIsDangerous) && (margin < criticalMargin));
+  }
+  if (isMoreCritical)
+  {
+    candidateResult.criticalSituationIndex = situationIndex;
+    candidateResult.longitudinalMargin = longitudinalMargin;
+    candidateResult.lateralMargin = lateralMargin;
+  }
+}
+
+bool evaluateNonIntersectionSituation(Situation const &situation,
+                                      std::size_t const situationIndex,
+                                      std::size_t const numberOfSituations,
+                                      EgoTerms &egoTerms,
+                                      std::vector<EgoMotionCandidateResult> &candidateResults)
+{
+  VehicleState const &otherVehicleState = situation.otherVehicleState;
+  if (!vehicleStateWithinValidInputRange(otherVehicleState))
+  {
+    return false;
+  }
+
+  // the other vehicle is the same for all candidates
+  egoTerms.otherVehicleBatch.resize(candidateResults.size());
+  egoTerms.otherVehicleBatch.setVelocity(otherVehicleState);
+  egoTerms.otherVehicleBatch.setDynamics(otherVehicleState.dynamics);
+  if (!calculateSituationMarginBatch(
+        situation, egoTerms.egoVehicleBatch, egoTerms.otherVehicleBatch, egoTerms.situationMargin))
+  {
+    return false;
+  }
+
+  // the lateral margin is only calculated if the vehicles don't overlap laterally
+  LateralRelativePosition const lateralPosition = situation.relativePosition.lateralPosition;
+  bool const isLateralSeparated
+    = (lateralPosition == LateralRelativePosition::AtLeft) || (lateralPosition == LateralRelativePosition::AtRight);
+  SituationMarginBatch const &situationMargin = egoTerms.situationMargin;
+  for (std::size_t c = 0u; c < candidateResults.size(); ++c)
+  {
+    updateCandidateResult(situationIndex,
+                          situationMargin.isDangerous[c] != 0u,
+                          Distance(situationMargin.lonMargin[c]),
+                          isLateralSeparated ? Distance(situationMargin.latMargin[c]) : Distance(0.),
+                          numberOfSituations,
+                          candidateResults[c]);
+  }
+  return true;
+}
+
+bool evaluateIntersectionSituation(Situation const &situation,
+                                   std::size_t const situationIndex,
+                                   std::size_t const numberOfSituations,
+                                   EgoTerms const &egoTerms,
+                                   std::vector<EgoMotionCandidateResult> &candidateResults)
+{
+  bool result = true;
+  Situation candidateSituation = situation;
+  for (std::size_t c = 0u; result && (c < candidateResults.size()); ++c)
+  {
+    candidateSituation.egoVehicleState = egoTerms.vehicleStates[c];
+    // a fresh history per evaluation, the intersection state of the situation is not kept
+    core::RssIntersectionCheckingState intersectionCheckingState;
+    state::RssState rssState;
+    result = calculateRssStateIntersection(
+      intersectionCheckingState, physics::TimeIndex(1u), candidateSituation, getDefaultFormulaProvider(), rssState);
+    if (result)
+    {
+      state::RssStateInformation const &information = rssState.longitudinalState.rssStateInformation;
+      updateCandidateResult(situationIndex,
+                            !rssState.longitudinalState.isSafe,
+                            information.currentDistance - information.safeDistance,
+                            Distance(0.),
+                            numberOfSituations,
+                            candidateResults[c]);
+    }
+  }
+  return result;
+}
+
+} // namespace
+
+bool evaluateEgoMotionCandidates(SituationSnapshot const &situationSnapshot,
+                                 std::vector<EgoMotionCandidate> const &candidates,
+                                 std::vector<EgoMotionCandidateResult> &candidateResults)
+{
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    std::size_t const numberOfSituations = situationSnapshot.situations.size();
+    EgoMotionCandidateResult initialResult;
+    initialResult.criticalSituationIndex = numberOfSituations;
+    candidateResults.assign(candidates.size(), initialResult);
+
+    result = withinValidInputRange(situationSnapshot);
+
+    // the ego terms are shared by all situations with the same ego dynamics
+    EgoTerms egoTerms;
+    bool egoTermsValid = false;
+    for (std::size_t s = 0u; result && (s < numberOfSituations); ++s)
+    {
+      Situation const &situation = situationSnapshot.situations[s];
+      if (situation.situationType == SituationType::NotRelevant)
+      {
+        continue;
+      }
+      if (!egoTermsValid || (egoTerms.dynamics != situation.egoVehicleState.dynamics))
+      {
+        result = calculateEgoTerms(situation.egoVehicleState, candidates, egoTerms);
+        egoTermsValid = result;
+      }
+      // the candidate vehicle states carry the lane information of the situation
+      for (auto &vehicleState : egoTerms.vehicleStates)
+      {
+        vehicleState.hasPriority = situation.egoVehicleState.hasPriority;
+        vehicleState.isInCorrectLane = situation.egoVehicleState.isInCorrectLane;
+        vehicleState.distanceToEnterIntersection = situation.egoVehicleState.distanceToEnterIntersection;
+        vehicleState.distanceToLeaveIntersection = situation.egoVehicleState.distanceToLeaveIntersection;
+      }
+
+      switch (situation.situationType)
+      {
+        case SituationType::SameDirection:
+        case SituationType::OppositeDirection:
+          result = result
+            && evaluateNonIntersectionSituation(situation, s, numberOfSituations, egoTerms, candidateResults);
+          break;
+        case SituationType::IntersectionEgoHasPriority:
+        case SituationType::IntersectionObjectHasPriority:
+        case SituationType::IntersectionSamePriority:
+          result = result
+            && evaluateIntersectionSituation(situation, s, numberOfSituations, egoTerms, candidateResults);
+          break;
+        default:
+          result = false;
+          break;
+      }
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  if (!result)
+  {
+    candidateResults.clear();
+  }
+  return result;
+}
+
+} // namespace situation
+} // namespace ad_rss
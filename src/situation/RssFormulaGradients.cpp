@@ -0,0 +1,231 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/situation/RssFormulaGradients.hpp"
+#include "ad_rss/situation/VehicleStateValidInputRange.hpp"
+#include "physics/Dual.hpp"
+#include "situation/RssFormulas.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+namespace {
+
+/*
+ * the input variables of a vehicle state within the dual numbers
+ */
+enum VehicleStateVariable : std::size_t
+{
+  SpeedLonMinimum = 0u,
+  SpeedLonMaximum,
+  SpeedLatMinimum,
+  SpeedLatMaximum,
+  ResponseTime,
+  AlphaLonAccelMax,
+  AlphaLonBrakeMax,
+  AlphaLonBrakeMin,
+  AlphaLonBrakeMinCorrect,
+  AlphaLatAccelMax,
+  AlphaLatBrakeMin,
+  NumberOfVehicleStateVariables
+};
+
+typedef physics::Dual<2u * NumberOfVehicleStateVariables> SafeDistanceScalar;
+typedef physics::ScalarTypes<SafeDistanceScalar> SafeDistanceTypes;
+
+/*
+ * the time to cover distance variables
+ */
+enum TimeToCoverDistanceVariable : std::size_t
+{
+  TimeCurrentSpeed = 0u,
+  TimeResponseTime,
+  TimeAcceleration,
+  TimeDeceleration,
+  TimeDistanceToCover,
+  NumberOfTimeToCoverDistanceVariables
+};
+
+typedef physics::Dual<NumberOfTimeToCoverDistanceVariables> TimeToCoverDistanceScalar;
+
+bool vehicleStateWithinValidInputRange(VehicleState const &vehicleState)
+{
+  return withinValidInputRange(vehicleState) && (vehicleState.velocity.speedLon.minimum >= physics::Speed(0.));
+}
+
+VehicleStateT<SafeDistanceTypes> createVehicleStateVariables(VehicleState const &vehicleState,
+                                                              std::size_t const offset)
+{
+  VehicleStateT<SafeDistanceTypes> variables;
+  variables.speedLonMinimum = SafeDistanceScalar::variable(
+    static_cast<double>(vehicleState.velocity.speedLon.minimum), offset + SpeedLonMinimum);
+  variables.speedLonMaximum = SafeDistanceScalar::variable(
+    static_cast<double>(vehicleState.velocity.speedLon.maximum), offset + SpeedLonMaximum);
+  variables.speedLatMinimum = SafeDistanceScalar::variable(
+    static_cast<double>(vehicleState.velocity.speedLat.minimum), offset + SpeedLatMinimum);
+  variables.speedLatMaximum = SafeDistanceScalar::variable(
+    static_cast<double>(vehicleState.velocity.speedLat.maximum), offset + SpeedLatMaximum);
+  variables.responseTime
+    = SafeDistanceScalar::variable(static_cast<double>(vehicleState.dynamics.responseTime), offset + ResponseTime);
+  variables.alphaLonAccelMax = SafeDistanceScalar::variable(
+    static_cast<double>(vehicleState.dynamics.alphaLon.accelMax), offset + AlphaLonAccelMax);
+  variables.alphaLonBrakeMax = SafeDistanceScalar::variable(
+    static_cast<double>(vehicleState.dynamics.alphaLon.brakeMax), offset + AlphaLonBrakeMax);
+  variables.alphaLonBrakeMin = SafeDistanceScalar::variable(
+    static_cast<double>(vehicleState.dynamics.alphaLon.brakeMin), offset + AlphaLonBrakeMin);
+  variables.alphaLonBrakeMinCorrect = SafeDistanceScalar::variable(
+    static_cast<double>(vehicleState.dynamics.alphaLon.brakeMinCorrect), offset + AlphaLonBrakeMinCorrect);
+  variables.alphaLatAccelMax = SafeDistanceScalar::variable(
+    static_cast<double>(vehicleState.dynamics.alphaLat.accelMax), offset + AlphaLatAccelMax);
+  variables.alphaLatBrakeMin = SafeDistanceScalar::variable(
+    static_cast<double>(vehicleState.dynamics.alphaLat.brakeMin), offset + AlphaLatBrakeMin);
+  return variables;
+}
+
+void extractVehicleStateGradient(SafeDistanceScalar const &value,
+                                 std::size_t const offset,
+                                 VehicleStateGradient &vehicleStateGradient)
+{
+  vehicleStateGradient.speedLonMinimum = value.derivatives[offset + SpeedLonMinimum];
+  vehicleStateGradient.speedLonMaximum = value.derivatives[offset + SpeedLonMaximum];
+  vehicleStateGradient.speedLatMinimum = value.derivatives[offset + SpeedLatMinimum];
+  vehicleStateGradient.speedLatMaximum = value.derivatives[offset + SpeedLatMaximum];
+  vehicleStateGradient.responseTime = value.derivatives[offset + ResponseTime];
+  vehicleStateGradient.alphaLonAccelMax = value.derivatives[offset + AlphaLonAccelMax];
+  vehicleStateGradient.alphaLonBrakeMax = value.derivatives[offset + AlphaLonBrakeMax];
+  vehicleStateGradient.alphaLonBrakeMin = value.derivatives[offset + AlphaLonBrakeMin];
+  vehicleStateGradient.alphaLonBrakeMinCorrect = value.derivatives[offset + AlphaLonBrakeMinCorrect];
+  vehicleStateGradient.alphaLatAccelMax = value.derivatives[offset + AlphaLatAccelMax];
+  vehicleStateGradient.alphaLatBrakeMin = value.derivatives[offset + AlphaLatBrakeMin];
+}
+
+typedef bool (*SafeDistanceFormula)(VehicleStateT<SafeDistanceTypes> const &,
+                                    VehicleStateT<SafeDistanceTypes> const &,
+                                    SafeDistanceScalar &);
+
+bool calculateSafeDistanceGradient(SafeDistanceFormula formula,
+                                   VehicleState const &firstVehicle,
+                                   VehicleState const &secondVehicle,
+                                   SafeDistanceGradient &gradient)
+{
+  if (!vehicleStateWithinValidInputRange(firstVehicle) || !vehicleStateWithinValidInputRange(secondVehicle))
+  {
+    return false;
+  }
+
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    SafeDistanceScalar safeDistance(0.);
+    result = formula(createVehicleStateVariables(firstVehicle, 0u),
+                     createVehicleStateVariables(secondVehicle, NumberOfVehicleStateVariables),
+                     safeDistance);
+    if (result)
+    {
+      gradient.safeDistance = physics::Distance(safeDistance.value);
+      extractVehicleStateGradient(safeDistance, 0u, gradient.firstVehicle);
+      extractVehicleStateGradient(safeDistance, NumberOfVehicleStateVariables, gradient.secondVehicle);
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+} // namespace
+
+bool calculateSafeLongitudinalDistanceSameDirectionGradient(VehicleState const &leadingVehicle,
+                                                            VehicleState const &followingVehicle,
+                                                            SafeDistanceGradient &gradient)
+{
+  return calculateSafeDistanceGradient(
+    calculateSafeLongitudinalDistanceSameDirectionT<SafeDistanceTypes>, leadingVehicle, followingVehicle, gradient);
+}
+
+bool calculateSafeLongitudinalDistanceOppositeDirectionGradient(VehicleState const &correctVehicle,
+                                                                VehicleState const &oppositeVehicle,
+                                                                SafeDistanceGradient &gradient)
+{
+  return calculateSafeDistanceGradient(calculateSafeLongitudinalDistanceOppositeDirectionT<SafeDistanceTypes>,
+                                       correctVehicle,
+                                       oppositeVehicle,
+                                       gradient);
+}
+
+bool calculateSafeLateralDistanceGradient(VehicleState const &leftVehicle,
+                                          VehicleState const &rightVehicle,
+                                          SafeDistanceGradient &gradient)
+{
+  return calculateSafeDistanceGradient(
+    calculateSafeLateralDistanceT<SafeDistanceTypes>, leftVehicle, rightVehicle, gradient);
+}
+
+bool calculateTimeToCoverDistanceGradient(physics::Speed const &currentSpeed,
+                                          physics::Duration const &responseTime,
+                                          physics::Acceleration const &acceleration,
+                                          physics::Acceleration const &deceleration,
+                                          physics::Distance const &distanceToCover,
+                                          TimeToCoverDistanceGradient &gradient)
+{
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    TimeToCoverDistanceScalar requiredTime(0.);
+    result = physics::calculateTimeToCoverDistanceT(
+      TimeToCoverDistanceScalar::variable(static_cast<double>(currentSpeed), TimeCurrentSpeed),
+      TimeToCoverDistanceScalar::variable(static_cast<double>(responseTime), TimeResponseTime),
+      TimeToCoverDistanceScalar::variable(static_cast<double>(acceleration), TimeAcceleration),
+      TimeToCoverDistanceScalar::variable(static_cast<double>(deceleration), TimeDeceleration),
+      TimeToCoverDistanceScalar::variable(static_cast<double>(distanceToCover), TimeDistanceToCover),
+      requiredTime);
+    if (result)
+    {
+      gradient.requiredTime = physics::Duration(requiredTime.value);
+      gradient.currentSpeed = requiredTime.derivatives[TimeCurrentSpeed];
+      gradient.responseTime = requiredTime.derivatives[TimeResponseTime];
+      gradient.acceleration = requiredTime.derivatives[TimeAcceleration];
+      gradient.deceleration = requiredTime.derivatives[TimeDeceleration];
+      gradient.distanceToCover = requiredTime.derivatives[TimeDistanceToCover];
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+} // namespace situation
+} // namespace ad_rss
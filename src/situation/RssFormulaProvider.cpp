@@ -0,0 +1,99 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/situation/RssFormulaProvider.hpp"
+#include "situation/RssFormulas.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+bool RssFormulaProvider::checkSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehicle,
+                                                                    VehicleState const &followingVehicle,
+                                                                    physics::Distance const &vehicleDistance,
+                                                                    physics::Distance &safeDistance,
+                                                                    bool &isDistanceSafe) const
+{
+  return situation::checkSafeLongitudinalDistanceSameDirection(
+    leadingVehicle, followingVehicle, vehicleDistance, safeDistance, isDistanceSafe);
+}
+
+bool RssFormulaProvider::isSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehicle,
+                                                                 VehicleState const &followingVehicle,
+                                                                 physics::Distance const &vehicleDistance,
+                                                                 bool &isDistanceSafe) const
+{
+  return situation::isSafeLongitudinalDistanceSameDirection(
+    leadingVehicle, followingVehicle, vehicleDistance, isDistanceSafe);
+}
+
+bool RssFormulaProvider::checkSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctVehicle,
+                                                                        VehicleState const &oppositeVehicle,
+                                                                        physics::Distance const &vehicleDistance,
+                                                                        physics::Distance &safeDistance,
+                                                                        bool &isDistanceSafe) const
+{
+  return situation::checkSafeLongitudinalDistanceOppositeDirection(
+    correctVehicle, oppositeVehicle, vehicleDistance, safeDistance, isDistanceSafe);
+}
+
+bool RssFormulaProvider::isSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctVehicle,
+                                                                     VehicleState const &oppositeVehicle,
+                                                                     physics::Distance const &vehicleDistance,
+                                                                     bool &isDistanceSafe) const
+{
+  return situation::isSafeLongitudinalDistanceOppositeDirection(
+    correctVehicle, oppositeVehicle, vehicleDistance, isDistanceSafe);
+}
+
+bool RssFormulaProvider::checkStopInFrontIntersection(VehicleState const &vehicle,
+                                                      physics::Distance &safeDistance,
+                                                      bool &isDistanceSafe) const
+{
+  return situation::checkStopInFrontIntersection(vehicle, safeDistance, isDistanceSafe);
+}
+
+bool RssFormulaProvider::checkSafeLateralDistance(VehicleState const &leftVehicle,
+                                                  VehicleState const &rightVehicle,
+                                                  physics::Distance const &vehicleDistance,
+                                                  physics::Distance &safeDistance,
+                                                  bool &isDistanceSafe) const
+{
+  return situation::checkSafeLateralDistance(leftVehicle, rightVehicle, vehicleDistance, safeDistance, isDistanceSafe);
+}
+
+RssFormulaProvider const &getDefaultFormulaProvider()
+{
+  static RssFormulaProvider const defaultFormulaProvider;
+  return defaultFormulaProvider;
+}
+
+} // namespace situation
+} // namespace ad_rss
@@ -32,7 +32,6 @@
 #include "situation/RssFormulas.hpp"
 #include <algorithm>
 #include "ad_rss/situation/VehicleStateValidInputRange.hpp"
-#include "physics/Math.hpp"
 
 namespace ad_rss {
 namespace situation {
@@ -58,6 +57,23 @@ inline bool vehicleStateWithinVaildInputRange(VehicleState const &vehicleState)
   return true;
 }
 
+inline VehicleStateT<physics::PhysicsTypes> createVehicleStateT(VehicleState const &vehicleState)
+{
+  VehicleStateT<physics::PhysicsTypes> vehicleStateT;
+  vehicleStateT.speedLonMinimum = vehicleState.velocity.speedLon.minimum;
+  vehicleStateT.speedLonMaximum = vehicleState.velocity.speedLon.maximum;
+  vehicleStateT.speedLatMinimum = vehicleState.velocity.speedLat.minimum;
+  vehicleStateT.speedLatMaximum = vehicleState.velocity.speedLat.maximum;
+  vehicleStateT.responseTime = vehicleState.dynamics.responseTime;
+  vehicleStateT.alphaLonAccelMax = vehicleState.dynamics.alphaLon.accelMax;
+  vehicleStateT.alphaLonBrakeMax = vehicleState.dynamics.alphaLon.brakeMax;
+  vehicleStateT.alphaLonBrakeMin = vehicleState.dynamics.alphaLon.brakeMin;
+  vehicleStateT.alphaLonBrakeMinCorrect = vehicleState.dynamics.alphaLon.brakeMinCorrect;
+  vehicleStateT.alphaLatAccelMax = vehicleState.dynamics.alphaLat.accelMax;
+  vehicleStateT.alphaLatBrakeMin = vehicleState.dynamics.alphaLat.brakeMin;
+  return vehicleStateT;
+}
+
 bool calculateDistanceOffsetAfterStatedBrakingPattern(CoordinateSystemAxis const &axis,
                                                       Speed const &currentSpeed,
                                                       Duration const &responseTime,
@@ -65,34 +81,57 @@ bool calculateDistanceOffsetAfterStatedBrakingPattern(CoordinateSystemAxis const
                                                       Acceleration const &deceleration,
                                                       Distance &distanceOffset)
 {
-  Speed resultingSpeed = Speed(0.);
-  bool result = calculateSpeedAfterResponseTime(axis, currentSpeed, acceleration, responseTime, resultingSpeed);
-
-  Distance distanceOffsetAfterResponseTime = Distance(0.);
-  result = result && calculateDistanceOffsetAfterResponseTime(
-                       axis, currentSpeed, acceleration, responseTime, distanceOffsetAfterResponseTime);
+  return calculateDistanceOffsetAfterStatedBrakingPatternT(
+    axis, currentSpeed, responseTime, acceleration, deceleration, distanceOffset);
+}
 
-  Distance distanceToStop = Distance(0.);
-  if (std::signbit(static_cast<double>(resultingSpeed)) == std::signbit(static_cast<double>(acceleration)))
+bool calculateSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehicle,
+                                                    VehicleState const &followingVehicle,
+                                                    Distance &safeDistance)
+{
+  if (!vehicleStateWithinVaildInputRange(leadingVehicle) || !vehicleStateWithinVaildInputRange(followingVehicle))
   {
-    // if speed after stated braking pattern has the same direction as the acceleration
-    // (always the case in longitudinal situation)
-    // further braking to full stop in that moving direction has to be added
-    result = result && calculateStoppingDistance(resultingSpeed, std::fabs(deceleration), distanceToStop);
+    return false;
   }
 
-  if (result)
+  return calculateSafeLongitudinalDistanceSameDirectionT(
+    createVehicleStateT(leadingVehicle), createVehicleStateT(followingVehicle), safeDistance);
+}
+
+bool checkSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehicle,
+                                                VehicleState const &followingVehicle,
+                                                Distance const &vehicleDistance,
+                                                Distance &safeDistance,
+                                                bool &isDistanceSafe)
+{
+  if (vehicleDistance < Distance(0.))
   {
-    distanceOffset = distanceOffsetAfterResponseTime + distanceToStop;
+    return false;
   }
 
+  isDistanceSafe = false;
+  safeDistance = std::numeric_limits<physics::Distance>::max();
+
+  bool const result = calculateSafeLongitudinalDistanceSameDirection(leadingVehicle, followingVehicle, safeDistance);
+
+  if (vehicleDistance > safeDistance)
+  {
+    isDistanceSafe = true;
+  }
   return result;
 }
 
-bool calculateSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehicle,
-                                                    VehicleState const &followingVehicle,
-                                                    Distance &safeDistance)
+bool isSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehicle,
+                                             VehicleState const &followingVehicle,
+                                             Distance const &vehicleDistance,
+                                             bool &isDistanceSafe)
 {
+  if (vehicleDistance < Distance(0.))
+  {
+    return false;
+  }
+
+  isDistanceSafe = false;
   if (!vehicleStateWithinVaildInputRange(leadingVehicle) || !vehicleStateWithinVaildInputRange(followingVehicle))
   {
     return false;
@@ -107,25 +146,45 @@ bool calculateSafeLongitudinalDistanceSameDirection(VehicleState const &leadingV
     followingVehicle.dynamics.alphaLon.accelMax,
     followingVehicle.dynamics.alphaLon.brakeMin,
     distanceStatedBraking);
-  Distance distanceMaxBrake = Distance(0.);
-  result = result && calculateStoppingDistance(leadingVehicle.velocity.speedLon.minimum,
-                                               leadingVehicle.dynamics.alphaLon.brakeMax,
-                                               distanceMaxBrake);
 
   if (result)
   {
-    safeDistance = distanceStatedBraking - distanceMaxBrake;
-    safeDistance = std::max(safeDistance, Distance(0.));
+    // the stopping distance of the leading vehicle is not negative and can only reduce the safe distance
+    isDistanceSafe = (vehicleDistance > std::max(distanceStatedBraking, Distance(0.)));
+  }
+
+  if (result && !isDistanceSafe)
+  {
+    Distance distanceMaxBrake = Distance(0.);
+    result = calculateStoppingDistance(
+      leadingVehicle.velocity.speedLon.minimum, leadingVehicle.dynamics.alphaLon.brakeMax, distanceMaxBrake);
+    if (result)
+    {
+      isDistanceSafe = (vehicleDistance > std::max(distanceStatedBraking - distanceMaxBrake, Distance(0.)));
+    }
   }
 
   return result;
 }
 
-bool checkSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehicle,
-                                                VehicleState const &followingVehicle,
-                                                Distance const &vehicleDistance,
-                                                Distance &safeDistance,
-                                                bool &isDistanceSafe)
+bool calculateSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctVehicle,
+                                                        VehicleState const &oppositeVehicle,
+                                                        Distance &safeDistance)
+{
+  if (!vehicleStateWithinVaildInputRange(correctVehicle) || !vehicleStateWithinVaildInputRange(oppositeVehicle))
+  {
+    return false;
+  }
+
+  return calculateSafeLongitudinalDistanceOppositeDirectionT(
+    createVehicleStateT(correctVehicle), createVehicleStateT(oppositeVehicle), safeDistance);
+}
+
+bool checkSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctVehicle,
+                                                    VehicleState const &oppositeVehicle,
+                                                    Distance const &vehicleDistance,
+                                                    Distance &safeDistance,
+                                                    bool &isDistanceSafe)
 {
   if (vehicleDistance < Distance(0.))
   {
@@ -134,8 +193,7 @@ bool checkSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehic
 
   isDistanceSafe = false;
   safeDistance = std::numeric_limits<physics::Distance>::max();
-
-  bool const result = calculateSafeLongitudinalDistanceSameDirection(leadingVehicle, followingVehicle, safeDistance);
+  bool const result = calculateSafeLongitudinalDistanceOppositeDirection(correctVehicle, oppositeVehicle, safeDistance);
 
   if (vehicleDistance > safeDistance)
   {
@@ -144,10 +202,17 @@ bool checkSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehic
   return result;
 }
 
-bool calculateSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctVehicle,
-                                                        VehicleState const &oppositeVehicle,
-                                                        Distance &safeDistance)
+bool isSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctVehicle,
+                                                 VehicleState const &oppositeVehicle,
+                                                 Distance const &vehicleDistance,
+                                                 bool &isDistanceSafe)
 {
+  if (vehicleDistance < Distance(0.))
+  {
+    return false;
+  }
+
+  isDistanceSafe = false;
   if (!vehicleStateWithinVaildInputRange(correctVehicle) || !vehicleStateWithinVaildInputRange(oppositeVehicle))
   {
     return false;
@@ -163,10 +228,10 @@ bool calculateSafeLongitudinalDistanceOppositeDirection(VehicleState const &corr
     correctVehicle.dynamics.alphaLon.brakeMinCorrect,
     distanceStatedBrakingCorrect);
 
-  Distance distanceStatedBrakingOpposite = Distance(0.);
-
-  if (result)
+  // the distance covered by the opposite vehicle is not negative and can only increase the safe distance
+  if (result && (vehicleDistance > distanceStatedBrakingCorrect))
   {
+    Distance distanceStatedBrakingOpposite = Distance(0.);
     result = calculateDistanceOffsetAfterStatedBrakingPattern( // LCOV_EXCL_LINE: wrong detection
       CoordinateSystemAxis::Longitudinal,
       oppositeVehicle.velocity.speedLon.maximum,
@@ -174,38 +239,15 @@ bool calculateSafeLongitudinalDistanceOppositeDirection(VehicleState const &corr
       oppositeVehicle.dynamics.alphaLon.accelMax,
       oppositeVehicle.dynamics.alphaLon.brakeMin,
       distanceStatedBrakingOpposite);
-  }
-
-  if (result)
-  {
-    safeDistance = distanceStatedBrakingCorrect + distanceStatedBrakingOpposite;
+    if (result)
+    {
+      isDistanceSafe = (vehicleDistance > (distanceStatedBrakingCorrect + distanceStatedBrakingOpposite));
+    }
   }
 
   return result;
 }
 
-bool checkSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctVehicle,
-                                                    VehicleState const &oppositeVehicle,
-                                                    Distance const &vehicleDistance,
-                                                    Distance &safeDistance,
-                                                    bool &isDistanceSafe)
-{
-  if (vehicleDistance < Distance(0.))
-  {
-    return false;
-  }
-
-  isDistanceSafe = false;
-  safeDistance = std::numeric_limits<physics::Distance>::max();
-  bool const result = calculateSafeLongitudinalDistanceOppositeDirection(correctVehicle, oppositeVehicle, safeDistance);
-
-  if (vehicleDistance > safeDistance)
-  {
-    isDistanceSafe = true;
-  }
-  return result;
-}
-
 bool checkStopInFrontIntersection(VehicleState const &vehicle, Distance &safeDistance, bool &isDistanceSafe)
 {
   if (!vehicleStateWithinVaildInputRange(vehicle))
@@ -241,34 +283,8 @@ bool calculateSafeLateralDistance(VehicleState const &leftVehicle,
     return false;
   }
 
-  bool result = false;
-  Distance distanceOffsetStatedBrakingLeft = Distance(0.);
-  Distance distanceOffsetStatedBrakingRight = Distance(0.);
-
-  result = calculateDistanceOffsetAfterStatedBrakingPattern( // LCOV_EXCL_LINE: wrong detection
-    CoordinateSystemAxis::Lateral,
-    leftVehicle.velocity.speedLat.maximum,
-    leftVehicle.dynamics.responseTime,
-    leftVehicle.dynamics.alphaLat.accelMax,
-    leftVehicle.dynamics.alphaLat.brakeMin,
-    distanceOffsetStatedBrakingLeft);
-
-  result = result && calculateDistanceOffsetAfterStatedBrakingPattern( // LCOV_EXCL_LINE: wrong detection
-                       CoordinateSystemAxis::Lateral,
-                       rightVehicle.velocity.speedLat.minimum,
-                       rightVehicle.dynamics.responseTime,
-                       -rightVehicle.dynamics.alphaLat.accelMax,
-                       -rightVehicle.dynamics.alphaLat.brakeMin,
-                       distanceOffsetStatedBrakingRight);
-
-  if (result)
-  {
-    // safe distance is the difference of both distances
-    // Note: The fluctuation margin is already considered in the vehicle bounding boxes
-    safeDistance = distanceOffsetStatedBrakingLeft - distanceOffsetStatedBrakingRight;
-    safeDistance = std::max(safeDistance, Distance(0.));
-  }
-  return result;
+  return calculateSafeLateralDistanceT(
+    createVehicleStateT(leftVehicle), createVehicleStateT(rightVehicle), safeDistance);
 }
 
 bool checkSafeLateralDistance(VehicleState const &leftVehicle,
@@ -35,8 +35,10 @@
 
 #pragma once
 
+#include <cmath>
 #include "ad_rss/physics/CoordinateSystemAxis.hpp"
 #include "ad_rss/situation/VehicleState.hpp"
+#include "physics/Math.hpp"
 
 /*!
  * @brief namespace ad_rss
@@ -112,6 +114,24 @@ bool checkSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehic
                                                 physics::Distance &safeDistance,
                                                 bool &isDistanceSafe);
 
+/**
+ * @brief Check if the longitudinal distance between the two vehicles is safe without providing the safe distance.
+ *
+ * Same decision as checkSafeLongitudinalDistanceSameDirection(), but the stopping distance of the leading vehicle is
+ * only calculated if the distance covered by the following vehicle alone isn't safe already.
+ *
+ * @param[in]  leadingVehicle      is the state of the leading vehicle
+ * @param[in]  followingVehicle    is the state of the following vehicle
+ * @param[in]  vehicleDistance     the (positive) longitudinal distance between the two vehicles
+ * @param[out] isDistanceSafe      true if the distance is safe, false otherwise
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool isSafeLongitudinalDistanceSameDirection(VehicleState const &leadingVehicle,
+                                             VehicleState const &followingVehicle,
+                                             physics::Distance const &vehicleDistance,
+                                             bool &isDistanceSafe);
+
 /**
  * @brief Calculate  the safe longitudinal distance between to vehicles driving in opposite direction
  * The calculation will assume that the correctVehicle is on the correct lane
@@ -164,6 +184,25 @@ bool checkSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctV
                                                     physics::Distance &safeDistance,
                                                     bool &isDistanceSafe);
 
+/**
+ * @brief Check if the longitudinal distance between to vehicles driving in opposite direction is safe without
+ * providing the safe distance.
+ *
+ * Same decision as checkSafeLongitudinalDistanceOppositeDirection(), but the distance covered by the oppositeVehicle
+ * is only calculated if the distance covered by the correctVehicle alone doesn't render the distance unsafe already.
+ *
+ * @param[in]  correctVehicle     is the state of the vehicle driving in the correct lane
+ * @param[in]  oppositeVehicle    is the state of the vehicle driving in the wrong lane
+ * @param[in]  vehicleDistance    the (positive) longitudinal distance between the two vehicles
+ * @param[out] isDistanceSafe     true if the distance is safe, false otherwise
+ *
+ * @return true on successful calculation, false otherwise
+ */
+bool isSafeLongitudinalDistanceOppositeDirection(VehicleState const &correctVehicle,
+                                                 VehicleState const &oppositeVehicle,
+                                                 physics::Distance const &vehicleDistance,
+                                                 bool &isDistanceSafe);
+
 /**
  * @brief Check if the vehicle can safely break longitudinaly in front of the intersection.
  *        Assuming: Using \a "stated breaking pattern" for breaking
@@ -244,5 +283,171 @@ bool checkSafeLateralDistance(VehicleState const &leftVehicle,
                               physics::Distance &safeDistance,
                               bool &isDistanceSafe);
 
+/*
+ * The implementation of the safe distance formulas above, templated on the types of the physical quantities like the
+ * templated functions of Math.hpp. The input range checks of the vehicle states are not part of the templated
+ * formulas and have to be performed by the caller.
+ */
+
+/*!
+ * @brief the inputs of the RSS formulas of a vehicle state with templated types of the physical quantities
+ */
+template <typename Types> struct VehicleStateT
+{
+  typename Types::SpeedType speedLonMinimum;
+  typename Types::SpeedType speedLonMaximum;
+  typename Types::SpeedType speedLatMinimum;
+  typename Types::SpeedType speedLatMaximum;
+  typename Types::DurationType responseTime;
+  typename Types::AccelerationType alphaLonAccelMax;
+  typename Types::AccelerationType alphaLonBrakeMax;
+  typename Types::AccelerationType alphaLonBrakeMin;
+  typename Types::AccelerationType alphaLonBrakeMinCorrect;
+  typename Types::AccelerationType alphaLatAccelMax;
+  typename Types::AccelerationType alphaLatBrakeMin;
+};
+
+/**
+ * @brief templated version of calculateDistanceOffsetAfterStatedBrakingPattern()
+ */
+template <typename SpeedType, typename DurationType, typename AccelerationType, typename DistanceType>
+bool calculateDistanceOffsetAfterStatedBrakingPatternT(physics::CoordinateSystemAxis const &axis,
+                                                       SpeedType const &currentSpeed,
+                                                       DurationType const &responseTime,
+                                                       AccelerationType const &acceleration,
+                                                       AccelerationType const &deceleration,
+                                                       DistanceType &distanceOffset)
+{
+  using physics::getValue;
+  using std::fabs;
+  SpeedType resultingSpeed(0.);
+  bool result
+    = physics::calculateSpeedAfterResponseTimeT(axis, currentSpeed, acceleration, responseTime, resultingSpeed);
+
+  DistanceType distanceOffsetAfterResponseTime(0.);
+  result = result
+    && physics::calculateDistanceOffsetAfterResponseTimeT(
+             axis, currentSpeed, acceleration, responseTime, distanceOffsetAfterResponseTime);
+
+  DistanceType distanceToStop(0.);
+  if (std::signbit(getValue(resultingSpeed)) == std::signbit(getValue(acceleration)))
+  {
+    // if speed after stated braking pattern has the same direction as the acceleration
+    // (always the case in longitudinal situation)
+    // further braking to full stop in that moving direction has to be added
+    result = result && physics::calculateStoppingDistanceT(resultingSpeed, fabs(deceleration), distanceToStop);
+  }
+
+  if (result)
+  {
+    distanceOffset = distanceOffsetAfterResponseTime + distanceToStop;
+  }
+
+  return result;
+}
+
+/*
+ * max(distance, 0) with the fuzzy comparison of physics::Distance
+ */
+template <typename DistanceType> DistanceType clampDistanceT(DistanceType const &distance)
+{
+  return (physics::toPhysicsType<physics::Distance>(distance) < physics::Distance(0.)) ? DistanceType(0.) : distance;
+}
+
+/**
+ * @brief templated version of calculateSafeLongitudinalDistanceSameDirection()
+ */
+template <typename Types>
+bool calculateSafeLongitudinalDistanceSameDirectionT(VehicleStateT<Types> const &leadingVehicle,
+                                                     VehicleStateT<Types> const &followingVehicle,
+                                                     typename Types::DistanceType &safeDistance)
+{
+  typename Types::DistanceType distanceStatedBraking(0.);
+  bool result = calculateDistanceOffsetAfterStatedBrakingPatternT(physics::CoordinateSystemAxis::Longitudinal,
+                                                                  followingVehicle.speedLonMaximum,
+                                                                  followingVehicle.responseTime,
+                                                                  followingVehicle.alphaLonAccelMax,
+                                                                  followingVehicle.alphaLonBrakeMin,
+                                                                  distanceStatedBraking);
+  typename Types::DistanceType distanceMaxBrake(0.);
+  result = result
+    && physics::calculateStoppingDistanceT(
+             leadingVehicle.speedLonMinimum, leadingVehicle.alphaLonBrakeMax, distanceMaxBrake);
+
+  if (result)
+  {
+    safeDistance = clampDistanceT(distanceStatedBraking - distanceMaxBrake);
+  }
+
+  return result;
+}
+
+/**
+ * @brief templated version of calculateSafeLongitudinalDistanceOppositeDirection()
+ */
+template <typename Types>
+bool calculateSafeLongitudinalDistanceOppositeDirectionT(VehicleStateT<Types> const &correctVehicle,
+                                                         VehicleStateT<Types> const &oppositeVehicle,
+                                                         typename Types::DistanceType &safeDistance)
+{
+  typename Types::DistanceType distanceStatedBrakingCorrect(0.);
+  bool result = calculateDistanceOffsetAfterStatedBrakingPatternT(physics::CoordinateSystemAxis::Longitudinal,
+                                                                  correctVehicle.speedLonMaximum,
+                                                                  correctVehicle.responseTime,
+                                                                  correctVehicle.alphaLonAccelMax,
+                                                                  correctVehicle.alphaLonBrakeMinCorrect,
+                                                                  distanceStatedBrakingCorrect);
+
+  typename Types::DistanceType distanceStatedBrakingOpposite(0.);
+  result = result
+    && calculateDistanceOffsetAfterStatedBrakingPatternT(physics::CoordinateSystemAxis::Longitudinal,
+                                                         oppositeVehicle.speedLonMaximum,
+                                                         oppositeVehicle.responseTime,
+                                                         oppositeVehicle.alphaLonAccelMax,
+                                                         oppositeVehicle.alphaLonBrakeMin,
+                                                         distanceStatedBrakingOpposite);
+
+  if (result)
+  {
+    safeDistance = distanceStatedBrakingCorrect + distanceStatedBrakingOpposite;
+  }
+
+  return result;
+}
+
+/**
+ * @brief templated version of calculateSafeLateralDistance()
+ */
+template <typename Types>
+bool calculateSafeLateralDistanceT(VehicleStateT<Types> const &leftVehicle,
+                                   VehicleStateT<Types> const &rightVehicle,
+                                   typename Types::DistanceType &safeDistance)
+{
+  typename Types::DistanceType distanceOffsetStatedBrakingLeft(0.);
+  bool result = calculateDistanceOffsetAfterStatedBrakingPatternT(physics::CoordinateSystemAxis::Lateral,
+                                                                  leftVehicle.speedLatMaximum,
+                                                                  leftVehicle.responseTime,
+                                                                  leftVehicle.alphaLatAccelMax,
+                                                                  leftVehicle.alphaLatBrakeMin,
+                                                                  distanceOffsetStatedBrakingLeft);
+
+  typename Types::DistanceType distanceOffsetStatedBrakingRight(0.);
+  result = result
+    && calculateDistanceOffsetAfterStatedBrakingPatternT(physics::CoordinateSystemAxis::Lateral,
+                                                         rightVehicle.speedLatMinimum,
+                                                         rightVehicle.responseTime,
+                                                         -rightVehicle.alphaLatAccelMax,
+                                                         -rightVehicle.alphaLatBrakeMin,
+                                                         distanceOffsetStatedBrakingRight);
+
+  if (result)
+  {
+    // safe distance is the difference of both distances
+    // Note: The fluctuation margin is already considered in the vehicle bounding boxes
+    safeDistance = clampDistanceT(distanceOffsetStatedBrakingLeft - distanceOffsetStatedBrakingRight);
+  }
+  return result;
+}
+
 } // namespace situation
 } // namespace ad_rss
@@ -0,0 +1,271 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "situation/RssFormulasBatch.hpp"
+#include <algorithm>
+#include "ad_rss/physics/Distance.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+void VehicleStateBatch::resize(std::size_t const size)
+{
+  speedLonMinimum.resize(size);
+  speedLonMaximum.resize(size);
+  speedLatMinimum.resize(size);
+  speedLatMaximum.resize(size);
+  responseTime.resize(size);
+  alphaLonAccelMax.resize(size);
+  alphaLonBrakeMax.resize(size);
+  alphaLonBrakeMin.resize(size);
+  alphaLonBrakeMinCorrect.resize(size);
+  alphaLatAccelMax.resize(size);
+  alphaLatBrakeMin.resize(size);
+}
+
+void VehicleStateBatch::setVelocity(VehicleState const &vehicleState)
+{
+  std::fill(speedLonMinimum.begin(),
+            speedLonMinimum.end(),
+            static_cast<double>(vehicleState.velocity.speedLon.minimum));
+  std::fill(speedLonMaximum.begin(),
+            speedLonMaximum.end(),
+            static_cast<double>(vehicleState.velocity.speedLon.maximum));
+  std::fill(speedLatMinimum.begin(),
+            speedLatMinimum.end(),
+            static_cast<double>(vehicleState.velocity.speedLat.minimum));
+  std::fill(speedLatMaximum.begin(),
+            speedLatMaximum.end(),
+            static_cast<double>(vehicleState.velocity.speedLat.maximum));
+}
+
+void VehicleStateBatch::setVelocity(std::size_t const index, VehicleState const &vehicleState)
+{
+  speedLonMinimum[index] = static_cast<double>(vehicleState.velocity.speedLon.minimum);
+  speedLonMaximum[index] = static_cast<double>(vehicleState.velocity.speedLon.maximum);
+  speedLatMinimum[index] = static_cast<double>(vehicleState.velocity.speedLat.minimum);
+  speedLatMaximum[index] = static_cast<double>(vehicleState.velocity.speedLat.maximum);
+}
+
+void VehicleStateBatch::setDynamics(world::RssDynamics const &dynamics)
+{
+  std::fill(responseTime.begin(), responseTime.end(), static_cast<double>(dynamics.responseTime));
+  std::fill(alphaLonAccelMax.begin(), alphaLonAccelMax.end(), static_cast<double>(dynamics.alphaLon.accelMax));
+  std::fill(alphaLonBrakeMax.begin(), alphaLonBrakeMax.end(), static_cast<double>(dynamics.alphaLon.brakeMax));
+  std::fill(alphaLonBrakeMin.begin(), alphaLonBrakeMin.end(), static_cast<double>(dynamics.alphaLon.brakeMin));
+  std::fill(alphaLonBrakeMinCorrect.begin(),
+            alphaLonBrakeMinCorrect.end(),
+            static_cast<double>(dynamics.alphaLon.brakeMinCorrect));
+  std::fill(alphaLatAccelMax.begin(), alphaLatAccelMax.end(), static_cast<double>(dynamics.alphaLat.accelMax));
+  std::fill(alphaLatBrakeMin.begin(), alphaLatBrakeMin.end(), static_cast<double>(dynamics.alphaLat.brakeMin));
+}
+
+void VehicleStateBatch::setDynamics(std::size_t const index, world::RssDynamics const &dynamics)
+{
+  responseTime[index] = static_cast<double>(dynamics.responseTime);
+  alphaLonAccelMax[index] = static_cast<double>(dynamics.alphaLon.accelMax);
+  alphaLonBrakeMax[index] = static_cast<double>(dynamics.alphaLon.brakeMax);
+  alphaLonBrakeMin[index] = static_cast<double>(dynamics.alphaLon.brakeMin);
+  alphaLonBrakeMinCorrect[index] = static_cast<double>(dynamics.alphaLon.brakeMinCorrect);
+  alphaLatAccelMax[index] = static_cast<double>(dynamics.alphaLat.accelMax);
+  alphaLatBrakeMin[index] = static_cast<double>(dynamics.alphaLat.brakeMin);
+}
+
+void SituationMarginBatch::resize(std::size_t const size)
+{
+  lonMargin.resize(size);
+  latMargin.resize(size);
+  margin.resize(size);
+  isDangerous.resize(size);
+}
+
+void calculateSafeLongitudinalDistanceSameDirectionBatch(VehicleStateBatch const &leadingVehicle,
+                                                         VehicleStateBatch const &followingVehicle,
+                                                         std::vector<double> &safeDistance)
+{
+  // the arrays are accessed by plain pointers to ease the vectorization of the loop
+  double const *const leadingSpeed = leadingVehicle.speedLonMinimum.data();
+  double const *const leadingBrakeMax = leadingVehicle.alphaLonBrakeMax.data();
+  double const *const followingSpeed = followingVehicle.speedLonMaximum.data();
+  double const *const followingResponseTime = followingVehicle.responseTime.data();
+  double const *const followingAccelMax = followingVehicle.alphaLonAccelMax.data();
+  double const *const followingBrakeMin = followingVehicle.alphaLonBrakeMin.data();
+  double *const result = safeDistance.data();
+  std::size_t const size = safeDistance.size();
+
+  for (std::size_t i = 0u; i < size; ++i)
+  {
+    double const distanceStatedBraking = calculateLongitudinalDistanceOffsetAfterStatedBrakingPattern(
+      followingSpeed[i], followingResponseTime[i], followingAccelMax[i], followingBrakeMin[i]);
+    double const distanceMaxBrake = leadingSpeed[i] * leadingSpeed[i] / (2. * leadingBrakeMax[i]);
+    result[i] = std::max(distanceStatedBraking - distanceMaxBrake, 0.);
+  }
+}
+
+void calculateSafeLongitudinalDistanceOppositeDirectionBatch(VehicleStateBatch const &correctVehicle,
+                                                             VehicleStateBatch const &oppositeVehicle,
+                                                             std::vector<double> &safeDistance)
+{
+  double const *const correctSpeed = correctVehicle.speedLonMaximum.data();
+  double const *const correctResponseTime = correctVehicle.responseTime.data();
+  double const *const correctAccelMax = correctVehicle.alphaLonAccelMax.data();
+  double const *const correctBrakeMinCorrect = correctVehicle.alphaLonBrakeMinCorrect.data();
+  double const *const oppositeSpeed = oppositeVehicle.speedLonMaximum.data();
+  double const *const oppositeResponseTime = oppositeVehicle.responseTime.data();
+  double const *const oppositeAccelMax = oppositeVehicle.alphaLonAccelMax.data();
+  double const *const oppositeBrakeMin = oppositeVehicle.alphaLonBrakeMin.data();
+  double *const result = safeDistance.data();
+  std::size_t const size = safeDistance.size();
+
+  for (std::size_t i = 0u; i < size; ++i)
+  {
+    result[i] = calculateLongitudinalDistanceOffsetAfterStatedBrakingPattern(
+                  correctSpeed[i], correctResponseTime[i], correctAccelMax[i], correctBrakeMinCorrect[i])
+      + calculateLongitudinalDistanceOffsetAfterStatedBrakingPattern(
+                  oppositeSpeed[i], oppositeResponseTime[i], oppositeAccelMax[i], oppositeBrakeMin[i]);
+  }
+}
+
+void calculateSafeLateralDistanceBatch(VehicleStateBatch const &leftVehicle,
+                                       VehicleStateBatch const &rightVehicle,
+                                       std::vector<double> &safeDistance)
+{
+  double const *const leftSpeed = leftVehicle.speedLatMaximum.data();
+  double const *const leftResponseTime = leftVehicle.responseTime.data();
+  double const *const leftAccelMax = leftVehicle.alphaLatAccelMax.data();
+  double const *const leftBrakeMin = leftVehicle.alphaLatBrakeMin.data();
+  double const *const rightSpeed = rightVehicle.speedLatMinimum.data();
+  double const *const rightResponseTime = rightVehicle.responseTime.data();
+  double const *const rightAccelMax = rightVehicle.alphaLatAccelMax.data();
+  double const *const rightBrakeMin = rightVehicle.alphaLatBrakeMin.data();
+  double *const result = safeDistance.data();
+  std::size_t const size = safeDistance.size();
+
+  for (std::size_t i = 0u; i < size; ++i)
+  {
+    // the right vehicle approaches the left vehicle in negative lateral direction
+    double const distanceOffsetStatedBrakingLeft = calculateLateralDistanceOffsetAfterStatedBrakingPattern(
+      leftSpeed[i], leftResponseTime[i], leftAccelMax[i], leftBrakeMin[i]);
+    double const distanceOffsetStatedBrakingRight = calculateLateralDistanceOffsetAfterStatedBrakingPattern(
+      rightSpeed[i], rightResponseTime[i], -rightAccelMax[i], rightBrakeMin[i]);
+    result[i] = std::max(distanceOffsetStatedBrakingLeft - distanceOffsetStatedBrakingRight, 0.);
+  }
+}
+
+bool calculateSituationMarginBatch(Situation const &situation,
+                                   VehicleStateBatch const &egoVehicle,
+                                   VehicleStateBatch const &otherVehicle,
+                                   SituationMarginBatch &situationMargin)
+{
+  std::size_t const size = egoVehicle.size();
+  if (otherVehicle.size() != size)
+  {
+    return false;
+  }
+  situationMargin.resize(size);
+
+  if (SituationType::SameDirection == situation.situationType)
+  {
+    if ((LongitudinalRelativePosition::InFront == situation.relativePosition.longitudinalPosition)
+        || (LongitudinalRelativePosition::OverlapFront == situation.relativePosition.longitudinalPosition))
+    {
+      calculateSafeLongitudinalDistanceSameDirectionBatch(egoVehicle, otherVehicle, situationMargin.lonMargin);
+    }
+    else
+    {
+      calculateSafeLongitudinalDistanceSameDirectionBatch(otherVehicle, egoVehicle, situationMargin.lonMargin);
+    }
+  }
+  else if (SituationType::OppositeDirection == situation.situationType)
+  {
+    if (situation.egoVehicleState.isInCorrectLane)
+    {
+      calculateSafeLongitudinalDistanceOppositeDirectionBatch(egoVehicle, otherVehicle, situationMargin.lonMargin);
+    }
+    else
+    {
+      calculateSafeLongitudinalDistanceOppositeDirectionBatch(otherVehicle, egoVehicle, situationMargin.lonMargin);
+    }
+  }
+  else
+  {
+    return false;
+  }
+
+  double const lonDistance = static_cast<double>(situation.relativePosition.longitudinalDistance);
+  double *const lonMargin = situationMargin.lonMargin.data();
+  double *const margin = situationMargin.margin.data();
+
+  if ((LateralRelativePosition::AtLeft == situation.relativePosition.lateralPosition)
+      || (LateralRelativePosition::AtRight == situation.relativePosition.lateralPosition))
+  {
+    if (LateralRelativePosition::AtLeft == situation.relativePosition.lateralPosition)
+    {
+      calculateSafeLateralDistanceBatch(egoVehicle, otherVehicle, situationMargin.latMargin);
+    }
+    else
+    {
+      calculateSafeLateralDistanceBatch(otherVehicle, egoVehicle, situationMargin.latMargin);
+    }
+    double const latDistance = static_cast<double>(situation.relativePosition.lateralDistance);
+    double *const latMargin = situationMargin.latMargin.data();
+    for (std::size_t i = 0u; i < size; ++i)
+    {
+      lonMargin[i] = lonDistance - lonMargin[i];
+      latMargin[i] = latDistance - latMargin[i];
+      margin[i] = std::max(lonMargin[i], latMargin[i]);
+    }
+  }
+  else
+  {
+    // laterally overlapping vehicles are never lateral safe
+    for (std::size_t i = 0u; i < size; ++i)
+    {
+      lonMargin[i] = lonDistance - lonMargin[i];
+      margin[i] = lonMargin[i];
+    }
+  }
+
+  // the distances are compared fuzzy by the situation checks: a distance is larger than the safe distance if the
+  // margin reaches the precision; the situation is dangerous if no axis is safe, i.e. the margin is below the
+  // precision. The sign of the difference is evaluated arithmetically, as the compiler doesn't vectorize the
+  // conversion of the comparison result.
+  double const precision = static_cast<double>(physics::Distance::getPrecision());
+  std::uint8_t *const isDangerous = situationMargin.isDangerous.data();
+  for (std::size_t i = 0u; i < size; ++i)
+  {
+    isDangerous[i] = static_cast<std::uint8_t>(static_cast<int>(0.5 - std::copysign(0.5, margin[i] - precision)));
+  }
+  return true;
+}
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,228 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "ad_rss/situation/Situation.hpp"
+#include "ad_rss/world/RssDynamics.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace situation
+ */
+namespace situation {
+
+/*
+ * The non intersection formulas of RssFormulas.hpp evaluated in closed form on batches of vehicle states, e.g. for
+ * many dynamics configurations or samples of the same situation. The batches are stored as structure of arrays and
+ * the formulas are plain loops over the arrays. The case distinctions of the scalar formulas are replaced by
+ * arithmetic selects and std::min/std::max, so the loop bodies are free of branches and the compiler vectorizes them
+ * (check with -fopt-info-vec). The results equal the scalar formulas up to rounding. The input range checks of the
+ * vehicle states are not part of the batch formulas and have to be performed by the caller.
+ */
+
+/*!
+ * @brief the inputs of the RSS formulas of a batch of vehicle states as structure of arrays
+ */
+struct VehicleStateBatch
+{
+  /**
+   * @brief resize all arrays
+   */
+  void resize(std::size_t const size);
+
+  /**
+   * @returns the number of vehicle states within the batch
+   */
+  std::size_t size() const
+  {
+    return responseTime.size();
+  }
+
+  /**
+   * @brief set the velocity of all vehicle states within the batch to the velocity of the given vehicle state
+   */
+  void setVelocity(VehicleState const &vehicleState);
+
+  /**
+   * @brief set the velocity of the vehicle state with the given index
+   */
+  void setVelocity(std::size_t const index, VehicleState const &vehicleState);
+
+  /**
+   * @brief set the dynamics of all vehicle states within the batch
+   */
+  void setDynamics(world::RssDynamics const &dynamics);
+
+  /**
+   * @brief set the dynamics of the vehicle state with the given index
+   */
+  void setDynamics(std::size_t const index, world::RssDynamics const &dynamics);
+
+  std::vector<double> speedLonMinimum;
+  std::vector<double> speedLonMaximum;
+  std::vector<double> speedLatMinimum;
+  std::vector<double> speedLatMaximum;
+  std::vector<double> responseTime;
+  std::vector<double> alphaLonAccelMax;
+  std::vector<double> alphaLonBrakeMax;
+  std::vector<double> alphaLonBrakeMin;
+  std::vector<double> alphaLonBrakeMinCorrect;
+  std::vector<double> alphaLatAccelMax;
+  std::vector<double> alphaLatBrakeMin;
+};
+
+/*!
+ * @brief the margins of a batch of evaluations of a non intersection situation
+ */
+struct SituationMarginBatch
+{
+  /**
+   * @brief resize all arrays
+   */
+  void resize(std::size_t const size);
+
+  /*!
+   * The difference of the current and the safe longitudinal distance
+   */
+  std::vector<double> lonMargin;
+
+  /*!
+   * The difference of the current and the safe lateral distance; only calculated if the vehicles don't overlap
+   * laterally
+   */
+  std::vector<double> latMargin;
+
+  /*!
+   * The margin of the situation: the larger one of both axes if the vehicles don't overlap laterally, the
+   * longitudinal margin otherwise; positive if the situation is safe
+   */
+  std::vector<double> margin;
+
+  /*!
+   * 1 if the situation is dangerous in the sense of state::isDangerous(), 0 otherwise
+   */
+  std::vector<std::uint8_t> isDangerous;
+};
+
+/**
+ * @brief batch version of calculateDistanceOffsetAfterStatedBrakingPattern() in longitudinal direction
+ *
+ * The current speed is not negative. The case distinctions are expressed by factors of 0 and 1 derived from the signs,
+ * so the function is free of branches and can be inlined into vectorized loops.
+ */
+inline double calculateLongitudinalDistanceOffsetAfterStatedBrakingPattern(double const currentSpeed,
+                                                                           double const responseTime,
+                                                                           double const acceleration,
+                                                                           double const deceleration)
+{
+  // 1 if the vehicle decelerates, 0 otherwise
+  double const isDecelerating = 0.5 - std::copysign(0.5, acceleration);
+  // on deceleration the movement within the response time ends on stop
+  double const timeToStop = currentSpeed / std::max(-acceleration, std::numeric_limits<double>::min());
+  double const duration = std::min(responseTime, timeToStop + (1. - isDecelerating) * responseTime);
+  double const distance = currentSpeed * duration + 0.5 * acceleration * duration * duration;
+  // further braking to full stop is only required if the vehicle is still moving after the response time
+  double const resultingSpeed = std::max(0., currentSpeed + acceleration * responseTime);
+  return distance + (1. - isDecelerating) * resultingSpeed * resultingSpeed / (2. * deceleration);
+}
+
+/**
+ * @brief batch version of calculateDistanceOffsetAfterStatedBrakingPattern() in lateral direction
+ *
+ * The deceleration is the absolute value of the deceleration. Free of branches like the longitudinal version.
+ */
+inline double calculateLateralDistanceOffsetAfterStatedBrakingPattern(double const currentSpeed,
+                                                                      double const responseTime,
+                                                                      double const acceleration,
+                                                                      double const deceleration)
+{
+  double const resultingSpeed = currentSpeed + acceleration * responseTime;
+  double const distance = currentSpeed * responseTime + 0.5 * acceleration * responseTime * responseTime;
+  // further braking to full stop is only required if the speed after the response time has the direction of the
+  // acceleration: 1 if the signs are equal, 0 otherwise
+  double const isSameDirection = 0.5 + std::copysign(0.5, resultingSpeed) * std::copysign(1., acceleration);
+  return distance + isSameDirection * resultingSpeed * std::fabs(resultingSpeed) / (2. * deceleration);
+}
+
+/**
+ * @brief batch version of calculateSafeLongitudinalDistanceSameDirection()
+ */
+void calculateSafeLongitudinalDistanceSameDirectionBatch(VehicleStateBatch const &leadingVehicle,
+                                                         VehicleStateBatch const &followingVehicle,
+                                                         std::vector<double> &safeDistance);
+
+/**
+ * @brief batch version of calculateSafeLongitudinalDistanceOppositeDirection()
+ */
+void calculateSafeLongitudinalDistanceOppositeDirectionBatch(VehicleStateBatch const &correctVehicle,
+                                                             VehicleStateBatch const &oppositeVehicle,
+                                                             std::vector<double> &safeDistance);
+
+/**
+ * @brief batch version of calculateSafeLateralDistance()
+ */
+void calculateSafeLateralDistanceBatch(VehicleStateBatch const &leftVehicle,
+                                       VehicleStateBatch const &rightVehicle,
+                                       std::vector<double> &safeDistance);
+
+/**
+ * @brief evaluate a non intersection situation for a batch of ego and other vehicle states
+ *
+ * The relative position of the situation is taken from the situation, the vehicle states from the batches. The
+ * decision equals the situation checks: an axis is safe if its margin exceeds the precision of physics::Distance.
+ *
+ * @param[in]  situation the situation providing the situation type and the relative position
+ * @param[in]  egoVehicle the batch of ego vehicle states
+ * @param[in]  otherVehicle the batch of other vehicle states; must have the size of the ego vehicle batch
+ * @param[out] situationMargin the margins and the decisions of the batch
+ *
+ * @returns false if the situation is not a non intersection situation or the batch sizes differ, true otherwise
+ */
+bool calculateSituationMarginBatch(Situation const &situation,
+                                   VehicleStateBatch const &egoVehicle,
+                                   VehicleStateBatch const &otherVehicle,
+                                   SituationMarginBatch &situationMargin);
+
+} // namespace situation
+} // namespace ad_rss
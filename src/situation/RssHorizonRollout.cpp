@@ -0,0 +1,350 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/situation/RssHorizonRollout.hpp"
+#include <algorithm>
+#include "ad_rss/physics/AccelerationValidInputRange.hpp"
+#include "ad_rss/physics/DurationValidInputRange.hpp"
+#include "ad_rss/situation/SituationSnapshotValidInputRange.hpp"
+#include "ad_rss/state/RssStateOperation.hpp"
+#include "physics/Math.hpp"
+#include "situation/RssIntersectionChecker.hpp"
+#include "situation/RssSituation.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+using physics::Acceleration;
+using physics::CoordinateSystemAxis;
+using physics::Distance;
+using physics::Duration;
+using physics::Speed;
+
+namespace {
+
+/*
+ * The kinematic states of a vehicle at all time steps of the horizon.
+ * The offsets are driven with the minimum and the maximum speed of the initial speed range.
+ */
+struct VehicleTrajectory
+{
+  VelocityRange velocity;
+  std::vector<VelocityRange> velocities;
+  std::vector<Distance> lonOffsetMinimum;
+  std::vector<Distance> lonOffsetMaximum;
+  std::vector<Distance> latOffsetMinimum;
+  std::vector<Distance> latOffsetMaximum;
+};
+
+bool accelerationWithinValidInputRange(PredictedAcceleration const &acceleration)
+{
+  return withinValidInputRange(acceleration.accelerationLon) && withinValidInputRange(acceleration.accelerationLat);
+}
+
+bool advanceSpeed(CoordinateSystemAxis const &axis,
+                  Speed const &currentSpeed,
+                  Acceleration const &acceleration,
+                  Duration const &duration,
+                  Speed &resultingSpeed,
+                  Distance &distanceOffset)
+{
+  return physics::calculateSpeedAfterResponseTime(axis, currentSpeed, acceleration, duration, resultingSpeed)
+    && physics::calculateDistanceOffsetAfterResponseTime(axis, currentSpeed, acceleration, duration, distanceOffset);
+}
+
+bool calculateVehicleTrajectory(VelocityRange const &velocity,
+                                PredictedAcceleration const &acceleration,
+                                std::vector<Duration> const &times,
+                                VehicleTrajectory &trajectory)
+{
+  std::size_t const numberOfTimes = times.size();
+  trajectory.velocity = velocity;
+  trajectory.velocities.resize(numberOfTimes);
+  trajectory.lonOffsetMinimum.resize(numberOfTimes);
+  trajectory.lonOffsetMaximum.resize(numberOfTimes);
+  trajectory.latOffsetMinimum.resize(numberOfTimes);
+  trajectory.latOffsetMaximum.resize(numberOfTimes);
+
+  bool result = true;
+  for (std::size_t k = 0u; result && (k < numberOfTimes); ++k)
+  {
+    VelocityRange &resultingVelocity = trajectory.velocities[k];
+    result = advanceSpeed(CoordinateSystemAxis::Longitudinal,
+                          velocity.speedLon.minimum,
+                          acceleration.accelerationLon,
+                          times[k],
+                          resultingVelocity.speedLon.minimum,
+                          trajectory.lonOffsetMinimum[k])
+      && advanceSpeed(CoordinateSystemAxis::Longitudinal,
+                      velocity.speedLon.maximum,
+                      acceleration.accelerationLon,
+                      times[k],
+                      resultingVelocity.speedLon.maximum,
+                      trajectory.lonOffsetMaximum[k])
+      && advanceSpeed(CoordinateSystemAxis::Lateral,
+                      velocity.speedLat.minimum,
+                      acceleration.accelerationLat,
+                      times[k],
+                      resultingVelocity.speedLat.minimum,
+                      trajectory.latOffsetMinimum[k])
+      && advanceSpeed(CoordinateSystemAxis::Lateral,
+                      velocity.speedLat.maximum,
+                      acceleration.accelerationLat,
+                      times[k],
+                      resultingVelocity.speedLat.maximum,
+                      trajectory.latOffsetMaximum[k]);
+  }
+  return result;
+}
+
+/*
+ * The distance after moving the vehicles; the vehicles overlap if the distance vanishes.
+ */
+bool rollOutDistance(Distance const &distance, Distance const &change, Distance &resultingDistance)
+{
+  resultingDistance = distance + change;
+  if (resultingDistance <= Distance(0.))
+  {
+    resultingDistance = Distance(0.);
+    return true;
+  }
+  return false;
+}
+
+void rollOutLongitudinalPosition(Situation const &situation,
+                                 VehicleTrajectory const &egoTrajectory,
+                                 VehicleTrajectory const &otherTrajectory,
+                                 std::size_t const k,
+                                 RelativePosition &relativePosition)
+{
+  // within intersections the positions are intersection centric, so both vehicles drive in the same direction
+  bool const isOppositeDirection = (situation.situationType == SituationType::OppositeDirection);
+  if (relativePosition.longitudinalPosition == LongitudinalRelativePosition::InFront)
+  {
+    Distance const change = isOppositeDirection
+      ? (egoTrajectory.lonOffsetMinimum[k] + otherTrajectory.lonOffsetMinimum[k])
+      : (egoTrajectory.lonOffsetMinimum[k] - otherTrajectory.lonOffsetMaximum[k]);
+    if (rollOutDistance(
+          situation.relativePosition.longitudinalDistance, change, relativePosition.longitudinalDistance))
+    {
+      relativePosition.longitudinalPosition = LongitudinalRelativePosition::OverlapFront;
+    }
+  }
+  else if (relativePosition.longitudinalPosition == LongitudinalRelativePosition::AtBack)
+  {
+    Distance const change = isOppositeDirection
+      ? -(egoTrajectory.lonOffsetMaximum[k] + otherTrajectory.lonOffsetMaximum[k])
+      : (otherTrajectory.lonOffsetMinimum[k] - egoTrajectory.lonOffsetMaximum[k]);
+    if (rollOutDistance(
+          situation.relativePosition.longitudinalDistance, change, relativePosition.longitudinalDistance))
+    {
+      relativePosition.longitudinalPosition = LongitudinalRelativePosition::OverlapBack;
+    }
+  }
+}
+
+void rollOutLateralPosition(Situation const &situation,
+                            VehicleTrajectory const &egoTrajectory,
+                            VehicleTrajectory const &otherTrajectory,
+                            std::size_t const k,
+                            RelativePosition &relativePosition)
+{
+  // positive lateral speeds move the left vehicle towards the right one
+  if (relativePosition.lateralPosition == LateralRelativePosition::AtLeft)
+  {
+    Distance const change = otherTrajectory.latOffsetMinimum[k] - egoTrajectory.latOffsetMaximum[k];
+    if (rollOutDistance(situation.relativePosition.lateralDistance, change, relativePosition.lateralDistance))
+    {
+      relativePosition.lateralPosition = LateralRelativePosition::OverlapLeft;
+    }
+  }
+  else if (relativePosition.lateralPosition == LateralRelativePosition::AtRight)
+  {
+    Distance const change = egoTrajectory.latOffsetMinimum[k] - otherTrajectory.latOffsetMaximum[k];
+    if (rollOutDistance(situation.relativePosition.lateralDistance, change, relativePosition.lateralDistance))
+    {
+      relativePosition.lateralPosition = LateralRelativePosition::OverlapRight;
+    }
+  }
+}
+
+void rollOutVehicleState(VehicleState const &vehicleState,
+                         VehicleTrajectory const &trajectory,
+                         std::size_t const k,
+                         VehicleState &resultingVehicleState)
+{
+  resultingVehicleState.velocity = trajectory.velocities[k];
+  // the vehicle enters the intersection at the earliest and leaves it at the latest point in time
+  resultingVehicleState.distanceToEnterIntersection
+    = std::max(Distance(0.), vehicleState.distanceToEnterIntersection - trajectory.lonOffsetMaximum[k]);
+  resultingVehicleState.distanceToLeaveIntersection
+    = std::max(resultingVehicleState.distanceToEnterIntersection,
+               vehicleState.distanceToLeaveIntersection - trajectory.lonOffsetMinimum[k]);
+}
+
+bool calculateRssState(Situation const &situation, state::RssState &rssState)
+{
+  bool result = false;
+  switch (situation.situationType)
+  {
+    case SituationType::SameDirection:
+      result = calculateRssStateNonIntersectionSameDirection(situation, getDefaultFormulaProvider(), rssState);
+      break;
+    case SituationType::OppositeDirection:
+      result = calculateRssStateNonIntersectionOppositeDirection(situation, getDefaultFormulaProvider(), rssState);
+      break;
+    case SituationType::IntersectionEgoHasPriority:
+    case SituationType::IntersectionObjectHasPriority:
+    case SituationType::IntersectionSamePriority:
+    {
+      // a fresh history per evaluation, the intersection state of the situation is not kept
+      core::RssIntersectionCheckingState intersectionCheckingState;
+      result = calculateRssStateIntersection(
+        intersectionCheckingState, physics::TimeIndex(1u), situation, getDefaultFormulaProvider(), rssState);
+      break;
+    }
+    default:
+      result = false;
+      break;
+  }
+  return result;
+}
+
+bool rollOutSituation(Situation const &situation,
+                      VehicleTrajectory const &egoTrajectory,
+                      VehicleTrajectory const &otherTrajectory,
+                      std::vector<Duration> const &times,
+                      std::vector<Situation> &rolledOutSituations,
+                      HorizonRolloutResult &rolloutResult)
+{
+  // first the situations of all time steps, then the checks until the first dangerous one
+  std::size_t const numberOfTimes = times.size();
+  rolledOutSituations.assign(numberOfTimes, situation);
+  for (std::size_t k = 0u; k < numberOfTimes; ++k)
+  {
+    Situation &rolledOutSituation = rolledOutSituations[k];
+    rollOutVehicleState(situation.egoVehicleState, egoTrajectory, k, rolledOutSituation.egoVehicleState);
+    rollOutVehicleState(situation.otherVehicleState, otherTrajectory, k, rolledOutSituation.otherVehicleState);
+    rollOutLongitudinalPosition(situation, egoTrajectory, otherTrajectory, k, rolledOutSituation.relativePosition);
+    rollOutLateralPosition(situation, egoTrajectory, otherTrajectory, k, rolledOutSituation.relativePosition);
+  }
+
+  bool result = true;
+  for (std::size_t k = 0u; result && !rolloutResult.isDangerous && (k < numberOfTimes); ++k)
+  {
+    state::RssState rssState;
+    result = calculateRssState(rolledOutSituations[k], rssState);
+    if (result && state::isDangerous(rssState))
+    {
+      rolloutResult.isDangerous = true;
+      rolloutResult.firstDangerousTimeStep = k;
+      rolloutResult.timeToDanger = times[k];
+    }
+  }
+  return result;
+}
+
+} // namespace
+
+bool calculateHorizonRollout(SituationSnapshot const &situationSnapshot,
+                             HorizonRolloutParameters const &parameters,
+                             std::vector<HorizonRolloutResult> &rolloutResults)
+{
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    rolloutResults.clear();
+    std::size_t const numberOfTimes = parameters.numberOfTimeSteps + 1u;
+    Duration const horizon = static_cast<double>(parameters.numberOfTimeSteps) * parameters.timeStep;
+    result = withinValidInputRange(situationSnapshot) && (parameters.timeStep > Duration(0.))
+      && withinValidInputRange(parameters.timeStep) && withinValidInputRange(horizon)
+      && accelerationWithinValidInputRange(parameters.egoAcceleration);
+    for (auto it = parameters.objectAccelerations.begin(); result && (it != parameters.objectAccelerations.end()); ++it)
+    {
+      result = accelerationWithinValidInputRange(it->second);
+    }
+
+    std::vector<Duration> times(numberOfTimes);
+    for (std::size_t k = 0u; k < numberOfTimes; ++k)
+    {
+      times[k] = static_cast<double>(k) * parameters.timeStep;
+    }
+
+    // the ego trajectory is shared by all situations with the same ego velocity
+    VehicleTrajectory egoTrajectory;
+    bool egoTrajectoryValid = false;
+    VehicleTrajectory otherTrajectory;
+    std::vector<Situation> rolledOutSituations;
+    rolloutResults.reserve(situationSnapshot.situations.size());
+    for (auto it = situationSnapshot.situations.begin(); result && (it != situationSnapshot.situations.end()); ++it)
+    {
+      Situation const &situation = *it;
+      HorizonRolloutResult rolloutResult;
+      rolloutResult.situationId = situation.situationId;
+      rolloutResult.objectId = situation.objectId;
+      rolloutResult.firstDangerousTimeStep = numberOfTimes;
+      if (situation.situationType != SituationType::NotRelevant)
+      {
+        if (!egoTrajectoryValid || (egoTrajectory.velocity != situation.egoVehicleState.velocity))
+        {
+          result = calculateVehicleTrajectory(
+            situation.egoVehicleState.velocity, parameters.egoAcceleration, times, egoTrajectory);
+          egoTrajectoryValid = result;
+        }
+
+        PredictedAcceleration otherAcceleration;
+        auto const findResult = parameters.objectAccelerations.find(situation.objectId);
+        if (findResult != parameters.objectAccelerations.end())
+        {
+          otherAcceleration = findResult->second;
+        }
+        result = result
+          && calculateVehicleTrajectory(
+               situation.otherVehicleState.velocity, otherAcceleration, times, otherTrajectory)
+          && rollOutSituation(situation, egoTrajectory, otherTrajectory, times, rolledOutSituations, rolloutResult);
+      }
+      rolloutResults.push_back(rolloutResult);
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  if (!result)
+  {
+    rolloutResults.clear();
+  }
+  return result;
+}
+
+} // namespace situation
+} // namespace ad_rss
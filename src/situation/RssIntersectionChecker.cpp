@@ -33,7 +33,6 @@
 #include <cmath>
 #include <limits>
 #include "physics/Math.hpp"
-#include "situation/RssFormulas.hpp"
 #include "situation/RssSituation.hpp"
 
 namespace ad_rss {
@@ -41,16 +40,7 @@ namespace situation {
 
 using physics::Duration;
 using physics::calculateTimeToCoverDistance;
-
-RssIntersectionChecker::RssIntersectionChecker()
-{
-}
-
-RssIntersectionChecker::~RssIntersectionChecker()
-{
-  mLastSafeStateMap.clear();
-  mCurrentSafeStateMap.clear();
-}
+typedef core::RssIntersectionCheckingState::IntersectionStateMap IntersectionStateMap;
 
 bool checkLateralIntersect(Situation const &situation, bool &isSafe)
 {
@@ -111,7 +101,32 @@ bool checkLateralIntersect(Situation const &situation, bool &isSafe)
   return result;
 }
 
+bool checkLongitudinalDistanceIntersection(RssFormulaProvider const &formulaProvider,
+                                           VehicleState const &leadingVehicle,
+                                           VehicleState const &followingVehicle,
+                                           physics::Distance const &vehicleDistance,
+                                           bool const decisionOnly,
+                                           ::ad_rss::state::RssStateInformation &rssStateInformation,
+                                           bool &isSafe)
+{
+  if (decisionOnly)
+  {
+    return formulaProvider.isSafeLongitudinalDistanceSameDirection(
+      leadingVehicle, followingVehicle, vehicleDistance, isSafe);
+  }
+  return formulaProvider.checkSafeLongitudinalDistanceSameDirection(
+    leadingVehicle, followingVehicle, vehicleDistance, rssStateInformation.safeDistance, isSafe);
+}
+
+/**
+ * @brief Check if the intersection is safe and determine the intersection state of the situation
+ *
+ * If decisionOnly is set, the safe longitudinal distance between the vehicles is only calculated as far as required
+ * for the decision and the content of the rssStateInformation is undefined.
+ */
 bool checkIntersectionSafe(Situation const &situation,
+                           RssFormulaProvider const &formulaProvider,
+                           bool const decisionOnly,
                            ::ad_rss::state::RssStateInformation &rssStateInformation,
                            bool &isSafe,
                            IntersectionState &intersectionState)
@@ -133,13 +148,15 @@ bool checkIntersectionSafe(Situation const &situation,
   {
     rssStateInformation.evaluator = state::RssStateEvaluator::IntersectionOtherPriorityEgoAbleToStop;
     rssStateInformation.currentDistance = situation.egoVehicleState.distanceToEnterIntersection;
-    result = checkStopInFrontIntersection(situation.egoVehicleState, rssStateInformation.safeDistance, isSafe);
+    result = formulaProvider.checkStopInFrontIntersection(
+      situation.egoVehicleState, rssStateInformation.safeDistance, isSafe);
   }
   if (result && !isSafe && !situation.otherVehicleState.hasPriority)
   {
     rssStateInformation.evaluator = state::RssStateEvaluator::IntersectionEgoPriorityOtherAbleToStop;
     rssStateInformation.currentDistance = situation.otherVehicleState.distanceToEnterIntersection;
-    result = checkStopInFrontIntersection(situation.otherVehicleState, rssStateInformation.safeDistance, isSafe);
+    result = formulaProvider.checkStopInFrontIntersection(
+      situation.otherVehicleState, rssStateInformation.safeDistance, isSafe);
   }
 
   if (isSafe)
@@ -155,20 +172,24 @@ bool checkIntersectionSafe(Situation const &situation,
     if (situation.relativePosition.longitudinalPosition == LongitudinalRelativePosition::InFront)
     {
       rssStateInformation.evaluator = state::RssStateEvaluator::IntersectionEgoInFront;
-      result = checkSafeLongitudinalDistanceSameDirection(situation.egoVehicleState,
-                                                          situation.otherVehicleState,
-                                                          situation.relativePosition.longitudinalDistance,
-                                                          rssStateInformation.safeDistance,
-                                                          isSafe);
+      result = checkLongitudinalDistanceIntersection(formulaProvider,
+                                                     situation.egoVehicleState,
+                                                     situation.otherVehicleState,
+                                                     situation.relativePosition.longitudinalDistance,
+                                                     decisionOnly,
+                                                     rssStateInformation,
+                                                     isSafe);
     }
     else
     {
       rssStateInformation.evaluator = state::RssStateEvaluator::IntersectionOtherInFront;
-      result = checkSafeLongitudinalDistanceSameDirection(situation.otherVehicleState,
-                                                          situation.egoVehicleState,
-                                                          situation.relativePosition.longitudinalDistance,
-                                                          rssStateInformation.safeDistance,
-                                                          isSafe);
+      result = checkLongitudinalDistanceIntersection(formulaProvider,
+                                                     situation.otherVehicleState,
+                                                     situation.egoVehicleState,
+                                                     situation.relativePosition.longitudinalDistance,
+                                                     decisionOnly,
+                                                     rssStateInformation,
+                                                     isSafe);
     }
     if (isSafe)
     {
@@ -191,9 +212,16 @@ bool checkIntersectionSafe(Situation const &situation,
   return result;
 }
 
-bool RssIntersectionChecker::calculateRssStateIntersection(physics::TimeIndex const &timeIndex,
-                                                           Situation const &situation,
-                                                           state::RssState &rssState)
+void setLateralRssStateInformationIntersection(::ad_rss::state::RssStateInformation &rssStateInformation)
+{
+  rssStateInformation.evaluator = state::RssStateEvaluator::LateralDistance;
+  rssStateInformation.currentDistance = physics::Distance(0);
+  rssStateInformation.safeDistance = physics::Distance(0);
+}
+
+bool calculateRssStateInformationIntersection(Situation const &situation,
+                                              RssFormulaProvider const &formulaProvider,
+                                              state::RssState &rssState)
 {
   if (situation.egoVehicleState.hasPriority && situation.otherVehicleState.hasPriority)
   {
@@ -203,15 +231,85 @@ bool RssIntersectionChecker::calculateRssStateIntersection(physics::TimeIndex co
   bool result = false;
   try
   {
-    if (timeIndex != mCurrentTimeIndex)
+    setLateralRssStateInformationIntersection(rssState.lateralStateLeft.rssStateInformation);
+    setLateralRssStateInformationIntersection(rssState.lateralStateRight.rssStateInformation);
+
+    bool isSafe = false;
+    IntersectionState intersectionState = IntersectionState::NonPrioAbleToBreak;
+    result = checkIntersectionSafe(
+      situation, formulaProvider, false, rssState.longitudinalState.rssStateInformation, isSafe, intersectionState);
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+namespace {
+
+/**
+ * @brief Switch the safe state maps if a new time step has started
+ *
+ * @param[in,out] intersectionCheckingState the history of the intersection checks
+ * @param[in]  timeIndex the time index of the current processing step
+ */
+void updateTimeIndex(core::RssIntersectionCheckingState &intersectionCheckingState,
+                     physics::TimeIndex const &timeIndex)
+{
+  if (timeIndex != intersectionCheckingState.currentTimeIndex)
+  {
+    /**
+     * next time step: current safe state map becomes last state now
+     */
+    intersectionCheckingState.lastSafeStates.swap(intersectionCheckingState.currentSafeStates);
+    intersectionCheckingState.currentSafeStates.clear();
+    intersectionCheckingState.currentTimeIndex = timeIndex;
+  }
+}
+
+} // namespace
+
+bool keepIntersectionState(core::RssIntersectionCheckingState &intersectionCheckingState,
+                           physics::TimeIndex const &timeIndex,
+                           SituationId const &situationId)
+{
+  bool result = true;
+  try
+  {
+    updateTimeIndex(intersectionCheckingState, timeIndex);
+
+    auto const previousIntersectionState = intersectionCheckingState.lastSafeStates.find(situationId);
+    if (previousIntersectionState != intersectionCheckingState.lastSafeStates.end())
     {
-      /**
-       * next time step: current safe state map becomes last state now
-       */
-      mLastSafeStateMap.swap(mCurrentSafeStateMap);
-      mCurrentSafeStateMap.clear();
-      mCurrentTimeIndex = timeIndex;
+      intersectionCheckingState.currentSafeStates.insert(*previousIntersectionState);
     }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+namespace {
+
+bool evaluateIntersection(core::RssIntersectionCheckingState &intersectionCheckingState,
+                          physics::TimeIndex const &timeIndex,
+                          Situation const &situation,
+                          RssFormulaProvider const &formulaProvider,
+                          bool const decisionOnly,
+                          state::RssState &rssState)
+{
+  if (situation.egoVehicleState.hasPriority && situation.otherVehicleState.hasPriority)
+  {
+    // both cannot have priority over the other at the same time
+    return false;
+  }
+  bool result = false;
+  try
+  {
+    updateTimeIndex(intersectionCheckingState, timeIndex);
 
     rssState.longitudinalState.isSafe = false;
     rssState.longitudinalState.response = ::ad_rss::state::LongitudinalResponse::BrakeMin;
@@ -222,14 +320,8 @@ bool RssIntersectionChecker::calculateRssStateIntersection(physics::TimeIndex co
      */
     rssState.lateralStateLeft.isSafe = false;
     rssState.lateralStateLeft.response = ::ad_rss::state::LateralResponse::None;
-    rssState.lateralStateLeft.rssStateInformation.evaluator = state::RssStateEvaluator::LateralDistance;
-    rssState.lateralStateLeft.rssStateInformation.currentDistance = physics::Distance(0);
-    rssState.lateralStateLeft.rssStateInformation.safeDistance = physics::Distance(0);
     rssState.lateralStateRight.isSafe = false;
     rssState.lateralStateRight.response = ::ad_rss::state::LateralResponse::None;
-    rssState.lateralStateRight.rssStateInformation.evaluator = state::RssStateEvaluator::LateralDistance;
-    rssState.lateralStateRight.rssStateInformation.currentDistance = physics::Distance(0);
-    rssState.lateralStateRight.rssStateInformation.safeDistance = physics::Distance(0);
 
     bool isSafe = false;
     IntersectionState intersectionState = IntersectionState::NonPrioAbleToBreak;
@@ -237,21 +329,32 @@ bool RssIntersectionChecker::calculateRssStateIntersection(physics::TimeIndex co
     /**
      * Check if the intersection is safe and determine the intersection state of the situation
      */
-    result
-      = checkIntersectionSafe(situation, rssState.longitudinalState.rssStateInformation, isSafe, intersectionState);
+    if (decisionOnly)
+    {
+      state::RssStateInformation unusedRssStateInformation;
+      result = checkIntersectionSafe(
+        situation, formulaProvider, true, unusedRssStateInformation, isSafe, intersectionState);
+    }
+    else
+    {
+      setLateralRssStateInformationIntersection(rssState.lateralStateLeft.rssStateInformation);
+      setLateralRssStateInformationIntersection(rssState.lateralStateRight.rssStateInformation);
+      result = checkIntersectionSafe(
+        situation, formulaProvider, false, rssState.longitudinalState.rssStateInformation, isSafe, intersectionState);
+    }
 
     if (result)
     {
       rssState.longitudinalState.isSafe = isSafe;
 
-      auto const previousIntersectionState = mLastSafeStateMap.find(situation.situationId);
+      auto const previousIntersectionState = intersectionCheckingState.lastSafeStates.find(situation.situationId);
 
       if (!isSafe)
       {
         /**
          * Situation is unsafe determine proper response
          */
-        if (previousIntersectionState != mLastSafeStateMap.end())
+        if (previousIntersectionState != intersectionCheckingState.lastSafeStates.end())
         {
           switch (previousIntersectionState->second)
           {
@@ -289,8 +392,8 @@ bool RssIntersectionChecker::calculateRssStateIntersection(physics::TimeIndex co
           /**
            * Store the last safe intersection state for next time step
            */
-          mCurrentSafeStateMap.insert(
-            RssIntersectionStateMap::value_type(situation.situationId, previousIntersectionState->second));
+          intersectionCheckingState.currentSafeStates.insert(
+            IntersectionStateMap::value_type(situation.situationId, previousIntersectionState->second));
         }
         else
         {
@@ -308,7 +411,8 @@ bool RssIntersectionChecker::calculateRssStateIntersection(physics::TimeIndex co
         rssState.longitudinalState.response = ::ad_rss::state::LongitudinalResponse::None;
 
         // Update the last safe state
-        mCurrentSafeStateMap.insert(RssIntersectionStateMap::value_type(situation.situationId, intersectionState));
+        intersectionCheckingState.currentSafeStates.insert(
+          IntersectionStateMap::value_type(situation.situationId, intersectionState));
       }
     }
   }
@@ -319,5 +423,25 @@ bool RssIntersectionChecker::calculateRssStateIntersection(physics::TimeIndex co
   return result;
 }
 
+} // namespace
+
+bool calculateRssStateIntersection(core::RssIntersectionCheckingState &intersectionCheckingState,
+                                   physics::TimeIndex const &timeIndex,
+                                   Situation const &situation,
+                                   RssFormulaProvider const &formulaProvider,
+                                   state::RssState &rssState)
+{
+  return evaluateIntersection(intersectionCheckingState, timeIndex, situation, formulaProvider, false, rssState);
+}
+
+bool calculateRssDecisionIntersection(core::RssIntersectionCheckingState &intersectionCheckingState,
+                                      physics::TimeIndex const &timeIndex,
+                                      Situation const &situation,
+                                      RssFormulaProvider const &formulaProvider,
+                                      state::RssState &rssState)
+{
+  return evaluateIntersection(intersectionCheckingState, timeIndex, situation, formulaProvider, true, rssState);
+}
+
 } // namespace situation
 } // namespace ad_rss
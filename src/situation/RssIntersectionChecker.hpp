@@ -35,9 +35,9 @@
 
 #pragma once
 
-#include <cstdint>
-#include <map>
+#include "ad_rss/core/RssCycleState.hpp"
 #include "ad_rss/physics/TimeIndex.hpp"
+#include "ad_rss/situation/RssFormulaProvider.hpp"
 #include "ad_rss/situation/Situation.hpp"
 #include "ad_rss/state/RssState.hpp"
 
@@ -50,72 +50,78 @@ namespace ad_rss {
  */
 namespace situation {
 
-/*!
- * \brief Enum LongitudinalResponse
+/**
+ * @brief Calculate the RssStateInformation of all axes for intersection situations
+ *
+ * In contrast to calculateRssStateIntersection() this function doesn't depend on the
+ * previous intersection states of the situation. Only the rssStateInformation members of the rssState are updated.
  *
- * Enumeration defining the possible longitudinal responses
+ * @param[in]  situation situation to analyze
+ * @param[in]  formulaProvider provider of the RSS formulas
+ * @param[in,out] rssState rssState of the ego vehicle
  *
- * Be aware: there has to be a strict order of the enumeration values according to
- * the strictness of the response
+ * @returns false if a failure occurred during calculations, true otherwise
  */
-enum class IntersectionState : std::uint32_t
-{
-  NonPrioAbleToBreak = 0u,       /*!< NonPrio-Vehicle can stop in front intersection */
-  SafeLongitudinalDistance = 1u, /*!< There is a safe longitudinal distance  between the vehicles*/
-  NoTimeOverlap = 2u             /*!< There is no time overlap between the paths of the two vehicles */
-};
+bool calculateRssStateInformationIntersection(Situation const &situation,
+                                              RssFormulaProvider const &formulaProvider,
+                                              state::RssState &rssState);
 
 /**
- * @brief Class to check whether an intersection is safe and to determine the proper response for the situation
+ * @brief Calculate safety checks and determine required rssState for intersection situations
+ *
+ * The previous states of the situation are maintained within the intersectionCheckingState in order to provide the
+ * proper response.
+ *
+ * @param[in,out] intersectionCheckingState the history of the intersection checks to be used and updated
+ * @param[in]  timeIndex the time index of the situation
+ * @param[in]  situation situation to analyze
+ * @param[in]  formulaProvider provider of the RSS formulas
+ * @param[out] rssState  rssState of the ego vehicle
  *
- * Class performs required check to if situation is safe
- * Class will maintain the previous state of the situation in order to provide the proper response.
+ * @returns false if a failure occurred during calculations, true otherwise
  */
-class RssIntersectionChecker
-{
-public:
-  /**
-   * @brief Constructor
-   */
-  RssIntersectionChecker();
+bool calculateRssStateIntersection(core::RssIntersectionCheckingState &intersectionCheckingState,
+                                   physics::TimeIndex const &timeIndex,
+                                   Situation const &situation,
+                                   RssFormulaProvider const &formulaProvider,
+                                   state::RssState &rssState);
 
-  /**
-   * @brief Destructor
-   */
-  ~RssIntersectionChecker();
-
-  /**
-   * @brief Calculate safety checks and determine required rssState for intersection situations
-   *
-   * @param[in]  timeIndex the time index of the situation
-   * @param[in]  situation situation to analyze
-   * @param[out] rssState  rssState of the ego vehicle
-   *
-   * @returns false if a failure occurred during calculations, true otherwise
-   *
-   */
-  bool calculateRssStateIntersection(physics::TimeIndex const &timeIndex,
-                                     Situation const &situation,
-                                     state::RssState &rssState);
-
-private:
-  typedef std::map<SituationId, IntersectionState> RssIntersectionStateMap;
-  /**
-   * @brief last safe IntersectionState of each situation of previous time step
-   */
-  RssIntersectionStateMap mLastSafeStateMap;
-
-  /**
-   * @brief last safe IntersectionState of each situation of current time step
-   */
-  RssIntersectionStateMap mCurrentSafeStateMap;
+/**
+ * @brief Determine the decision parts of the rssState for intersection situations
+ *
+ * In contrast to calculateRssStateIntersection() only isSafe and response of all axes are updated;
+ * the safe distances are only calculated as far as required for the decision and the rssStateInformation is left
+ * untouched. The intersectionCheckingState is maintained in the same way.
+ *
+ * @param[in,out] intersectionCheckingState the history of the intersection checks to be used and updated
+ * @param[in]  timeIndex the time index of the situation
+ * @param[in]  situation situation to analyze
+ * @param[in]  formulaProvider provider of the RSS formulas
+ * @param[in,out] rssState  rssState of the ego vehicle
+ *
+ * @returns false if a failure occurred during calculations, true otherwise
+ */
+bool calculateRssDecisionIntersection(core::RssIntersectionCheckingState &intersectionCheckingState,
+                                      physics::TimeIndex const &timeIndex,
+                                      Situation const &situation,
+                                      RssFormulaProvider const &formulaProvider,
+                                      state::RssState &rssState);
 
-  /**
-   * @brief time index of the current processing step
-   * If time index increases we need to update the mLastSafeStateMap
-   */
-  physics::TimeIndex mCurrentTimeIndex{0u};
-};
+/**
+ * @brief Keep the last safe intersection state of a situation which is not evaluated at the given time index
+ *
+ * Used if the evaluation of an intersection situation is skipped, so the response of the following time steps is
+ * still based on the state before the situation became unsafe.
+ *
+ * @param[in,out] intersectionCheckingState the history of the intersection checks to be used and updated
+ * @param[in]  timeIndex the time index of the situation
+ * @param[in]  situationId the id of the situation not evaluated
+ *
+ * @returns false if a failure occurred, true otherwise
+ */
+bool keepIntersectionState(core::RssIntersectionCheckingState &intersectionCheckingState,
+                           physics::TimeIndex const &timeIndex,
+                           SituationId const &situationId);
 
 } // namespace situation
 } // namespace ad_rss
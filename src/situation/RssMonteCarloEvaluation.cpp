@@ -0,0 +1,300 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/situation/RssMonteCarloEvaluation.hpp"
+#include <algorithm>
+#include "ad_rss/physics/SpeedValidInputRange.hpp"
+#include "ad_rss/situation/SituationSnapshotValidInputRange.hpp"
+#include "ad_rss/state/RssStateOperation.hpp"
+#include "situation/RssFormulasBatch.hpp"
+#include "situation/RssIntersectionChecker.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+using physics::Speed;
+
+namespace {
+
+/*!
+ * @brief the sampled inputs of a vehicle state, each one drawn from its own random stream
+ */
+enum class SampleStream : std::uint64_t
+{
+  SpeedLon = 1u,
+  SpeedLat = 2u,
+  ResponseTime = 3u,
+  Acceleration = 4u,
+  Deceleration = 5u
+};
+
+std::uint64_t const cGoldenGamma = 0x9e3779b97f4a7c15ull;
+
+/*
+ * The finalizer of the SplitMix64 generator, a bijective mixing of the bits.
+ */
+inline std::uint64_t mixBits(std::uint64_t value)
+{
+  value = (value ^ (value >> 30u)) * 0xbf58476d1ce4e5b9ull;
+  value = (value ^ (value >> 27u)) * 0x94d049bb133111ebull;
+  return value ^ (value >> 31u);
+}
+
+/*
+ * Counter based random numbers: the number of a counter is calculated directly from the key of the stream and the
+ * counter, so the samples don't depend on the order of their evaluation and the loops filling them are free of
+ * dependencies between the iterations.
+ */
+inline double uniformRandom(std::uint64_t const key, std::uint64_t const counter)
+{
+  // the upper 53 bits provide a double within [0, 1)
+  return static_cast<double>(mixBits(key + counter * cGoldenGamma) >> 11u) * (1. / 9007199254740992.);
+}
+
+std::uint64_t calculateStreamKey(MonteCarloParameters const &parameters,
+                                 Situation const &situation,
+                                 SampleStream const stream)
+{
+  std::uint64_t const situationKey
+    = mixBits(parameters.seed ^ mixBits(situation.situationId ^ mixBits(situation.objectId + cGoldenGamma)));
+  return mixBits(situationKey + static_cast<std::uint64_t>(stream) * cGoldenGamma);
+}
+
+/*
+ * Fill the values with samples uniformly distributed within [lower, upper)
+ */
+void sampleUniform(std::uint64_t const key, double const lower, double const upper, std::vector<double> &values)
+{
+  double const range = upper - lower;
+  double *const result = values.data();
+  std::size_t const size = values.size();
+  for (std::size_t i = 0u; i < size; ++i)
+  {
+    result[i] = lower + range * uniformRandom(key, i);
+  }
+}
+
+void scaleValues(double const value, std::vector<double> const &factors, std::vector<double> &values)
+{
+  double const *const factor = factors.data();
+  double *const result = values.data();
+  std::size_t const size = values.size();
+  for (std::size_t i = 0u; i < size; ++i)
+  {
+    result[i] = value * factor[i];
+  }
+}
+
+bool parametersWithinValidInputRange(MonteCarloParameters const &parameters)
+{
+  auto const relativeUncertaintyWithinValidInputRange
+    = [](double const uncertainty) { return (uncertainty >= 0.) && (uncertainty < 1.); };
+  return (parameters.numberOfSamples > 0u) && withinValidInputRange(parameters.speedLonUncertainty)
+    && (parameters.speedLonUncertainty >= Speed(0.)) && withinValidInputRange(parameters.speedLatUncertainty)
+    && (parameters.speedLatUncertainty >= Speed(0.))
+    && relativeUncertaintyWithinValidInputRange(parameters.responseTimeUncertainty)
+    && relativeUncertaintyWithinValidInputRange(parameters.accelerationUncertainty)
+    && relativeUncertaintyWithinValidInputRange(parameters.decelerationUncertainty);
+}
+
+/*
+ * Draw the samples of the other vehicle of the situation.
+ */
+void sampleVehicleStates(MonteCarloParameters const &parameters,
+                         Situation const &situation,
+                         VehicleStateBatch &samples,
+                         std::vector<double> &factors)
+{
+  VehicleState const &vehicleState = situation.otherVehicleState;
+  world::RssDynamics const &dynamics = vehicleState.dynamics;
+
+  // the speed ranges collapse to the sampled speed
+  double const speedLonUncertainty = static_cast<double>(parameters.speedLonUncertainty);
+  sampleUniform(calculateStreamKey(parameters, situation, SampleStream::SpeedLon),
+                std::max(0., static_cast<double>(vehicleState.velocity.speedLon.minimum) - speedLonUncertainty),
+                static_cast<double>(vehicleState.velocity.speedLon.maximum) + speedLonUncertainty,
+                samples.speedLonMinimum);
+  samples.speedLonMaximum = samples.speedLonMinimum;
+  double const speedLatUncertainty = static_cast<double>(parameters.speedLatUncertainty);
+  sampleUniform(calculateStreamKey(parameters, situation, SampleStream::SpeedLat),
+                static_cast<double>(vehicleState.velocity.speedLat.minimum) - speedLatUncertainty,
+                static_cast<double>(vehicleState.velocity.speedLat.maximum) + speedLatUncertainty,
+                samples.speedLatMinimum);
+  samples.speedLatMaximum = samples.speedLatMinimum;
+
+  sampleUniform(calculateStreamKey(parameters, situation, SampleStream::ResponseTime),
+                1. - parameters.responseTimeUncertainty,
+                1. + parameters.responseTimeUncertainty,
+                factors);
+  scaleValues(static_cast<double>(dynamics.responseTime), factors, samples.responseTime);
+
+  sampleUniform(calculateStreamKey(parameters, situation, SampleStream::Acceleration),
+                1. - parameters.accelerationUncertainty,
+                1. + parameters.accelerationUncertainty,
+                factors);
+  scaleValues(static_cast<double>(dynamics.alphaLon.accelMax), factors, samples.alphaLonAccelMax);
+  scaleValues(static_cast<double>(dynamics.alphaLat.accelMax), factors, samples.alphaLatAccelMax);
+
+  sampleUniform(calculateStreamKey(parameters, situation, SampleStream::Deceleration),
+                1. - parameters.decelerationUncertainty,
+                1. + parameters.decelerationUncertainty,
+                factors);
+  scaleValues(static_cast<double>(dynamics.alphaLon.brakeMax), factors, samples.alphaLonBrakeMax);
+  scaleValues(static_cast<double>(dynamics.alphaLon.brakeMin), factors, samples.alphaLonBrakeMin);
+  scaleValues(static_cast<double>(dynamics.alphaLon.brakeMinCorrect), factors, samples.alphaLonBrakeMinCorrect);
+  scaleValues(static_cast<double>(dynamics.alphaLat.brakeMin), factors, samples.alphaLatBrakeMin);
+}
+
+/*
+ * The intersection checks are not available as batch formulas, so the samples are evaluated one by one.
+ */
+bool countDangerousIntersectionSamples(Situation const &situation,
+                                       VehicleStateBatch const &samples,
+                                       std::uint32_t &numberOfDangerousSamples)
+{
+  Situation sampledSituation = situation;
+  VehicleState &vehicleState = sampledSituation.otherVehicleState;
+  bool result = true;
+  for (std::size_t i = 0u; result && (i < samples.size()); ++i)
+  {
+    vehicleState.velocity.speedLon.minimum = Speed(samples.speedLonMinimum[i]);
+    vehicleState.velocity.speedLon.maximum = Speed(samples.speedLonMaximum[i]);
+    vehicleState.velocity.speedLat.minimum = Speed(samples.speedLatMinimum[i]);
+    vehicleState.velocity.speedLat.maximum = Speed(samples.speedLatMaximum[i]);
+    vehicleState.dynamics.responseTime = physics::Duration(samples.responseTime[i]);
+    vehicleState.dynamics.alphaLon.accelMax = physics::Acceleration(samples.alphaLonAccelMax[i]);
+    vehicleState.dynamics.alphaLon.brakeMax = physics::Acceleration(samples.alphaLonBrakeMax[i]);
+    vehicleState.dynamics.alphaLon.brakeMin = physics::Acceleration(samples.alphaLonBrakeMin[i]);
+    vehicleState.dynamics.alphaLon.brakeMinCorrect = physics::Acceleration(samples.alphaLonBrakeMinCorrect[i]);
+    vehicleState.dynamics.alphaLat.accelMax = physics::Acceleration(samples.alphaLatAccelMax[i]);
+    vehicleState.dynamics.alphaLat.brakeMin = physics::Acceleration(samples.alphaLatBrakeMin[i]);
+
+    // a fresh history per evaluation, the intersection state of the situation is not kept
+    core::RssIntersectionCheckingState intersectionCheckingState;
+    state::RssState rssState;
+    result = calculateRssStateIntersection(
+      intersectionCheckingState, physics::TimeIndex(1u), sampledSituation, getDefaultFormulaProvider(), rssState);
+    if (result && state::isDangerous(rssState))
+    {
+      numberOfDangerousSamples++;
+    }
+  }
+  return result;
+}
+
+} // namespace
+
+bool calculateDangerProbabilities(SituationSnapshot const &situationSnapshot,
+                                  MonteCarloParameters const &parameters,
+                                  std::vector<MonteCarloResult> &monteCarloResults)
+{
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    monteCarloResults.clear();
+    result = withinValidInputRange(situationSnapshot) && parametersWithinValidInputRange(parameters);
+
+    std::size_t const numberOfSamples = parameters.numberOfSamples;
+    VehicleStateBatch egoVehicle;
+    VehicleStateBatch otherVehicle;
+    SituationMarginBatch situationMargin;
+    std::vector<double> factors(numberOfSamples);
+    egoVehicle.resize(numberOfSamples);
+    otherVehicle.resize(numberOfSamples);
+
+    monteCarloResults.reserve(situationSnapshot.situations.size());
+    for (auto it = situationSnapshot.situations.begin(); result && (it != situationSnapshot.situations.end()); ++it)
+    {
+      Situation const &situation = *it;
+      MonteCarloResult monteCarloResult;
+      monteCarloResult.situationId = situation.situationId;
+      monteCarloResult.objectId = situation.objectId;
+      monteCarloResult.numberOfSamples = parameters.numberOfSamples;
+
+      switch (situation.situationType)
+      {
+        case SituationType::NotRelevant:
+          break;
+        case SituationType::SameDirection:
+        case SituationType::OppositeDirection:
+        {
+          // the RSS formulas don't accept negative longitudinal speeds
+          result = (situation.egoVehicleState.velocity.speedLon.minimum >= Speed(0.));
+          if (result)
+          {
+            egoVehicle.setVelocity(situation.egoVehicleState);
+            egoVehicle.setDynamics(situation.egoVehicleState.dynamics);
+            sampleVehicleStates(parameters, situation, otherVehicle, factors);
+            result = calculateSituationMarginBatch(situation, egoVehicle, otherVehicle, situationMargin);
+          }
+          if (result)
+          {
+            std::uint8_t const *const isDangerous = situationMargin.isDangerous.data();
+            std::uint32_t numberOfDangerousSamples = 0u;
+            for (std::size_t i = 0u; i < numberOfSamples; ++i)
+            {
+              numberOfDangerousSamples += isDangerous[i];
+            }
+            monteCarloResult.numberOfDangerousSamples = numberOfDangerousSamples;
+          }
+          break;
+        }
+        case SituationType::IntersectionEgoHasPriority:
+        case SituationType::IntersectionObjectHasPriority:
+        case SituationType::IntersectionSamePriority:
+          sampleVehicleStates(parameters, situation, otherVehicle, factors);
+          result = countDangerousIntersectionSamples(
+            situation, otherVehicle, monteCarloResult.numberOfDangerousSamples);
+          break;
+        default:
+          result = false;
+          break;
+      }
+
+      monteCarloResult.dangerProbability = static_cast<double>(monteCarloResult.numberOfDangerousSamples)
+        / static_cast<double>(monteCarloResult.numberOfSamples);
+      monteCarloResults.push_back(monteCarloResult);
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  if (!result)
+  {
+    monteCarloResults.clear();
+  }
+  return result;
+}
+
+} // namespace situation
+} // namespace ad_rss
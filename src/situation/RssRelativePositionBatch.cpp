@@ -0,0 +1,161 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "situation/RssRelativePositionBatch.hpp"
+#include <cfloat>
+#include <cmath>
+#include "ad_rss/physics/Distance.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+namespace {
+
+/**
+ * @returns 1 if the value is at least the precision, 0 otherwise
+ *
+ * The difference of equal values is +0, so a value equal to the precision results in 1.
+ */
+inline double isAtLeastPrecision(double const value, double const precision)
+{
+  return 0.5 + std::copysign(0.5, value - precision);
+}
+
+/**
+ * @returns the number of values not being a valid physics::Distance, i.e. not zero or normal or out of the range
+ */
+double countInvalidDistances(double const *const values, std::size_t const size)
+{
+  // the constants are copied to locals, so the compiler knows they are not changed within the loop
+  double const minValue = physics::Distance::cMinValue;
+  double const maxValue = physics::Distance::cMaxValue;
+  double numberOfInvalidValues = 0.;
+  for (std::size_t i = 0u; i < size; ++i)
+  {
+    // the comparisons are converted into a double, as the compiler vectorizes that conversion only
+    double const absoluteValue = std::fabs(values[i]);
+    numberOfInvalidValues += static_cast<double>(
+      !((minValue <= values[i]) & (values[i] <= maxValue) & ((absoluteValue >= DBL_MIN) | !(absoluteValue > 0.))));
+  }
+  return numberOfInvalidValues;
+}
+
+} // namespace
+
+void RelativePositionBatch::resize(std::size_t const size)
+{
+  egoMinimum.resize(size);
+  egoMaximum.resize(size);
+  otherMinimum.resize(size);
+  otherMaximum.resize(size);
+  position.resize(size);
+  distance.resize(size);
+}
+
+void RelativePositionBatch::setRanges(std::size_t const index,
+                                      physics::MetricRange const &ego,
+                                      physics::MetricRange const &other)
+{
+  egoMinimum[index] = static_cast<double>(ego.minimum);
+  egoMaximum[index] = static_cast<double>(ego.maximum);
+  otherMinimum[index] = static_cast<double>(other.minimum);
+  otherMaximum[index] = static_cast<double>(other.maximum);
+}
+
+void RelativePositionBatch::setRangesIntersection(std::size_t const index,
+                                                  physics::MetricRange const &egoIntersection,
+                                                  physics::MetricRange const &otherIntersection)
+{
+  // the negation is exact, so the fuzzy comparisons of the mirrored ranges are identical to the inverted comparisons
+  egoMinimum[index] = -static_cast<double>(egoIntersection.maximum);
+  egoMaximum[index] = -static_cast<double>(egoIntersection.minimum);
+  otherMinimum[index] = -static_cast<double>(otherIntersection.maximum);
+  otherMaximum[index] = -static_cast<double>(otherIntersection.minimum);
+}
+
+void RelativePositionBatch::setOverlap(std::size_t const index)
+{
+  egoMinimum[index] = 0.;
+  egoMaximum[index] = 0.;
+  otherMinimum[index] = 0.;
+  otherMaximum[index] = 0.;
+}
+
+bool calculateRelativePositionBatch(RelativePositionBatch &batch)
+{
+  std::size_t const size = batch.size();
+  if ((batch.egoMaximum.size() != size) || (batch.otherMinimum.size() != size) || (batch.otherMaximum.size() != size))
+  {
+    return false;
+  }
+  batch.position.resize(size);
+  batch.distance.resize(size);
+
+  // a > b of physics::Distance holds if a - b is at least the precision; the sign of the difference is exact
+  double const precision = physics::Distance::cPrecisionValue;
+  double const *const egoMinimum = batch.egoMinimum.data();
+  double const *const egoMaximum = batch.egoMaximum.data();
+  double const *const otherMinimum = batch.otherMinimum.data();
+  double const *const otherMaximum = batch.otherMaximum.data();
+  std::int32_t *const position = batch.position.data();
+  double *const distance = batch.distance.data();
+
+  // the classification doesn't depend on the validity of the ranges, so it's performed for all entries in a loop free
+  // of branches
+  for (std::size_t i = 0u; i < size; ++i)
+  {
+    double const frontDistance = egoMinimum[i] - otherMaximum[i];
+    double const backDistance = otherMinimum[i] - egoMaximum[i];
+    double const minimumDifference = egoMinimum[i] - otherMinimum[i];
+    double const maximumDifference = egoMaximum[i] - otherMaximum[i];
+
+    double const isInFront = isAtLeastPrecision(frontDistance, precision);
+    double const isAtBack = (1. - isInFront) * isAtLeastPrecision(backDistance, precision);
+    double const isOverlap = 1. - isInFront - isAtBack;
+    double const isOverlapFront
+      = isAtLeastPrecision(minimumDifference, precision) * isAtLeastPrecision(maximumDifference, precision);
+    double const isOverlapBack
+      = isAtLeastPrecision(-minimumDifference, precision) * isAtLeastPrecision(-maximumDifference, precision);
+
+    position[i] = static_cast<std::int32_t>(4. * isAtBack + isOverlap * (2. + isOverlapBack - isOverlapFront));
+    // adding 0 turns a distance of -0 into 0
+    distance[i] = isInFront * frontDistance + isAtBack * backDistance + 0.;
+  }
+
+  // the validity is checked in separate loops without early out
+  double const numberOfInvalidValues = countInvalidDistances(egoMinimum, size)
+    + countInvalidDistances(egoMaximum, size) + countInvalidDistances(otherMinimum, size)
+    + countInvalidDistances(otherMaximum, size) + countInvalidDistances(distance, size);
+  return !(numberOfInvalidValues > 0.);
+}
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,151 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ad_rss/physics/MetricRange.hpp"
+#include "ad_rss/situation/LateralRelativePosition.hpp"
+#include "ad_rss/situation/LongitudinalRelativePosition.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace situation
+ */
+namespace situation {
+
+/*
+ * The classification of the relative position of the ego vehicle and an object evaluated on batches of metric
+ * ranges, e.g. for all scenes of a world model. The ranges are stored as structure of arrays. The classification is a
+ * loop of arithmetic selects without branches; the validity of the ranges is checked by separate loops afterwards, so
+ * the compiler vectorizes all of them (check with -fopt-info-vec). The results equal the classification by the checked
+ * physics::Distance comparisons of the situation extraction.
+ *
+ * The classification results in a position code along the axis:
+ *   0: the ego vehicle is in front of (longitudinal) or right of (lateral) the object
+ *   1: the ranges overlap, the ego vehicle is shifted to the front or to the right
+ *   2: the ranges overlap
+ *   3: the ranges overlap, the ego vehicle is shifted to the back or to the left
+ *   4: the ego vehicle is at the back of or left of the object
+ */
+
+/*!
+ * @brief the metric ranges of the ego vehicle and the object of a batch of scenes along one axis as structure of
+ * arrays together with the resulting relative positions
+ */
+struct RelativePositionBatch
+{
+  /**
+   * @brief resize all arrays
+   */
+  void resize(std::size_t const size);
+
+  /**
+   * @returns the number of entries within the batch
+   */
+  std::size_t size() const
+  {
+    return egoMinimum.size();
+  }
+
+  /**
+   * @brief set the metric ranges of the entry with the given index
+   */
+  void setRanges(std::size_t const index, physics::MetricRange const &ego, physics::MetricRange const &other);
+
+  /**
+   * @brief set the intersection centric metric ranges of the entry with the given index
+   *
+   * Intersection centric ranges are measured from the object towards the intersection entry, i.e. in the opposite
+   * direction. The ranges are stored mirrored, so the common classification yields the longitudinal position of the
+   * intersection.
+   */
+  void setRangesIntersection(std::size_t const index,
+                             physics::MetricRange const &egoIntersection,
+                             physics::MetricRange const &otherIntersection);
+
+  /**
+   * @brief set the entry with the given index to identical ranges classified as overlap with distance 0
+   */
+  void setOverlap(std::size_t const index);
+
+  std::vector<double> egoMinimum;
+  std::vector<double> egoMaximum;
+  std::vector<double> otherMinimum;
+  std::vector<double> otherMaximum;
+
+  /*!
+   * The resulting position codes
+   */
+  std::vector<std::int32_t> position;
+
+  /*!
+   * The resulting distances; 0 if the ranges overlap
+   */
+  std::vector<double> distance;
+};
+
+/**
+ * @brief classify the relative positions of all entries of the batch
+ *
+ * @param [in,out] batch the batch providing the ranges and receiving the positions and distances
+ *
+ * @return true if the classification succeeded, false if one of the ranges or distances is not a valid
+ * physics::Distance
+ */
+bool calculateRelativePositionBatch(RelativePositionBatch &batch);
+
+/**
+ * @returns the longitudinal relative position of the given position code
+ */
+inline LongitudinalRelativePosition toLongitudinalRelativePosition(std::int32_t const position)
+{
+  return static_cast<LongitudinalRelativePosition>(position);
+}
+
+/**
+ * @returns the lateral relative position of the given position code
+ */
+inline LateralRelativePosition toLateralRelativePosition(std::int32_t const position)
+{
+  return static_cast<LateralRelativePosition>(4 - position);
+}
+
+} // namespace situation
+} // namespace ad_rss
@@ -30,32 +30,177 @@
 // ----------------- END LICENSE BLOCK -----------------------------------
 
 #include "situation/RssSituation.hpp"
-#include "situation/RssFormulas.hpp"
 
 namespace ad_rss {
 namespace situation {
 
-bool calculateRssStateNonIntersectionSameDirection(Situation const &situation, state::RssState &rssState)
+namespace {
+
+bool isEgoInFront(Situation const &situation)
+{
+  return (LongitudinalRelativePosition::InFront == situation.relativePosition.longitudinalPosition)
+    || (LongitudinalRelativePosition::OverlapFront == situation.relativePosition.longitudinalPosition);
+}
+
+void setLateralRssStateDecision(Situation const &situation,
+                                bool const isDistanceSafe,
+                                state::LateralRssState &rssStateLeft,
+                                state::LateralRssState &rssStateRight)
 {
-  bool result = calculateLongitudinalRssStateNonIntersectionSameDirection(situation, rssState.longitudinalState);
+  rssStateLeft.isSafe = false;
+  rssStateLeft.response = state::LateralResponse::BrakeMin;
+  rssStateRight.isSafe = false;
+  rssStateRight.response = state::LateralResponse::BrakeMin;
+
+  if (isDistanceSafe)
+  {
+    rssStateLeft.isSafe = true;
+    rssStateLeft.response = state::LateralResponse::None;
+    rssStateRight.isSafe = true;
+    rssStateRight.response = state::LateralResponse::None;
+  }
+  else if ((LateralRelativePosition::AtLeft == situation.relativePosition.lateralPosition)
+           || (LateralRelativePosition::OverlapLeft == situation.relativePosition.lateralPosition))
+  {
+    // ego is the left vehicle, so the collision is on the right side
+    rssStateLeft.isSafe = true;
+    rssStateLeft.response = state::LateralResponse::None;
+  }
+  else if ((LateralRelativePosition::AtRight == situation.relativePosition.lateralPosition)
+           || (LateralRelativePosition::OverlapRight == situation.relativePosition.lateralPosition))
+  {
+    // ego is the right vehicle, so the collision is on the left side
+    rssStateRight.isSafe = true;
+    rssStateRight.response = state::LateralResponse::None;
+  }
+}
+
+bool calculateLateralRssDecision(Situation const &situation,
+                                 RssFormulaProvider const &formulaProvider,
+                                 state::LateralRssState &rssStateLeft,
+                                 state::LateralRssState &rssStateRight)
+{
+  bool isDistanceSafe = false;
+  // the safe lateral distance is required completely for the decision, it's just not provided
+  physics::Distance safeDistance;
+  bool result = true;
+  if (LateralRelativePosition::AtLeft == situation.relativePosition.lateralPosition)
+  {
+    result = formulaProvider.checkSafeLateralDistance(situation.egoVehicleState,
+                                                      situation.otherVehicleState,
+                                                      situation.relativePosition.lateralDistance,
+                                                      safeDistance,
+                                                      isDistanceSafe);
+  }
+  else if (LateralRelativePosition::AtRight == situation.relativePosition.lateralPosition)
+  {
+    result = formulaProvider.checkSafeLateralDistance(situation.otherVehicleState,
+                                                      situation.egoVehicleState,
+                                                      situation.relativePosition.lateralDistance,
+                                                      safeDistance,
+                                                      isDistanceSafe);
+  }
+  setLateralRssStateDecision(situation, isDistanceSafe, rssStateLeft, rssStateRight);
+  return result;
+}
+
+} // namespace
+
+bool calculateRssDecisionNonIntersectionSameDirection(Situation const &situation,
+                                                      RssFormulaProvider const &formulaProvider,
+                                                      state::RssState &rssState)
+{
+  bool isSafe = false;
+  bool result = false;
+  if (isEgoInFront(situation))
+  {
+    result = formulaProvider.isSafeLongitudinalDistanceSameDirection(situation.egoVehicleState,
+                                                                     situation.otherVehicleState,
+                                                                     situation.relativePosition.longitudinalDistance,
+                                                                     isSafe);
+  }
+  else
+  {
+    result = formulaProvider.isSafeLongitudinalDistanceSameDirection(situation.otherVehicleState,
+                                                                     situation.egoVehicleState,
+                                                                     situation.relativePosition.longitudinalDistance,
+                                                                     isSafe);
+  }
+
+  rssState.longitudinalState.isSafe = isSafe;
+  // The ego vehicle is leading in the first case so we don't need to break longitudinal
+  rssState.longitudinalState.response = (isSafe || isEgoInFront(situation)) ? state::LongitudinalResponse::None
+                                                                             : state::LongitudinalResponse::BrakeMin;
   if (result)
   {
-    result = calculateLateralRssState(situation, rssState.lateralStateLeft, rssState.lateralStateRight);
+    result = calculateLateralRssDecision(
+      situation, formulaProvider, rssState.lateralStateLeft, rssState.lateralStateRight);
   }
   return result;
 }
 
-bool calculateRssStateNonIntersectionOppositeDirection(Situation const &situation, state::RssState &rssState)
+bool calculateRssDecisionNonIntersectionOppositeDirection(Situation const &situation,
+                                                          RssFormulaProvider const &formulaProvider,
+                                                          state::RssState &rssState)
 {
-  bool result = calculateLongitudinalRssStateNonIntersectionOppositeDirection(situation, rssState.longitudinalState);
+  bool isSafe = false;
+  bool result = false;
+  rssState.longitudinalState.response = state::LongitudinalResponse::BrakeMin;
+  if (situation.egoVehicleState.isInCorrectLane)
+  {
+    result = formulaProvider.isSafeLongitudinalDistanceOppositeDirection(
+      situation.egoVehicleState, situation.otherVehicleState, situation.relativePosition.longitudinalDistance, isSafe);
+    rssState.longitudinalState.response = state::LongitudinalResponse::BrakeMinCorrect;
+  }
+  else
+  {
+    result = formulaProvider.isSafeLongitudinalDistanceOppositeDirection(
+      situation.otherVehicleState, situation.egoVehicleState, situation.relativePosition.longitudinalDistance, isSafe);
+  }
+
+  rssState.longitudinalState.isSafe = isSafe;
+  if (isSafe)
+  {
+    rssState.longitudinalState.response = state::LongitudinalResponse::None;
+  }
+  if (result)
+  {
+    result = calculateLateralRssDecision(
+      situation, formulaProvider, rssState.lateralStateLeft, rssState.lateralStateRight);
+  }
+  return result;
+}
+
+bool calculateRssStateNonIntersectionSameDirection(Situation const &situation,
+                                                   RssFormulaProvider const &formulaProvider,
+                                                   state::RssState &rssState)
+{
+  bool result = calculateLongitudinalRssStateNonIntersectionSameDirection(
+    situation, formulaProvider, rssState.longitudinalState);
+  if (result)
+  {
+    result = calculateLateralRssState(
+      situation, formulaProvider, rssState.lateralStateLeft, rssState.lateralStateRight);
+  }
+  return result;
+}
+
+bool calculateRssStateNonIntersectionOppositeDirection(Situation const &situation,
+                                                       RssFormulaProvider const &formulaProvider,
+                                                       state::RssState &rssState)
+{
+  bool result = calculateLongitudinalRssStateNonIntersectionOppositeDirection(
+    situation, formulaProvider, rssState.longitudinalState);
   if (result)
   {
-    result = calculateLateralRssState(situation, rssState.lateralStateLeft, rssState.lateralStateRight);
+    result = calculateLateralRssState(
+      situation, formulaProvider, rssState.lateralStateLeft, rssState.lateralStateRight);
   }
   return result;
 }
 
 bool calculateLongitudinalRssStateNonIntersectionSameDirection(Situation const &situation,
+                                                               RssFormulaProvider const &formulaProvider,
                                                                state::LongitudinalRssState &rssState)
 {
   bool result = false;
@@ -65,29 +210,30 @@ bool calculateLongitudinalRssStateNonIntersectionSameDirection(Situation const &
 
   bool isSafe = false;
 
-  if ((LongitudinalRelativePosition::InFront == situation.relativePosition.longitudinalPosition)
-      || (LongitudinalRelativePosition::OverlapFront == situation.relativePosition.longitudinalPosition))
+  if (isEgoInFront(situation))
   {
     rssState.rssStateInformation.evaluator = state::RssStateEvaluator::LongitudinalDistanceSameDirectionEgoFront;
 
     // The ego vehicle is leading in this situation so we don't need to break longitudinal
     rssState.response = state::LongitudinalResponse::None;
 
-    result = checkSafeLongitudinalDistanceSameDirection(situation.egoVehicleState,
-                                                        situation.otherVehicleState,
-                                                        situation.relativePosition.longitudinalDistance,
-                                                        rssState.rssStateInformation.safeDistance,
-                                                        isSafe);
+    result = formulaProvider.checkSafeLongitudinalDistanceSameDirection(
+      situation.egoVehicleState,
+      situation.otherVehicleState,
+      situation.relativePosition.longitudinalDistance,
+      rssState.rssStateInformation.safeDistance,
+      isSafe);
   }
   else
   {
     rssState.rssStateInformation.evaluator = state::RssStateEvaluator::LongitudinalDistanceSameDirectionOtherInFront;
 
-    result = checkSafeLongitudinalDistanceSameDirection(situation.otherVehicleState,
-                                                        situation.egoVehicleState,
-                                                        situation.relativePosition.longitudinalDistance,
-                                                        rssState.rssStateInformation.safeDistance,
-                                                        isSafe);
+    result = formulaProvider.checkSafeLongitudinalDistanceSameDirection(
+      situation.otherVehicleState,
+      situation.egoVehicleState,
+      situation.relativePosition.longitudinalDistance,
+      rssState.rssStateInformation.safeDistance,
+      isSafe);
   }
 
   rssState.isSafe = isSafe;
@@ -100,6 +246,7 @@ bool calculateLongitudinalRssStateNonIntersectionSameDirection(Situation const &
 }
 
 bool calculateLongitudinalRssStateNonIntersectionOppositeDirection(Situation const &situation,
+                                                                   RssFormulaProvider const &formulaProvider,
                                                                    state::LongitudinalRssState &rssState)
 {
   bool result = false;
@@ -113,22 +260,24 @@ bool calculateLongitudinalRssStateNonIntersectionOppositeDirection(Situation con
     rssState.rssStateInformation.evaluator
       = state::RssStateEvaluator::LongitudinalDistanceOppositeDirectionEgoCorrectLane;
 
-    result = checkSafeLongitudinalDistanceOppositeDirection(situation.egoVehicleState,
-                                                            situation.otherVehicleState,
-                                                            situation.relativePosition.longitudinalDistance,
-                                                            rssState.rssStateInformation.safeDistance,
-                                                            isSafe);
+    result = formulaProvider.checkSafeLongitudinalDistanceOppositeDirection(
+      situation.egoVehicleState,
+      situation.otherVehicleState,
+      situation.relativePosition.longitudinalDistance,
+      rssState.rssStateInformation.safeDistance,
+      isSafe);
     rssState.response = state::LongitudinalResponse::BrakeMinCorrect;
   }
   else
   {
     rssState.rssStateInformation.evaluator = state::RssStateEvaluator::LongitudinalDistanceOppositeDirection;
 
-    result = checkSafeLongitudinalDistanceOppositeDirection(situation.otherVehicleState,
-                                                            situation.egoVehicleState,
-                                                            situation.relativePosition.longitudinalDistance,
-                                                            rssState.rssStateInformation.safeDistance,
-                                                            isSafe);
+    result = formulaProvider.checkSafeLongitudinalDistanceOppositeDirection(
+      situation.otherVehicleState,
+      situation.egoVehicleState,
+      situation.relativePosition.longitudinalDistance,
+      rssState.rssStateInformation.safeDistance,
+      isSafe);
   }
 
   rssState.isSafe = isSafe;
@@ -141,14 +290,10 @@ bool calculateLongitudinalRssStateNonIntersectionOppositeDirection(Situation con
 }
 
 bool calculateLateralRssState(Situation const &situation,
+                              RssFormulaProvider const &formulaProvider,
                               state::LateralRssState &rssStateLeft,
                               state::LateralRssState &rssStateRight)
 {
-  rssStateLeft.isSafe = false;
-  rssStateLeft.response = state::LateralResponse::BrakeMin;
-  rssStateRight.isSafe = false;
-  rssStateRight.response = state::LateralResponse::BrakeMin;
-
   bool isDistanceSafe = false;
 
   bool result = false;
@@ -161,11 +306,11 @@ bool calculateLateralRssState(Situation const &situation,
     // ego is the left vehicle, so right side has to be checked
     rssStateRight.rssStateInformation.evaluator = state::RssStateEvaluator::LateralDistance;
     rssStateRight.rssStateInformation.currentDistance = situation.relativePosition.lateralDistance;
-    result = checkSafeLateralDistance(situation.egoVehicleState,
-                                      situation.otherVehicleState,
-                                      situation.relativePosition.lateralDistance,
-                                      rssStateRight.rssStateInformation.safeDistance,
-                                      isDistanceSafe);
+    result = formulaProvider.checkSafeLateralDistance(situation.egoVehicleState,
+                                                      situation.otherVehicleState,
+                                                      situation.relativePosition.lateralDistance,
+                                                      rssStateRight.rssStateInformation.safeDistance,
+                                                      isDistanceSafe);
   }
   else if (LateralRelativePosition::AtRight == situation.relativePosition.lateralPosition)
   {
@@ -176,11 +321,11 @@ bool calculateLateralRssState(Situation const &situation,
     // ego is the right vehicle, so left side has to be checked
     rssStateLeft.rssStateInformation.evaluator = state::RssStateEvaluator::LateralDistance;
     rssStateLeft.rssStateInformation.currentDistance = situation.relativePosition.lateralDistance;
-    result = checkSafeLateralDistance(situation.otherVehicleState,
-                                      situation.egoVehicleState,
-                                      situation.relativePosition.lateralDistance,
-                                      rssStateLeft.rssStateInformation.safeDistance,
-                                      isDistanceSafe);
+    result = formulaProvider.checkSafeLateralDistance(situation.otherVehicleState,
+                                                      situation.egoVehicleState,
+                                                      situation.relativePosition.lateralDistance,
+                                                      rssStateLeft.rssStateInformation.safeDistance,
+                                                      isDistanceSafe);
   }
   else
   {
@@ -195,27 +340,7 @@ bool calculateLateralRssState(Situation const &situation,
     result = true;
   }
 
-  if (isDistanceSafe)
-  {
-    rssStateLeft.isSafe = true;
-    rssStateLeft.response = state::LateralResponse::None;
-    rssStateRight.isSafe = true;
-    rssStateRight.response = state::LateralResponse::None;
-  }
-  else if ((LateralRelativePosition::AtLeft == situation.relativePosition.lateralPosition)
-           || (LateralRelativePosition::OverlapLeft == situation.relativePosition.lateralPosition))
-  {
-    // ego is the left vehicle, so the collision is on the right side
-    rssStateLeft.isSafe = true;
-    rssStateLeft.response = state::LateralResponse::None;
-  }
-  else if ((LateralRelativePosition::AtRight == situation.relativePosition.lateralPosition)
-           || (LateralRelativePosition::OverlapRight == situation.relativePosition.lateralPosition))
-  {
-    // ego is the right vehicle, so the collision is on the left side
-    rssStateRight.isSafe = true;
-    rssStateRight.response = state::LateralResponse::None;
-  }
+  setLateralRssStateDecision(situation, isDistanceSafe, rssStateLeft, rssStateRight);
 
   return result;
 }
@@ -34,6 +34,7 @@
 
 #pragma once
 
+#include "ad_rss/situation/RssFormulaProvider.hpp"
 #include "ad_rss/situation/Situation.hpp"
 #include "ad_rss/state/RssState.hpp"
 
@@ -50,33 +51,75 @@ namespace situation {
  * @brief Calculate safety checks and determine required rssState for non intersection same direction scenario
  *
  * @param[in]  situation situation to analyze
+ * @param[in]  formulaProvider provider of the RSS formulas
  * @param[out] rssState  response state of the ego vehicle
  *
  * @returns false if a failure occurred during calculations, true otherwise
  */
-bool calculateRssStateNonIntersectionSameDirection(Situation const &situation, state::RssState &rssState);
+bool calculateRssStateNonIntersectionSameDirection(Situation const &situation,
+                                                   RssFormulaProvider const &formulaProvider,
+                                                   state::RssState &rssState);
 
 /**
  * @brief Calculate safety checks and determine required rssState for non intersection opposite direction scenario
  *
  * @param[in]  situation situation to analyze
+ * @param[in]  formulaProvider provider of the RSS formulas
  * @param[out] rssState  response state of the ego vehicle
  *
  * @returns false if a failure occurred during calculations, true otherwise
  */
-bool calculateRssStateNonIntersectionOppositeDirection(Situation const &situation, state::RssState &rssState);
+bool calculateRssStateNonIntersectionOppositeDirection(Situation const &situation,
+                                                       RssFormulaProvider const &formulaProvider,
+                                                       state::RssState &rssState);
+
+/**
+ * @brief Determine the decision parts of the rssState for non intersection same direction scenario
+ *
+ * In contrast to calculateRssStateNonIntersectionSameDirection() only isSafe and response of all axes are updated;
+ * the safe distances are only calculated as far as required for the decision and the rssStateInformation is left
+ * untouched.
+ *
+ * @param[in]  situation situation to analyze
+ * @param[in]  formulaProvider provider of the RSS formulas
+ * @param[in,out] rssState  response state of the ego vehicle
+ *
+ * @returns false if a failure occurred during calculations, true otherwise
+ */
+bool calculateRssDecisionNonIntersectionSameDirection(Situation const &situation,
+                                                      RssFormulaProvider const &formulaProvider,
+                                                      state::RssState &rssState);
+
+/**
+ * @brief Determine the decision parts of the rssState for non intersection opposite direction scenario
+ *
+ * In contrast to calculateRssStateNonIntersectionOppositeDirection() only isSafe and response of all axes are
+ * updated; the safe distances are only calculated as far as required for the decision and the rssStateInformation is
+ * left untouched.
+ *
+ * @param[in]  situation situation to analyze
+ * @param[in]  formulaProvider provider of the RSS formulas
+ * @param[in,out] rssState  response state of the ego vehicle
+ *
+ * @returns false if a failure occurred during calculations, true otherwise
+ */
+bool calculateRssDecisionNonIntersectionOppositeDirection(Situation const &situation,
+                                                          RssFormulaProvider const &formulaProvider,
+                                                          state::RssState &rssState);
 
 /**
  * @brief Calculate safety checks and determine required rssState for longitudinal direction for
  * non intersection scenario when both vehicles are driving in same direction
  *
  * @param[in]  situation situation to analyze
+ * @param[in]  formulaProvider provider of the RSS formulas
  * @param[out] rssState  rssState of the ego vehicle
  *
  * @returns false if a failure occurred during calculations, true otherwise
  *
  */
 bool calculateLongitudinalRssStateNonIntersectionSameDirection(Situation const &situation,
+                                                               RssFormulaProvider const &formulaProvider,
                                                                state::LongitudinalRssState &rssState);
 
 /**
@@ -84,18 +127,21 @@ bool calculateLongitudinalRssStateNonIntersectionSameDirection(Situation const &
  * non intersection scenario when vehicles are driving in opposite direction
  *
  * @param[in]  situation situation to analyze
+ * @param[in]  formulaProvider provider of the RSS formulas
  * @param[out] rssState  rssState of the ego vehicle
  *
  * @returns false if a failure occurred during calculations, true otherwise
  *
  */
 bool calculateLongitudinalRssStateNonIntersectionOppositeDirection(Situation const &situation,
+                                                                   RssFormulaProvider const &formulaProvider,
                                                                    state::LongitudinalRssState &rssState);
 
 /**
  * @brief Calculate safety checks and determine required rssState for lateral direction
  *
  * @param[in] situation      situation to analyze
+ * @param[in] formulaProvider provider of the RSS formulas
  * @param[out] rssStateLeft  rssState of the ego vehicle at its left side
  * @param[out] rssStateRight rssState of the ego vehicle at its right side
  *
@@ -103,6 +149,7 @@ bool calculateLongitudinalRssStateNonIntersectionOppositeDirection(Situation con
  *
  */
 bool calculateLateralRssState(Situation const &situation,
+                              RssFormulaProvider const &formulaProvider,
                               state::LateralRssState &rssStateLeft,
                               state::LateralRssState &rssStateRight);
 
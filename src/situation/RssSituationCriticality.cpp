@@ -0,0 +1,436 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/situation/RssSituationCriticality.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include "physics/Math.hpp"
+#include "situation/RssFormulas.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+namespace {
+
+double timeToCover(double const distance, double const closingSpeed)
+{
+  if (distance <= 0.)
+  {
+    return 0.;
+  }
+  if (closingSpeed <= 0.)
+  {
+    return std::numeric_limits<double>::infinity();
+  }
+  return distance / closingSpeed;
+}
+
+bool isLongitudinalOverlap(LongitudinalRelativePosition const &longitudinalPosition)
+{
+  return (longitudinalPosition != LongitudinalRelativePosition::InFront)
+    && (longitudinalPosition != LongitudinalRelativePosition::AtBack);
+}
+
+/*
+ * Bound of the decrease of the margin between the current and the safe distance:
+ *   d/dt margin >= -(offset + slope * t)
+ */
+struct MarginDecrease
+{
+  double offset{0.};
+  double slope{0.};
+};
+
+/*
+ * Add a vehicle approaching the other one with its worst case behavior.
+ *
+ * The margin decreases by the distance driven plus the increase of the stated braking distance
+ * s(v) = v * rho + a/2 * rho^2 + u * |u| / (2 * b) with u = v + a * rho. With |dv/dt| <= a and ds/dv = rho + |u| / b,
+ * the decrease rate is bounded by (v0 + a * t) + a * (rho + (|u0| + a * t) / b).
+ */
+void addApproachingVehicle(physics::Speed const &speedTowardsOther,
+                           physics::Duration const &responseTime,
+                           physics::Acceleration const &accelMax,
+                           physics::Acceleration const &brakeMin,
+                           MarginDecrease &marginDecrease)
+{
+  double const speed = static_cast<double>(speedTowardsOther);
+  double const rho = static_cast<double>(responseTime);
+  double const a = static_cast<double>(accelMax);
+  double const b = static_cast<double>(brakeMin);
+  marginDecrease.offset += speed + a * rho + a * std::fabs(speed + a * rho) / b;
+  marginDecrease.slope += a + a * a / b;
+}
+
+/*
+ * The first point in time the margin might be used up: margin - offset * t - slope / 2 * t^2 = 0
+ * The distance checks consider distances within the precision of physics::Distance as equal.
+ */
+double timeToExhaustMargin(bool const isSafe, physics::Distance const &margin, MarginDecrease const &marginDecrease)
+{
+  double const currentMargin = static_cast<double>(margin - physics::Distance::getPrecision());
+  if (!isSafe || (currentMargin <= 0.))
+  {
+    return 0.;
+  }
+  if (marginDecrease.slope <= 0.)
+  {
+    return timeToCover(currentMargin, marginDecrease.offset);
+  }
+  return (-marginDecrease.offset
+          + std::sqrt(marginDecrease.offset * marginDecrease.offset + 2. * marginDecrease.slope * currentMargin))
+    / marginDecrease.slope;
+}
+
+/*
+ * The leading vehicle doesn't contribute: its position plus its stopping distance with brakeMax never decreases.
+ */
+bool calculateTimeToUnsafeSameDirection(VehicleState const &leadingVehicle,
+                                        VehicleState const &followingVehicle,
+                                        physics::Distance const &distance,
+                                        RssFormulaProvider const &formulaProvider,
+                                        double &time)
+{
+  physics::Distance safeDistance(0.);
+  bool isSafe = false;
+  bool const result = formulaProvider.checkSafeLongitudinalDistanceSameDirection(
+    leadingVehicle, followingVehicle, distance, safeDistance, isSafe);
+  MarginDecrease marginDecrease;
+  addApproachingVehicle(followingVehicle.velocity.speedLon.maximum,
+                        followingVehicle.dynamics.responseTime,
+                        followingVehicle.dynamics.alphaLon.accelMax,
+                        followingVehicle.dynamics.alphaLon.brakeMin,
+                        marginDecrease);
+  time = timeToExhaustMargin(isSafe, distance - safeDistance, marginDecrease);
+
+  if (result && isSafe && (safeDistance <= physics::Distance(0.)))
+  {
+    // The safe distance is clamped at 0, the leading vehicle is able to stop further away than the following one.
+    // While this holds, the leading vehicle is faster if its brakeMax is not below the brakeMin of the following
+    // vehicle; then the distance can't vanish before the unclamped safe distance is reached.
+    physics::Distance statedBrakingDistance(0.);
+    physics::Distance stoppingDistance(0.);
+    if (calculateDistanceOffsetAfterStatedBrakingPattern(physics::CoordinateSystemAxis::Longitudinal,
+                                                         followingVehicle.velocity.speedLon.maximum,
+                                                         followingVehicle.dynamics.responseTime,
+                                                         followingVehicle.dynamics.alphaLon.accelMax,
+                                                         followingVehicle.dynamics.alphaLon.brakeMin,
+                                                         statedBrakingDistance)
+        && physics::calculateStoppingDistance(leadingVehicle.velocity.speedLon.minimum,
+                                              leadingVehicle.dynamics.alphaLon.brakeMax,
+                                              stoppingDistance))
+    {
+      double unclampedTime = timeToExhaustMargin(
+        true, distance - std::min(physics::Distance(0.), statedBrakingDistance - stoppingDistance), marginDecrease);
+      if (leadingVehicle.dynamics.alphaLon.brakeMax < followingVehicle.dynamics.alphaLon.brakeMin)
+      {
+        // d/dt distance >= (leading speed - brakeMax * t) - (following speed + accelMax * t)
+        MarginDecrease distanceDecrease;
+        distanceDecrease.offset = static_cast<double>(followingVehicle.velocity.speedLon.maximum
+                                                      - leadingVehicle.velocity.speedLon.minimum);
+        distanceDecrease.slope = static_cast<double>(followingVehicle.dynamics.alphaLon.accelMax
+                                                     + leadingVehicle.dynamics.alphaLon.brakeMax);
+        unclampedTime = std::min(unclampedTime, timeToExhaustMargin(true, distance, distanceDecrease));
+      }
+      time = std::max(time, unclampedTime);
+    }
+  }
+  return result;
+}
+
+bool calculateTimeToUnsafeOppositeDirection(Situation const &situation,
+                                            RssFormulaProvider const &formulaProvider,
+                                            double &time)
+{
+  bool const isEgoCorrect = situation.egoVehicleState.isInCorrectLane;
+  VehicleState const &correctVehicle = isEgoCorrect ? situation.egoVehicleState : situation.otherVehicleState;
+  VehicleState const &oppositeVehicle = isEgoCorrect ? situation.otherVehicleState : situation.egoVehicleState;
+  physics::Distance const distance = situation.relativePosition.longitudinalDistance;
+  physics::Distance safeDistance(0.);
+  bool isSafe = false;
+  bool const result = formulaProvider.checkSafeLongitudinalDistanceOppositeDirection(
+    correctVehicle, oppositeVehicle, distance, safeDistance, isSafe);
+  MarginDecrease marginDecrease;
+  addApproachingVehicle(correctVehicle.velocity.speedLon.maximum,
+                        correctVehicle.dynamics.responseTime,
+                        correctVehicle.dynamics.alphaLon.accelMax,
+                        correctVehicle.dynamics.alphaLon.brakeMinCorrect,
+                        marginDecrease);
+  addApproachingVehicle(oppositeVehicle.velocity.speedLon.maximum,
+                        oppositeVehicle.dynamics.responseTime,
+                        oppositeVehicle.dynamics.alphaLon.accelMax,
+                        oppositeVehicle.dynamics.alphaLon.brakeMin,
+                        marginDecrease);
+  time = timeToExhaustMargin(isSafe, distance - safeDistance, marginDecrease);
+  return result;
+}
+
+bool calculateTimeToUnsafeLateral(Situation const &situation, RssFormulaProvider const &formulaProvider, double &time)
+{
+  LateralRelativePosition const lateralPosition = situation.relativePosition.lateralPosition;
+  if ((lateralPosition != LateralRelativePosition::AtLeft) && (lateralPosition != LateralRelativePosition::AtRight))
+  {
+    // lateral overlap is never safe
+    time = 0.;
+    return true;
+  }
+
+  // ego at left: ego is the left vehicle
+  bool const isEgoLeft = (lateralPosition == LateralRelativePosition::AtLeft);
+  VehicleState const &leftVehicle = isEgoLeft ? situation.egoVehicleState : situation.otherVehicleState;
+  VehicleState const &rightVehicle = isEgoLeft ? situation.otherVehicleState : situation.egoVehicleState;
+  physics::Distance const distance = situation.relativePosition.lateralDistance;
+  physics::Distance safeDistance(0.);
+  bool isSafe = false;
+  bool const result
+    = formulaProvider.checkSafeLateralDistance(leftVehicle, rightVehicle, distance, safeDistance, isSafe);
+  // positive lateral speeds move the left vehicle towards the right one
+  MarginDecrease marginDecrease;
+  addApproachingVehicle(leftVehicle.velocity.speedLat.maximum,
+                        leftVehicle.dynamics.responseTime,
+                        leftVehicle.dynamics.alphaLat.accelMax,
+                        leftVehicle.dynamics.alphaLat.brakeMin,
+                        marginDecrease);
+  addApproachingVehicle(-rightVehicle.velocity.speedLat.minimum,
+                        rightVehicle.dynamics.responseTime,
+                        rightVehicle.dynamics.alphaLat.accelMax,
+                        rightVehicle.dynamics.alphaLat.brakeMin,
+                        marginDecrease);
+  time = timeToExhaustMargin(isSafe, distance - safeDistance, marginDecrease);
+  return result;
+}
+
+bool calculateTimeToUnsafeStopInFrontIntersection(VehicleState const &vehicle,
+                                                  RssFormulaProvider const &formulaProvider,
+                                                  double &time)
+{
+  physics::Distance safeDistance(0.);
+  bool isSafe = false;
+  bool const result = formulaProvider.checkStopInFrontIntersection(vehicle, safeDistance, isSafe);
+  MarginDecrease marginDecrease;
+  addApproachingVehicle(vehicle.velocity.speedLon.maximum,
+                        vehicle.dynamics.responseTime,
+                        vehicle.dynamics.alphaLon.accelMax,
+                        vehicle.dynamics.alphaLon.brakeMin,
+                        marginDecrease);
+  time = timeToExhaustMargin(isSafe, vehicle.distanceToEnterIntersection - safeDistance, marginDecrease);
+  return result;
+}
+
+bool calculateTimeToUnsafeLongitudinal(Situation const &situation,
+                                       bool const isEgoLeading,
+                                       RssFormulaProvider const &formulaProvider,
+                                       double &time)
+{
+  VehicleState const &leadingVehicle = isEgoLeading ? situation.egoVehicleState : situation.otherVehicleState;
+  VehicleState const &followingVehicle = isEgoLeading ? situation.otherVehicleState : situation.egoVehicleState;
+  return calculateTimeToUnsafeSameDirection(
+    leadingVehicle, followingVehicle, situation.relativePosition.longitudinalDistance, formulaProvider, time);
+}
+
+bool calculateTimeToUnsafeIntersection(Situation const &situation,
+                                       RssFormulaProvider const &formulaProvider,
+                                       double &time)
+{
+  // the intersection checks consider the ego vehicle leading only if it is completely in front
+  double longitudinalTime = 0.;
+  bool result = calculateTimeToUnsafeLongitudinal(
+    situation,
+    situation.relativePosition.longitudinalPosition == LongitudinalRelativePosition::InFront,
+    formulaProvider,
+    longitudinalTime);
+  time = longitudinalTime;
+
+  double egoStopTime = 0.;
+  if (result && !situation.egoVehicleState.hasPriority)
+  {
+    result = calculateTimeToUnsafeStopInFrontIntersection(situation.egoVehicleState, formulaProvider, egoStopTime);
+    time = std::max(time, egoStopTime);
+  }
+  double otherStopTime = 0.;
+  if (result && !situation.otherVehicleState.hasPriority)
+  {
+    result
+      = calculateTimeToUnsafeStopInFrontIntersection(situation.otherVehicleState, formulaProvider, otherStopTime);
+    time = std::max(time, otherStopTime);
+  }
+  return result;
+}
+
+} // namespace
+
+physics::Duration estimateTimeToConflict(Situation const &situation)
+{
+  double const egoMaxSpeed = static_cast<double>(situation.egoVehicleState.velocity.speedLon.maximum);
+  double const egoMinSpeed = static_cast<double>(situation.egoVehicleState.velocity.speedLon.minimum);
+  double const otherMaxSpeed = static_cast<double>(situation.otherVehicleState.velocity.speedLon.maximum);
+  double const otherMinSpeed = static_cast<double>(situation.otherVehicleState.velocity.speedLon.minimum);
+  double const distance = static_cast<double>(situation.relativePosition.longitudinalDistance);
+
+  double timeToConflict = std::numeric_limits<double>::infinity();
+  switch (situation.situationType)
+  {
+    case SituationType::SameDirection:
+      if (isLongitudinalOverlap(situation.relativePosition.longitudinalPosition))
+      {
+        timeToConflict = 0.;
+      }
+      else if (situation.relativePosition.longitudinalPosition == LongitudinalRelativePosition::InFront)
+      {
+        timeToConflict = timeToCover(distance, otherMaxSpeed - egoMinSpeed);
+      }
+      else
+      {
+        timeToConflict = timeToCover(distance, egoMaxSpeed - otherMinSpeed);
+      }
+      break;
+    case SituationType::OppositeDirection:
+      if (isLongitudinalOverlap(situation.relativePosition.longitudinalPosition))
+      {
+        timeToConflict = 0.;
+      }
+      else
+      {
+        timeToConflict = timeToCover(distance, egoMaxSpeed + otherMaxSpeed);
+      }
+      break;
+    case SituationType::IntersectionEgoHasPriority:
+    case SituationType::IntersectionObjectHasPriority:
+    case SituationType::IntersectionSamePriority:
+      timeToConflict = std::max(
+        timeToCover(static_cast<double>(situation.egoVehicleState.distanceToEnterIntersection), egoMaxSpeed),
+        timeToCover(static_cast<double>(situation.otherVehicleState.distanceToEnterIntersection), otherMaxSpeed));
+      break;
+    default:
+      break;
+  }
+
+  physics::Duration const maxDuration = std::numeric_limits<physics::Duration>::max();
+  if (timeToConflict >= static_cast<double>(maxDuration))
+  {
+    return maxDuration;
+  }
+  return physics::Duration(timeToConflict);
+}
+
+bool orderSituationsByCriticality(SituationSnapshot const &situationSnapshot, std::vector<std::size_t> &situationOrder)
+{
+  bool result = true;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    // criticality key: estimated time to conflict, then longitudinal distance
+    std::vector<std::pair<double, double>> criticalities;
+    criticalities.reserve(situationSnapshot.situations.size());
+    situationOrder.clear();
+    situationOrder.reserve(situationSnapshot.situations.size());
+    for (std::size_t i = 0u; i < situationSnapshot.situations.size(); ++i)
+    {
+      Situation const &situation = situationSnapshot.situations[i];
+      criticalities.push_back(std::make_pair(static_cast<double>(estimateTimeToConflict(situation)),
+                                             static_cast<double>(situation.relativePosition.longitudinalDistance)));
+      situationOrder.push_back(i);
+    }
+
+    std::stable_sort(
+      situationOrder.begin(), situationOrder.end(), [&criticalities](std::size_t const left, std::size_t const right) {
+        return criticalities[left] < criticalities[right];
+      });
+  }
+  catch (...)
+  {
+    situationOrder.clear();
+    result = false;
+  }
+  return result;
+}
+
+bool calculateTimeToDanger(Situation const &situation,
+                           RssFormulaProvider const &formulaProvider,
+                           physics::Duration &timeToDanger)
+{
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    double time = 0.;
+    double longitudinalTime = 0.;
+    double lateralTime = 0.;
+    LongitudinalRelativePosition const longitudinalPosition = situation.relativePosition.longitudinalPosition;
+    bool const isEgoLeading = (longitudinalPosition == LongitudinalRelativePosition::InFront)
+      || (longitudinalPosition == LongitudinalRelativePosition::OverlapFront);
+    switch (situation.situationType)
+    {
+      case SituationType::NotRelevant:
+        time = std::numeric_limits<double>::infinity();
+        result = true;
+        break;
+      case SituationType::SameDirection:
+        result = calculateTimeToUnsafeLongitudinal(situation, isEgoLeading, formulaProvider, longitudinalTime)
+          && calculateTimeToUnsafeLateral(situation, formulaProvider, lateralTime);
+        time = std::max(longitudinalTime, lateralTime);
+        break;
+      case SituationType::OppositeDirection:
+        result = calculateTimeToUnsafeOppositeDirection(situation, formulaProvider, longitudinalTime)
+          && calculateTimeToUnsafeLateral(situation, formulaProvider, lateralTime);
+        time = std::max(longitudinalTime, lateralTime);
+        break;
+      case SituationType::IntersectionEgoHasPriority:
+      case SituationType::IntersectionObjectHasPriority:
+      case SituationType::IntersectionSamePriority:
+        result = calculateTimeToUnsafeIntersection(situation, formulaProvider, time);
+        break;
+      default:
+        result = false;
+        break;
+    }
+
+    physics::Duration const maxDuration = std::numeric_limits<physics::Duration>::max();
+    if (time >= static_cast<double>(maxDuration))
+    {
+      timeToDanger = maxDuration;
+    }
+    else
+    {
+      timeToDanger = physics::Duration(time);
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,351 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/situation/RssSpeedEnvelope.hpp"
+#include <algorithm>
+#include <cmath>
+#include "ad_rss/situation/SituationSnapshotValidInputRange.hpp"
+#include "ad_rss/state/RssStateOperation.hpp"
+#include "physics/Math.hpp"
+#include "situation/RssFormulas.hpp"
+#include "situation/RssIntersectionChecker.hpp"
+#include "situation/RssSituation.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+using physics::Acceleration;
+using physics::CoordinateSystemAxis;
+using physics::Distance;
+using physics::Speed;
+
+namespace {
+
+Speed toSpeed(double const speed)
+{
+  return Speed(std::max(static_cast<double>(std::numeric_limits<Speed>::lowest()),
+                        std::min(static_cast<double>(std::numeric_limits<Speed>::max()), speed)));
+}
+
+/*
+ * The supremum of the speeds v with d(v) < maximumOffset, where d(v) is the distance offset of the stated braking
+ * pattern of the vehicle with a non negative acceleration (see calculateDistanceOffsetAfterStatedBrakingPattern()).
+ */
+Speed calculateMaximumSpeed(Distance const &maximumOffset,
+                            physics::Duration const &responseTime,
+                            Acceleration const &acceleration,
+                            Acceleration const &deceleration)
+{
+  double const offset = static_cast<double>(maximumOffset);
+  double const t = static_cast<double>(responseTime);
+  double const a = static_cast<double>(acceleration);
+  double const b = static_cast<double>(deceleration);
+
+  // the offset if the speed after the response time is zero
+  double const offsetAtStandstill = -0.5 * a * t * t;
+  if (offset > offsetAtStandstill)
+  {
+    // solve u^2 / (2 * b) + u * t + offsetAtStandstill = offset for the speed u after the response time
+    double const speedAfterResponseTime = -b * t + std::sqrt(b * b * t * t + 2. * b * (offset - offsetAtStandstill));
+    return toSpeed(speedAfterResponseTime - a * t);
+  }
+  if (t > 0.)
+  {
+    // the speed after the response time is against the acceleration, no braking afterwards (lateral only)
+    return toSpeed((offset - 0.5 * a * t * t) / t);
+  }
+  return std::numeric_limits<Speed>::lowest();
+}
+
+bool calculateStatedBrakingOffset(VehicleState const &vehicleState,
+                                  CoordinateSystemAxis const &axis,
+                                  bool const towardsLeft,
+                                  Acceleration const &deceleration,
+                                  Distance &offset)
+{
+  Speed const speed = (axis == CoordinateSystemAxis::Longitudinal)
+    ? vehicleState.velocity.speedLon.maximum
+    : (towardsLeft ? vehicleState.velocity.speedLat.maximum : vehicleState.velocity.speedLat.minimum);
+  Acceleration const acceleration = (axis == CoordinateSystemAxis::Longitudinal)
+    ? vehicleState.dynamics.alphaLon.accelMax
+    : vehicleState.dynamics.alphaLat.accelMax;
+  double const sign = towardsLeft ? 1. : -1.;
+  return calculateDistanceOffsetAfterStatedBrakingPattern(
+    axis, speed, vehicleState.dynamics.responseTime, sign * acceleration, sign * deceleration, offset);
+}
+
+/*
+ * Longitudinal limit of the ego vehicle following the other vehicle: safe if d_ego(v) - d_stop_other < distance
+ */
+bool calculateFollowingLimit(Situation const &situation, Speed &speedLonMax)
+{
+  VehicleState const &egoVehicleState = situation.egoVehicleState;
+  VehicleState const &otherVehicleState = situation.otherVehicleState;
+  Distance otherStoppingDistance(0.);
+  bool const result = physics::calculateStoppingDistance(
+    otherVehicleState.velocity.speedLon.minimum, otherVehicleState.dynamics.alphaLon.brakeMax, otherStoppingDistance);
+  if (situation.relativePosition.longitudinalDistance > Distance(0.))
+  {
+    speedLonMax = calculateMaximumSpeed(situation.relativePosition.longitudinalDistance + otherStoppingDistance,
+                                        egoVehicleState.dynamics.responseTime,
+                                        egoVehicleState.dynamics.alphaLon.accelMax,
+                                        egoVehicleState.dynamics.alphaLon.brakeMin);
+  }
+  else
+  {
+    speedLonMax = std::numeric_limits<Speed>::lowest();
+  }
+  return result;
+}
+
+/*
+ * Longitudinal limits of the same and opposite direction situations
+ */
+bool calculateLongitudinalLimits(Situation const &situation, SituationSpeedLimits &limits)
+{
+  VehicleState const &egoVehicleState = situation.egoVehicleState;
+  VehicleState const &otherVehicleState = situation.otherVehicleState;
+  Distance const distance = situation.relativePosition.longitudinalDistance;
+  bool result = false;
+  if (situation.situationType == SituationType::OppositeDirection)
+  {
+    // safe if d_ego(v) + d_other < distance
+    Acceleration const egoDeceleration = egoVehicleState.isInCorrectLane
+      ? egoVehicleState.dynamics.alphaLon.brakeMinCorrect
+      : egoVehicleState.dynamics.alphaLon.brakeMin;
+    Acceleration const otherDeceleration = egoVehicleState.isInCorrectLane
+      ? otherVehicleState.dynamics.alphaLon.brakeMin
+      : otherVehicleState.dynamics.alphaLon.brakeMinCorrect;
+    Distance otherOffset(0.);
+    result = calculateStatedBrakingOffset(
+      otherVehicleState, CoordinateSystemAxis::Longitudinal, true, otherDeceleration, otherOffset);
+    limits.speedLonMax = calculateMaximumSpeed(distance - otherOffset,
+                                               egoVehicleState.dynamics.responseTime,
+                                               egoVehicleState.dynamics.alphaLon.accelMax,
+                                               egoDeceleration);
+  }
+  else if ((situation.relativePosition.longitudinalPosition == LongitudinalRelativePosition::InFront)
+           || (situation.relativePosition.longitudinalPosition == LongitudinalRelativePosition::OverlapFront))
+  {
+    // ego leading: safe if d_other - v^2 / (2 * brakeMax) < distance
+    Distance otherOffset(0.);
+    result = calculateStatedBrakingOffset(otherVehicleState,
+                                          CoordinateSystemAxis::Longitudinal,
+                                          true,
+                                          otherVehicleState.dynamics.alphaLon.brakeMin,
+                                          otherOffset);
+    if (distance <= Distance(0.))
+    {
+      limits.speedLonMin = std::numeric_limits<Speed>::max();
+    }
+    else if (otherOffset >= distance)
+    {
+      limits.speedLonMin = toSpeed(
+        std::sqrt(2. * static_cast<double>(egoVehicleState.dynamics.alphaLon.brakeMax)
+                  * static_cast<double>(otherOffset - distance)));
+    }
+  }
+  else
+  {
+    result = calculateFollowingLimit(situation, limits.speedLonMax);
+  }
+  return result;
+}
+
+/*
+ * Lateral limits of the same and opposite direction situations
+ */
+bool calculateLateralLimits(Situation const &situation, SituationSpeedLimits &limits)
+{
+  VehicleState const &egoVehicleState = situation.egoVehicleState;
+  VehicleState const &otherVehicleState = situation.otherVehicleState;
+  Distance const distance = situation.relativePosition.lateralDistance;
+  bool result = true;
+  if (situation.relativePosition.lateralPosition == LateralRelativePosition::AtLeft)
+  {
+    // ego at left: safe if d_ego_left(v) - d_other_right < distance
+    Distance otherOffset(0.);
+    result = calculateStatedBrakingOffset(otherVehicleState,
+                                          CoordinateSystemAxis::Lateral,
+                                          false,
+                                          otherVehicleState.dynamics.alphaLat.brakeMin,
+                                          otherOffset);
+    limits.speedLatMax = (distance > Distance(0.)) ? calculateMaximumSpeed(distance + otherOffset,
+                                                                           egoVehicleState.dynamics.responseTime,
+                                                                           egoVehicleState.dynamics.alphaLat.accelMax,
+                                                                           egoVehicleState.dynamics.alphaLat.brakeMin)
+                                                   : std::numeric_limits<Speed>::lowest();
+  }
+  else if (situation.relativePosition.lateralPosition == LateralRelativePosition::AtRight)
+  {
+    // ego at right: safe if d_other_left - d_ego_right(v) < distance, where d_ego_right(v) = -d_ego_left(-v)
+    Distance otherOffset(0.);
+    result = calculateStatedBrakingOffset(otherVehicleState,
+                                          CoordinateSystemAxis::Lateral,
+                                          true,
+                                          otherVehicleState.dynamics.alphaLat.brakeMin,
+                                          otherOffset);
+    limits.speedLatMin = (distance > Distance(0.)) ? -calculateMaximumSpeed(distance - otherOffset,
+                                                                            egoVehicleState.dynamics.responseTime,
+                                                                            egoVehicleState.dynamics.alphaLat.accelMax,
+                                                                            egoVehicleState.dynamics.alphaLat.brakeMin)
+                                                   : std::numeric_limits<Speed>::max();
+  }
+  else
+  {
+    // lateral overlap, never safe
+    limits.speedLatMin = std::numeric_limits<Speed>::max();
+    limits.speedLatMax = std::numeric_limits<Speed>::lowest();
+  }
+  return result;
+}
+
+/*
+ * Upper longitudinal limit of the intersection situations: stopping in front of the intersection or keeping the
+ * distance to the other vehicle in front, unless the other vehicle is able to stop in front of the intersection.
+ */
+bool calculateIntersectionLimits(Situation const &situation, SituationSpeedLimits &limits)
+{
+  VehicleState const &egoVehicleState = situation.egoVehicleState;
+  bool result = true;
+  limits.speedLatMin = std::numeric_limits<Speed>::max();
+  limits.speedLatMax = std::numeric_limits<Speed>::lowest();
+
+  bool isOtherAbleToStop = false;
+  if (!situation.otherVehicleState.hasPriority)
+  {
+    Distance safeDistance(0.);
+    result = checkStopInFrontIntersection(situation.otherVehicleState, safeDistance, isOtherAbleToStop);
+  }
+  if (result && !isOtherAbleToStop)
+  {
+    limits.speedLonMax = std::numeric_limits<Speed>::lowest();
+    if (!egoVehicleState.hasPriority)
+    {
+      // safe if d_ego(v) < distance to enter the intersection
+      limits.speedLonMax = calculateMaximumSpeed(egoVehicleState.distanceToEnterIntersection,
+                                                 egoVehicleState.dynamics.responseTime,
+                                                 egoVehicleState.dynamics.alphaLon.accelMax,
+                                                 egoVehicleState.dynamics.alphaLon.brakeMin);
+    }
+    if (situation.relativePosition.longitudinalPosition != LongitudinalRelativePosition::InFront)
+    {
+      Speed followingSpeedLonMax(0.);
+      result = calculateFollowingLimit(situation, followingSpeedLonMax);
+      limits.speedLonMax = std::max(limits.speedLonMax, followingSpeedLonMax);
+    }
+  }
+  return result;
+}
+
+bool calculateSituationSpeedLimits(Situation const &situation, SituationSpeedLimits &limits)
+{
+  limits = SituationSpeedLimits();
+  limits.situationId = situation.situationId;
+  limits.objectId = situation.objectId;
+
+  state::RssState rssState;
+  bool result = false;
+  switch (situation.situationType)
+  {
+    case SituationType::NotRelevant:
+      return true;
+    case SituationType::SameDirection:
+      result = calculateRssStateNonIntersectionSameDirection(situation, getDefaultFormulaProvider(), rssState)
+        && calculateLongitudinalLimits(situation, limits) && calculateLateralLimits(situation, limits);
+      break;
+    case SituationType::OppositeDirection:
+      result = calculateRssStateNonIntersectionOppositeDirection(situation, getDefaultFormulaProvider(), rssState)
+        && calculateLongitudinalLimits(situation, limits) && calculateLateralLimits(situation, limits);
+      break;
+    case SituationType::IntersectionEgoHasPriority:
+    case SituationType::IntersectionObjectHasPriority:
+    case SituationType::IntersectionSamePriority:
+    {
+      // the safety at the current ego velocity doesn't depend on the history
+      core::RssIntersectionCheckingState intersectionCheckingState;
+      result = calculateRssStateIntersection(
+                 intersectionCheckingState, physics::TimeIndex(1u), situation, getDefaultFormulaProvider(), rssState)
+        && calculateIntersectionLimits(situation, limits);
+      break;
+    }
+    default:
+      break;
+  }
+  limits.isLongitudinalSafe = state::isLongitudinalSafe(rssState);
+  limits.isLateralSafe = state::isLateralSafe(rssState);
+  return result;
+}
+
+} // namespace
+
+bool calculateSpeedEnvelope(SituationSnapshot const &situationSnapshot, SpeedEnvelope &speedEnvelope)
+{
+  bool result = false;
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    speedEnvelope = SpeedEnvelope();
+    result = withinValidInputRange(situationSnapshot);
+    speedEnvelope.situationLimits.resize(situationSnapshot.situations.size());
+    for (std::size_t s = 0u; result && (s < situationSnapshot.situations.size()); ++s)
+    {
+      SituationSpeedLimits &limits = speedEnvelope.situationLimits[s];
+      result = calculateSituationSpeedLimits(situationSnapshot.situations[s], limits);
+      if (!limits.isLateralSafe)
+      {
+        speedEnvelope.speedLonMin = std::max(speedEnvelope.speedLonMin, limits.speedLonMin);
+        speedEnvelope.speedLonMax = std::min(speedEnvelope.speedLonMax, limits.speedLonMax);
+      }
+      if (!limits.isLongitudinalSafe)
+      {
+        speedEnvelope.speedLatMin = std::max(speedEnvelope.speedLatMin, limits.speedLatMin);
+        speedEnvelope.speedLatMax = std::min(speedEnvelope.speedLatMax, limits.speedLatMax);
+      }
+      if (!limits.isLongitudinalSafe && !limits.isLateralSafe)
+      {
+        speedEnvelope.dangerousObjects.push_back(limits.objectId);
+      }
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  if (!result)
+  {
+    speedEnvelope = SpeedEnvelope();
+  }
+  return result;
+}
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,83 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/world/CompactRoadArea.hpp"
+
+namespace ad_rss {
+namespace world {
+
+bool convertToCompactRoadArea(RoadArea const &roadArea, CompactRoadArea &compactRoadArea)
+{
+  try
+  {
+    std::size_t numberOfLaneSegments = 0u;
+    for (auto const &roadSegment : roadArea)
+    {
+      numberOfLaneSegments += roadSegment.size();
+    }
+
+    compactRoadArea.laneSegments.clear();
+    compactRoadArea.roadSegmentOffsets.clear();
+    compactRoadArea.lengthMinimum.clear();
+    compactRoadArea.lengthMaximum.clear();
+    compactRoadArea.widthMinimum.clear();
+    compactRoadArea.widthMaximum.clear();
+
+    compactRoadArea.laneSegments.reserve(numberOfLaneSegments);
+    compactRoadArea.roadSegmentOffsets.reserve(roadArea.size() + 1u);
+    compactRoadArea.lengthMinimum.reserve(numberOfLaneSegments);
+    compactRoadArea.lengthMaximum.reserve(numberOfLaneSegments);
+    compactRoadArea.widthMinimum.reserve(numberOfLaneSegments);
+    compactRoadArea.widthMaximum.reserve(numberOfLaneSegments);
+
+    for (auto const &roadSegment : roadArea)
+    {
+      compactRoadArea.roadSegmentOffsets.push_back(compactRoadArea.laneSegments.size());
+      for (auto const &laneSegment : roadSegment)
+      {
+        compactRoadArea.laneSegments.push_back(laneSegment);
+        compactRoadArea.lengthMinimum.push_back(laneSegment.length.minimum);
+        compactRoadArea.lengthMaximum.push_back(laneSegment.length.maximum);
+        compactRoadArea.widthMinimum.push_back(laneSegment.width.minimum);
+        compactRoadArea.widthMaximum.push_back(laneSegment.width.maximum);
+      }
+    }
+    compactRoadArea.roadSegmentOffsets.push_back(compactRoadArea.laneSegments.size());
+  }
+  catch (...)
+  {
+    return false;
+  }
+  return true;
+}
+
+} // namespace world
+} // namespace ad_rss
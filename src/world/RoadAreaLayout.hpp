@@ -0,0 +1,232 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include "world/SceneReference.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace world
+ */
+namespace world {
+
+/*
+ * The layout accessors provide uniform access to the lane segments of the different road area representations,
+ * so that the algorithms operating on the road area are written once as template and instantiated per layout.
+ */
+
+/*!
+ * @brief Layout accessor of a RoadArea storing one lane segment vector per road segment
+ */
+class RoadAreaLayout
+{
+public:
+  explicit RoadAreaLayout(RoadArea const &roadArea)
+    : mRoadArea(roadArea)
+  {
+  }
+
+  std::size_t getNumberOfRoadSegments() const
+  {
+    return mRoadArea.size();
+  }
+
+  std::size_t getNumberOfLaneSegments(std::size_t roadSegmentIndex) const
+  {
+    return mRoadArea[roadSegmentIndex].size();
+  }
+
+  LaneSegment const &getLaneSegment(std::size_t roadSegmentIndex, std::size_t laneSegmentIndex) const
+  {
+    return mRoadArea[roadSegmentIndex][laneSegmentIndex];
+  }
+
+  physics::Distance const &getLengthMinimum(std::size_t roadSegmentIndex, std::size_t laneSegmentIndex) const
+  {
+    return mRoadArea[roadSegmentIndex][laneSegmentIndex].length.minimum;
+  }
+
+  physics::Distance const &getLengthMaximum(std::size_t roadSegmentIndex, std::size_t laneSegmentIndex) const
+  {
+    return mRoadArea[roadSegmentIndex][laneSegmentIndex].length.maximum;
+  }
+
+  physics::Distance const &getWidthMinimum(std::size_t roadSegmentIndex, std::size_t laneSegmentIndex) const
+  {
+    return mRoadArea[roadSegmentIndex][laneSegmentIndex].width.minimum;
+  }
+
+  physics::Distance const &getWidthMaximum(std::size_t roadSegmentIndex, std::size_t laneSegmentIndex) const
+  {
+    return mRoadArea[roadSegmentIndex][laneSegmentIndex].width.maximum;
+  }
+
+private:
+  RoadArea const &mRoadArea;
+};
+
+/*!
+ * @brief Layout accessor of a CompactRoadArea
+ *
+ * The lengths and widths are read from the separate columns of the compact representation.
+ */
+class CompactRoadAreaLayout
+{
+public:
+  explicit CompactRoadAreaLayout(CompactRoadArea const &roadArea)
+    : mRoadArea(roadArea)
+  {
+  }
+
+  std::size_t getNumberOfRoadSegments() const
+  {
+    return mRoadArea.getNumberOfRoadSegments();
+  }
+
+  std::size_t getNumberOfLaneSegments(std::size_t roadSegmentIndex) const
+  {
+    return mRoadArea.getNumberOfLaneSegments(roadSegmentIndex);
+  }
+
+  LaneSegment const &getLaneSegment(std::size_t roadSegmentIndex, std::size_t laneSegmentIndex) const
+  {
+    return mRoadArea.laneSegments[mRoadArea.getIndex(roadSegmentIndex, laneSegmentIndex)];
+  }
+
+  physics::Distance const &getLengthMinimum(std::size_t roadSegmentIndex, std::size_t laneSegmentIndex) const
+  {
+    return mRoadArea.lengthMinimum[mRoadArea.getIndex(roadSegmentIndex, laneSegmentIndex)];
+  }
+
+  physics::Distance const &getLengthMaximum(std::size_t roadSegmentIndex, std::size_t laneSegmentIndex) const
+  {
+    return mRoadArea.lengthMaximum[mRoadArea.getIndex(roadSegmentIndex, laneSegmentIndex)];
+  }
+
+  physics::Distance const &getWidthMinimum(std::size_t roadSegmentIndex, std::size_t laneSegmentIndex) const
+  {
+    return mRoadArea.widthMinimum[mRoadArea.getIndex(roadSegmentIndex, laneSegmentIndex)];
+  }
+
+  physics::Distance const &getWidthMaximum(std::size_t roadSegmentIndex, std::size_t laneSegmentIndex) const
+  {
+    return mRoadArea.widthMaximum[mRoadArea.getIndex(roadSegmentIndex, laneSegmentIndex)];
+  }
+
+private:
+  CompactRoadArea const &mRoadArea;
+};
+
+/*!
+ * @brief Layout accessor of a RoadAreaView
+ */
+class RoadAreaViewLayout
+{
+public:
+  explicit RoadAreaViewLayout(RoadAreaView const &roadArea)
+    : mRoadArea(roadArea)
+  {
+  }
+
+  std::size_t getNumberOfRoadSegments() const
+  {
+    return mRoadArea.getNumberOfRoadSegments();
+  }
+
+  std::size_t getNumberOfLaneSegments(std::size_t roadSegmentIndex) const
+  {
+    return mRoadArea.getNumberOfLaneSegments(roadSegmentIndex);
+  }
+
+  LaneSegment const &getLaneSegment(std::size_t roadSegmentIndex, std::size_t laneSegmentIndex) const
+  {
+    return mRoadArea.laneSegments[mRoadArea.getIndex(roadSegmentIndex, laneSegmentIndex)];
+  }
+
+  physics::Distance const &getLengthMinimum(std::size_t roadSegmentIndex, std::size_t laneSegmentIndex) const
+  {
+    return getLaneSegment(roadSegmentIndex, laneSegmentIndex).length.minimum;
+  }
+
+  physics::Distance const &getLengthMaximum(std::size_t roadSegmentIndex, std::size_t laneSegmentIndex) const
+  {
+    return getLaneSegment(roadSegmentIndex, laneSegmentIndex).length.maximum;
+  }
+
+  physics::Distance const &getWidthMinimum(std::size_t roadSegmentIndex, std::size_t laneSegmentIndex) const
+  {
+    return getLaneSegment(roadSegmentIndex, laneSegmentIndex).width.minimum;
+  }
+
+  physics::Distance const &getWidthMaximum(std::size_t roadSegmentIndex, std::size_t laneSegmentIndex) const
+  {
+    return getLaneSegment(roadSegmentIndex, laneSegmentIndex).width.maximum;
+  }
+
+private:
+  RoadAreaView const &mRoadArea;
+};
+
+/**
+ * @brief Call the visitor with the layout accessor of the referenced road area
+ *
+ * The compact representation is preferred over the view, the view over the nested RoadArea.
+ *
+ * @param[in] roadArea the referenced road area
+ * @param[in] visitor callable object providing a templated operator()(Layout const &) returning bool
+ *
+ * @returns the result of the visitor
+ */
+template <class Visitor> bool visitRoadAreaLayout(RoadAreaReference const &roadArea, Visitor const &visitor)
+{
+  if (roadArea.compactRoadArea != nullptr)
+  {
+    return visitor(CompactRoadAreaLayout(*roadArea.compactRoadArea));
+  }
+  else if (roadArea.roadAreaView != nullptr)
+  {
+    return visitor(RoadAreaViewLayout(*roadArea.roadAreaView));
+  }
+  else
+  {
+    return visitor(RoadAreaLayout(*roadArea.roadArea));
+  }
+}
+
+} // namespace world
+} // namespace ad_rss
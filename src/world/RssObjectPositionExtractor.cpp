@@ -48,8 +48,8 @@ namespace world {
 using physics::Distance;
 using physics::MetricRange;
 
-RssObjectPositionExtractor::RssObjectPositionExtractor(OccupiedRegionVector const &occupiedRegions)
-  : mOccupiedRegions(occupiedRegions)
+RssObjectPositionExtractor::RssObjectPositionExtractor(ArrayView<OccupiedRegion> const &occupiedRegions)
+  : mOccupiedRegions(occupiedRegions.begin(), occupiedRegions.end())
 {
   mObjectDimensions.intersectionPosition.maximum = Distance(0.);
 }
@@ -73,7 +73,7 @@ bool RssObjectPositionExtractor::newLaneSegment(MetricRange lateralDistance, Lan
   while (!noAdditionalObjects && !mOccupiedRegions.empty())
   {
     auto const objectSegment
-      = std::find_if(mOccupiedRegions.begin(), mOccupiedRegions.end(), [laneSegment](OccupiedRegion const &region) {
+      = std::find_if(mOccupiedRegions.begin(), mOccupiedRegions.end(), [&laneSegment](OccupiedRegion const &region) {
           return region.segmentId == laneSegment.id;
         });
     if (objectSegment == mOccupiedRegions.end())
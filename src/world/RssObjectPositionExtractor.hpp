@@ -37,6 +37,7 @@
 #include <limits>
 #include "ad_rss/world/LaneSegment.hpp"
 #include "ad_rss/world/Object.hpp"
+#include "ad_rss/world/WorldModelView.hpp"
 
 /*!
  * @brief namespace ad_rss
@@ -107,7 +108,7 @@ public:
    *
    * @param occupiedRegions representing the object
    */
-  explicit RssObjectPositionExtractor(OccupiedRegionVector const &occupiedRegions);
+  explicit RssObjectPositionExtractor(ArrayView<OccupiedRegion> const &occupiedRegions);
 
   /**
    * @brief Indicate that there is a new road segment
@@ -37,6 +37,7 @@
 #include <algorithm>
 #include <limits>
 #include <vector>
+#include "world/RoadAreaLayout.hpp"
 
 /*!
  * @brief namespace ad_rss
@@ -50,7 +51,10 @@ namespace world {
 using physics::Distance;
 using physics::MetricRange;
 
-bool calculateLateralDimensions(RoadArea const &roadArea, std::vector<MetricRange> &lateralRanges)
+namespace {
+
+template <class RoadLayout>
+bool calculateLateralDimensionsT(RoadLayout const &roadLayout, std::vector<MetricRange> &lateralRanges)
 {
   bool result = true;
 
@@ -61,6 +65,7 @@ bool calculateLateralDimensions(RoadArea const &roadArea, std::vector<MetricRang
     currentLateralPosition.maximum = Distance(0.);
     currentLateralPosition.minimum = Distance(0.);
 
+    std::size_t const numberOfRoadSegments = roadLayout.getNumberOfRoadSegments();
     std::size_t currentLateralIndex = 0u;
     bool roadSegmentFound = true;
     while (roadSegmentFound)
@@ -70,13 +75,15 @@ bool calculateLateralDimensions(RoadArea const &roadArea, std::vector<MetricRang
 
       Distance lateralDistanceMax = Distance(0.);
       Distance lateralDistanceMin = std::numeric_limits<Distance>::max();
-      for (const auto &roadSegment : roadArea)
+      for (std::size_t roadSegmentIndex = 0u; roadSegmentIndex < numberOfRoadSegments; roadSegmentIndex++)
       {
-        if (roadSegment.size() > currentLateralIndex)
+        if (roadLayout.getNumberOfLaneSegments(roadSegmentIndex) > currentLateralIndex)
         {
           roadSegmentFound = true;
-          lateralDistanceMax = std::max(lateralDistanceMax, roadSegment[currentLateralIndex].width.maximum);
-          lateralDistanceMin = std::min(lateralDistanceMin, roadSegment[currentLateralIndex].width.minimum);
+          lateralDistanceMax
+            = std::max(lateralDistanceMax, roadLayout.getWidthMaximum(roadSegmentIndex, currentLateralIndex));
+          lateralDistanceMin
+            = std::min(lateralDistanceMin, roadLayout.getWidthMinimum(roadSegmentIndex, currentLateralIndex));
         }
       }
 
@@ -96,6 +103,23 @@ bool calculateLateralDimensions(RoadArea const &roadArea, std::vector<MetricRang
   return result;
 }
 
+} // namespace
+
+bool calculateLateralDimensions(RoadArea const &roadArea, std::vector<MetricRange> &lateralRanges)
+{
+  return calculateLateralDimensionsT(RoadAreaLayout(roadArea), lateralRanges);
+}
+
+bool calculateLateralDimensions(CompactRoadArea const &roadArea, std::vector<MetricRange> &lateralRanges)
+{
+  return calculateLateralDimensionsT(CompactRoadAreaLayout(roadArea), lateralRanges);
+}
+
+bool calculateLateralDimensions(RoadAreaView const &roadArea, std::vector<MetricRange> &lateralRanges)
+{
+  return calculateLateralDimensionsT(RoadAreaViewLayout(roadArea), lateralRanges);
+}
+
 /**
  * The RoadArea describes the relation between object and egoVehicle.
  * The RoadArea can be regarded as as matrix.
@@ -145,79 +169,146 @@ bool calculateLateralDimensions(RoadArea const &roadArea, std::vector<MetricRang
  *
  */
 
-bool calculateObjectDimensions(std::vector<Object> const &objects,
-                               RoadArea const &roadArea,
-                               std::vector<ObjectDimensions> &objectDimensions)
+namespace {
+
+template <class RoadLayout>
+bool calculateObjectDimensionsT(std::vector<ObjectView const *> const &objects,
+                                RoadLayout const &roadLayout,
+                                std::vector<MetricRange> const &lateralRanges,
+                                std::vector<ObjectDimensions> &objectDimensions)
 {
   bool result = true;
 
-  try
+  MetricRange longitudinalDimensions;
+
+  longitudinalDimensions.maximum = Distance(0.);
+  longitudinalDimensions.minimum = Distance(0.);
+
+  std::vector<RssObjectPositionExtractor> extractors;
+  for (const auto &object : objects)
   {
-    std::vector<MetricRange> lateralRanges;
-    result = calculateLateralDimensions(roadArea, lateralRanges);
-    if (result)
+    if (object->occupiedRegions.empty())
     {
-      MetricRange longitudinalDimensions;
+      return false;
+    }
+    extractors.push_back(RssObjectPositionExtractor(object->occupiedRegions));
+  }
 
-      longitudinalDimensions.maximum = Distance(0.);
-      longitudinalDimensions.minimum = Distance(0.);
+  std::size_t const numberOfRoadSegments = roadLayout.getNumberOfRoadSegments();
+  for (std::size_t roadSegmentIndex = 0u; roadSegmentIndex < numberOfRoadSegments && result; roadSegmentIndex++)
+  {
+    Distance longitudinalDistanceMax = Distance(0.);
+    Distance longitudinalDistanceMin = Distance(0.);
+    for (auto &extractor : extractors)
+    {
+      result = result && extractor.newRoadSegment(longitudinalDimensions.minimum, longitudinalDimensions.maximum);
+    }
 
-      std::vector<RssObjectPositionExtractor> extractors;
-      for (const auto &object : objects)
-      {
-        if (object.occupiedRegions.empty())
-        {
-          return false;
-        }
-        extractors.push_back(RssObjectPositionExtractor(object.occupiedRegions));
-      }
+    // This is needed, because we want to look for the minimum
+    longitudinalDistanceMin = std::numeric_limits<Distance>::max();
 
-      for (auto roadSegment = roadArea.cbegin(); roadSegment != roadArea.cend() && result; roadSegment++)
+    std::size_t const numberOfLaneSegments = roadLayout.getNumberOfLaneSegments(roadSegmentIndex);
+    for (std::size_t i = 0u; i < numberOfLaneSegments && result; i++)
+    {
+      if (i < lateralRanges.size())
       {
-        Distance longitudinalDistanceMax = Distance(0.);
-        Distance longitudinalDistanceMin = Distance(0.);
         for (auto &extractor : extractors)
         {
-          result = result && extractor.newRoadSegment(longitudinalDimensions.minimum, longitudinalDimensions.maximum);
+          result = result && extractor.newLaneSegment(lateralRanges[i], roadLayout.getLaneSegment(roadSegmentIndex, i));
         }
+      }
+      else
+      {
+        result = false; // LCOV_EXCL_LINE: unreachable code, keep to be on the safe side
+      }
 
-        // This is needed, because we want to look for the minimum
-        longitudinalDistanceMin = std::numeric_limits<Distance>::max();
+      longitudinalDistanceMax = std::max(longitudinalDistanceMax, roadLayout.getLengthMaximum(roadSegmentIndex, i));
+      longitudinalDistanceMin = std::min(longitudinalDistanceMin, roadLayout.getLengthMinimum(roadSegmentIndex, i));
+    }
 
-        for (std::size_t i = 0u; i < roadSegment->size() && result; i++)
-        {
-          if (i < lateralRanges.size())
-          {
-            for (auto &extractor : extractors)
-            {
-              result = result && extractor.newLaneSegment(lateralRanges[i], (*roadSegment)[i]);
-            }
-          }
-          else
-          {
-            result = false; // LCOV_EXCL_LINE: unreachable code, keep to be on the safe side
-          }
-
-          longitudinalDistanceMax = std::max(longitudinalDistanceMax, (*roadSegment)[i].length.maximum);
-          longitudinalDistanceMin = std::min(longitudinalDistanceMin, (*roadSegment)[i].length.minimum);
-        }
+    if (result)
+    {
+      longitudinalDimensions.maximum += longitudinalDistanceMax;
+      longitudinalDimensions.minimum += longitudinalDistanceMin;
+    }
+  }
 
-        if (result)
-        {
-          longitudinalDimensions.maximum += longitudinalDistanceMax;
-          longitudinalDimensions.minimum += longitudinalDistanceMin;
-        }
-      }
+  if (result)
+  {
+    for (auto &extractor : extractors)
+    {
+      ObjectDimensions extractedDimensions;
+      result = result && extractor.getObjectDimensions(extractedDimensions);
+      objectDimensions.push_back(extractedDimensions);
+    }
+  }
 
-      if (result)
-      {
-        for (auto &extractor : extractors)
-        {
-          ObjectDimensions extractedDimensions;
-          result = result && extractor.getObjectDimensions(extractedDimensions);
-          objectDimensions.push_back(extractedDimensions);
-        }
-      }
+  return result;
+}
+
+/*!
+ * @brief Visitor calculating the lateral ranges of a road area layout
+ */
+struct LateralDimensionsCalculation
+{
+  explicit LateralDimensionsCalculation(std::vector<MetricRange> &lateralRanges)
+    : mLateralRanges(lateralRanges)
+  {
+  }
+
+  template <class RoadLayout> bool operator()(RoadLayout const &roadLayout) const
+  {
+    return calculateLateralDimensionsT(roadLayout, mLateralRanges);
+  }
+
+  std::vector<MetricRange> &mLateralRanges;
+};
+
+/*!
+ * @brief Visitor calculating the object dimensions on a road area layout
+ */
+struct ObjectDimensionsCalculation
+{
+  ObjectDimensionsCalculation(std::vector<ObjectView const *> const &objects,
+                              std::vector<MetricRange> const &lateralRanges,
+                              std::vector<ObjectDimensions> &objectDimensions)
+    : mObjects(objects)
+    , mLateralRanges(lateralRanges)
+    , mObjectDimensions(objectDimensions)
+  {
+  }
+
+  template <class RoadLayout> bool operator()(RoadLayout const &roadLayout) const
+  {
+    return calculateObjectDimensionsT(mObjects, roadLayout, mLateralRanges, mObjectDimensions);
+  }
+
+  std::vector<ObjectView const *> const &mObjects;
+  std::vector<MetricRange> const &mLateralRanges;
+  std::vector<ObjectDimensions> &mObjectDimensions;
+};
+
+} // namespace
+
+bool calculateObjectDimensions(std::vector<ObjectView const *> const &objects,
+                               RoadAreaReference const &roadAreaReference,
+                               std::vector<ObjectDimensions> &objectDimensions)
+{
+  bool result = true;
+
+  try
+  {
+    std::vector<MetricRange> lateralRangesStorage;
+    if (roadAreaReference.lateralRanges == nullptr)
+    {
+      result = visitRoadAreaLayout(roadAreaReference, LateralDimensionsCalculation(lateralRangesStorage));
+    }
+    std::vector<MetricRange> const &lateralRanges
+      = (roadAreaReference.lateralRanges == nullptr) ? lateralRangesStorage : *roadAreaReference.lateralRanges;
+    if (result)
+    {
+      result = visitRoadAreaLayout(roadAreaReference,
+                                   ObjectDimensionsCalculation(objects, lateralRanges, objectDimensions));
     }
   }
   catch (...)
@@ -228,7 +319,9 @@ bool calculateObjectDimensions(std::vector<Object> const &objects,
   return result;
 }
 
-bool calculateObjectDimensions(Scene const &currentScene,
+bool calculateObjectDimensions(ObjectView const &egoVehicle,
+                               ObjectView const &object,
+                               RoadAreaReference const &roadArea,
                                ObjectDimensions &egoVehiclePosition,
                                ObjectDimensions &objectPosition)
 {
@@ -236,12 +329,12 @@ bool calculateObjectDimensions(Scene const &currentScene,
 
   try
   {
-    std::vector<Object> objects;
-    objects.push_back(currentScene.egoVehicle);
-    objects.push_back(currentScene.object);
+    std::vector<ObjectView const *> objects;
+    objects.push_back(&egoVehicle);
+    objects.push_back(&object);
 
     std::vector<ObjectDimensions> objectDimensions;
-    result = calculateObjectDimensions(objects, currentScene.egoVehicleRoad, objectDimensions);
+    result = calculateObjectDimensions(objects, roadArea, objectDimensions);
 
     if (result && (objectDimensions.size() == 2))
     {
@@ -261,16 +354,16 @@ bool calculateObjectDimensions(Scene const &currentScene,
   return result;
 }
 
-bool calculateObjectDimensions(Object const &object,
-                               ::ad_rss::world::RoadArea const &roadArea,
+bool calculateObjectDimensions(ObjectView const &object,
+                               RoadAreaReference const &roadArea,
                                ObjectDimensions &objectPosition)
 {
   bool result = true;
 
   try
   {
-    std::vector<Object> objects;
-    objects.push_back(object);
+    std::vector<ObjectView const *> objects;
+    objects.push_back(&object);
 
     std::vector<ObjectDimensions> objectDimensions;
     result = calculateObjectDimensions(objects, roadArea, objectDimensions);
@@ -292,7 +385,29 @@ bool calculateObjectDimensions(Object const &object,
   return result;
 }
 
-void convertVehicleStateDynamics(Object const &object,
+bool calculateObjectDimensions(Scene const &currentScene,
+                               ObjectDimensions &egoVehiclePosition,
+                               ObjectDimensions &objectPosition)
+{
+  RoadAreaReference roadArea;
+  roadArea.roadArea = &currentScene.egoVehicleRoad;
+  return calculateObjectDimensions(createObjectView(currentScene.egoVehicle),
+                                   createObjectView(currentScene.object),
+                                   roadArea,
+                                   egoVehiclePosition,
+                                   objectPosition);
+}
+
+bool calculateObjectDimensions(Object const &object,
+                               ::ad_rss::world::RoadArea const &roadArea,
+                               ObjectDimensions &objectPosition)
+{
+  RoadAreaReference roadAreaReference;
+  roadAreaReference.roadArea = &roadArea;
+  return calculateObjectDimensions(createObjectView(object), roadAreaReference, objectPosition);
+}
+
+void convertVehicleStateDynamics(ObjectView const &object,
                                  RssDynamics const &rssDynamics,
                                  ::ad_rss::situation::VehicleState &vehicleState)
 {
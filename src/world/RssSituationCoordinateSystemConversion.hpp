@@ -37,6 +37,7 @@
 #include "ad_rss/situation/VehicleState.hpp"
 #include "ad_rss/world/Scene.hpp"
 #include "world/RssObjectPositionExtractor.hpp"
+#include "world/SceneReference.hpp"
 
 /*!
  * @brief namespace ad_rss
@@ -47,6 +48,69 @@ namespace ad_rss {
  */
 namespace world {
 
+/**
+ * @brief Calculate the lateral ranges of the lane segment columns of a road area
+ *
+ * @param[in] roadArea: information about the lanes
+ * @param[out] lateralRanges: the minimum and maximum lateral distance to the begin of each lane segment column
+ */
+bool calculateLateralDimensions(RoadArea const &roadArea, std::vector<physics::MetricRange> &lateralRanges);
+
+/**
+ * @brief Calculate the lateral ranges of the lane segment columns of a compact road area
+ *
+ * @param[in] roadArea: information about the lanes in compact representation
+ * @param[out] lateralRanges: the minimum and maximum lateral distance to the begin of each lane segment column
+ */
+bool calculateLateralDimensions(CompactRoadArea const &roadArea, std::vector<physics::MetricRange> &lateralRanges);
+
+/**
+ * @brief Calculate the lateral ranges of the lane segment columns of a viewed road area
+ *
+ * @param[in] roadArea: view on the lanes
+ * @param[out] lateralRanges: the minimum and maximum lateral distance to the begin of each lane segment column
+ */
+bool calculateLateralDimensions(RoadAreaView const &roadArea, std::vector<physics::MetricRange> &lateralRanges);
+
+/**
+ * @brief Calculate the position ranges of several objects in the situation coordinate system
+ *
+ * The road area is traversed only once for all objects.
+ *
+ * @param[in] objects: the objects
+ * @param[in] roadArea: the referenced road area
+ * @param[out] objectDimensions: position ranges of the objects in the situation coordinate system, in order of objects
+ */
+bool calculateObjectDimensions(std::vector<ObjectView const *> const &objects,
+                               RoadAreaReference const &roadArea,
+                               std::vector<ObjectDimensions> &objectDimensions);
+
+/**
+ * @brief Calculate the object position ranges in the situation coordinate system
+ *
+ * @param[in] egoVehicle: information about the ego vehicle
+ * @param[in] object: information about the other object
+ * @param[in] roadArea: the referenced road area of the ego vehicle
+ * @param[out] egoVehiclePosition: position ranges in the situation coordinate system of the egoVehicle
+ * @param[out] objectPosition: position ranges in the situation coordinate system of the other object
+ */
+bool calculateObjectDimensions(ObjectView const &egoVehicle,
+                               ObjectView const &object,
+                               RoadAreaReference const &roadArea,
+                               ObjectDimensions &egoVehiclePosition,
+                               ObjectDimensions &objectPosition);
+
+/**
+ * @brief Calculate the object position ranges in the situation coordinate system
+ *
+ * @param[in] object: information about the object
+ * @param[in] roadArea: the referenced road area of the object
+ * @param[out] objectPosition: position ranges in the situation coordinate system of the other object
+ */
+bool calculateObjectDimensions(ObjectView const &object,
+                               RoadAreaReference const &roadArea,
+                               ObjectDimensions &objectPosition);
+
 /**
  * @brief Calculate the object position ranges in the situation coordinate system
  *
@@ -72,7 +136,7 @@ bool calculateObjectDimensions(Object const &object, RoadArea const &roadArea, O
  *
  * This functions only converts data from the structs. The values it self are not modified.
  */
-void convertVehicleStateDynamics(Object const &object,
+void convertVehicleStateDynamics(ObjectView const &object,
                                  RssDynamics const &rssDynamics,
                                  situation::VehicleState &vehicleState);
 
@@ -35,42 +35,46 @@
 namespace ad_rss {
 namespace world {
 
-RssSituationIdProvider::SituationData::SituationData(physics::TimeIndex timeIndex,
-                                                     situation::SituationId const situationId,
-                                                     Scene const &scene)
-  : mTimeIndex(timeIndex)
-  , mSituationType(scene.situationType)
-  , mSituationId(situationId)
+namespace {
+
+typedef core::RssSituationIdState::SituationData SituationData;
+typedef std::multimap<ObjectId, SituationData> SituationDataMap;
+
+bool isIntersectionSituation(situation::SituationType const &situationType)
 {
-  if ((mSituationType == situation::SituationType::IntersectionEgoHasPriority)
-      || (mSituationType == situation::SituationType::IntersectionObjectHasPriority)
-      || (mSituationType == situation::SituationType::IntersectionSamePriority))
-  {
-    mEgoVehicleIntersectionArea = getIntersectionArea(scene.egoVehicleRoad);
-    mObjectIntersectionArea = getIntersectionArea(scene.intersectingRoad);
-  }
+  return (situationType == situation::SituationType::IntersectionEgoHasPriority)
+    || (situationType == situation::SituationType::IntersectionObjectHasPriority)
+    || (situationType == situation::SituationType::IntersectionSamePriority);
 }
 
-RssSituationIdProvider::SituationData::IntersectionArea
-RssSituationIdProvider::SituationData::getIntersectionArea(RoadArea roadArea)
+SituationData createSituationData(physics::TimeIndex const &timeIndex,
+                                  situation::SituationId const situationId,
+                                  SceneReference const &sceneReference)
 {
-  IntersectionArea intersectionArea;
-  for (auto &roadSegment : roadArea)
+  SituationData situationData;
+  situationData.timeIndex = timeIndex;
+  situationData.situationType = sceneReference.situationType;
+  situationData.situationId = situationId;
+  if (isIntersectionSituation(situationData.situationType))
   {
-    for (auto &laneSegment : roadSegment)
-    {
-      if (laneSegment.type == LaneSegmentType::Intersection)
-      {
-        intersectionArea.insert(laneSegment.id);
-      }
-    }
+    IntersectionArea intersectionAreaStorage;
+    situationData.egoVehicleIntersectionArea
+      = getIntersectionArea(sceneReference.egoVehicleRoad, intersectionAreaStorage);
+    situationData.objectIntersectionArea
+      = getIntersectionArea(sceneReference.intersectingRoad, intersectionAreaStorage);
   }
-  return intersectionArea;
+  return situationData;
 }
 
-bool RssSituationIdProvider::SituationData::isSmallerOrEqual(
-  RssSituationIdProvider::SituationData::IntersectionArea const &left,
-  RssSituationIdProvider::SituationData::IntersectionArea const &right) const
+/*!
+ * Most of the time the intersection areas are identical
+ * If a vehicle has already entered the intersection, the areas are shrinking,
+ * but still have to be identical from end on
+ * As a consequence the whole new areas have to be within the old ones.
+ *
+ * @return \c true if the left intersection area is fully contained in the right one.
+ */
+bool isSmallerOrEqual(IntersectionArea const &left, IntersectionArea const &right)
 {
   if (right.size() < left.size())
   {
@@ -86,9 +90,16 @@ bool RssSituationIdProvider::SituationData::isSmallerOrEqual(
   return differenceSet.size() == expectedDifference;
 }
 
-bool RssSituationIdProvider::SituationData::updateSituation(physics::TimeIndex const timeIndex, Scene const &scene)
+/*!
+ * @brief update the situation data in case the scene matches the situation data
+ *
+ * @return \c true if the update succeeded, \c false if the scene doesn't match the situation
+ */
+bool updateSituation(SituationData &situationData,
+                     physics::TimeIndex const timeIndex,
+                     SceneReference const &sceneReference)
 {
-  if (scene.situationType != mSituationType)
+  if (sceneReference.situationType != situationData.situationType)
   {
     return false;
   }
@@ -96,19 +107,17 @@ bool RssSituationIdProvider::SituationData::updateSituation(physics::TimeIndex c
   IntersectionArea sceneEgoVehicleIntersectionArea;
   IntersectionArea sceneObjectIntersectionArea;
 
-  if ((mSituationType == situation::SituationType::IntersectionEgoHasPriority)
-      || (mSituationType == situation::SituationType::IntersectionObjectHasPriority)
-      || (mSituationType == situation::SituationType::IntersectionSamePriority))
+  if (isIntersectionSituation(situationData.situationType))
   {
     // extract the intersection areas of the scene
-    sceneEgoVehicleIntersectionArea = getIntersectionArea(scene.egoVehicleRoad);
-    if (!isSmallerOrEqual(sceneEgoVehicleIntersectionArea, mEgoVehicleIntersectionArea))
+    if (!isSmallerOrEqual(getIntersectionArea(sceneReference.egoVehicleRoad, sceneEgoVehicleIntersectionArea),
+                          situationData.egoVehicleIntersectionArea))
     {
       return false;
     }
 
-    sceneObjectIntersectionArea = getIntersectionArea(scene.intersectingRoad);
-    if (!isSmallerOrEqual(sceneObjectIntersectionArea, mObjectIntersectionArea))
+    if (!isSmallerOrEqual(getIntersectionArea(sceneReference.intersectingRoad, sceneObjectIntersectionArea),
+                          situationData.objectIntersectionArea))
     {
       return false;
     }
@@ -119,23 +128,29 @@ bool RssSituationIdProvider::SituationData::updateSituation(physics::TimeIndex c
     // therefore, the situation is treated to be the same if the situation type matches
   }
 
-  mTimeIndex = timeIndex;
+  situationData.timeIndex = timeIndex;
   return true;
 }
 
-void RssSituationIdProvider::updateTime(physics::TimeIndex const &timeIndex)
+/*!
+ * Update the time and free outdated data.
+ *
+ * @param[in] timeIndex the current time index
+ */
+void updateTime(core::RssSituationIdState &situationIdState, physics::TimeIndex const &timeIndex)
 {
-  if (timeIndex != mCurrentTime)
+  if (timeIndex != situationIdState.currentTime)
   {
-    mLastTime = mCurrentTime;
-    mCurrentTime = timeIndex;
+    situationIdState.lastTime = situationIdState.currentTime;
+    situationIdState.currentTime = timeIndex;
 
     // next time step, remove outdated data
-    for (auto iter = mSituationData.begin(); iter != mSituationData.end();)
+    for (auto iter = situationIdState.situationData.begin(); iter != situationIdState.situationData.end();)
     {
-      if ((iter->second.mTimeIndex != mLastTime) && (iter->second.mTimeIndex != mCurrentTime))
+      if ((iter->second.timeIndex != situationIdState.lastTime)
+          && (iter->second.timeIndex != situationIdState.currentTime))
       {
-        iter = mSituationData.erase(iter);
+        iter = situationIdState.situationData.erase(iter);
       }
       else
       {
@@ -145,45 +160,69 @@ void RssSituationIdProvider::updateTime(physics::TimeIndex const &timeIndex)
   }
 }
 
+/*!
+ * @brief get the next free situation id
+ */
+situation::SituationId getFreeSituationId(core::RssSituationIdState &situationIdState)
+{
+  bool situationIdFound = false;
+  do // LCOV_EXCL_LINE: lcov analysis misses this line
+  {
+    situationIdState.nextSituationId++;
+    auto findResult = std::find_if(situationIdState.situationData.begin(),
+                                   situationIdState.situationData.end(),
+                                   [&situationIdState](SituationDataMap::value_type const &situation) {
+                                     return (situation.second.situationId == situationIdState.nextSituationId);
+                                   });
+    situationIdFound = findResult == situationIdState.situationData.end();
+  } while (!situationIdFound);
+
+  return situationIdState.nextSituationId;
+}
+
+} // namespace
+
 situation::SituationId RssSituationIdProvider::getSituationId(physics::TimeIndex const &timeIndex, Scene const &scene)
 {
-  updateTime(timeIndex);
+  return getSituationId(mSituationIdState, timeIndex, createSceneReference(scene));
+}
+
+situation::SituationId RssSituationIdProvider::getSituationId(physics::TimeIndex const &timeIndex,
+                                                              SceneReference const &sceneReference)
+{
+  return getSituationId(mSituationIdState, timeIndex, sceneReference);
+}
 
-  auto const objectDataRange = mSituationData.equal_range(scene.object.objectId);
-  auto findResult = std::find_if(
-    objectDataRange.first, objectDataRange.second, [&scene, this](SituationDataMap::value_type &situation) {
-      return situation.second.updateSituation(this->mCurrentTime, scene);
-    });
+situation::SituationId RssSituationIdProvider::getSituationId(core::RssSituationIdState &situationIdState,
+                                                              physics::TimeIndex const &timeIndex,
+                                                              SceneReference const &sceneReference)
+{
+  updateTime(situationIdState, timeIndex);
+
+  auto const objectDataRange = situationIdState.situationData.equal_range(sceneReference.object.objectId);
+  physics::TimeIndex const currentTime = situationIdState.currentTime;
+  auto findResult = std::find_if(objectDataRange.first,
+                                 objectDataRange.second,
+                                 [&sceneReference, &currentTime](SituationDataMap::value_type &situation) {
+                                   return updateSituation(situation.second, currentTime, sceneReference);
+                                 });
   if (findResult != objectDataRange.second)
   {
-    return findResult->second.mSituationId;
+    return findResult->second.situationId;
   }
-  auto insertResult = mSituationData.emplace_hint(
-    objectDataRange.first, scene.object.objectId, SituationData(mCurrentTime, getFreeSituationId(), scene));
-  if (insertResult != mSituationData.end())
+  situation::SituationId const situationId = getFreeSituationId(situationIdState);
+  auto insertResult = situationIdState.situationData.emplace_hint(
+    objectDataRange.first,
+    sceneReference.object.objectId,
+    createSituationData(situationIdState.currentTime, situationId, sceneReference));
+  if (insertResult != situationIdState.situationData.end())
   {
-    return insertResult->second.mSituationId;
+    return insertResult->second.situationId;
   }
   // LCOV_EXCL_START: unreachable code, keep to be on the safe side
   throw std::runtime_error("RssSituationIdProvider::getSituationId>> cannot add scene to situation map");
   // LCOV_EXCL_STOP: unreachable code, keep to be on the safe side
 }
 
-situation::SituationId RssSituationIdProvider::getFreeSituationId()
-{
-  bool situationIdFound = false;
-  do // LCOV_EXCL_LINE: lcov analysis misses this line
-  {
-    mNextSituationId++;
-    auto findResult = std::find_if(
-      mSituationData.begin(), mSituationData.end(), [this](SituationDataMap::value_type const &situation) {
-        return (situation.second.mSituationId == this->mNextSituationId);
-      });
-    situationIdFound = findResult == mSituationData.end();
-  } while (!situationIdFound);
-
-  return mNextSituationId;
-}
-
 } // namespace world
 } // namespace ad_rss
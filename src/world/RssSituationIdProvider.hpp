@@ -34,11 +34,11 @@
 
 #pragma once
 
-#include <map>
-#include <set>
+#include "ad_rss/core/RssCycleState.hpp"
 #include "ad_rss/physics/TimeIndex.hpp"
 #include "ad_rss/situation/SituationId.hpp"
 #include "ad_rss/world/Scene.hpp"
+#include "world/SceneReference.hpp"
 
 /*!
  * @brief namespace ad_rss
@@ -52,7 +52,8 @@ namespace world {
 /*!
  * @brief class supporting to keep track of unique situation ids
  *
- * Situation id's have to be constant over time.
+ * Situation id's have to be constant over time. The history of the situations is kept within a
+ * core::RssSituationIdState, which is either owned by the provider or passed explicitly.
  */
 class RssSituationIdProvider
 {
@@ -77,59 +78,31 @@ public:
    */
   situation::SituationId getSituationId(physics::TimeIndex const &timeIndex, Scene const &scene);
 
-private:
-  struct SituationData
-  {
-    SituationData(physics::TimeIndex timeIndex, situation::SituationId const situationId, Scene const &scene);
-    /*!
-     * @brief update the current situation data in case the scene matches the situation data
-     *
-     * @return \c true if the update succeeded, \c false if the scene doesn't match the situation
-     */
-    bool updateSituation(physics::TimeIndex timeIndex, Scene const &scene);
-
-    typedef std::set<LaneSegmentId> IntersectionArea;
-
-    /*!
-     * Most of the time the intersection areas are identical
-     * If a vehicle has already entered the intersection, the areas are shrinking,
-     * but still have to be identical from end on
-     * As a consequence the whole new areas have to be within the old ones.
-     *
-     * @return \c true if the left intersection area is fully contained in the right one.
-     */
-    bool isSmallerOrEqual(IntersectionArea const &left, IntersectionArea const &right) const;
-
-    /*!
-     * @brief extract the intersection area from the RoadArea
-     */
-    IntersectionArea getIntersectionArea(RoadArea roadArea);
-
-    physics::TimeIndex mTimeIndex;
-    situation::SituationType mSituationType;
-    situation::SituationId mSituationId;
-    IntersectionArea mEgoVehicleIntersectionArea;
-    IntersectionArea mObjectIntersectionArea;
-  };
-
   /*!
-   * Update the time and free outdated data.
+   * @brief get the situation id of the referenced scene
    *
-   * @param[in] timeIndex the current time index
+   * @param[in] timeIndex the time index the scene refers to
+   * @param[in] sceneReference the reference to the relevant scene
+   *
+   * @return the situation id assigned to the referenced scene
    */
-  void updateTime(physics::TimeIndex const &timeIndex);
+  situation::SituationId getSituationId(physics::TimeIndex const &timeIndex, SceneReference const &sceneReference);
 
   /*!
-   * @brief get the next free situation id
+   * @brief get the situation id of the referenced scene based on an explicit history
+   *
+   * @param[in,out] situationIdState the history of the situation id assignment to be used and updated
+   * @param[in] timeIndex the time index the scene refers to
+   * @param[in] sceneReference the reference to the relevant scene
+   *
+   * @return the situation id assigned to the referenced scene
    */
-  situation::SituationId getFreeSituationId();
-
-  typedef std::multimap<ObjectId, SituationData> SituationDataMap;
+  static situation::SituationId getSituationId(core::RssSituationIdState &situationIdState,
+                                               physics::TimeIndex const &timeIndex,
+                                               SceneReference const &sceneReference);
 
-  physics::TimeIndex mCurrentTime{0};
-  physics::TimeIndex mLastTime{0};
-  situation::SituationId mNextSituationId{0};
-  SituationDataMap mSituationData;
+private:
+  core::RssSituationIdState mSituationIdState;
 };
 
 } // namespace world
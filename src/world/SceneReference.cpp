@@ -0,0 +1,140 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "world/SceneReference.hpp"
+#include "world/RoadAreaLayout.hpp"
+
+namespace ad_rss {
+namespace world {
+
+namespace {
+
+/*!
+ * @brief Visitor collecting the intersection area of a road area layout
+ */
+struct IntersectionAreaCalculation
+{
+  explicit IntersectionAreaCalculation(IntersectionArea &intersectionArea)
+    : mIntersectionArea(intersectionArea)
+  {
+  }
+
+  template <class RoadLayout> bool operator()(RoadLayout const &roadLayout) const
+  {
+    std::size_t const numberOfRoadSegments = roadLayout.getNumberOfRoadSegments();
+    for (std::size_t roadSegmentIndex = 0u; roadSegmentIndex < numberOfRoadSegments; roadSegmentIndex++)
+    {
+      std::size_t const numberOfLaneSegments = roadLayout.getNumberOfLaneSegments(roadSegmentIndex);
+      for (std::size_t laneSegmentIndex = 0u; laneSegmentIndex < numberOfLaneSegments; laneSegmentIndex++)
+      {
+        LaneSegment const &laneSegment = roadLayout.getLaneSegment(roadSegmentIndex, laneSegmentIndex);
+        if (laneSegment.type == LaneSegmentType::Intersection)
+        {
+          mIntersectionArea.insert(laneSegment.id);
+        }
+      }
+    }
+    return true;
+  }
+
+  IntersectionArea &mIntersectionArea;
+};
+
+/*!
+ * @brief Visitor checking if a road area layout is empty
+ */
+struct EmptyCheck
+{
+  template <class RoadLayout> bool operator()(RoadLayout const &roadLayout) const
+  {
+    return roadLayout.getNumberOfRoadSegments() == 0u;
+  }
+};
+
+} // namespace
+
+SceneReference createSceneReference(Scene const &scene)
+{
+  SceneReference sceneReference;
+  sceneReference.situationType = scene.situationType;
+  sceneReference.egoVehicle = createObjectView(scene.egoVehicle);
+  sceneReference.object = createObjectView(scene.object);
+  sceneReference.objectRssDynamics = &scene.objectRssDynamics;
+  sceneReference.egoVehicleRoad.roadArea = &scene.egoVehicleRoad;
+  sceneReference.intersectingRoad.roadArea = &scene.intersectingRoad;
+  return sceneReference;
+}
+
+SceneReference createSceneReference(SceneView const &scene)
+{
+  SceneReference sceneReference;
+  sceneReference.situationType = scene.situationType;
+  sceneReference.egoVehicle = scene.egoVehicle;
+  sceneReference.object = scene.object;
+  sceneReference.objectRssDynamics = scene.objectRssDynamics;
+  sceneReference.egoVehicleRoad.roadAreaView = &scene.egoVehicleRoad;
+  sceneReference.intersectingRoad.roadAreaView = &scene.intersectingRoad;
+  return sceneReference;
+}
+
+bool isEmpty(RoadAreaReference const &roadArea)
+{
+  return visitRoadAreaLayout(roadArea, EmptyCheck());
+}
+
+IntersectionArea calculateIntersectionArea(RoadArea const &roadArea)
+{
+  IntersectionArea intersectionArea;
+  IntersectionAreaCalculation const calculation(intersectionArea);
+  calculation(RoadAreaLayout(roadArea));
+  return intersectionArea;
+}
+
+IntersectionArea calculateIntersectionArea(RoadAreaReference const &roadArea)
+{
+  IntersectionArea intersectionArea;
+  visitRoadAreaLayout(roadArea, IntersectionAreaCalculation(intersectionArea));
+  return intersectionArea;
+}
+
+IntersectionArea const &getIntersectionArea(RoadAreaReference const &roadArea,
+                                            IntersectionArea &intersectionAreaStorage)
+{
+  if (roadArea.intersectionArea != nullptr)
+  {
+    return *roadArea.intersectionArea;
+  }
+  intersectionAreaStorage = calculateIntersectionArea(roadArea);
+  return intersectionAreaStorage;
+}
+
+} // namespace world
+} // namespace ad_rss
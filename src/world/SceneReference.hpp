@@ -0,0 +1,169 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <set>
+#include <vector>
+#include "ad_rss/physics/MetricRange.hpp"
+#include "ad_rss/world/CompactRoadArea.hpp"
+#include "ad_rss/world/Scene.hpp"
+#include "ad_rss/world/WorldModelView.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace world
+ */
+namespace world {
+
+/*!
+ * @brief the lane segments of a road area that are part of an intersection
+ */
+typedef std::set<LaneSegmentId> IntersectionArea;
+
+/*!
+ * @brief Reference to a road area together with its derived geometry
+ *
+ * The road area is referenced in one of its representations: the compact representation, a view or the nested
+ * RoadArea (see visitRoadAreaLayout()).
+ * The derived geometry is optional. If not provided (nullptr), it is calculated on demand out of the road area.
+ */
+struct RoadAreaReference
+{
+  /*!
+   * @brief the road area
+   */
+  RoadArea const *roadArea{nullptr};
+
+  /*!
+   * @brief the view on the road area
+   */
+  RoadAreaView const *roadAreaView{nullptr};
+
+  /*!
+   * @brief the compact representation of the road area, see convertToCompactRoadArea()
+   */
+  CompactRoadArea const *compactRoadArea{nullptr};
+
+  /*!
+   * @brief the lateral ranges of the lane segment columns of the road area, see calculateLateralDimensions()
+   */
+  std::vector<physics::MetricRange> const *lateralRanges{nullptr};
+
+  /*!
+   * @brief the intersection area of the road area, see calculateIntersectionArea()
+   */
+  IntersectionArea const *intersectionArea{nullptr};
+};
+
+/*!
+ * @brief Reference to the data of a scene required to extract the situation out of it
+ *
+ * Enables the situation extraction to operate on different scene representations without copying the data.
+ */
+struct SceneReference
+{
+  situation::SituationType situationType{situation::SituationType::NotRelevant};
+  ObjectView egoVehicle;
+  ObjectView object;
+  RssDynamics const *objectRssDynamics{nullptr};
+  RoadAreaReference egoVehicleRoad;
+  RoadAreaReference intersectingRoad;
+};
+
+/**
+ * @brief Create the reference to a scene
+ *
+ * The derived geometry of the road areas is not provided by the reference.
+ *
+ * @param[in] scene the scene to be referenced
+ *
+ * @returns the scene reference
+ */
+SceneReference createSceneReference(Scene const &scene);
+
+/**
+ * @brief Create the reference to a scene view
+ *
+ * The derived geometry of the road areas is not provided by the reference.
+ *
+ * @param[in] scene the scene view to be referenced
+ *
+ * @returns the scene reference
+ */
+SceneReference createSceneReference(SceneView const &scene);
+
+/**
+ * @brief Check if a referenced road area is empty
+ *
+ * @param[in] roadArea the referenced road area
+ *
+ * @returns true if the road area does not contain any road segment
+ */
+bool isEmpty(RoadAreaReference const &roadArea);
+
+/**
+ * @brief Calculate the intersection area of a road area
+ *
+ * @param[in] roadArea the road area
+ *
+ * @returns the ids of all lane segments of the road area with type LaneSegmentType::Intersection
+ */
+IntersectionArea calculateIntersectionArea(RoadArea const &roadArea);
+
+/**
+ * @brief Calculate the intersection area of a referenced road area
+ *
+ * @param[in] roadArea the referenced road area
+ *
+ * @returns the ids of all lane segments of the road area with type LaneSegmentType::Intersection
+ */
+IntersectionArea calculateIntersectionArea(RoadAreaReference const &roadArea);
+
+/**
+ * @brief Provide the intersection area of a referenced road area
+ *
+ * @param[in] roadArea the referenced road area
+ * @param[out] intersectionAreaStorage storage for the intersection area, if it has to be calculated on demand
+ *
+ * @returns the intersection area of the referenced road area
+ */
+IntersectionArea const &getIntersectionArea(RoadAreaReference const &roadArea,
+                                            IntersectionArea &intersectionAreaStorage);
+
+} // namespace world
+} // namespace ad_rss
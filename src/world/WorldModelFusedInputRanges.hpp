@@ -0,0 +1,125 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include "ad_rss/physics/TimeIndex.hpp"
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+/*!
+ * @brief namespace world
+ */
+namespace world {
+/*!
+ * @brief namespace fused
+ */
+namespace fused {
+
+/*
+ * The input ranges of the members of a world model checked by withinValidInputRangeFused(). The generated
+ * withinValidInputRange() functions state their ranges as literals within the code, so these limits repeat them.
+ * WorldModelFusedValidInputRangeTests compares both validators at all of these limits to detect any difference.
+ */
+
+/*!
+ * @brief The kinds of range checks of the members of a world model. The generic and the individual input range of a
+ * member of the generated withinValidInputRange() functions are combined into a single range.
+ */
+enum RangeKind
+{
+  ParametricValueRange,
+  DistanceRange,
+  LateralFluctuationMarginRange,
+  SpeedLonRange,
+  SpeedLatRange,
+  AccelerationRange,
+  NonNegativeAccelerationRange,
+  PositiveAccelerationRange,
+  ResponseTimeRange,
+  NumberOfRangeKinds
+};
+
+/*!
+ * @brief The input range of a range check: [lowerBound, upperBound], or (lowerBound, upperBound] if the lower bound
+ * is exclusive. The precision is the one of the physics type of the checked members.
+ */
+struct InputRange
+{
+  double lowerBound;
+  bool lowerBoundExclusive;
+  double upperBound;
+  double precision;
+};
+
+/*!
+ * @returns the input range of the given kind of range check
+ */
+InputRange getInputRange(RangeKind const rangeKind);
+
+/*!
+ * @brief The minimal time index of a world model
+ */
+physics::TimeIndex const cMinTimeIndex = 1u;
+
+/*!
+ * @brief The maximal number of scenes of a world model
+ */
+std::size_t const cMaxNumberOfScenes = 1000u;
+
+/*!
+ * @brief The maximal number of occupied regions of an object
+ */
+std::size_t const cMaxNumberOfOccupiedRegions = 1000u;
+
+/*!
+ * @brief The maximal number of road segments of a road area
+ */
+std::size_t const cMaxNumberOfRoadSegments = 50u;
+
+/*!
+ * @brief The minimal number of lane segments of a road segment
+ */
+std::size_t const cMinNumberOfLaneSegments = 1u;
+
+/*!
+ * @brief The maximal number of lane segments of a road segment
+ */
+std::size_t const cMaxNumberOfLaneSegments = 20u;
+
+} // namespace fused
+} // namespace world
+} // namespace ad_rss
@@ -0,0 +1,499 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/world/WorldModelFusedValidInputRange.hpp"
+#include <cfloat>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "ad_rss/situation/SituationTypeValidInputRange.hpp"
+#include "ad_rss/world/LaneDrivingDirectionValidInputRange.hpp"
+#include "ad_rss/world/LaneSegmentTypeValidInputRange.hpp"
+#include "ad_rss/world/ObjectTypeValidInputRange.hpp"
+#include "world/WorldModelFusedInputRanges.hpp"
+
+namespace ad_rss {
+namespace world {
+namespace fused {
+
+InputRange getInputRange(RangeKind const rangeKind)
+{
+  switch (rangeKind)
+  {
+    case ParametricValueRange:
+      return InputRange{0., false, 1., physics::ParametricValue::cPrecisionValue};
+    case DistanceRange:
+      return InputRange{0., false, 1e6, physics::Distance::cPrecisionValue};
+    case LateralFluctuationMarginRange:
+      return InputRange{0., false, 1., physics::Distance::cPrecisionValue};
+    case SpeedLonRange:
+      return InputRange{0., false, 100., physics::Speed::cPrecisionValue};
+    case SpeedLatRange:
+      return InputRange{-10., false, 10., physics::Speed::cPrecisionValue};
+    case AccelerationRange:
+      return InputRange{-1e2, false, 1e2, physics::Acceleration::cPrecisionValue};
+    case NonNegativeAccelerationRange:
+      return InputRange{0., false, 1e2, physics::Acceleration::cPrecisionValue};
+    case PositiveAccelerationRange:
+      return InputRange{0., true, 1e2, physics::Acceleration::cPrecisionValue};
+    case ResponseTimeRange:
+      return InputRange{0., true, 10., physics::Duration::cPrecisionValue};
+    default:
+      throw std::out_of_range("invalid range kind"); // LCOV_EXCL_LINE: unreachable code
+  }
+}
+
+} // namespace fused
+
+namespace {
+
+using fused::RangeKind;
+
+/*
+ * The kinds of order checks, one per physics type
+ */
+enum OrderKind
+{
+  ParametricValueOrder,
+  DistanceOrder,
+  AccelerationOrder,
+  NumberOfOrderKinds
+};
+
+/*
+ * The range of the values of a range check: the value is a valid value of its type and within
+ * [lowerBound, upperBound], or within (lowerBound, upperBound] if the lower bound is exclusive.
+ *
+ * The comparison operators of the physics types consider values closer than the precision as equal:
+ *   a <= b  <=>  a - b < precision
+ *   a < b   <=>  b - a >= precision
+ * so the lower bound holds if value - lowerBound >= lowerBoundThreshold, with the threshold being the precision if the
+ * lower bound is exclusive and the smallest value larger than -precision otherwise.
+ */
+struct RangeSpecification
+{
+  double lowerBound;
+  double lowerBoundThreshold;
+  double upperBound;
+  double precision;
+  double typeMinimum;
+  double typeMaximum;
+};
+
+template <class PhysicsType> RangeSpecification createRangeSpecification(RangeKind const rangeKind)
+{
+  fused::InputRange const inputRange = fused::getInputRange(rangeKind);
+  return RangeSpecification{inputRange.lowerBound,
+                            inputRange.lowerBoundExclusive ? inputRange.precision
+                                                           : std::nextafter(-inputRange.precision, 0.),
+                            inputRange.upperBound,
+                            inputRange.precision,
+                            PhysicsType::cMinValue,
+                            PhysicsType::cMaxValue};
+}
+
+RangeSpecification getRangeSpecification(std::size_t const rangeKind)
+{
+  switch (rangeKind)
+  {
+    case fused::ParametricValueRange:
+      return createRangeSpecification<physics::ParametricValue>(fused::ParametricValueRange);
+    case fused::DistanceRange:
+      return createRangeSpecification<physics::Distance>(fused::DistanceRange);
+    case fused::LateralFluctuationMarginRange:
+      return createRangeSpecification<physics::Distance>(fused::LateralFluctuationMarginRange);
+    case fused::SpeedLonRange:
+      return createRangeSpecification<physics::Speed>(fused::SpeedLonRange);
+    case fused::SpeedLatRange:
+      return createRangeSpecification<physics::Speed>(fused::SpeedLatRange);
+    case fused::AccelerationRange:
+      return createRangeSpecification<physics::Acceleration>(fused::AccelerationRange);
+    case fused::NonNegativeAccelerationRange:
+      return createRangeSpecification<physics::Acceleration>(fused::NonNegativeAccelerationRange);
+    case fused::PositiveAccelerationRange:
+      return createRangeSpecification<physics::Acceleration>(fused::PositiveAccelerationRange);
+    case fused::ResponseTimeRange:
+      return createRangeSpecification<physics::Duration>(fused::ResponseTimeRange);
+    default:
+      throw std::out_of_range("invalid range kind"); // LCOV_EXCL_LINE: unreachable code
+  }
+}
+
+double getOrderPrecision(std::size_t const orderKind)
+{
+  switch (orderKind)
+  {
+    case ParametricValueOrder:
+      return physics::ParametricValue::cPrecisionValue;
+    case DistanceOrder:
+      return physics::Distance::cPrecisionValue;
+    case AccelerationOrder:
+      return physics::Acceleration::cPrecisionValue;
+    default:
+      throw std::out_of_range("invalid order kind"); // LCOV_EXCL_LINE: unreachable code
+  }
+}
+
+inline OrderKind getOrderKind(physics::ParametricValue const &)
+{
+  return ParametricValueOrder;
+}
+
+inline OrderKind getOrderKind(physics::Distance const &)
+{
+  return DistanceOrder;
+}
+
+inline OrderKind getOrderKind(physics::Acceleration const &)
+{
+  return AccelerationOrder;
+}
+
+/*
+ * Invalid values let the operators of the physics types throw, i.e. NaN, infinite and denormalized values or values
+ * outside of the range of the type are never within valid input range.
+ */
+inline bool isWithinRange(double const value,
+                          double const lowerBound,
+                          double const lowerBoundThreshold,
+                          double const upperBound,
+                          double const precision,
+                          double const typeMinimum,
+                          double const typeMaximum)
+{
+  double const absoluteValue = std::fabs(value);
+  return (typeMinimum <= value) & (value <= typeMaximum) & ((absoluteValue >= DBL_MIN) | !(absoluteValue > 0.))
+    & ((value - lowerBound) >= lowerBoundThreshold) & ((value - upperBound) < precision);
+}
+
+inline bool isWithinRange(double const value, RangeSpecification const &range)
+{
+  return isWithinRange(value,
+                       range.lowerBound,
+                       range.lowerBoundThreshold,
+                       range.upperBound,
+                       range.precision,
+                       range.typeMinimum,
+                       range.typeMaximum);
+}
+
+inline bool isOrdered(double const lower, double const upper, double const precision)
+{
+  return (lower - upper) < precision;
+}
+
+/*
+ * The range specifications of all kinds of range checks and the precisions of all kinds of order checks
+ */
+struct CheckSpecifications
+{
+  CheckSpecifications()
+  {
+    for (std::size_t rangeKind = 0u; rangeKind < fused::NumberOfRangeKinds; ++rangeKind)
+    {
+      range[rangeKind] = getRangeSpecification(rangeKind);
+    }
+    for (std::size_t orderKind = 0u; orderKind < NumberOfOrderKinds; ++orderKind)
+    {
+      orderPrecision[orderKind] = getOrderPrecision(orderKind);
+    }
+  }
+
+  RangeSpecification range[fused::NumberOfRangeKinds];
+  double orderPrecision[NumberOfOrderKinds];
+};
+
+/*
+ * Visitor evaluating the checks in place while traversing the world model. The failed checks are counted without
+ * branches and without any allocation.
+ */
+class CheckVisitor
+{
+public:
+  void enter(char const *)
+  {
+  }
+
+  void enter(char const *, std::size_t const)
+  {
+  }
+
+  void leave()
+  {
+  }
+
+  template <class PhysicsType> void checkRange(char const *, RangeKind const rangeKind, PhysicsType const &value)
+  {
+    mNumberOfFailedChecks += isWithinRange(static_cast<double>(value), mSpecifications.range[rangeKind]) ? 0u : 1u;
+  }
+
+  template <class PhysicsType> void checkOrder(char const *, PhysicsType const &lower, PhysicsType const &upper)
+  {
+    mNumberOfFailedChecks += isOrdered(static_cast<double>(lower),
+                                       static_cast<double>(upper),
+                                       mSpecifications.orderPrecision[getOrderKind(lower)])
+      ? 0u
+      : 1u;
+  }
+
+  void checkCondition(char const *, bool const condition)
+  {
+    mNumberOfFailedChecks += condition ? 0u : 1u;
+  }
+
+  bool areAllChecksPassed() const
+  {
+    return mNumberOfFailedChecks == 0u;
+  }
+
+private:
+  CheckSpecifications const mSpecifications;
+  std::size_t mNumberOfFailedChecks{0u};
+};
+
+/*
+ * Visitor locating the member of the first failed check
+ */
+class LocateVisitor
+{
+public:
+  void enter(char const *member)
+  {
+    mPath.push_back(member);
+  }
+
+  void enter(char const *member, std::size_t const index)
+  {
+    mPath.push_back(std::string(member) + "[" + std::to_string(index) + "]");
+  }
+
+  void leave()
+  {
+    mPath.pop_back();
+  }
+
+  template <class PhysicsType> void checkRange(char const *member, RangeKind const rangeKind, PhysicsType const &value)
+  {
+    locate(!isWithinRange(static_cast<double>(value), mSpecifications.range[rangeKind]), member);
+  }
+
+  template <class PhysicsType> void checkOrder(char const *member, PhysicsType const &lower, PhysicsType const &upper)
+  {
+    locate(!isOrdered(static_cast<double>(lower),
+                      static_cast<double>(upper),
+                      mSpecifications.orderPrecision[getOrderKind(lower)]),
+           member);
+  }
+
+  void checkCondition(char const *member, bool const condition)
+  {
+    locate(!condition, member);
+  }
+
+  std::string const &getInvalidMember() const
+  {
+    return mInvalidMember;
+  }
+
+private:
+  void locate(bool const failed, char const *member)
+  {
+    if (failed && mInvalidMember.empty())
+    {
+      for (auto const &pathElement : mPath)
+      {
+        append(pathElement);
+      }
+      append(member);
+    }
+  }
+
+  void append(std::string const &pathElement)
+  {
+    // array indices of unnamed elements are appended to the parent
+    if (!mInvalidMember.empty() && !pathElement.empty() && (pathElement[0] != '['))
+    {
+      mInvalidMember += ".";
+    }
+    mInvalidMember += pathElement;
+  }
+
+  CheckSpecifications const mSpecifications;
+  std::vector<std::string> mPath;
+  std::string mInvalidMember;
+};
+
+template <class Visitor>
+void visitParametricRange(Visitor &visitor, char const *member, physics::ParametricRange const &range)
+{
+  visitor.enter(member);
+  visitor.checkRange("minimum", fused::ParametricValueRange, range.minimum);
+  visitor.checkRange("maximum", fused::ParametricValueRange, range.maximum);
+  visitor.checkOrder("maximum", range.minimum, range.maximum);
+  visitor.leave();
+}
+
+template <class Visitor> void visitMetricRange(Visitor &visitor, char const *member, physics::MetricRange const &range)
+{
+  visitor.enter(member);
+  visitor.checkRange("minimum", fused::DistanceRange, range.minimum);
+  visitor.checkRange("maximum", fused::DistanceRange, range.maximum);
+  visitor.checkOrder("maximum", range.minimum, range.maximum);
+  visitor.leave();
+}
+
+template <class Visitor> void visitRssDynamics(Visitor &visitor, char const *member, RssDynamics const &dynamics)
+{
+  visitor.enter(member);
+  visitor.enter("alphaLon");
+  visitor.checkRange("accelMax", fused::NonNegativeAccelerationRange, dynamics.alphaLon.accelMax);
+  visitor.checkRange("brakeMax", fused::AccelerationRange, dynamics.alphaLon.brakeMax);
+  visitor.checkRange("brakeMin", fused::AccelerationRange, dynamics.alphaLon.brakeMin);
+  visitor.checkRange("brakeMinCorrect", fused::PositiveAccelerationRange, dynamics.alphaLon.brakeMinCorrect);
+  visitor.checkOrder("brakeMax", dynamics.alphaLon.brakeMin, dynamics.alphaLon.brakeMax);
+  visitor.checkOrder("brakeMin", dynamics.alphaLon.brakeMinCorrect, dynamics.alphaLon.brakeMin);
+  visitor.leave();
+  visitor.enter("alphaLat");
+  visitor.checkRange("accelMax", fused::NonNegativeAccelerationRange, dynamics.alphaLat.accelMax);
+  visitor.checkRange("brakeMin", fused::PositiveAccelerationRange, dynamics.alphaLat.brakeMin);
+  visitor.leave();
+  visitor.checkRange(
+    "lateralFluctuationMargin", fused::LateralFluctuationMarginRange, dynamics.lateralFluctuationMargin);
+  visitor.checkRange("responseTime", fused::ResponseTimeRange, dynamics.responseTime);
+  visitor.leave();
+}
+
+template <class Visitor> void visitObject(Visitor &visitor, char const *member, Object const &object)
+{
+  visitor.enter(member);
+  visitor.checkCondition("objectType", ::withinValidInputRange(object.objectType));
+  visitor.checkCondition("occupiedRegions", object.occupiedRegions.size() <= fused::cMaxNumberOfOccupiedRegions);
+  for (std::size_t i = 0u; i < object.occupiedRegions.size(); ++i)
+  {
+    visitor.enter("occupiedRegions", i);
+    visitParametricRange(visitor, "lonRange", object.occupiedRegions[i].lonRange);
+    visitParametricRange(visitor, "latRange", object.occupiedRegions[i].latRange);
+    visitor.leave();
+  }
+  visitor.enter("velocity");
+  visitor.checkRange("speedLon", fused::SpeedLonRange, object.velocity.speedLon);
+  visitor.checkRange("speedLat", fused::SpeedLatRange, object.velocity.speedLat);
+  visitor.leave();
+  visitor.leave();
+}
+
+template <class Visitor> void visitRoadArea(Visitor &visitor, char const *member, RoadArea const &roadArea)
+{
+  visitor.checkCondition(member, roadArea.size() <= fused::cMaxNumberOfRoadSegments);
+  for (std::size_t i = 0u; i < roadArea.size(); ++i)
+  {
+    visitor.enter(member, i);
+    RoadSegment const &roadSegment = roadArea[i];
+    visitor.checkCondition("", (fused::cMinNumberOfLaneSegments <= roadSegment.size())
+                             && (roadSegment.size() <= fused::cMaxNumberOfLaneSegments));
+    for (std::size_t j = 0u; j < roadSegment.size(); ++j)
+    {
+      visitor.enter("", j);
+      visitor.checkCondition("type", ::withinValidInputRange(roadSegment[j].type));
+      visitor.checkCondition("drivingDirection", ::withinValidInputRange(roadSegment[j].drivingDirection));
+      visitMetricRange(visitor, "length", roadSegment[j].length);
+      visitMetricRange(visitor, "width", roadSegment[j].width);
+      visitor.leave();
+    }
+    visitor.leave();
+  }
+}
+
+template <class Visitor> void visitWorldModel(Visitor &visitor, WorldModel const &worldModel)
+{
+  visitor.checkCondition("timeIndex", fused::cMinTimeIndex <= worldModel.timeIndex);
+  visitRssDynamics(visitor, "egoVehicleRssDynamics", worldModel.egoVehicleRssDynamics);
+  visitor.checkCondition("scenes", worldModel.scenes.size() <= fused::cMaxNumberOfScenes);
+  for (std::size_t i = 0u; i < worldModel.scenes.size(); ++i)
+  {
+    Scene const &scene = worldModel.scenes[i];
+    visitor.enter("scenes", i);
+    visitor.checkCondition("situationType", ::withinValidInputRange(scene.situationType));
+    visitObject(visitor, "egoVehicle", scene.egoVehicle);
+    visitObject(visitor, "object", scene.object);
+    visitRssDynamics(visitor, "objectRssDynamics", scene.objectRssDynamics);
+    visitRoadArea(visitor, "intersectingRoad", scene.intersectingRoad);
+    visitRoadArea(visitor, "egoVehicleRoad", scene.egoVehicleRoad);
+    visitor.leave();
+  }
+}
+
+bool checkInPlace(WorldModel const &worldModel)
+{
+  CheckVisitor visitor;
+  visitWorldModel(visitor, worldModel);
+  return visitor.areAllChecksPassed();
+}
+
+} // namespace
+
+} // namespace world
+} // namespace ad_rss
+
+bool withinValidInputRangeFused(::ad_rss::world::WorldModel const &input)
+{
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    return ::ad_rss::world::checkInPlace(input);
+  }
+  catch (...)
+  {
+    return false;
+  }
+}
+
+bool withinValidInputRangeFused(::ad_rss::world::WorldModel const &input, std::string &invalidMember)
+{
+  // global try catch block to ensure this library call doesn't throw an exception
+  try
+  {
+    invalidMember.clear();
+    if (::ad_rss::world::checkInPlace(input))
+    {
+      return true;
+    }
+
+    ::ad_rss::world::LocateVisitor visitor;
+    ::ad_rss::world::visitWorldModel(visitor, input);
+    invalidMember = visitor.getInvalidMember();
+  }
+  catch (...)
+  {
+  }
+  return false;
+}
@@ -0,0 +1,157 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "ad_rss/world/WorldModelView.hpp"
+#include "ad_rss/situation/SituationTypeValidInputRange.hpp"
+#include "ad_rss/world/LaneSegmentValidInputRange.hpp"
+#include "ad_rss/world/ObjectTypeValidInputRange.hpp"
+#include "ad_rss/world/OccupiedRegionValidInputRange.hpp"
+#include "ad_rss/world/RssDynamicsValidInputRange.hpp"
+#include "ad_rss/world/VelocityValidInputRange.hpp"
+
+namespace ad_rss {
+namespace world {
+
+ObjectView createObjectView(Object const &object)
+{
+  ObjectView objectView;
+  objectView.objectId = object.objectId;
+  objectView.objectType = object.objectType;
+  objectView.occupiedRegions = ArrayView<OccupiedRegion>(object.occupiedRegions);
+  objectView.velocity = object.velocity;
+  return objectView;
+}
+
+RoadAreaView createRoadAreaView(CompactRoadArea const &roadArea)
+{
+  RoadAreaView roadAreaView;
+  roadAreaView.laneSegments = ArrayView<LaneSegment>(roadArea.laneSegments);
+  roadAreaView.roadSegmentOffsets = ArrayView<std::size_t>(roadArea.roadSegmentOffsets);
+  return roadAreaView;
+}
+
+} // namespace world
+} // namespace ad_rss
+
+bool withinValidInputRange(::ad_rss::world::ObjectView const &input)
+{
+  try
+  {
+    // same restrictions as for ::ad_rss::world::Object
+    bool inValidInputRange = withinValidInputRange(input.objectType) && withinValidInputRange(input.velocity)
+      && (input.occupiedRegions.size() <= std::size_t(1000))
+      && ((input.occupiedRegions.data() != nullptr) || input.occupiedRegions.empty());
+    if (inValidInputRange)
+    {
+      for (auto const &occupiedRegion : input.occupiedRegions)
+      {
+        inValidInputRange = inValidInputRange && withinValidInputRange(occupiedRegion);
+      }
+    }
+    return inValidInputRange;
+  }
+  catch (std::out_of_range &)
+  {
+  }
+  return false;
+}
+
+bool withinValidInputRange(::ad_rss::world::RoadAreaView const &input)
+{
+  try
+  {
+    if (input.roadSegmentOffsets.empty())
+    {
+      // the empty road area
+      return input.laneSegments.empty();
+    }
+
+    // same restrictions as for ::ad_rss::world::RoadArea, plus the consistency of the offsets
+    std::size_t const numberOfRoadSegments = input.getNumberOfRoadSegments();
+    bool inValidInputRange = (numberOfRoadSegments <= std::size_t(50)) && (input.roadSegmentOffsets.data() != nullptr)
+      && (input.roadSegmentOffsets[0] == 0u)
+      && (input.roadSegmentOffsets[numberOfRoadSegments] == input.laneSegments.size())
+      && ((input.laneSegments.data() != nullptr) || input.laneSegments.empty());
+    for (std::size_t roadSegmentIndex = 0u; inValidInputRange && (roadSegmentIndex < numberOfRoadSegments);
+         roadSegmentIndex++)
+    {
+      // lane segment count of a road segment has to be in [1, 20]
+      inValidInputRange = (input.roadSegmentOffsets[roadSegmentIndex] < input.roadSegmentOffsets[roadSegmentIndex + 1u])
+        && (input.getNumberOfLaneSegments(roadSegmentIndex) <= std::size_t(20));
+    }
+    if (inValidInputRange)
+    {
+      for (auto const &laneSegment : input.laneSegments)
+      {
+        inValidInputRange = inValidInputRange && withinValidInputRange(laneSegment);
+      }
+    }
+    return inValidInputRange;
+  }
+  catch (std::out_of_range &)
+  {
+  }
+  return false;
+}
+
+bool withinValidInputRange(::ad_rss::world::SceneView const &input)
+{
+  try
+  {
+    return withinValidInputRange(input.situationType) && withinValidInputRange(input.egoVehicle)
+      && withinValidInputRange(input.object) && (input.objectRssDynamics != nullptr)
+      && withinValidInputRange(*input.objectRssDynamics) && withinValidInputRange(input.intersectingRoad)
+      && withinValidInputRange(input.egoVehicleRoad);
+  }
+  catch (std::out_of_range &)
+  {
+  }
+  return false;
+}
+
+bool withinValidInputRange(::ad_rss::world::WorldModelView const &input)
+{
+  try
+  {
+    bool inValidInputRange = withinValidInputRange(input.egoVehicleRssDynamics)
+      && (::ad_rss::physics::TimeIndex(1) <= input.timeIndex) && (input.scenes.size() <= std::size_t(1000))
+      && ((input.scenes.data() != nullptr) || input.scenes.empty());
+    for (auto const &scene : input.scenes)
+    {
+      inValidInputRange = inValidInputRange && withinValidInputRange(scene);
+    }
+    return inValidInputRange;
+  }
+  catch (std::out_of_range &)
+  {
+  }
+  return false;
+}
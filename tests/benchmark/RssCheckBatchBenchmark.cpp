@@ -0,0 +1,117 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <chrono>
+#include <iostream>
+#include "RssCheckTestBaseT.hpp"
+#include "ad_rss/core/RssCheckBatch.hpp"
+
+namespace ad_rss {
+namespace core {
+
+/*!
+ * @brief Scaling benchmark of the RssCheckBatch from 1 to 64 threads
+ *
+ * Not part of the regular test run; execute ad-rss-benchmark with a release build to get meaningful numbers.
+ */
+class RssCheckBatchBenchmark : public RssCheckTestBase
+{
+protected:
+  static const uint32_t cInstances = 256u;
+  static const uint32_t cCycles = 50u;
+
+  uint32_t getNumberOfSceneObjects() override
+  {
+    return 3u;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t objectIndex) override
+  {
+    switch (objectIndex)
+    {
+      case 0u:
+        return objectOnSegment7;
+      case 1u:
+        return objectOnSegment8;
+      case 2u:
+        return objectOnSegment6;
+      default:
+        throw std::out_of_range("Test setup out of range");
+    }
+  }
+
+  double measureBatch(std::size_t const numberOfThreads)
+  {
+    std::vector<world::WorldModel> worldModels(cInstances, worldModel);
+    std::vector<RssCheckBatchEntry> entries(cInstances);
+    for (uint32_t i = 0u; i < cInstances; i++)
+    {
+      entries[i].instanceId = i;
+      entries[i].worldModel = &worldModels[i];
+    }
+
+    RssCheckBatch batch(numberOfThreads);
+    std::vector<RssCheckBatchResult> results;
+    auto const start = std::chrono::steady_clock::now();
+    for (uint32_t cycle = 0u; cycle < cCycles; cycle++)
+    {
+      for (auto &instanceWorldModel : worldModels)
+      {
+        instanceWorldModel.timeIndex++;
+      }
+      EXPECT_TRUE(batch.calculateAccelerationRestrictions(entries, results));
+    }
+    auto const end = std::chrono::steady_clock::now();
+    for (auto const &result : results)
+    {
+      EXPECT_TRUE(result.isValid);
+    }
+    return static_cast<double>(cInstances * cCycles) / std::chrono::duration<double>(end - start).count();
+  }
+};
+
+TEST_F(RssCheckBatchBenchmark, Scaling)
+{
+  double singleThreadThroughput = 0.;
+  for (std::size_t numberOfThreads = 1u; numberOfThreads <= 64u; numberOfThreads *= 2u)
+  {
+    double const throughput = measureBatch(numberOfThreads);
+    if (numberOfThreads == 1u)
+    {
+      singleThreadThroughput = throughput;
+    }
+    std::cout << "RssCheckBatch " << numberOfThreads << " threads: " << throughput << " world models/s, speedup "
+              << throughput / singleThreadThroughput << std::endl;
+  }
+}
+
+} // namespace core
+} // namespace ad_rss
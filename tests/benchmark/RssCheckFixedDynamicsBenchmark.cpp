@@ -0,0 +1,140 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <chrono>
+#include <iostream>
+#include "RssCheckTestBaseT.hpp"
+#include "ad_rss/core/RssCheckFixedDynamics.hpp"
+
+namespace ad_rss {
+namespace core {
+
+/*!
+ * @brief Benchmark of the RssCheck specialized for fixed dynamics profiles against the runtime dynamics RssCheck
+ *
+ * Not part of the regular test run; execute ad-rss-benchmark with a release build to get meaningful numbers.
+ */
+class RssCheckFixedDynamicsBenchmark : public RssCheckTestBase
+{
+protected:
+  typedef RssCheckFixedDynamics<TestEgoRssDynamicsProfile, TestObjectRssDynamicsProfile> FixedDynamicsRssCheck;
+  typedef situation::RssFixedDynamicsFormulaProvider<TestEgoRssDynamicsProfile, TestObjectRssDynamicsProfile>
+    FixedDynamicsFormulaProvider;
+
+  static const uint32_t cIterations = 20000u;
+
+  uint32_t getNumberOfSceneObjects() override
+  {
+    return 3u;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t objectIndex) override
+  {
+    switch (objectIndex)
+    {
+      case 0u:
+        return objectOnSegment7;
+      case 1u:
+        return objectOnSegment8;
+      case 2u:
+        return objectOnSegment6;
+      default:
+        throw std::out_of_range("Test setup out of range");
+    }
+  }
+
+  template <class RssCheckType>
+  double measureRssCheck(RssCheckType &rssCheck, world::AccelerationRestriction &accelerationRestriction)
+  {
+    world::WorldModel benchmarkWorldModel = worldModel;
+    auto const start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0u; i < cIterations; i++)
+    {
+      benchmarkWorldModel.timeIndex++;
+      EXPECT_TRUE(rssCheck.calculateAccelerationRestriction(benchmarkWorldModel, accelerationRestriction));
+    }
+    auto const end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / cIterations;
+  }
+
+  double measureFormulaProvider(situation::RssFormulaProvider const &formulaProvider, double &safeDistanceSum)
+  {
+    situation::VehicleState leadingVehicle = createVehicleStateForLongitudinalMotion(10.);
+    situation::VehicleState followingVehicle = createVehicleStateForLongitudinalMotion(0.);
+    followingVehicle.dynamics = getEgoRssDynamics();
+    safeDistanceSum = 0.;
+    auto const start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0u; i < cIterations; i++)
+    {
+      followingVehicle.velocity.speedLon.maximum = Speed(static_cast<double>(i % 50u));
+      Distance safeDistance(0.);
+      bool isSafe = false;
+      EXPECT_TRUE(formulaProvider.checkSafeLongitudinalDistanceSameDirection(
+        leadingVehicle, followingVehicle, Distance(50.), safeDistance, isSafe));
+      safeDistanceSum += static_cast<double>(safeDistance);
+    }
+    auto const end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / cIterations;
+  }
+};
+
+TEST_F(RssCheckFixedDynamicsBenchmark, RssCheck)
+{
+  RssCheck runtimeRssCheck;
+  FixedDynamicsRssCheck fixedRssCheck;
+  world::AccelerationRestriction runtimeAccelerationRestriction;
+  world::AccelerationRestriction fixedAccelerationRestriction;
+
+  double const runtimeDuration = measureRssCheck(runtimeRssCheck, runtimeAccelerationRestriction);
+  double const fixedDuration = measureRssCheck(fixedRssCheck, fixedAccelerationRestriction);
+  EXPECT_EQ(runtimeAccelerationRestriction, fixedAccelerationRestriction);
+
+  std::cout << "RssCheck runtime dynamics:       " << runtimeDuration << " ns/call" << std::endl;
+  std::cout << "RssCheck fixed dynamics profile: " << fixedDuration << " ns/call" << std::endl;
+}
+
+TEST_F(RssCheckFixedDynamicsBenchmark, FormulaProvider)
+{
+  situation::RssFormulaProvider runtimeFormulaProvider;
+  FixedDynamicsFormulaProvider fixedFormulaProvider;
+  double runtimeSafeDistanceSum = 0.;
+  double fixedSafeDistanceSum = 0.;
+
+  double const runtimeDuration = measureFormulaProvider(runtimeFormulaProvider, runtimeSafeDistanceSum);
+  double const fixedDuration = measureFormulaProvider(fixedFormulaProvider, fixedSafeDistanceSum);
+  EXPECT_NEAR(runtimeSafeDistanceSum, fixedSafeDistanceSum, cDoubleNear);
+
+  std::cout << "Safe distance runtime dynamics:       " << runtimeDuration << " ns/call" << std::endl;
+  std::cout << "Safe distance fixed dynamics profile: " << fixedDuration << " ns/call" << std::endl;
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,114 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <chrono>
+#include <iostream>
+#include "TestSupport.hpp"
+#include "ad_rss/core/RssSituationChecking.hpp"
+#include "ad_rss/situation/RssMonteCarloEvaluation.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+/*!
+ * @brief Benchmark of the Monte Carlo evaluation against checking the samples one by one
+ *
+ * Not part of the regular test run; execute ad-rss-benchmark with a release build to get meaningful numbers.
+ */
+class RssMonteCarloBenchmark : public testing::Test
+{
+protected:
+  static const uint32_t cIterations = 100u;
+  static const uint32_t cNumberOfSamples = 10000u;
+
+  virtual void SetUp()
+  {
+    situationSnapshot.timeIndex = 1u;
+    Situation situation;
+    situation.situationId = 1u;
+    situation.objectId = 100u;
+    situation.situationType = SituationType::SameDirection;
+    situation.egoVehicleState = createVehicleState(60., 0.);
+    situation.egoVehicleState.dynamics = getEgoRssDynamics();
+    situation.otherVehicleState = createVehicleState(40., 1.);
+    situation.relativePosition = createRelativeLateralPosition(LateralRelativePosition::AtRight, Distance(1.));
+    situation.relativePosition.longitudinalPosition = LongitudinalRelativePosition::AtBack;
+    situation.relativePosition.longitudinalDistance = Distance(60.);
+    situationSnapshot.situations.push_back(situation);
+
+    parameters.numberOfSamples = cNumberOfSamples;
+    parameters.speedLonUncertainty = Speed(5.);
+    parameters.speedLatUncertainty = Speed(0.5);
+    parameters.responseTimeUncertainty = 0.2;
+    parameters.accelerationUncertainty = 0.2;
+    parameters.decelerationUncertainty = 0.2;
+  }
+
+  SituationSnapshot situationSnapshot;
+  MonteCarloParameters parameters;
+};
+
+TEST_F(RssMonteCarloBenchmark, SamplesPerSituation)
+{
+  std::vector<MonteCarloResult> monteCarloResults;
+  auto const start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0u; i < cIterations; i++)
+  {
+    parameters.seed = i;
+    EXPECT_TRUE(calculateDangerProbabilities(situationSnapshot, parameters, monteCarloResults));
+  }
+  auto const end = std::chrono::steady_clock::now();
+  double const monteCarloDuration = std::chrono::duration<double, std::micro>(end - start).count() / cIterations;
+
+  // the same number of evaluations by the situation checks, with the speed of the other vehicle varied
+  core::RssSituationChecking situationChecking;
+  Situation situation = situationSnapshot.situations.front();
+  uint32_t numberOfDangerousSamples = 0u;
+  auto const scalarStart = std::chrono::steady_clock::now();
+  for (uint32_t i = 0u; i < cNumberOfSamples; i++)
+  {
+    situation.otherVehicleState.velocity.speedLon.minimum = Speed(6. + 1e-3 * static_cast<double>(i));
+    situation.otherVehicleState.velocity.speedLon.maximum = situation.otherVehicleState.velocity.speedLon.minimum;
+    state::RssState rssState;
+    EXPECT_TRUE(situationChecking.checkSituation(situation, rssState));
+    numberOfDangerousSamples += rssState.longitudinalState.isSafe ? 0u : 1u;
+  }
+  auto const scalarEnd = std::chrono::steady_clock::now();
+  double const scalarDuration = std::chrono::duration<double, std::micro>(scalarEnd - scalarStart).count();
+
+  std::cout << "Monte Carlo " << cNumberOfSamples << " samples:      " << monteCarloDuration << " us/situation"
+            << std::endl;
+  std::cout << "Situation checks " << cNumberOfSamples << " samples: " << scalarDuration << " us/situation ("
+            << numberOfDangerousSamples << " dangerous)" << std::endl;
+}
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,104 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <chrono>
+#include <iostream>
+#include "TestSupport.hpp"
+#include "ad_rss/world/WorldModelFusedValidInputRange.hpp"
+#include "ad_rss/world/WorldModelValidInputRange.hpp"
+
+namespace ad_rss {
+namespace world {
+
+/*!
+ * @brief Benchmark of the fused input range check of a world model against the generated one
+ *
+ * Not part of the regular test run; execute ad-rss-benchmark with a release build to get meaningful numbers.
+ */
+class WorldModelFusedValidInputRangeBenchmark : public testing::Test
+{
+protected:
+  static const uint32_t cIterations = 100u;
+  static const uint32_t cNumberOfScenes = 1000u;
+
+  virtual void SetUp()
+  {
+    worldModel.timeIndex = 1u;
+    worldModel.egoVehicleRssDynamics = getEgoRssDynamics();
+    RoadArea roadArea;
+    for (uint32_t i = 0u; i < 5u; i++)
+    {
+      roadArea.push_back(longitudinalNoDifferenceRoadSegment());
+    }
+    for (uint32_t i = 0u; i < cNumberOfScenes; i++)
+    {
+      Scene scene;
+      scene.situationType = situation::SituationType::SameDirection;
+      scene.egoVehicle = objectAsEgo(createObject(10., 0.));
+      scene.object = createObject(10., 0.);
+      scene.object.objectId = i + 1u;
+      scene.objectRssDynamics = getObjectRssDynamics();
+      scene.egoVehicleRoad = roadArea;
+      worldModel.scenes.push_back(scene);
+    }
+  }
+
+  WorldModel worldModel;
+};
+
+TEST_F(WorldModelFusedValidInputRangeBenchmark, WorldModel)
+{
+  ASSERT_TRUE(withinValidInputRange(worldModel));
+
+  auto const start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0u; i < cIterations; i++)
+  {
+    EXPECT_TRUE(withinValidInputRange(worldModel));
+  }
+  auto const end = std::chrono::steady_clock::now();
+  double const generatedDuration = std::chrono::duration<double, std::micro>(end - start).count() / cIterations;
+
+  auto const fusedStart = std::chrono::steady_clock::now();
+  for (uint32_t i = 0u; i < cIterations; i++)
+  {
+    EXPECT_TRUE(withinValidInputRangeFused(worldModel));
+  }
+  auto const fusedEnd = std::chrono::steady_clock::now();
+  double const fusedDuration
+    = std::chrono::duration<double, std::micro>(fusedEnd - fusedStart).count() / cIterations;
+
+  std::cout << "Generated input range check " << cNumberOfScenes << " scenes: " << generatedDuration << " us"
+            << std::endl;
+  std::cout << "Fused input range check " << cNumberOfScenes << " scenes:     " << fusedDuration << " us" << std::endl;
+}
+
+} // namespace world
+} // namespace ad_rss
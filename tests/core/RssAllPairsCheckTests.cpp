@@ -0,0 +1,316 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <algorithm>
+#include "TestSupport.hpp"
+#include "ad_rss/core/RssAllPairsCheck.hpp"
+#include "ad_rss/state/RssStateOperation.hpp"
+
+namespace ad_rss {
+namespace core {
+
+class RssAllPairsCheckTests : public ::testing::Test
+{
+protected:
+  static constexpr std::size_t cNumberOfRoadSegments = 20u;
+  static constexpr double cRoadSegmentLength = 50.;
+
+  /*
+   * Each road segment has a lane in road direction and a lane against it.
+   */
+  world::RoadArea createRoadArea(std::size_t const numberOfRoadSegments, double const roadSegmentLength)
+  {
+    world::RoadArea roadArea;
+    for (std::size_t s = 0u; s < numberOfRoadSegments; ++s)
+    {
+      world::RoadSegment roadSegment;
+      for (std::size_t l = 0u; l < 2u; ++l)
+      {
+        world::LaneSegment laneSegment;
+        laneSegment.id = 10u * s + l + 1u;
+        laneSegment.type = world::LaneSegmentType::Normal;
+        laneSegment.drivingDirection
+          = (l == 0u) ? world::LaneDrivingDirection::Positive : world::LaneDrivingDirection::Negative;
+        laneSegment.length.minimum = Distance(roadSegmentLength);
+        laneSegment.length.maximum = Distance(roadSegmentLength);
+        laneSegment.width.minimum = Distance(3.5);
+        laneSegment.width.maximum = Distance(3.5);
+        roadSegment.push_back(laneSegment);
+      }
+      roadArea.push_back(roadSegment);
+    }
+    return roadArea;
+  }
+
+  RssAllPairsWorldModel createWorldModel(std::size_t const numberOfParticipants,
+                                         std::size_t const numberOfRoadSegments = cNumberOfRoadSegments,
+                                         double const roadSegmentLength = cRoadSegmentLength)
+  {
+    RssAllPairsWorldModel allPairsWorldModel;
+    allPairsWorldModel.timeIndex = 1u;
+    allPairsWorldModel.roadArea = createRoadArea(numberOfRoadSegments, roadSegmentLength);
+    for (std::size_t k = 0u; k < numberOfParticipants; ++k)
+    {
+      bool const drivesInRoadDirection = ((k % 3u) != 0u);
+      RssAllPairsParticipant participant;
+      participant.object = createObject(20. + static_cast<double>(k % 10u) * 5., (k % 4u == 1u) ? 0.5 : 0.);
+      participant.object.objectId = 1000u + k;
+      participant.rssDynamics = getObjectRssDynamics();
+      participant.drivesInRoadDirection = drivesInRoadDirection;
+
+      world::OccupiedRegion occupiedRegion;
+      std::size_t const roadSegment = (k * 7u) % numberOfRoadSegments;
+      occupiedRegion.segmentId = 10u * roadSegment + (drivesInRoadDirection ? 1u : 2u);
+      double const position = static_cast<double>((k * 13u) % 90u) / 100.;
+      occupiedRegion.lonRange.minimum = ParametricValue(position);
+      occupiedRegion.lonRange.maximum = ParametricValue(position + 5. / roadSegmentLength);
+      occupiedRegion.latRange.minimum = ParametricValue(0.2 + static_cast<double>(k % 3u) * 0.1);
+      occupiedRegion.latRange.maximum = ParametricValue(0.6 + static_cast<double>(k % 3u) * 0.1);
+      participant.object.occupiedRegions.push_back(occupiedRegion);
+      allPairsWorldModel.participants.push_back(participant);
+    }
+    return allPairsWorldModel;
+  }
+
+  /*
+   * The road area and the object viewed in the opposite direction of the road area.
+   */
+  world::RoadArea reverseRoadArea(world::RoadArea const &roadArea)
+  {
+    world::RoadArea reversedRoadArea(roadArea.rbegin(), roadArea.rend());
+    for (auto &roadSegment : reversedRoadArea)
+    {
+      std::reverse(roadSegment.begin(), roadSegment.end());
+      for (auto &laneSegment : roadSegment)
+      {
+        laneSegment.drivingDirection = (laneSegment.drivingDirection == world::LaneDrivingDirection::Positive)
+          ? world::LaneDrivingDirection::Negative
+          : world::LaneDrivingDirection::Positive;
+      }
+    }
+    return reversedRoadArea;
+  }
+
+  world::Object reverseObject(world::Object const &object)
+  {
+    world::Object reversedObject = object;
+    for (auto &occupiedRegion : reversedObject.occupiedRegions)
+    {
+      occupiedRegion.lonRange.minimum = ParametricValue(1.) - object.occupiedRegions[0].lonRange.maximum;
+      occupiedRegion.lonRange.maximum = ParametricValue(1.) - object.occupiedRegions[0].lonRange.minimum;
+      occupiedRegion.latRange.minimum = ParametricValue(1.) - object.occupiedRegions[0].latRange.maximum;
+      occupiedRegion.latRange.maximum = ParametricValue(1.) - object.occupiedRegions[0].latRange.minimum;
+    }
+    return reversedObject;
+  }
+
+  /*
+   * Evaluates a pair with the scene based RSS situation extraction and checking.
+   */
+  state::RssState checkPairByScene(RssAllPairsWorldModel const &allPairsWorldModel,
+                                   std::size_t const egoIndex,
+                                   std::size_t const otherIndex)
+  {
+    RssAllPairsParticipant const &ego = allPairsWorldModel.participants[egoIndex];
+    RssAllPairsParticipant const &other = allPairsWorldModel.participants[otherIndex];
+    world::WorldModel sceneWorldModel;
+    sceneWorldModel.timeIndex = allPairsWorldModel.timeIndex;
+    sceneWorldModel.egoVehicleRssDynamics = ego.rssDynamics;
+    world::Scene scene;
+    scene.situationType = (ego.drivesInRoadDirection == other.drivesInRoadDirection)
+      ? situation::SituationType::SameDirection
+      : situation::SituationType::OppositeDirection;
+    if (ego.drivesInRoadDirection)
+    {
+      scene.egoVehicle = objectAsEgo(ego.object);
+      scene.object = other.object;
+      scene.egoVehicleRoad = allPairsWorldModel.roadArea;
+    }
+    else
+    {
+      scene.egoVehicle = objectAsEgo(reverseObject(ego.object));
+      scene.object = reverseObject(other.object);
+      scene.egoVehicleRoad = reverseRoadArea(allPairsWorldModel.roadArea);
+    }
+    scene.objectRssDynamics = other.rssDynamics;
+    sceneWorldModel.scenes.push_back(scene);
+
+    RssSituationExtraction situationExtraction;
+    RssSituationChecking situationChecking;
+    situation::SituationSnapshot situationSnapshot;
+    state::RssStateSnapshot rssStateSnapshot;
+    EXPECT_TRUE(situationExtraction.extractSituations(sceneWorldModel, situationSnapshot));
+    EXPECT_TRUE(situationChecking.checkSituations(situationSnapshot, rssStateSnapshot));
+    EXPECT_EQ(rssStateSnapshot.individualResponses.size(), 1u);
+    return rssStateSnapshot.individualResponses.empty() ? state::RssState() : rssStateSnapshot.individualResponses[0];
+  }
+
+  void expectEqualIgnoringSituationId(state::RssState expected, state::RssState const &actual)
+  {
+    expected.situationId = actual.situationId;
+    EXPECT_EQ(expected, actual);
+  }
+};
+
+TEST_F(RssAllPairsCheckTests, IdenticalToSceneBasedEvaluation)
+{
+  RssAllPairsWorldModel const allPairsWorldModel = createWorldModel(60u);
+  RssAllPairsCheck allPairsCheck;
+  std::vector<RssAllPairsResult> pairResults;
+  ASSERT_TRUE(allPairsCheck.checkAllPairs(allPairsWorldModel, pairResults));
+  ASSERT_EQ(pairResults.size(), allPairsCheck.getNumberOfEvaluatedPairs());
+  EXPECT_EQ(allPairsCheck.getNumberOfEvaluatedPairs() + allPairsCheck.getNumberOfPrunedPairs(), 60u * 59u / 2u);
+  EXPECT_GT(allPairsCheck.getNumberOfPrunedPairs(), 0u);
+
+  std::size_t numberOfDangerousPairs = 0u;
+  std::size_t nextResult = 0u;
+  for (std::size_t i = 0u; i < allPairsWorldModel.participants.size(); ++i)
+  {
+    for (std::size_t j = i + 1u; j < allPairsWorldModel.participants.size(); ++j)
+    {
+      state::RssState const referenceRssState = checkPairByScene(allPairsWorldModel, i, j);
+      if ((nextResult < pairResults.size()) && (pairResults[nextResult].egoParticipant == i)
+          && (pairResults[nextResult].otherParticipant == j))
+      {
+        RssAllPairsResult const &pairResult = pairResults[nextResult];
+        EXPECT_EQ(pairResult.rssState.objectId, allPairsWorldModel.participants[j].object.objectId);
+        expectEqualIgnoringSituationId(referenceRssState, pairResult.rssState);
+        if (state::isDangerous(pairResult.rssState))
+        {
+          numberOfDangerousPairs++;
+        }
+        nextResult++;
+      }
+      else
+      {
+        // pruned pairs are longitudinally safe
+        EXPECT_TRUE(state::isLongitudinalSafe(referenceRssState)) << i << " " << j;
+        EXPECT_FALSE(state::isDangerous(referenceRssState));
+      }
+    }
+  }
+  EXPECT_EQ(nextResult, pairResults.size());
+  EXPECT_GT(numberOfDangerousPairs, 0u);
+}
+
+TEST_F(RssAllPairsCheckTests, ThreadsAndSituationIds)
+{
+  RssAllPairsWorldModel allPairsWorldModel = createWorldModel(200u);
+  RssAllPairsCheck singleThreadCheck(1u);
+  RssAllPairsCheck multiThreadCheck(4u);
+  std::vector<RssAllPairsResult> singleThreadResults;
+  std::vector<RssAllPairsResult> multiThreadResults;
+  ASSERT_TRUE(singleThreadCheck.checkAllPairs(allPairsWorldModel, singleThreadResults));
+  ASSERT_TRUE(multiThreadCheck.checkAllPairs(allPairsWorldModel, multiThreadResults));
+  ASSERT_EQ(singleThreadResults.size(), multiThreadResults.size());
+  for (std::size_t p = 0u; p < singleThreadResults.size(); ++p)
+  {
+    EXPECT_EQ(singleThreadResults[p].egoParticipant, multiThreadResults[p].egoParticipant);
+    EXPECT_EQ(singleThreadResults[p].otherParticipant, multiThreadResults[p].otherParticipant);
+    EXPECT_EQ(singleThreadResults[p].situationType, multiThreadResults[p].situationType);
+    EXPECT_EQ(singleThreadResults[p].rssState, multiThreadResults[p].rssState);
+  }
+
+  // the situation ids of the pairs are kept, even if the order of the participants changes
+  std::reverse(allPairsWorldModel.participants.begin(), allPairsWorldModel.participants.end());
+  allPairsWorldModel.timeIndex++;
+  std::vector<RssAllPairsResult> nextResults;
+  ASSERT_TRUE(singleThreadCheck.checkAllPairs(allPairsWorldModel, nextResults));
+  ASSERT_EQ(nextResults.size(), singleThreadResults.size());
+  std::size_t numberOfKeptSituationIds = 0u;
+  for (auto const &nextResult : nextResults)
+  {
+    for (auto const &previousResult : singleThreadResults)
+    {
+      if (previousResult.rssState.situationId == nextResult.rssState.situationId)
+      {
+        numberOfKeptSituationIds++;
+      }
+    }
+  }
+  EXPECT_EQ(numberOfKeptSituationIds, nextResults.size());
+}
+
+TEST_F(RssAllPairsCheckTests, ThousandsOfParticipants)
+{
+  std::size_t const cNumberOfParticipants = 3000u;
+  RssAllPairsWorldModel const allPairsWorldModel = createWorldModel(cNumberOfParticipants, 50u, 2000.);
+  RssAllPairsCheck allPairsCheck(0u);
+  std::vector<RssAllPairsResult> pairResults;
+  ASSERT_TRUE(allPairsCheck.checkAllPairs(allPairsWorldModel, pairResults));
+  std::size_t const numberOfPairs = cNumberOfParticipants * (cNumberOfParticipants - 1u) / 2u;
+  EXPECT_EQ(allPairsCheck.getNumberOfEvaluatedPairs() + allPairsCheck.getNumberOfPrunedPairs(), numberOfPairs);
+  EXPECT_LT(allPairsCheck.getNumberOfEvaluatedPairs() * 100u, numberOfPairs);
+}
+
+TEST_F(RssAllPairsCheckTests, InvalidInput)
+{
+  RssAllPairsCheck allPairsCheck;
+  std::vector<RssAllPairsResult> pairResults;
+  RssAllPairsWorldModel allPairsWorldModel = createWorldModel(10u);
+
+  allPairsWorldModel.timeIndex = 0u;
+  EXPECT_FALSE(allPairsCheck.checkAllPairs(allPairsWorldModel, pairResults));
+  allPairsWorldModel.timeIndex = 1u;
+  EXPECT_TRUE(allPairsCheck.checkAllPairs(allPairsWorldModel, pairResults));
+  EXPECT_FALSE(pairResults.empty());
+  // the time index has to increase
+  EXPECT_FALSE(allPairsCheck.checkAllPairs(allPairsWorldModel, pairResults));
+  EXPECT_TRUE(pairResults.empty());
+
+  RssAllPairsWorldModel invalidWorldModel = allPairsWorldModel;
+  invalidWorldModel.timeIndex = 2u;
+  invalidWorldModel.participants[3].object.objectId = invalidWorldModel.participants[5].object.objectId;
+  EXPECT_FALSE(allPairsCheck.checkAllPairs(invalidWorldModel, pairResults));
+
+  invalidWorldModel = allPairsWorldModel;
+  invalidWorldModel.timeIndex = 3u;
+  invalidWorldModel.participants[3].object.occupiedRegions[0].segmentId = 12345u;
+  EXPECT_FALSE(allPairsCheck.checkAllPairs(invalidWorldModel, pairResults));
+
+  invalidWorldModel = allPairsWorldModel;
+  invalidWorldModel.timeIndex = 4u;
+  invalidWorldModel.participants[3].rssDynamics.responseTime = Duration(-1.);
+  EXPECT_FALSE(allPairsCheck.checkAllPairs(invalidWorldModel, pairResults));
+
+  // empty and single participant areas
+  allPairsWorldModel.timeIndex = 5u;
+  allPairsWorldModel.participants.resize(1u);
+  EXPECT_TRUE(allPairsCheck.checkAllPairs(allPairsWorldModel, pairResults));
+  EXPECT_TRUE(pairResults.empty());
+  allPairsWorldModel.timeIndex = 6u;
+  allPairsWorldModel.participants.clear();
+  EXPECT_TRUE(allPairsCheck.checkAllPairs(allPairsWorldModel, pairResults));
+  EXPECT_EQ(allPairsCheck.getNumberOfPrunedPairs(), 0u);
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,265 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <atomic>
+#include "RssCheckTestBaseT.hpp"
+#include "ad_rss/core/RssCheckAsync.hpp"
+
+namespace ad_rss {
+namespace core {
+
+class RssCheckAsyncTests : public RssCheckTestBase
+{
+protected:
+  uint32_t getNumberOfSceneObjects() override
+  {
+    return 3u;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t objectIndex) override
+  {
+    switch (objectIndex)
+    {
+      case 0u:
+        return objectOnSegment7;
+      case 1u:
+        return objectOnSegment8;
+      case 2u:
+        return objectOnSegment6;
+      default:
+        throw std::out_of_range("Test setup out of range");
+    }
+  }
+
+  std::vector<world::WorldModel> createWorldModels(uint32_t const numberOfWorldModels)
+  {
+    std::vector<world::WorldModel> worldModels;
+    for (uint32_t i = 0; i < numberOfWorldModels; i++)
+    {
+      for (auto &scene : worldModel.scenes)
+      {
+        scene.egoVehicle.occupiedRegions[0].lonRange.minimum = ParametricValue(0.01 * (i % 90u));
+        scene.egoVehicle.occupiedRegions[0].lonRange.maximum = ParametricValue(0.01 * (i % 90u) + 0.1);
+      }
+      worldModel.timeIndex++;
+      worldModels.push_back(worldModel);
+    }
+    return worldModels;
+  }
+};
+
+TEST_F(RssCheckAsyncTests, IdenticalResultsToRssCheck)
+{
+  std::vector<world::WorldModel> const worldModels = createWorldModels(100u);
+  RssCheck rssCheck;
+  RssCheckAsync rssCheckAsync;
+
+  std::vector<std::future<RssCheckAsync::Result>> results(worldModels.size());
+  for (size_t i = 0u; i < worldModels.size(); i++)
+  {
+    ASSERT_TRUE(rssCheckAsync.submit(worldModels[i], results[i]));
+  }
+
+  for (size_t i = 0u; i < worldModels.size(); i++)
+  {
+    world::AccelerationRestriction accelerationRestriction;
+    state::ProperResponse properResponse;
+    ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(worldModels[i], accelerationRestriction, properResponse));
+
+    RssCheckAsync::Result const result = results[i].get();
+    ASSERT_EQ(result.status, RssCheckAsync::ResultStatus::Success);
+    EXPECT_EQ(result.checkResult.timeIndex, worldModels[i].timeIndex);
+    EXPECT_EQ(result.checkResult.accelerationRestriction, accelerationRestriction);
+    EXPECT_EQ(result.checkResult.properResponse, properResponse);
+  }
+  EXPECT_EQ(rssCheckAsync.getNumberOfDroppedWorldModels(), 0u);
+}
+
+TEST_F(RssCheckAsyncTests, StagesIdenticalToRssCheck)
+{
+  std::vector<world::WorldModel> const worldModels = createWorldModels(10u);
+  RssCheck rssCheck;
+  RssCheck stagedRssCheck;
+  RssCycleState cycleState;
+
+  for (auto const &stagedWorldModel : worldModels)
+  {
+    world::AccelerationRestriction accelerationRestriction;
+    state::ProperResponse properResponse;
+    ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(stagedWorldModel, accelerationRestriction, properResponse));
+
+    situation::SituationSnapshot situationSnapshot;
+    world::AccelerationRestriction stagedAccelerationRestriction;
+    state::ProperResponse stagedProperResponse;
+    ASSERT_TRUE(stagedRssCheck.extractSituationSnapshot(stagedWorldModel, cycleState, situationSnapshot));
+    ASSERT_TRUE(stagedRssCheck.checkSituationSnapshot(situationSnapshot,
+                                                      stagedWorldModel.egoVehicleRssDynamics,
+                                                      cycleState,
+                                                      stagedAccelerationRestriction,
+                                                      stagedProperResponse));
+    EXPECT_EQ(stagedAccelerationRestriction, accelerationRestriction);
+    EXPECT_EQ(stagedProperResponse, properResponse);
+  }
+  EXPECT_EQ(cycleState.situationIdState.nextSituationId, rssCheck.getCycleState().situationIdState.nextSituationId);
+  EXPECT_EQ(cycleState.responseResolvingState.statesBeforeDangerThresholdTime.size(),
+            rssCheck.getCycleState().responseResolvingState.statesBeforeDangerThresholdTime.size());
+}
+
+TEST_F(RssCheckAsyncTests, ResultCallback)
+{
+  std::vector<world::WorldModel> const worldModels = createWorldModels(20u);
+  RssCheckAsync rssCheckAsync(2u, RssCheckAsync::BackpressurePolicy::Block);
+  EXPECT_EQ(rssCheckAsync.getBackpressurePolicy(), RssCheckAsync::BackpressurePolicy::Block);
+
+  std::vector<physics::TimeIndex> resultTimeIndices;
+  for (auto const &submittedWorldModel : worldModels)
+  {
+    ASSERT_TRUE(rssCheckAsync.submit(submittedWorldModel, [&resultTimeIndices](RssCheckAsync::Result const &result) {
+      EXPECT_EQ(result.status, RssCheckAsync::ResultStatus::Success);
+      resultTimeIndices.push_back(result.checkResult.timeIndex);
+    }));
+  }
+  rssCheckAsync.waitUntilIdle();
+
+  // results are provided in submission order
+  ASSERT_EQ(resultTimeIndices.size(), worldModels.size());
+  for (size_t i = 0u; i < worldModels.size(); i++)
+  {
+    EXPECT_EQ(resultTimeIndices[i], worldModels[i].timeIndex);
+  }
+}
+
+TEST_F(RssCheckAsyncTests, InvalidWorldModel)
+{
+  std::vector<world::WorldModel> worldModels = createWorldModels(3u);
+  worldModels[1].timeIndex = worldModels[0].timeIndex;
+  worldModels[2].egoVehicleRssDynamics.responseTime = Duration(-1.);
+  RssCheckAsync rssCheckAsync;
+
+  std::vector<std::future<RssCheckAsync::Result>> results(worldModels.size());
+  for (size_t i = 0u; i < worldModels.size(); i++)
+  {
+    ASSERT_TRUE(rssCheckAsync.submit(worldModels[i], results[i]));
+  }
+  EXPECT_EQ(results[0].get().status, RssCheckAsync::ResultStatus::Success);
+  EXPECT_EQ(results[1].get().status, RssCheckAsync::ResultStatus::Failed);
+  EXPECT_EQ(results[2].get().status, RssCheckAsync::ResultStatus::Failed);
+}
+
+TEST_F(RssCheckAsyncTests, DropOldest)
+{
+  std::vector<world::WorldModel> const worldModels = createWorldModels(10u);
+  RssCheckAsync rssCheckAsync(1u, RssCheckAsync::BackpressurePolicy::DropOldest);
+
+  // block the checking of the first world model to fill the pipeline
+  std::atomic<bool> started(false);
+  std::atomic<bool> released(false);
+  ASSERT_TRUE(rssCheckAsync.submit(worldModels[0], [&started, &released](RssCheckAsync::Result const &) {
+    started = true;
+    while (!released)
+    {
+      std::this_thread::yield();
+    }
+  }));
+  while (!started)
+  {
+    std::this_thread::yield();
+  }
+
+  std::vector<std::future<RssCheckAsync::Result>> results(worldModels.size());
+  for (size_t i = 1u; i < worldModels.size(); i++)
+  {
+    ASSERT_TRUE(rssCheckAsync.submit(worldModels[i], results[i]));
+  }
+  released = true;
+  rssCheckAsync.waitUntilIdle();
+
+  // at most four world models are in the pipeline: checked, extracted, in extraction and queued
+  size_t droppedResults = 0u;
+  physics::TimeIndex lastTimeIndex = worldModels[0].timeIndex;
+  for (size_t i = 1u; i < worldModels.size(); i++)
+  {
+    RssCheckAsync::Result const result = results[i].get();
+    if (result.status == RssCheckAsync::ResultStatus::Dropped)
+    {
+      droppedResults++;
+    }
+    else
+    {
+      ASSERT_EQ(result.status, RssCheckAsync::ResultStatus::Success);
+      EXPECT_GT(result.checkResult.timeIndex, lastTimeIndex);
+      lastTimeIndex = result.checkResult.timeIndex;
+    }
+  }
+  EXPECT_GE(droppedResults, 6u);
+  EXPECT_EQ(rssCheckAsync.getNumberOfDroppedWorldModels(), droppedResults);
+  EXPECT_EQ(lastTimeIndex, worldModels.back().timeIndex);
+}
+
+TEST_F(RssCheckAsyncTests, Stop)
+{
+  std::vector<world::WorldModel> const worldModels = createWorldModels(20u);
+  std::vector<std::future<RssCheckAsync::Result>> results(worldModels.size());
+  {
+    RssCheckAsync rssCheckAsync(worldModels.size());
+    for (size_t i = 0u; i < worldModels.size(); i++)
+    {
+      ASSERT_TRUE(rssCheckAsync.submit(worldModels[i], results[i]));
+    }
+    rssCheckAsync.stop();
+
+    std::future<RssCheckAsync::Result> rejectedResult;
+    EXPECT_FALSE(rssCheckAsync.submit(worldModels[0], rejectedResult));
+    EXPECT_FALSE(rejectedResult.valid());
+  }
+
+  // all results are provided, the processing stops in submission order
+  bool stopped = false;
+  for (auto &result : results)
+  {
+    RssCheckAsync::ResultStatus const status = result.get().status;
+    if (stopped)
+    {
+      EXPECT_EQ(status, RssCheckAsync::ResultStatus::Stopped);
+    }
+    else if (status == RssCheckAsync::ResultStatus::Stopped)
+    {
+      stopped = true;
+    }
+    else
+    {
+      EXPECT_EQ(status, RssCheckAsync::ResultStatus::Success);
+    }
+  }
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,176 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckTestBaseT.hpp"
+#include "ad_rss/core/RssCheckBatch.hpp"
+
+namespace ad_rss {
+namespace core {
+
+class RssCheckBatchTests : public RssCheckTestBase
+{
+protected:
+  uint32_t getNumberOfSceneObjects() override
+  {
+    return 3u;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t objectIndex) override
+  {
+    switch (objectIndex)
+    {
+      case 0u:
+        return objectOnSegment7;
+      case 1u:
+        return objectOnSegment8;
+      case 2u:
+        return objectOnSegment6;
+      default:
+        throw std::out_of_range("Test setup out of range");
+    }
+  }
+
+  /*
+   * The ego vehicle of each instance approaches the objects with a different speed.
+   */
+  world::WorldModel createWorldModel(std::uint64_t const instanceId, uint32_t const cycle)
+  {
+    world::WorldModel instanceWorldModel = worldModel;
+    instanceWorldModel.timeIndex = cycle + 1u;
+    double const position = 0.02 * static_cast<double>(cycle * (instanceId % 5u));
+    for (auto &scene : instanceWorldModel.scenes)
+    {
+      scene.egoVehicle.occupiedRegions[0].lonRange.minimum = ParametricValue(std::min(position, 0.9));
+      scene.egoVehicle.occupiedRegions[0].lonRange.maximum = ParametricValue(std::min(position + 0.1, 1.0));
+    }
+    return instanceWorldModel;
+  }
+
+  void performBatches(std::size_t const numberOfThreads)
+  {
+    std::size_t const cNumberOfInstances = 17u;
+    RssCheckBatch batch(numberOfThreads);
+    EXPECT_EQ(batch.getNumberOfThreads(), numberOfThreads);
+    std::vector<RssCheck> referenceRssChecks(cNumberOfInstances);
+
+    for (uint32_t cycle = 0u; cycle < 20u; ++cycle)
+    {
+      std::vector<world::WorldModel> worldModels;
+      std::vector<RssCheckBatchEntry> entries;
+      for (std::size_t i = 0u; i < cNumberOfInstances; ++i)
+      {
+        // the order of the instances changes every cycle
+        std::uint64_t const instanceId = 100u + (i + cycle) % cNumberOfInstances;
+        worldModels.push_back(createWorldModel(instanceId, cycle));
+      }
+      for (std::size_t i = 0u; i < cNumberOfInstances; ++i)
+      {
+        RssCheckBatchEntry entry;
+        entry.instanceId = 100u + (i + cycle) % cNumberOfInstances;
+        entry.worldModel = &worldModels[i];
+        entries.push_back(entry);
+      }
+
+      std::vector<RssCheckBatchResult> results;
+      ASSERT_TRUE(batch.calculateAccelerationRestrictions(entries, results));
+      ASSERT_EQ(results.size(), entries.size());
+      for (std::size_t i = 0u; i < entries.size(); ++i)
+      {
+        RssCheck &referenceRssCheck = referenceRssChecks[entries[i].instanceId - 100u];
+        world::AccelerationRestriction accelerationRestriction;
+        state::ProperResponse properResponse;
+        ASSERT_TRUE(referenceRssCheck.calculateAccelerationRestriction(
+          worldModels[i], accelerationRestriction, properResponse));
+        EXPECT_TRUE(results[i].isValid);
+        EXPECT_EQ(results[i].accelerationRestriction, accelerationRestriction);
+        EXPECT_EQ(results[i].properResponse, properResponse);
+      }
+    }
+    EXPECT_EQ(batch.getNumberOfInstances(), cNumberOfInstances);
+  }
+};
+
+TEST_F(RssCheckBatchTests, SingleThread)
+{
+  performBatches(1u);
+}
+
+TEST_F(RssCheckBatchTests, MultipleThreads)
+{
+  performBatches(4u);
+}
+
+TEST_F(RssCheckBatchTests, MoreThreadsThanEntries)
+{
+  performBatches(32u);
+}
+
+TEST_F(RssCheckBatchTests, InvalidEntries)
+{
+  RssCheckBatch batch(2u);
+  EXPECT_GE(batch.getNumberOfThreads(), 1u);
+  std::vector<RssCheckBatchResult> results;
+  EXPECT_TRUE(batch.calculateAccelerationRestrictions(std::vector<RssCheckBatchEntry>(), results));
+  EXPECT_TRUE(results.empty());
+
+  world::WorldModel invalidWorldModel = worldModel;
+  invalidWorldModel.egoVehicleRssDynamics.responseTime = Duration(-1.);
+  std::vector<RssCheckBatchEntry> entries(3u);
+  entries[0].instanceId = 1u;
+  entries[0].worldModel = &worldModel;
+  entries[1].instanceId = 2u;
+  entries[1].worldModel = &invalidWorldModel;
+  entries[2].instanceId = 3u;
+  entries[2].worldModel = &worldModel;
+
+  // an invalid world model only affects its own entry
+  ASSERT_TRUE(batch.calculateAccelerationRestrictions(entries, results));
+  ASSERT_EQ(results.size(), 3u);
+  EXPECT_TRUE(results[0].isValid);
+  EXPECT_FALSE(results[1].isValid);
+  EXPECT_TRUE(results[2].isValid);
+  EXPECT_EQ(batch.getNumberOfInstances(), 3u);
+
+  // duplicate instance ids and missing world models are rejected
+  entries[2].instanceId = 1u;
+  EXPECT_FALSE(batch.calculateAccelerationRestrictions(entries, results));
+  entries[2].instanceId = 4u;
+  entries[2].worldModel = nullptr;
+  EXPECT_FALSE(batch.calculateAccelerationRestrictions(entries, results));
+  EXPECT_EQ(batch.getNumberOfInstances(), 3u);
+
+  EXPECT_TRUE(batch.removeInstance(2u));
+  EXPECT_FALSE(batch.removeInstance(2u));
+  EXPECT_EQ(batch.getNumberOfInstances(), 2u);
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,204 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckTestBaseT.hpp"
+
+namespace ad_rss {
+namespace core {
+
+template <class TESTBASE> class RssCheckBudgetTestBase : public TESTBASE
+{
+protected:
+  using TESTBASE::worldModel;
+
+  void performBudgetComparison()
+  {
+    RssCheck stagedRssCheck(RssCheck::ExecutionMode::Staged);
+    RssCheck budgetRssCheck;
+
+    for (uint32_t i = 0; i <= 90; i++)
+    {
+      for (auto &scene : worldModel.scenes)
+      {
+        scene.egoVehicle.occupiedRegions[0].lonRange.minimum = ParametricValue(0.01 * i);
+        scene.egoVehicle.occupiedRegions[0].lonRange.maximum = ParametricValue(0.01 * i + 0.1);
+      }
+      worldModel.timeIndex++;
+
+      world::AccelerationRestriction stagedAccelerationRestriction;
+      state::ProperResponse stagedProperResponse;
+      situation::SituationSnapshot stagedSituationSnapshot;
+      bool const stagedResult = stagedRssCheck.calculateAccelerationRestriction(
+        worldModel, stagedAccelerationRestriction, stagedProperResponse, &stagedSituationSnapshot);
+
+      world::AccelerationRestriction budgetAccelerationRestriction;
+      state::ProperResponse budgetProperResponse;
+      RssCheck::BudgetStatistics budgetStatistics;
+      bool const budgetResult = budgetRssCheck.calculateAccelerationRestrictionWithinBudget(
+        worldModel, std::chrono::hours(1), budgetAccelerationRestriction, budgetProperResponse, budgetStatistics);
+
+      ASSERT_TRUE(stagedResult);
+      ASSERT_TRUE(budgetResult);
+      EXPECT_FALSE(budgetStatistics.isPartial);
+      EXPECT_EQ(budgetStatistics.evaluatedSituations, stagedSituationSnapshot.situations.size());
+      EXPECT_EQ(budgetStatistics.skippedSituations, 0u);
+      EXPECT_EQ(stagedProperResponse, budgetProperResponse);
+      EXPECT_EQ(stagedAccelerationRestriction, budgetAccelerationRestriction);
+    }
+  }
+};
+
+class RssCheckBudgetSameDirectionTests : public RssCheckBudgetTestBase<RssCheckTestBase>
+{
+protected:
+  uint32_t getNumberOfSceneObjects() override
+  {
+    return 3u;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t objectIndex) override
+  {
+    switch (objectIndex)
+    {
+      case 0u:
+        return objectOnSegment7;
+      case 1u:
+        return objectOnSegment8;
+      case 2u:
+        return objectOnSegment6;
+      default:
+        throw std::out_of_range("Test setup out of range");
+    }
+  }
+};
+
+TEST_F(RssCheckBudgetSameDirectionTests, IdenticalResultsWithinBudget)
+{
+  performBudgetComparison();
+}
+
+TEST_F(RssCheckBudgetSameDirectionTests, BudgetExceeded)
+{
+  RssCheck rssCheck;
+  ASSERT_EQ(rssCheck.getSkippedSituationPolicy(), RssCheck::SkippedSituationPolicy::BrakeMin);
+
+  world::AccelerationRestriction accelerationRestriction;
+  state::ProperResponse properResponse;
+  RssCheck::BudgetStatistics budgetStatistics;
+  std::chrono::steady_clock::duration const noBudget = std::chrono::steady_clock::duration::zero();
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestrictionWithinBudget(
+    worldModel, noBudget, accelerationRestriction, properResponse, budgetStatistics));
+
+  EXPECT_TRUE(budgetStatistics.isPartial);
+  EXPECT_EQ(budgetStatistics.evaluatedSituations, 0u);
+  EXPECT_EQ(budgetStatistics.skippedSituations, 3u);
+  EXPECT_FALSE(properResponse.isSafe);
+  EXPECT_EQ(properResponse.dangerousObjects.size(), 3u);
+  EXPECT_EQ(properResponse.longitudinalResponse, state::LongitudinalResponse::BrakeMin);
+  EXPECT_EQ(properResponse.lateralResponseLeft, state::LateralResponse::BrakeMin);
+  EXPECT_EQ(properResponse.lateralResponseRight, state::LateralResponse::BrakeMin);
+
+  rssCheck.setSkippedSituationPolicy(RssCheck::SkippedSituationPolicy::LongitudinalBrakeMin);
+  ASSERT_EQ(rssCheck.getSkippedSituationPolicy(), RssCheck::SkippedSituationPolicy::LongitudinalBrakeMin);
+  worldModel.timeIndex++;
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestrictionWithinBudget(
+    worldModel, noBudget, accelerationRestriction, properResponse, budgetStatistics));
+
+  EXPECT_TRUE(budgetStatistics.isPartial);
+  EXPECT_FALSE(properResponse.isSafe);
+  EXPECT_EQ(properResponse.longitudinalResponse, state::LongitudinalResponse::BrakeMin);
+  EXPECT_EQ(properResponse.lateralResponseLeft, state::LateralResponse::None);
+  EXPECT_EQ(properResponse.lateralResponseRight, state::LateralResponse::None);
+}
+
+TEST_F(RssCheckBudgetSameDirectionTests, InvalidWorldModel)
+{
+  RssCheck rssCheck;
+  world::AccelerationRestriction accelerationRestriction;
+  state::ProperResponse properResponse;
+  RssCheck::BudgetStatistics budgetStatistics;
+
+  budgetStatistics.isPartial = true;
+  budgetStatistics.evaluatedSituations = 1u;
+  budgetStatistics.skippedSituations = 2u;
+  worldModel.timeIndex = 0u;
+  ASSERT_FALSE(rssCheck.calculateAccelerationRestrictionWithinBudget(
+    worldModel, std::chrono::hours(1), accelerationRestriction, properResponse, budgetStatistics));
+  EXPECT_FALSE(budgetStatistics.isPartial);
+  EXPECT_EQ(budgetStatistics.evaluatedSituations, 0u);
+  EXPECT_EQ(budgetStatistics.skippedSituations, 0u);
+}
+
+TEST_F(RssCheckBudgetSameDirectionTests, FailureAfterPartialCalculation)
+{
+  RssCheck rssCheck;
+  world::AccelerationRestriction accelerationRestriction;
+  state::ProperResponse properResponse;
+  RssCheck::BudgetStatistics budgetStatistics;
+  std::chrono::steady_clock::duration const noBudget = std::chrono::steady_clock::duration::zero();
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestrictionWithinBudget(
+    worldModel, noBudget, accelerationRestriction, properResponse, budgetStatistics));
+  ASSERT_TRUE(budgetStatistics.isPartial);
+
+  // the time index has to increase
+  ASSERT_FALSE(rssCheck.calculateAccelerationRestrictionWithinBudget(
+    worldModel, noBudget, accelerationRestriction, properResponse, budgetStatistics));
+  EXPECT_FALSE(budgetStatistics.isPartial);
+  EXPECT_EQ(budgetStatistics.evaluatedSituations, 0u);
+  EXPECT_EQ(budgetStatistics.skippedSituations, 0u);
+}
+
+class RssCheckBudgetIntersectionTests : public RssCheckBudgetTestBase<RssCheckTestBase>
+{
+protected:
+  situation::SituationType getSituationType() override
+  {
+    return situation::SituationType::IntersectionSamePriority;
+  }
+
+  ::ad_rss::world::Object &getEgoObject() override
+  {
+    return objectOnSegment0;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t) override
+  {
+    return objectOnSegment8;
+  }
+};
+
+TEST_F(RssCheckBudgetIntersectionTests, IdenticalResultsWithinBudget)
+{
+  performBudgetComparison();
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,184 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckTestBaseT.hpp"
+
+namespace ad_rss {
+namespace core {
+
+class RssCheckCycleStateTests : public RssCheckTestBase
+{
+protected:
+  uint32_t getNumberOfSceneObjects() override
+  {
+    return 3u;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t objectIndex) override
+  {
+    switch (objectIndex)
+    {
+      case 0u:
+        return objectOnSegment7;
+      case 1u:
+        return objectOnSegment8;
+      case 2u:
+        return objectOnSegment6;
+      default:
+        throw std::out_of_range("Test setup out of range");
+    }
+  }
+
+  void moveEgoVehicle(uint32_t i)
+  {
+    for (auto &scene : worldModel.scenes)
+    {
+      scene.egoVehicle.occupiedRegions[0].lonRange.minimum = ParametricValue(0.01 * i);
+      scene.egoVehicle.occupiedRegions[0].lonRange.maximum = ParametricValue(0.01 * i + 0.1);
+    }
+    worldModel.timeIndex++;
+  }
+
+  void performCycleStateComparison(RssCheck::ExecutionMode const executionMode)
+  {
+    RssCheck statefulRssCheck(executionMode);
+    RssCheck const reentrantRssCheck(executionMode);
+    RssCycleState cycleState;
+
+    for (uint32_t i = 0; i <= 90; i++)
+    {
+      moveEgoVehicle(i);
+
+      world::AccelerationRestriction statefulAccelerationRestriction;
+      state::ProperResponse statefulProperResponse;
+      bool const statefulResult = statefulRssCheck.calculateAccelerationRestriction(
+        worldModel, statefulAccelerationRestriction, statefulProperResponse);
+
+      world::AccelerationRestriction reentrantAccelerationRestriction;
+      state::ProperResponse reentrantProperResponse;
+      bool const reentrantResult = reentrantRssCheck.calculateAccelerationRestriction(
+        worldModel, cycleState, cycleState, reentrantAccelerationRestriction, reentrantProperResponse);
+
+      ASSERT_TRUE(statefulResult);
+      ASSERT_TRUE(reentrantResult);
+      EXPECT_EQ(statefulProperResponse, reentrantProperResponse);
+      EXPECT_EQ(statefulAccelerationRestriction, reentrantAccelerationRestriction);
+    }
+  }
+};
+
+TEST_F(RssCheckCycleStateTests, StagedIdenticalResults)
+{
+  performCycleStateComparison(RssCheck::ExecutionMode::Staged);
+}
+
+TEST_F(RssCheckCycleStateTests, FusedIdenticalResults)
+{
+  performCycleStateComparison(RssCheck::ExecutionMode::Fused);
+}
+
+TEST_F(RssCheckCycleStateTests, ForkedCycleStatesContinueIdentically)
+{
+  RssCheck rssCheck;
+  world::AccelerationRestriction accelerationRestriction;
+  state::ProperResponse properResponse;
+  for (uint32_t i = 0; i <= 40; i++)
+  {
+    moveEgoVehicle(i);
+    ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction, properResponse));
+  }
+
+  RssCycleState const forkedCycleState = rssCheck.getCycleState();
+  RssCycleState firstCycleState;
+  RssCycleState secondCycleState;
+  for (uint32_t i = 41; i <= 90; i++)
+  {
+    moveEgoVehicle(i);
+
+    world::AccelerationRestriction firstAccelerationRestriction;
+    state::ProperResponse firstProperResponse;
+    ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(worldModel,
+                                                          (i == 41u) ? forkedCycleState : firstCycleState,
+                                                          firstCycleState,
+                                                          firstAccelerationRestriction,
+                                                          firstProperResponse));
+
+    world::AccelerationRestriction secondAccelerationRestriction;
+    state::ProperResponse secondProperResponse;
+    ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(worldModel,
+                                                          (i == 41u) ? forkedCycleState : secondCycleState,
+                                                          secondCycleState,
+                                                          secondAccelerationRestriction,
+                                                          secondProperResponse));
+
+    ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction, properResponse));
+
+    EXPECT_EQ(firstProperResponse, secondProperResponse);
+    EXPECT_EQ(firstAccelerationRestriction, secondAccelerationRestriction);
+    EXPECT_EQ(properResponse, firstProperResponse);
+    EXPECT_EQ(accelerationRestriction, firstAccelerationRestriction);
+  }
+}
+
+TEST_F(RssCheckCycleStateTests, InputCycleStateIsNotModified)
+{
+  RssCheck rssCheck;
+  RssCycleState const initialCycleState;
+  RssCycleState nextCycleState;
+  world::AccelerationRestriction firstAccelerationRestriction;
+  state::ProperResponse firstProperResponse;
+  moveEgoVehicle(0u);
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(
+    worldModel, initialCycleState, nextCycleState, firstAccelerationRestriction, firstProperResponse));
+  EXPECT_TRUE(initialCycleState.situationIdState.situationData.empty());
+  EXPECT_FALSE(nextCycleState.situationIdState.situationData.empty());
+  EXPECT_EQ(nextCycleState.situationIdState.currentTime, worldModel.timeIndex);
+
+  // the stateful interface is not affected by the re-entrant calls
+  EXPECT_TRUE(rssCheck.getCycleState().situationIdState.situationData.empty());
+
+  // repeating the call with the same input cycle state provides the same results
+  world::AccelerationRestriction secondAccelerationRestriction;
+  state::ProperResponse secondProperResponse;
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(
+    worldModel, initialCycleState, nextCycleState, secondAccelerationRestriction, secondProperResponse));
+  EXPECT_EQ(firstProperResponse, secondProperResponse);
+  EXPECT_EQ(firstAccelerationRestriction, secondAccelerationRestriction);
+
+  // the cycle state can be transferred into the stateful interface
+  rssCheck.setCycleState(nextCycleState);
+  EXPECT_EQ(rssCheck.getCycleState().situationIdState.currentTime, worldModel.timeIndex);
+  worldModel.timeIndex--;
+  EXPECT_FALSE(rssCheck.calculateAccelerationRestriction(worldModel, firstAccelerationRestriction));
+}
+
+} // namespace core
+} // namespace ad_rss
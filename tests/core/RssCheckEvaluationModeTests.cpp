@@ -0,0 +1,278 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckTestBaseT.hpp"
+
+namespace ad_rss {
+namespace core {
+
+/*!
+ * @brief formula provider counting the evaluations of the longitudinal formulas
+ */
+class CountingFormulaProvider : public situation::RssFormulaProvider
+{
+public:
+  bool checkSafeLongitudinalDistanceSameDirection(situation::VehicleState const &leadingVehicle,
+                                                  situation::VehicleState const &followingVehicle,
+                                                  physics::Distance const &vehicleDistance,
+                                                  physics::Distance &safeDistance,
+                                                  bool &isDistanceSafe) const override
+  {
+    safeDistanceCalculations++;
+    return situation::RssFormulaProvider::checkSafeLongitudinalDistanceSameDirection(
+      leadingVehicle, followingVehicle, vehicleDistance, safeDistance, isDistanceSafe);
+  }
+
+  bool isSafeLongitudinalDistanceSameDirection(situation::VehicleState const &leadingVehicle,
+                                               situation::VehicleState const &followingVehicle,
+                                               physics::Distance const &vehicleDistance,
+                                               bool &isDistanceSafe) const override
+  {
+    decisionCalculations++;
+    return situation::RssFormulaProvider::isSafeLongitudinalDistanceSameDirection(
+      leadingVehicle, followingVehicle, vehicleDistance, isDistanceSafe);
+  }
+
+  bool checkSafeLongitudinalDistanceOppositeDirection(situation::VehicleState const &correctVehicle,
+                                                      situation::VehicleState const &oppositeVehicle,
+                                                      physics::Distance const &vehicleDistance,
+                                                      physics::Distance &safeDistance,
+                                                      bool &isDistanceSafe) const override
+  {
+    safeDistanceCalculations++;
+    return situation::RssFormulaProvider::checkSafeLongitudinalDistanceOppositeDirection(
+      correctVehicle, oppositeVehicle, vehicleDistance, safeDistance, isDistanceSafe);
+  }
+
+  bool isSafeLongitudinalDistanceOppositeDirection(situation::VehicleState const &correctVehicle,
+                                                   situation::VehicleState const &oppositeVehicle,
+                                                   physics::Distance const &vehicleDistance,
+                                                   bool &isDistanceSafe) const override
+  {
+    decisionCalculations++;
+    return situation::RssFormulaProvider::isSafeLongitudinalDistanceOppositeDirection(
+      correctVehicle, oppositeVehicle, vehicleDistance, isDistanceSafe);
+  }
+
+  mutable uint32_t safeDistanceCalculations{0u};
+  mutable uint32_t decisionCalculations{0u};
+};
+
+template <class TESTBASE> class RssCheckEvaluationModeTestBase : public TESTBASE
+{
+protected:
+  using TESTBASE::worldModel;
+
+  CountingFormulaProvider decisionFormulaProvider;
+
+  void expectEmptyRssStateInformation(state::RssStateInformation const &rssStateInformation)
+  {
+    EXPECT_EQ(rssStateInformation.evaluator, state::RssStateEvaluator::None);
+    EXPECT_EQ(rssStateInformation.currentDistance, std::numeric_limits<physics::Distance>::max());
+    EXPECT_EQ(rssStateInformation.safeDistance, std::numeric_limits<physics::Distance>::max());
+  }
+
+  void performEvaluationModeComparison()
+  {
+    RssCheck fullRssCheck(RssCheck::ExecutionMode::Staged, RssCheck::EvaluationMode::Full);
+    RssCheck decisionRssCheck(RssCheck::ExecutionMode::Staged, RssCheck::EvaluationMode::DecisionOnly);
+    ASSERT_EQ(fullRssCheck.getEvaluationMode(), RssCheck::EvaluationMode::Full);
+    ASSERT_EQ(decisionRssCheck.getEvaluationMode(), RssCheck::EvaluationMode::DecisionOnly);
+    ASSERT_TRUE(decisionRssCheck.setFormulaProvider(decisionFormulaProvider));
+
+    for (uint32_t i = 0; i <= 90; i++)
+    {
+      for (auto &scene : worldModel.scenes)
+      {
+        scene.egoVehicle.occupiedRegions[0].lonRange.minimum = ParametricValue(0.01 * i);
+        scene.egoVehicle.occupiedRegions[0].lonRange.maximum = ParametricValue(0.01 * i + 0.1);
+      }
+      worldModel.timeIndex++;
+
+      world::AccelerationRestriction fullAccelerationRestriction;
+      state::ProperResponse fullProperResponse;
+      state::RssStateSnapshot fullRssStateSnapshot;
+      ASSERT_TRUE(fullRssCheck.calculateAccelerationRestriction(
+        worldModel, fullAccelerationRestriction, fullProperResponse, nullptr, &fullRssStateSnapshot));
+
+      world::AccelerationRestriction decisionAccelerationRestriction;
+      state::ProperResponse decisionProperResponse;
+      situation::SituationSnapshot decisionSituationSnapshot;
+      state::RssStateSnapshot decisionRssStateSnapshot;
+      ASSERT_TRUE(decisionRssCheck.calculateAccelerationRestriction(worldModel,
+                                                                    decisionAccelerationRestriction,
+                                                                    decisionProperResponse,
+                                                                    &decisionSituationSnapshot,
+                                                                    &decisionRssStateSnapshot));
+      // the safe distances are not calculated in decision only mode
+      EXPECT_EQ(0u, decisionFormulaProvider.safeDistanceCalculations);
+
+      EXPECT_EQ(fullProperResponse, decisionProperResponse);
+      EXPECT_EQ(fullAccelerationRestriction, decisionAccelerationRestriction);
+
+      ASSERT_EQ(fullRssStateSnapshot.individualResponses.size(), decisionRssStateSnapshot.individualResponses.size());
+      ASSERT_EQ(decisionSituationSnapshot.situations.size(), decisionRssStateSnapshot.individualResponses.size());
+      for (size_t j = 0u; j < decisionRssStateSnapshot.individualResponses.size(); ++j)
+      {
+        auto &decisionRssState = decisionRssStateSnapshot.individualResponses[j];
+        auto const &fullRssState = fullRssStateSnapshot.individualResponses[j];
+
+        EXPECT_EQ(fullRssState.longitudinalState.isSafe, decisionRssState.longitudinalState.isSafe);
+        EXPECT_EQ(fullRssState.longitudinalState.response, decisionRssState.longitudinalState.response);
+        EXPECT_EQ(fullRssState.lateralStateLeft.isSafe, decisionRssState.lateralStateLeft.isSafe);
+        EXPECT_EQ(fullRssState.lateralStateLeft.response, decisionRssState.lateralStateLeft.response);
+        EXPECT_EQ(fullRssState.lateralStateRight.isSafe, decisionRssState.lateralStateRight.isSafe);
+        EXPECT_EQ(fullRssState.lateralStateRight.response, decisionRssState.lateralStateRight.response);
+        expectEmptyRssStateInformation(decisionRssState.longitudinalState.rssStateInformation);
+        expectEmptyRssStateInformation(decisionRssState.lateralStateLeft.rssStateInformation);
+        expectEmptyRssStateInformation(decisionRssState.lateralStateRight.rssStateInformation);
+
+        // diagnostics on request
+        ASSERT_TRUE(
+          decisionRssCheck.calculateRssStateInformation(decisionSituationSnapshot.situations[j], decisionRssState));
+        EXPECT_EQ(fullRssState, decisionRssState);
+      }
+      decisionFormulaProvider.safeDistanceCalculations = 0u;
+    }
+  }
+};
+
+class RssCheckEvaluationModeSameDirectionTests : public RssCheckEvaluationModeTestBase<RssCheckTestBase>
+{
+protected:
+  uint32_t getNumberOfSceneObjects() override
+  {
+    return 3u;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t objectIndex) override
+  {
+    switch (objectIndex)
+    {
+      case 0u:
+        return objectOnSegment7;
+      case 1u:
+        return objectOnSegment8;
+      case 2u:
+        return objectOnSegment6;
+      default:
+        throw std::out_of_range("Test setup out of range");
+    }
+  }
+};
+
+TEST_F(RssCheckEvaluationModeSameDirectionTests, IdenticalDecisions)
+{
+  performEvaluationModeComparison();
+  EXPECT_LT(0u, decisionFormulaProvider.decisionCalculations);
+}
+
+TEST_F(RssCheckEvaluationModeSameDirectionTests, IdenticalDecisionsWithNotRelevantScene)
+{
+  worldModel.scenes[1].situationType = situation::SituationType::NotRelevant;
+  performEvaluationModeComparison();
+}
+
+TEST_F(RssCheckEvaluationModeSameDirectionTests, InformationOfInvalidSituation)
+{
+  RssCheck decisionRssCheck(RssCheck::ExecutionMode::Fused, RssCheck::EvaluationMode::DecisionOnly);
+  world::AccelerationRestriction accelerationRestriction;
+  state::ProperResponse properResponse;
+  situation::SituationSnapshot situationSnapshot;
+  state::RssStateSnapshot rssStateSnapshot;
+  ASSERT_TRUE(decisionRssCheck.calculateAccelerationRestriction(
+    worldModel, accelerationRestriction, properResponse, &situationSnapshot, &rssStateSnapshot));
+  ASSERT_FALSE(situationSnapshot.situations.empty());
+
+  auto situation = situationSnapshot.situations[0];
+  auto rssState = rssStateSnapshot.individualResponses[0];
+  situation.relativePosition.longitudinalDistance = Distance(-1.);
+  EXPECT_FALSE(decisionRssCheck.calculateRssStateInformation(situation, rssState));
+  EXPECT_EQ(rssStateSnapshot.individualResponses[0], rssState);
+}
+
+class RssCheckEvaluationModeOppositeDirectionTests : public RssCheckEvaluationModeTestBase<RssCheckTestBase>
+{
+protected:
+  situation::SituationType getSituationType() override
+  {
+    return situation::SituationType::OppositeDirection;
+  }
+
+  ::ad_rss::world::Object &getEgoObject() override
+  {
+    return objectOnSegment1;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t) override
+  {
+    return objectOnSegment7;
+  }
+};
+
+TEST_F(RssCheckEvaluationModeOppositeDirectionTests, IdenticalDecisions)
+{
+  performEvaluationModeComparison();
+  EXPECT_LT(0u, decisionFormulaProvider.decisionCalculations);
+}
+
+class RssCheckEvaluationModeIntersectionTests : public RssCheckEvaluationModeTestBase<RssCheckTestBase>
+{
+protected:
+  situation::SituationType getSituationType() override
+  {
+    return situation::SituationType::IntersectionSamePriority;
+  }
+
+  ::ad_rss::world::Object &getEgoObject() override
+  {
+    return objectOnSegment0;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t) override
+  {
+    return objectOnSegment8;
+  }
+};
+
+TEST_F(RssCheckEvaluationModeIntersectionTests, IdenticalDecisions)
+{
+  performEvaluationModeComparison();
+  for (auto &scene : worldModel.scenes)
+  {
+    scene.egoVehicle.occupiedRegions[0].segmentId = world::LaneSegmentId(3);
+  }
+  performEvaluationModeComparison();
+  EXPECT_LT(0u, decisionFormulaProvider.decisionCalculations);
+}
+
+} // namespace core
+} // namespace ad_rss
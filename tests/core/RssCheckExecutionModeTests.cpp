@@ -0,0 +1,204 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckTestBaseT.hpp"
+
+namespace ad_rss {
+namespace core {
+
+template <class TESTBASE> class RssCheckExecutionModeTestBase : public TESTBASE
+{
+protected:
+  using TESTBASE::worldModel;
+
+  void performExecutionModeComparison()
+  {
+    RssCheck stagedRssCheck(RssCheck::ExecutionMode::Staged);
+    RssCheck fusedRssCheck(RssCheck::ExecutionMode::Fused);
+    ASSERT_EQ(stagedRssCheck.getExecutionMode(), RssCheck::ExecutionMode::Staged);
+    ASSERT_EQ(fusedRssCheck.getExecutionMode(), RssCheck::ExecutionMode::Fused);
+
+    for (uint32_t i = 0; i <= 90; i++)
+    {
+      for (auto &scene : worldModel.scenes)
+      {
+        scene.egoVehicle.occupiedRegions[0].lonRange.minimum = ParametricValue(0.01 * i);
+        scene.egoVehicle.occupiedRegions[0].lonRange.maximum = ParametricValue(0.01 * i + 0.1);
+      }
+      worldModel.timeIndex++;
+
+      world::AccelerationRestriction stagedAccelerationRestriction;
+      state::ProperResponse stagedProperResponse;
+      situation::SituationSnapshot stagedSituationSnapshot;
+      state::RssStateSnapshot stagedRssStateSnapshot;
+      bool const stagedResult = stagedRssCheck.calculateAccelerationRestriction(worldModel,
+                                                                                stagedAccelerationRestriction,
+                                                                                stagedProperResponse,
+                                                                                &stagedSituationSnapshot,
+                                                                                &stagedRssStateSnapshot);
+
+      world::AccelerationRestriction fusedAccelerationRestriction;
+      state::ProperResponse fusedProperResponse;
+      situation::SituationSnapshot fusedSituationSnapshot;
+      state::RssStateSnapshot fusedRssStateSnapshot;
+      bool const fusedResult = fusedRssCheck.calculateAccelerationRestriction(worldModel,
+                                                                              fusedAccelerationRestriction,
+                                                                              fusedProperResponse,
+                                                                              &fusedSituationSnapshot,
+                                                                              &fusedRssStateSnapshot);
+
+      ASSERT_TRUE(stagedResult);
+      ASSERT_TRUE(fusedResult);
+      EXPECT_EQ(stagedSituationSnapshot, fusedSituationSnapshot);
+      EXPECT_EQ(stagedRssStateSnapshot, fusedRssStateSnapshot);
+      EXPECT_EQ(stagedProperResponse, fusedProperResponse);
+      EXPECT_EQ(stagedAccelerationRestriction, fusedAccelerationRestriction);
+    }
+  }
+};
+
+class RssCheckExecutionModeSameDirectionTests : public RssCheckExecutionModeTestBase<RssCheckTestBase>
+{
+protected:
+  uint32_t getNumberOfSceneObjects() override
+  {
+    return 3u;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t objectIndex) override
+  {
+    switch (objectIndex)
+    {
+      case 0u:
+        return objectOnSegment7;
+      case 1u:
+        return objectOnSegment8;
+      case 2u:
+        return objectOnSegment6;
+      default:
+        throw std::out_of_range("Test setup out of range");
+    }
+  }
+};
+
+TEST_F(RssCheckExecutionModeSameDirectionTests, IdenticalResults)
+{
+  performExecutionModeComparison();
+}
+
+TEST_F(RssCheckExecutionModeSameDirectionTests, IdenticalResultsWithMergedScenes)
+{
+  // variations of the same situation are merged into the worst-case situation
+  auto duplicateScene = worldModel.scenes[0];
+  duplicateScene.object.velocity.speedLon = Speed(15.);
+  worldModel.scenes.push_back(duplicateScene);
+  duplicateScene = worldModel.scenes[1];
+  duplicateScene.egoVehicle.velocity.speedLon = Speed(20.);
+  worldModel.scenes.insert(worldModel.scenes.begin(), duplicateScene);
+
+  // irrelevant scenes don't contribute
+  duplicateScene = worldModel.scenes[2];
+  duplicateScene.situationType = situation::SituationType::NotRelevant;
+  worldModel.scenes.push_back(duplicateScene);
+
+  performExecutionModeComparison();
+}
+
+TEST_F(RssCheckExecutionModeSameDirectionTests, SnapshotsNotRequested)
+{
+  RssCheck stagedRssCheck(RssCheck::ExecutionMode::Staged);
+  RssCheck fusedRssCheck(RssCheck::ExecutionMode::Fused);
+
+  world::AccelerationRestriction stagedAccelerationRestriction;
+  world::AccelerationRestriction fusedAccelerationRestriction;
+  ASSERT_TRUE(stagedRssCheck.calculateAccelerationRestriction(worldModel, stagedAccelerationRestriction));
+  ASSERT_TRUE(fusedRssCheck.calculateAccelerationRestriction(worldModel, fusedAccelerationRestriction));
+  EXPECT_EQ(stagedAccelerationRestriction, fusedAccelerationRestriction);
+}
+
+TEST_F(RssCheckExecutionModeSameDirectionTests, InvalidScene)
+{
+  RssCheck fusedRssCheck(RssCheck::ExecutionMode::Fused);
+  world::AccelerationRestriction accelerationRestriction;
+
+  worldModel.scenes[1].object.objectId = worldModel.scenes[1].egoVehicle.objectId;
+  ASSERT_FALSE(fusedRssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+
+  worldModel.scenes[1].situationType = situation::SituationType::NotRelevant;
+  worldModel.timeIndex++;
+  ASSERT_TRUE(fusedRssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction));
+}
+
+TEST_F(RssCheckExecutionModeSameDirectionTests, MergeFails)
+{
+  RssCheck fusedRssCheck(RssCheck::ExecutionMode::Fused);
+  world::AccelerationRestriction accelerationRestriction;
+  state::ProperResponse properResponse;
+  state::RssStateSnapshot rssStateSnapshot;
+
+  auto duplicateScene = worldModel.scenes[0];
+  duplicateScene.objectRssDynamics.responseTime = Duration(1.5);
+  worldModel.scenes.push_back(duplicateScene);
+  ASSERT_FALSE(fusedRssCheck.calculateAccelerationRestriction(
+    worldModel, accelerationRestriction, properResponse, nullptr, &rssStateSnapshot));
+}
+
+class RssCheckExecutionModeIntersectionTests : public RssCheckExecutionModeTestBase<RssCheckTestBase>
+{
+protected:
+  situation::SituationType getSituationType() override
+  {
+    return situation::SituationType::IntersectionSamePriority;
+  }
+
+  ::ad_rss::world::Object &getEgoObject() override
+  {
+    return objectOnSegment0;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t) override
+  {
+    return objectOnSegment8;
+  }
+};
+
+TEST_F(RssCheckExecutionModeIntersectionTests, IdenticalResults)
+{
+  performExecutionModeComparison();
+  for (auto &scene : worldModel.scenes)
+  {
+    scene.egoVehicle.occupiedRegions[0].segmentId = world::LaneSegmentId(3);
+  }
+  performExecutionModeComparison();
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,174 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckTestBaseT.hpp"
+#include "ad_rss/core/RssCheckFixedDynamics.hpp"
+
+namespace ad_rss {
+namespace core {
+
+template <class TESTBASE> class RssCheckFixedDynamicsTestBase : public TESTBASE
+{
+protected:
+  using TESTBASE::worldModel;
+
+  typedef RssCheckFixedDynamics<TestEgoRssDynamicsProfile, TestObjectRssDynamicsProfile> FixedDynamicsRssCheck;
+
+  void performFixedDynamicsComparison(RssCheck::ExecutionMode const executionMode)
+  {
+    RssCheck runtimeRssCheck(executionMode);
+    FixedDynamicsRssCheck fixedRssCheck(executionMode);
+
+    for (uint32_t i = 0; i <= 90; i++)
+    {
+      for (auto &scene : worldModel.scenes)
+      {
+        scene.egoVehicle.occupiedRegions[0].lonRange.minimum = ParametricValue(0.01 * i);
+        scene.egoVehicle.occupiedRegions[0].lonRange.maximum = ParametricValue(0.01 * i + 0.1);
+      }
+      worldModel.timeIndex++;
+
+      world::AccelerationRestriction runtimeAccelerationRestriction;
+      state::ProperResponse runtimeProperResponse;
+      state::RssStateSnapshot runtimeRssStateSnapshot;
+      bool const runtimeResult = runtimeRssCheck.calculateAccelerationRestriction(
+        worldModel, runtimeAccelerationRestriction, runtimeProperResponse, nullptr, &runtimeRssStateSnapshot);
+
+      world::AccelerationRestriction fixedAccelerationRestriction;
+      state::ProperResponse fixedProperResponse;
+      state::RssStateSnapshot fixedRssStateSnapshot;
+      bool const fixedResult = fixedRssCheck.calculateAccelerationRestriction(
+        worldModel, fixedAccelerationRestriction, fixedProperResponse, nullptr, &fixedRssStateSnapshot);
+
+      ASSERT_TRUE(runtimeResult);
+      ASSERT_TRUE(fixedResult);
+      EXPECT_EQ(runtimeRssStateSnapshot, fixedRssStateSnapshot);
+      EXPECT_EQ(runtimeProperResponse, fixedProperResponse);
+      EXPECT_EQ(runtimeAccelerationRestriction, fixedAccelerationRestriction);
+    }
+  }
+};
+
+class RssCheckFixedDynamicsSameDirectionTests : public RssCheckFixedDynamicsTestBase<RssCheckTestBase>
+{
+protected:
+  uint32_t getNumberOfSceneObjects() override
+  {
+    return 3u;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t objectIndex) override
+  {
+    switch (objectIndex)
+    {
+      case 0u:
+        return objectOnSegment7;
+      case 1u:
+        return objectOnSegment8;
+      case 2u:
+        return objectOnSegment6;
+      default:
+        throw std::out_of_range("Test setup out of range");
+    }
+  }
+};
+
+TEST_F(RssCheckFixedDynamicsSameDirectionTests, IdenticalResultsStaged)
+{
+  performFixedDynamicsComparison(RssCheck::ExecutionMode::Staged);
+}
+
+TEST_F(RssCheckFixedDynamicsSameDirectionTests, IdenticalResultsFused)
+{
+  performFixedDynamicsComparison(RssCheck::ExecutionMode::Fused);
+}
+
+TEST_F(RssCheckFixedDynamicsSameDirectionTests, ObjectDynamicsNotMatchingAnyProfile)
+{
+  worldModel.scenes[1].objectRssDynamics.alphaLon.brakeMax = Acceleration(9.);
+  performFixedDynamicsComparison(RssCheck::ExecutionMode::Staged);
+}
+
+class RssCheckFixedDynamicsOppositeDirectionTests : public RssCheckFixedDynamicsTestBase<RssCheckTestBase>
+{
+protected:
+  situation::SituationType getSituationType() override
+  {
+    return situation::SituationType::OppositeDirection;
+  }
+
+  ::ad_rss::world::Object &getEgoObject() override
+  {
+    return objectOnSegment1;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t) override
+  {
+    return objectOnSegment7;
+  }
+};
+
+TEST_F(RssCheckFixedDynamicsOppositeDirectionTests, IdenticalResults)
+{
+  performFixedDynamicsComparison(RssCheck::ExecutionMode::Staged);
+}
+
+class RssCheckFixedDynamicsIntersectionTests : public RssCheckFixedDynamicsTestBase<RssCheckTestBase>
+{
+protected:
+  situation::SituationType getSituationType() override
+  {
+    return situation::SituationType::IntersectionSamePriority;
+  }
+
+  ::ad_rss::world::Object &getEgoObject() override
+  {
+    return objectOnSegment0;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t) override
+  {
+    return objectOnSegment8;
+  }
+};
+
+TEST_F(RssCheckFixedDynamicsIntersectionTests, IdenticalResults)
+{
+  performFixedDynamicsComparison(RssCheck::ExecutionMode::Staged);
+  for (auto &scene : worldModel.scenes)
+  {
+    scene.egoVehicle.occupiedRegions[0].segmentId = world::LaneSegmentId(3);
+  }
+  performFixedDynamicsComparison(RssCheck::ExecutionMode::Fused);
+}
+
+} // namespace core
+} // namespace ad_rss
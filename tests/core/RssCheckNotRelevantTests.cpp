@@ -79,7 +79,7 @@ using RssCheckNotRelevantOutOfMemoryTest = RssCheckNotRelevantTestBase<RssCheckO
 TEST_P(RssCheckNotRelevantOutOfMemoryTest, outOfMemoryAnyTime)
 {
   // throw at some vaules will succeed, but that's expected in this case as no actual calculations are performed.
-  performOutOfMemoryTest({3u, 5u, 6u});
+  performOutOfMemoryTest({4u, 5u, 6u});
 }
 INSTANTIATE_TEST_CASE_P(Range, RssCheckNotRelevantOutOfMemoryTest, ::testing::Range(uint64_t(0u), uint64_t(50u)));
 
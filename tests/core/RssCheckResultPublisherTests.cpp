@@ -0,0 +1,226 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <thread>
+#include "RssCheckTestBaseT.hpp"
+#include "ad_rss/core/RssCheckResultPublisher.hpp"
+
+namespace ad_rss {
+namespace core {
+
+class RssCheckResultPublisherTests : public RssCheckTestBase
+{
+protected:
+  static void createResult(physics::TimeIndex const timeIndex,
+                           world::AccelerationRestriction &accelerationRestriction,
+                           state::ProperResponse &properResponse)
+  {
+    accelerationRestriction.timeIndex = timeIndex;
+    // encode the time index into the contents to be able to detect torn reads
+    accelerationRestriction.longitudinalRange.maximum = Acceleration(static_cast<double>(timeIndex % 100u));
+    properResponse.timeIndex = timeIndex;
+    properResponse.isSafe = false;
+    properResponse.dangerousObjects.assign(timeIndex % 5u, static_cast<world::ObjectId>(timeIndex));
+  }
+
+  static bool isConsistent(RssCheckResult const &result)
+  {
+    return (result.timeIndex == result.accelerationRestriction.timeIndex)
+      && (result.timeIndex == result.properResponse.timeIndex)
+      && (result.accelerationRestriction.longitudinalRange.maximum
+          == Acceleration(static_cast<double>(result.timeIndex % 100u)))
+      && (result.properResponse.dangerousObjects.size() == result.timeIndex % 5u);
+  }
+};
+
+TEST_F(RssCheckResultPublisherTests, NothingPublished)
+{
+  RssCheckResultPublisher publisher;
+  RssCheckResult result;
+  EXPECT_FALSE(publisher.hasNewResult());
+  EXPECT_FALSE(publisher.readLatest(result));
+  EXPECT_EQ(publisher.getPublishedTimeIndex(), 0u);
+}
+
+TEST_F(RssCheckResultPublisherTests, PublishRssCheckResult)
+{
+  RssCheck rssCheck(RssCheck::ExecutionMode::Fused);
+  RssCheckResultPublisher publisher;
+
+  world::AccelerationRestriction accelerationRestriction;
+  state::ProperResponse properResponse;
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction, properResponse));
+  ASSERT_TRUE(publisher.publish(accelerationRestriction, properResponse));
+  EXPECT_EQ(publisher.getPublishedTimeIndex(), worldModel.timeIndex);
+  EXPECT_TRUE(publisher.hasNewResult());
+
+  RssCheckResult result;
+  ASSERT_TRUE(publisher.readLatest(result));
+  EXPECT_FALSE(publisher.hasNewResult());
+  EXPECT_EQ(result.timeIndex, worldModel.timeIndex);
+  EXPECT_EQ(result.accelerationRestriction, accelerationRestriction);
+  EXPECT_EQ(result.properResponse, properResponse);
+
+  // the latest result stays available
+  RssCheckResult secondResult;
+  ASSERT_TRUE(publisher.readLatest(secondResult));
+  EXPECT_EQ(secondResult.accelerationRestriction, accelerationRestriction);
+}
+
+TEST_F(RssCheckResultPublisherTests, LatestResultWins)
+{
+  RssCheckResultPublisher publisher;
+  world::AccelerationRestriction accelerationRestriction;
+  state::ProperResponse properResponse;
+  RssCheckResult result;
+
+  for (physics::TimeIndex timeIndex = 1u; timeIndex <= 10u; timeIndex++)
+  {
+    createResult(timeIndex, accelerationRestriction, properResponse);
+    ASSERT_TRUE(publisher.publish(accelerationRestriction, properResponse));
+    if (timeIndex % 3u == 0u)
+    {
+      ASSERT_TRUE(publisher.readLatest(result));
+      EXPECT_EQ(result.timeIndex, timeIndex);
+      EXPECT_TRUE(isConsistent(result));
+    }
+  }
+  ASSERT_TRUE(publisher.readLatest(result));
+  EXPECT_EQ(result.timeIndex, 10u);
+  EXPECT_TRUE(isConsistent(result));
+}
+
+TEST_F(RssCheckResultPublisherTests, InvalidTimeIndex)
+{
+  RssCheckResultPublisher publisher;
+  world::AccelerationRestriction accelerationRestriction;
+  state::ProperResponse properResponse;
+
+  createResult(0u, accelerationRestriction, properResponse);
+  EXPECT_FALSE(publisher.publish(accelerationRestriction, properResponse));
+
+  createResult(5u, accelerationRestriction, properResponse);
+  properResponse.timeIndex = 4u;
+  EXPECT_FALSE(publisher.publish(accelerationRestriction, properResponse));
+
+  createResult(5u, accelerationRestriction, properResponse);
+  EXPECT_TRUE(publisher.publish(accelerationRestriction, properResponse));
+  EXPECT_FALSE(publisher.publish(accelerationRestriction, properResponse));
+  createResult(4u, accelerationRestriction, properResponse);
+  EXPECT_FALSE(publisher.publish(accelerationRestriction, properResponse));
+  EXPECT_EQ(publisher.getPublishedTimeIndex(), 5u);
+}
+
+TEST_F(RssCheckResultPublisherTests, TimeIndexOverflow)
+{
+  RssCheckResultPublisher publisher;
+  world::AccelerationRestriction accelerationRestriction;
+  state::ProperResponse properResponse;
+
+  createResult(std::numeric_limits<physics::TimeIndex>::max(), accelerationRestriction, properResponse);
+  ASSERT_TRUE(publisher.publish(accelerationRestriction, properResponse));
+  // 0 is never valid, the time index continues with 1
+  createResult(1u, accelerationRestriction, properResponse);
+  EXPECT_TRUE(publisher.publish(accelerationRestriction, properResponse));
+  createResult(2u, accelerationRestriction, properResponse);
+  EXPECT_TRUE(publisher.publish(accelerationRestriction, properResponse));
+  EXPECT_EQ(publisher.getPublishedTimeIndex(), 2u);
+
+  // results from before the overflow are outdated
+  createResult(std::numeric_limits<physics::TimeIndex>::max() - 1u, accelerationRestriction, properResponse);
+  EXPECT_FALSE(publisher.publish(accelerationRestriction, properResponse));
+
+  RssCheckResult result;
+  ASSERT_TRUE(publisher.readLatest(result));
+  EXPECT_EQ(result.timeIndex, 2u);
+}
+
+TEST_F(RssCheckResultPublisherTests, AcquireLatestWithoutCopy)
+{
+  RssCheckResultPublisher publisher;
+  world::AccelerationRestriction accelerationRestriction;
+  state::ProperResponse properResponse;
+  EXPECT_EQ(publisher.acquireLatest(), nullptr);
+
+  createResult(3u, accelerationRestriction, properResponse);
+  ASSERT_TRUE(publisher.publish(accelerationRestriction, properResponse));
+  RssCheckResult const *result = publisher.acquireLatest();
+  ASSERT_NE(result, nullptr);
+  EXPECT_EQ(result->timeIndex, 3u);
+  EXPECT_TRUE(isConsistent(*result));
+
+  // the acquired result is not touched by following publications
+  createResult(4u, accelerationRestriction, properResponse);
+  ASSERT_TRUE(publisher.publish(accelerationRestriction, properResponse));
+  createResult(5u, accelerationRestriction, properResponse);
+  ASSERT_TRUE(publisher.publish(accelerationRestriction, properResponse));
+  EXPECT_EQ(result->timeIndex, 3u);
+  EXPECT_TRUE(isConsistent(*result));
+
+  result = publisher.acquireLatest();
+  ASSERT_NE(result, nullptr);
+  EXPECT_EQ(result->timeIndex, 5u);
+}
+
+TEST_F(RssCheckResultPublisherTests, ConcurrentPublishAndRead)
+{
+  RssCheckResultPublisher publisher;
+  physics::TimeIndex const lastTimeIndex = 20000u;
+
+  std::thread publishingThread([&publisher, lastTimeIndex]() {
+    world::AccelerationRestriction accelerationRestriction;
+    state::ProperResponse properResponse;
+    for (physics::TimeIndex timeIndex = 1u; timeIndex <= lastTimeIndex; timeIndex++)
+    {
+      createResult(timeIndex, accelerationRestriction, properResponse);
+      publisher.publish(accelerationRestriction, properResponse);
+    }
+  });
+
+  physics::TimeIndex lastReadTimeIndex = 0u;
+  bool consistent = true;
+  while (lastReadTimeIndex < lastTimeIndex)
+  {
+    RssCheckResult result;
+    if (publisher.readLatest(result))
+    {
+      consistent = consistent && isConsistent(result) && (result.timeIndex >= lastReadTimeIndex);
+      lastReadTimeIndex = result.timeIndex;
+    }
+  }
+  publishingThread.join();
+
+  EXPECT_TRUE(consistent);
+  EXPECT_EQ(lastReadTimeIndex, lastTimeIndex);
+}
+
+} // namespace core
+} // namespace ad_rss
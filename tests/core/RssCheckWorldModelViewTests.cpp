@@ -0,0 +1,238 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckTestBaseT.hpp"
+
+namespace ad_rss {
+namespace core {
+
+template <class TESTBASE> class RssCheckWorldModelViewTestBase : public TESTBASE
+{
+protected:
+  using TESTBASE::worldModel;
+
+  /*
+   * Emulates the buffers of a middleware holding the data in its own contiguous memory.
+   * The views refer to the world model and to the compact road areas; both must not be modified
+   * in a way that reallocates their memory while the view is in use.
+   */
+  world::WorldModelView createWorldModelView()
+  {
+    mRoadAreas.clear();
+    mSceneViews.clear();
+    mRoadAreas.reserve(2u * worldModel.scenes.size());
+    mSceneViews.reserve(worldModel.scenes.size());
+    for (auto const &scene : worldModel.scenes)
+    {
+      world::SceneView sceneView;
+      sceneView.situationType = scene.situationType;
+      sceneView.egoVehicle = world::createObjectView(scene.egoVehicle);
+      sceneView.object = world::createObjectView(scene.object);
+      sceneView.objectRssDynamics = &scene.objectRssDynamics;
+      sceneView.egoVehicleRoad = createRoadAreaView(scene.egoVehicleRoad);
+      sceneView.intersectingRoad = createRoadAreaView(scene.intersectingRoad);
+      mSceneViews.push_back(sceneView);
+    }
+
+    world::WorldModelView worldModelView;
+    worldModelView.timeIndex = worldModel.timeIndex;
+    worldModelView.egoVehicleRssDynamics = worldModel.egoVehicleRssDynamics;
+    worldModelView.scenes = world::ArrayView<world::SceneView>(mSceneViews);
+    return worldModelView;
+  }
+
+  world::RoadAreaView createRoadAreaView(world::RoadArea const &sceneRoadArea)
+  {
+    if (sceneRoadArea.empty())
+    {
+      return world::RoadAreaView();
+    }
+    world::CompactRoadArea compactRoadArea;
+    EXPECT_TRUE(world::convertToCompactRoadArea(sceneRoadArea, compactRoadArea));
+    mRoadAreas.push_back(compactRoadArea);
+    return world::createRoadAreaView(mRoadAreas.back());
+  }
+
+  void performWorldModelViewComparison(RssCheck::ExecutionMode const executionMode)
+  {
+    RssCheck rssCheck(executionMode);
+    RssCheck viewRssCheck(executionMode);
+
+    for (uint32_t i = 0; i <= 90; i++)
+    {
+      for (auto &scene : worldModel.scenes)
+      {
+        scene.egoVehicle.occupiedRegions[0].lonRange.minimum = ParametricValue(0.01 * i);
+        scene.egoVehicle.occupiedRegions[0].lonRange.maximum = ParametricValue(0.01 * i + 0.1);
+      }
+      worldModel.timeIndex++;
+      world::WorldModelView const worldModelView = createWorldModelView();
+
+      world::AccelerationRestriction accelerationRestriction;
+      state::ProperResponse properResponse;
+      situation::SituationSnapshot situationSnapshot;
+      state::RssStateSnapshot rssStateSnapshot;
+      ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(
+        worldModel, accelerationRestriction, properResponse, &situationSnapshot, &rssStateSnapshot));
+
+      world::AccelerationRestriction viewAccelerationRestriction;
+      state::ProperResponse viewProperResponse;
+      situation::SituationSnapshot viewSituationSnapshot;
+      state::RssStateSnapshot viewRssStateSnapshot;
+      ASSERT_TRUE(viewRssCheck.calculateAccelerationRestriction(worldModelView,
+                                                                viewAccelerationRestriction,
+                                                                viewProperResponse,
+                                                                &viewSituationSnapshot,
+                                                                &viewRssStateSnapshot));
+
+      EXPECT_EQ(situationSnapshot, viewSituationSnapshot);
+      EXPECT_EQ(rssStateSnapshot, viewRssStateSnapshot);
+      EXPECT_EQ(properResponse, viewProperResponse);
+      EXPECT_EQ(accelerationRestriction, viewAccelerationRestriction);
+    }
+  }
+
+  std::vector<world::CompactRoadArea> mRoadAreas;
+  std::vector<world::SceneView> mSceneViews;
+};
+
+class RssCheckWorldModelViewSameDirectionTests : public RssCheckWorldModelViewTestBase<RssCheckTestBase>
+{
+protected:
+  uint32_t getNumberOfSceneObjects() override
+  {
+    return 3u;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t objectIndex) override
+  {
+    switch (objectIndex)
+    {
+      case 0u:
+        return objectOnSegment7;
+      case 1u:
+        return objectOnSegment8;
+      case 2u:
+        return objectOnSegment6;
+      default:
+        throw std::out_of_range("Test setup out of range");
+    }
+  }
+};
+
+TEST_F(RssCheckWorldModelViewSameDirectionTests, IdenticalResultsStaged)
+{
+  performWorldModelViewComparison(RssCheck::ExecutionMode::Staged);
+}
+
+TEST_F(RssCheckWorldModelViewSameDirectionTests, IdenticalResultsFused)
+{
+  performWorldModelViewComparison(RssCheck::ExecutionMode::Fused);
+}
+
+TEST_F(RssCheckWorldModelViewSameDirectionTests, EmptyView)
+{
+  RssCheck rssCheck;
+  world::WorldModelView worldModelView;
+  worldModelView.timeIndex = 1u;
+  worldModelView.egoVehicleRssDynamics = worldModel.egoVehicleRssDynamics;
+  world::AccelerationRestriction accelerationRestriction;
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(worldModelView, accelerationRestriction));
+  EXPECT_EQ(accelerationRestriction.longitudinalRange.maximum,
+            worldModel.egoVehicleRssDynamics.alphaLon.accelMax);
+}
+
+TEST_F(RssCheckWorldModelViewSameDirectionTests, InvalidView)
+{
+  RssCheck rssCheck;
+  world::AccelerationRestriction accelerationRestriction;
+  worldModel.timeIndex++;
+  world::WorldModelView worldModelView = createWorldModelView();
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(worldModelView, accelerationRestriction));
+
+  worldModelView.timeIndex = 0u;
+  EXPECT_FALSE(rssCheck.calculateAccelerationRestriction(worldModelView, accelerationRestriction));
+  worldModelView.timeIndex = worldModel.timeIndex;
+
+  mSceneViews[0].objectRssDynamics = nullptr;
+  EXPECT_FALSE(rssCheck.calculateAccelerationRestriction(worldModelView, accelerationRestriction));
+  mSceneViews[0].objectRssDynamics = &worldModel.scenes[0].objectRssDynamics;
+
+  // end offset not matching the number of lane segments
+  world::RoadAreaView const roadAreaView = mSceneViews[0].egoVehicleRoad;
+  mSceneViews[0].egoVehicleRoad.laneSegments
+    = world::ArrayView<world::LaneSegment>(roadAreaView.laneSegments.data(), roadAreaView.laneSegments.size() - 1u);
+  EXPECT_FALSE(rssCheck.calculateAccelerationRestriction(worldModelView, accelerationRestriction));
+
+  // road segment without lane segment
+  std::vector<std::size_t> roadSegmentOffsets(roadAreaView.roadSegmentOffsets.begin(),
+                                              roadAreaView.roadSegmentOffsets.end());
+  roadSegmentOffsets[1] = 0u;
+  mSceneViews[0].egoVehicleRoad.laneSegments = roadAreaView.laneSegments;
+  mSceneViews[0].egoVehicleRoad.roadSegmentOffsets = world::ArrayView<std::size_t>(roadSegmentOffsets);
+  EXPECT_FALSE(rssCheck.calculateAccelerationRestriction(worldModelView, accelerationRestriction));
+
+  // lane segments without road segment
+  mSceneViews[0].egoVehicleRoad.roadSegmentOffsets = world::ArrayView<std::size_t>();
+  EXPECT_FALSE(rssCheck.calculateAccelerationRestriction(worldModelView, accelerationRestriction));
+
+  mSceneViews[0].egoVehicleRoad = roadAreaView;
+  mSceneViews[0].egoVehicle.occupiedRegions = world::ArrayView<world::OccupiedRegion>(nullptr, 1u);
+  EXPECT_FALSE(rssCheck.calculateAccelerationRestriction(worldModelView, accelerationRestriction));
+}
+
+class RssCheckWorldModelViewIntersectionTests : public RssCheckWorldModelViewTestBase<RssCheckTestBase>
+{
+protected:
+  situation::SituationType getSituationType() override
+  {
+    return situation::SituationType::IntersectionSamePriority;
+  }
+
+  ::ad_rss::world::Object &getEgoObject() override
+  {
+    return objectOnSegment0;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t) override
+  {
+    return objectOnSegment8;
+  }
+};
+
+TEST_F(RssCheckWorldModelViewIntersectionTests, IdenticalResults)
+{
+  performWorldModelViewComparison(RssCheck::ExecutionMode::Staged);
+  performWorldModelViewComparison(RssCheck::ExecutionMode::Fused);
+}
+
+} // namespace core
+} // namespace ad_rss
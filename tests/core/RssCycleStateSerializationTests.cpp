@@ -0,0 +1,253 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckTestBaseT.hpp"
+#include "ad_rss/core/RssCycleStateSerialization.hpp"
+
+namespace ad_rss {
+namespace core {
+
+namespace {
+
+RssCycleState createCycleState()
+{
+  RssCycleState cycleState;
+  cycleState.situationIdState.currentTime = 1000u;
+  cycleState.situationIdState.lastTime = 999u;
+  cycleState.situationIdState.nextSituationId = std::numeric_limits<situation::SituationId>::max();
+
+  RssSituationIdState::SituationData situationData;
+  situationData.timeIndex = 1000u;
+  situationData.situationType = situation::SituationType::IntersectionSamePriority;
+  situationData.situationId = 17u;
+  situationData.egoVehicleIntersectionArea = {3u, 5u, std::numeric_limits<world::LaneSegmentId>::max()};
+  situationData.objectIntersectionArea = {0u, 7u};
+  cycleState.situationIdState.situationData.insert(std::make_pair(world::ObjectId(12u), situationData));
+  situationData.situationId = 18u;
+  situationData.situationType = situation::SituationType::SameDirection;
+  situationData.egoVehicleIntersectionArea.clear();
+  cycleState.situationIdState.situationData.insert(std::make_pair(world::ObjectId(12u), situationData));
+  situationData.situationId = 2u;
+  situationData.timeIndex = 999u;
+  cycleState.situationIdState.situationData.insert(std::make_pair(world::ObjectId(4u), situationData));
+
+  cycleState.situationCheckingState.currentTimeIndex = 1000u;
+  cycleState.situationCheckingState.intersectionCheckingState.currentTimeIndex = 1000u;
+  cycleState.situationCheckingState.intersectionCheckingState.lastSafeStates[17u]
+    = situation::IntersectionState::NoTimeOverlap;
+  cycleState.situationCheckingState.intersectionCheckingState.currentSafeStates[17u]
+    = situation::IntersectionState::SafeLongitudinalDistance;
+  cycleState.situationCheckingState.intersectionCheckingState.currentSafeStates[0u]
+    = situation::IntersectionState::NonPrioAbleToBreak;
+
+  cycleState.responseResolvingState.statesBeforeDangerThresholdTime[2u].longitudinalSafe = true;
+  cycleState.responseResolvingState.statesBeforeDangerThresholdTime[17u].lateralSafe = true;
+  cycleState.responseResolvingState.statesBeforeDangerThresholdTime[18u];
+  return cycleState;
+}
+
+void expectEqualCycleStates(RssCycleState const &left, RssCycleState const &right)
+{
+  EXPECT_EQ(left.situationIdState.currentTime, right.situationIdState.currentTime);
+  EXPECT_EQ(left.situationIdState.lastTime, right.situationIdState.lastTime);
+  EXPECT_EQ(left.situationIdState.nextSituationId, right.situationIdState.nextSituationId);
+  ASSERT_EQ(left.situationIdState.situationData.size(), right.situationIdState.situationData.size());
+  for (auto leftIter = left.situationIdState.situationData.begin(),
+            rightIter = right.situationIdState.situationData.begin();
+       leftIter != left.situationIdState.situationData.end();
+       ++leftIter, ++rightIter)
+  {
+    EXPECT_EQ(leftIter->first, rightIter->first);
+    EXPECT_EQ(leftIter->second.timeIndex, rightIter->second.timeIndex);
+    EXPECT_EQ(leftIter->second.situationType, rightIter->second.situationType);
+    EXPECT_EQ(leftIter->second.situationId, rightIter->second.situationId);
+    EXPECT_EQ(leftIter->second.egoVehicleIntersectionArea, rightIter->second.egoVehicleIntersectionArea);
+    EXPECT_EQ(leftIter->second.objectIntersectionArea, rightIter->second.objectIntersectionArea);
+  }
+
+  EXPECT_EQ(left.situationCheckingState.currentTimeIndex, right.situationCheckingState.currentTimeIndex);
+  EXPECT_EQ(left.situationCheckingState.intersectionCheckingState.currentTimeIndex,
+            right.situationCheckingState.intersectionCheckingState.currentTimeIndex);
+  EXPECT_EQ(left.situationCheckingState.intersectionCheckingState.lastSafeStates,
+            right.situationCheckingState.intersectionCheckingState.lastSafeStates);
+  EXPECT_EQ(left.situationCheckingState.intersectionCheckingState.currentSafeStates,
+            right.situationCheckingState.intersectionCheckingState.currentSafeStates);
+
+  ASSERT_EQ(left.responseResolvingState.statesBeforeDangerThresholdTime.size(),
+            right.responseResolvingState.statesBeforeDangerThresholdTime.size());
+  for (auto leftIter = left.responseResolvingState.statesBeforeDangerThresholdTime.begin(),
+            rightIter = right.responseResolvingState.statesBeforeDangerThresholdTime.begin();
+       leftIter != left.responseResolvingState.statesBeforeDangerThresholdTime.end();
+       ++leftIter, ++rightIter)
+  {
+    EXPECT_EQ(leftIter->first, rightIter->first);
+    EXPECT_EQ(leftIter->second.longitudinalSafe, rightIter->second.longitudinalSafe);
+    EXPECT_EQ(leftIter->second.lateralSafe, rightIter->second.lateralSafe);
+  }
+}
+
+} // namespace
+
+TEST(RssCycleStateSerializationTests, RoundTrip)
+{
+  RssCycleState const cycleState = createCycleState();
+  std::vector<std::uint8_t> checkpoint;
+  ASSERT_TRUE(serializeCycleState(cycleState, checkpoint));
+
+  RssCycleState restoredCycleState;
+  ASSERT_TRUE(deserializeCycleState(checkpoint, restoredCycleState));
+  expectEqualCycleStates(cycleState, restoredCycleState);
+
+  std::vector<std::uint8_t> secondCheckpoint;
+  ASSERT_TRUE(serializeCycleState(restoredCycleState, secondCheckpoint));
+  EXPECT_EQ(checkpoint, secondCheckpoint);
+}
+
+TEST(RssCycleStateSerializationTests, EmptyCycleState)
+{
+  std::vector<std::uint8_t> checkpoint;
+  ASSERT_TRUE(serializeCycleState(RssCycleState(), checkpoint));
+  // header, situation id state, situation checking state and response resolving state: one byte per value
+  EXPECT_EQ(checkpoint.size(), 5u + 4u + 4u + 1u);
+
+  RssCycleState restoredCycleState = createCycleState();
+  ASSERT_TRUE(deserializeCycleState(checkpoint, restoredCycleState));
+  expectEqualCycleStates(RssCycleState(), restoredCycleState);
+}
+
+TEST(RssCycleStateSerializationTests, InvalidCheckpoints)
+{
+  RssCycleState const cycleState = createCycleState();
+  std::vector<std::uint8_t> checkpoint;
+  ASSERT_TRUE(serializeCycleState(cycleState, checkpoint));
+
+  RssCycleState restoredCycleState;
+  // every truncated checkpoint is rejected and leaves the state untouched
+  for (std::size_t size = 0u; size < checkpoint.size(); ++size)
+  {
+    EXPECT_FALSE(deserializeCycleState(checkpoint.data(), size, restoredCycleState));
+    EXPECT_TRUE(restoredCycleState.situationIdState.situationData.empty());
+  }
+  EXPECT_FALSE(deserializeCycleState(nullptr, 1u, restoredCycleState));
+
+  std::vector<std::uint8_t> invalidCheckpoint = checkpoint;
+  invalidCheckpoint.push_back(0u);
+  EXPECT_FALSE(deserializeCycleState(invalidCheckpoint, restoredCycleState));
+
+  invalidCheckpoint = checkpoint;
+  invalidCheckpoint[0] = 'X';
+  EXPECT_FALSE(deserializeCycleState(invalidCheckpoint, restoredCycleState));
+
+  invalidCheckpoint = checkpoint;
+  invalidCheckpoint[4]++;
+  EXPECT_FALSE(deserializeCycleState(invalidCheckpoint, restoredCycleState));
+
+  // huge element count
+  invalidCheckpoint = std::vector<std::uint8_t>(checkpoint.begin(), checkpoint.begin() + 5);
+  invalidCheckpoint.insert(invalidCheckpoint.end(), {0u, 0u, 0u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x0Fu});
+  EXPECT_FALSE(deserializeCycleState(invalidCheckpoint, restoredCycleState));
+
+  // value exceeding 64 bit
+  invalidCheckpoint = std::vector<std::uint8_t>(checkpoint.begin(), checkpoint.begin() + 5);
+  invalidCheckpoint.insert(invalidCheckpoint.end(), 9u, 0xFFu);
+  invalidCheckpoint.push_back(0x02u);
+  EXPECT_FALSE(deserializeCycleState(invalidCheckpoint, restoredCycleState));
+
+  EXPECT_TRUE(restoredCycleState.situationIdState.situationData.empty());
+}
+
+class RssCheckCheckpointTests : public RssCheckTestBase
+{
+protected:
+  uint32_t getNumberOfSceneObjects() override
+  {
+    return 3u;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t objectIndex) override
+  {
+    switch (objectIndex)
+    {
+      case 0u:
+        return objectOnSegment7;
+      case 1u:
+        return objectOnSegment8;
+      case 2u:
+        return objectOnSegment6;
+      default:
+        throw std::out_of_range("Test setup out of range");
+    }
+  }
+};
+
+TEST_F(RssCheckCheckpointTests, WarmStartProvidesIdenticalResults)
+{
+  RssCheck rssCheck;
+  std::unique_ptr<RssCheck> restoredRssCheck;
+  world::AccelerationRestriction accelerationRestriction;
+  state::ProperResponse properResponse;
+
+  for (uint32_t i = 0; i <= 90; i++)
+  {
+    for (auto &scene : worldModel.scenes)
+    {
+      scene.egoVehicle.occupiedRegions[0].lonRange.minimum = ParametricValue(0.01 * i);
+      scene.egoVehicle.occupiedRegions[0].lonRange.maximum = ParametricValue(0.01 * i + 0.1);
+    }
+    worldModel.timeIndex++;
+
+    if (i == 40u)
+    {
+      std::vector<std::uint8_t> checkpoint;
+      ASSERT_TRUE(rssCheck.saveCheckpoint(checkpoint));
+      restoredRssCheck.reset(new RssCheck(RssCheck::ExecutionMode::Fused));
+      ASSERT_TRUE(restoredRssCheck->restoreCheckpoint(checkpoint));
+      expectEqualCycleStates(rssCheck.getCycleState(), restoredRssCheck->getCycleState());
+    }
+
+    ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction, properResponse));
+    if (static_cast<bool>(restoredRssCheck))
+    {
+      world::AccelerationRestriction restoredAccelerationRestriction;
+      state::ProperResponse restoredProperResponse;
+      ASSERT_TRUE(restoredRssCheck->calculateAccelerationRestriction(
+        worldModel, restoredAccelerationRestriction, restoredProperResponse));
+      EXPECT_EQ(properResponse, restoredProperResponse);
+      EXPECT_EQ(accelerationRestriction, restoredAccelerationRestriction);
+    }
+  }
+  ASSERT_TRUE(static_cast<bool>(restoredRssCheck));
+  EXPECT_FALSE(restoredRssCheck->restoreCheckpoint(std::vector<std::uint8_t>()));
+  expectEqualCycleStates(rssCheck.getCycleState(), restoredRssCheck->getCycleState());
+}
+
+} // namespace core
+} // namespace ad_rss
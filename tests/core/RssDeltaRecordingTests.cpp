@@ -0,0 +1,413 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include "RssCheckTestBaseT.hpp"
+#include "ad_rss/core/RssDeltaRecording.hpp"
+#include "ad_rss/core/RssRecording.hpp"
+
+namespace ad_rss {
+namespace core {
+
+template <typename T> bool isBitwiseIdentical(T const &left, T const &right)
+{
+  return std::memcmp(&left, &right, sizeof(T)) == 0;
+}
+
+bool isBitwiseIdentical(world::Object const &left, world::Object const &right)
+{
+  if ((left.objectId != right.objectId) || (left.objectType != right.objectType)
+      || !isBitwiseIdentical(left.velocity, right.velocity)
+      || (left.occupiedRegions.size() != right.occupiedRegions.size()))
+  {
+    return false;
+  }
+  for (std::size_t i = 0u; i < left.occupiedRegions.size(); ++i)
+  {
+    if (!isBitwiseIdentical(left.occupiedRegions[i], right.occupiedRegions[i]))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool isBitwiseIdentical(world::RoadArea const &left, world::RoadArea const &right)
+{
+  if (left.size() != right.size())
+  {
+    return false;
+  }
+  for (std::size_t i = 0u; i < left.size(); ++i)
+  {
+    if (left[i].size() != right[i].size())
+    {
+      return false;
+    }
+    for (std::size_t j = 0u; j < left[i].size(); ++j)
+    {
+      if (!isBitwiseIdentical(left[i][j], right[i][j]))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool isBitwiseIdentical(world::WorldModel const &left, world::WorldModel const &right)
+{
+  if ((left.timeIndex != right.timeIndex)
+      || !isBitwiseIdentical(left.egoVehicleRssDynamics, right.egoVehicleRssDynamics)
+      || (left.scenes.size() != right.scenes.size()))
+  {
+    return false;
+  }
+  for (std::size_t i = 0u; i < left.scenes.size(); ++i)
+  {
+    world::Scene const &leftScene = left.scenes[i];
+    world::Scene const &rightScene = right.scenes[i];
+    if ((leftScene.situationType != rightScene.situationType)
+        || !isBitwiseIdentical(leftScene.egoVehicle, rightScene.egoVehicle)
+        || !isBitwiseIdentical(leftScene.object, rightScene.object)
+        || !isBitwiseIdentical(leftScene.objectRssDynamics, rightScene.objectRssDynamics)
+        || !isBitwiseIdentical(leftScene.intersectingRoad, rightScene.intersectingRoad)
+        || !isBitwiseIdentical(leftScene.egoVehicleRoad, rightScene.egoVehicleRoad))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+class RssDeltaRecordingTestBase : public RssCheckTestBase
+{
+protected:
+  void SetUp() override
+  {
+    RssCheckTestBase::SetUp();
+    mFileName = ::testing::TempDir() + "RssDeltaRecordingTests.rssdelta";
+  }
+
+  void TearDown() override
+  {
+    std::remove(mFileName.c_str());
+    RssCheckTestBase::TearDown();
+  }
+
+  /*
+   * Moves the ego vehicle and the objects; from time to time the last scene disappears and the scenes are reordered.
+   */
+  world::WorldModel createWorldModel(uint32_t i)
+  {
+    for (auto &scene : worldModel.scenes)
+    {
+      scene.egoVehicle.occupiedRegions[0].lonRange.minimum = ParametricValue(0.01 * i);
+      scene.egoVehicle.occupiedRegions[0].lonRange.maximum = ParametricValue(0.01 * i + 0.1);
+      scene.egoVehicle.velocity.speedLon = Speed(10. + 0.1 * i);
+      scene.object.velocity.speedLon = Speed(10. + 0.3 * (i % 7u));
+    }
+    worldModel.timeIndex++;
+
+    world::WorldModel result = worldModel;
+    if (((i % 7u) == 3u) && (result.scenes.size() > 1u))
+    {
+      result.scenes.pop_back();
+      std::reverse(result.scenes.begin(), result.scenes.end());
+    }
+    return result;
+  }
+
+  /*
+   * Records the world models together with the results of every other cycle.
+   */
+  void record(std::size_t const keyframeInterval)
+  {
+    RssCheck rssCheck;
+    mWorldModels.clear();
+    mProperResponses.clear();
+    mAccelerationRestrictions.clear();
+
+    RssDeltaRecordWriter writer(keyframeInterval);
+    ASSERT_TRUE(writer.open(mFileName));
+    ASSERT_TRUE(writer.isOpen());
+    for (uint32_t i = 0; i <= 90; i++)
+    {
+      world::WorldModel const currentWorldModel = createWorldModel(i);
+      world::AccelerationRestriction accelerationRestriction;
+      state::ProperResponse properResponse;
+      ASSERT_TRUE(
+        rssCheck.calculateAccelerationRestriction(currentWorldModel, accelerationRestriction, properResponse));
+      if ((i % 2u) == 0u)
+      {
+        ASSERT_TRUE(writer.writeFrame(currentWorldModel, properResponse, accelerationRestriction));
+      }
+      else
+      {
+        ASSERT_TRUE(writer.writeFrame(currentWorldModel));
+      }
+      mWorldModels.push_back(currentWorldModel);
+      mProperResponses.push_back(properResponse);
+      mAccelerationRestrictions.push_back(accelerationRestriction);
+    }
+    ASSERT_TRUE(writer.close());
+    ASSERT_FALSE(writer.isOpen());
+    ASSERT_FALSE(writer.writeFrame(worldModel));
+  }
+
+  void expectFrame(RssDeltaRecordFrame const &frame, std::size_t const i)
+  {
+    EXPECT_TRUE(isBitwiseIdentical(frame.worldModel, mWorldModels[i]));
+    EXPECT_EQ(frame.hasResult, (i % 2u) == 0u);
+    if (frame.hasResult)
+    {
+      EXPECT_EQ(mProperResponses[i], frame.properResponse);
+      EXPECT_TRUE(isBitwiseIdentical(mAccelerationRestrictions[i], frame.accelerationRestriction));
+    }
+  }
+
+  void performRecordAndReplay()
+  {
+    record(30u);
+
+    RssDeltaRecordReader reader;
+    ASSERT_TRUE(reader.open(mFileName));
+    ASSERT_EQ(reader.getKeyframes().size(), 4u);
+    RssCheck replayRssCheck;
+    for (std::size_t i = 0u; i < mWorldModels.size(); ++i)
+    {
+      ASSERT_FALSE(reader.isAtEnd());
+      ASSERT_TRUE(reader.readNextFrame());
+      EXPECT_EQ(reader.getFrameNumber(), i);
+      RssDeltaRecordFrame const &frame = reader.getFrame();
+      expectFrame(frame, i);
+
+      // the replay results in identical responses
+      world::AccelerationRestriction accelerationRestriction;
+      state::ProperResponse properResponse;
+      ASSERT_TRUE(
+        replayRssCheck.calculateAccelerationRestriction(frame.worldModel, accelerationRestriction, properResponse));
+      EXPECT_EQ(mProperResponses[i], properResponse);
+      EXPECT_TRUE(isBitwiseIdentical(mAccelerationRestrictions[i], accelerationRestriction));
+    }
+    EXPECT_TRUE(reader.isAtEnd());
+    EXPECT_FALSE(reader.readNextFrame());
+    reader.close();
+    EXPECT_FALSE(reader.isOpen());
+  }
+
+  std::vector<std::uint8_t> readFile()
+  {
+    std::ifstream stream(mFileName, std::ios::in | std::ios::binary);
+    return std::vector<std::uint8_t>(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+  }
+
+  void writeFile(std::vector<std::uint8_t> const &data)
+  {
+    std::ofstream stream(mFileName, std::ios::out | std::ios::binary | std::ios::trunc);
+    stream.write(reinterpret_cast<char const *>(data.data()), static_cast<std::streamsize>(data.size()));
+  }
+
+  std::string mFileName;
+  std::vector<world::WorldModel> mWorldModels;
+  std::vector<state::ProperResponse> mProperResponses;
+  std::vector<world::AccelerationRestriction> mAccelerationRestrictions;
+};
+
+class RssDeltaRecordingSameDirectionTests : public RssDeltaRecordingTestBase
+{
+protected:
+  uint32_t getNumberOfSceneObjects() override
+  {
+    return 3u;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t objectIndex) override
+  {
+    switch (objectIndex)
+    {
+      case 0u:
+        return objectOnSegment7;
+      case 1u:
+        return objectOnSegment8;
+      case 2u:
+        return objectOnSegment6;
+      default:
+        throw std::out_of_range("Test setup out of range");
+    }
+  }
+};
+
+TEST_F(RssDeltaRecordingSameDirectionTests, RecordAndReplay)
+{
+  performRecordAndReplay();
+}
+
+TEST_F(RssDeltaRecordingSameDirectionTests, SmallerThanFullRecording)
+{
+  record(100u);
+  std::size_t const deltaRecordingSize = readFile().size();
+
+  RssRecordWriter writer;
+  ASSERT_TRUE(writer.open(mFileName));
+  for (std::size_t i = 0u; i < mWorldModels.size(); ++i)
+  {
+    ASSERT_TRUE(writer.writeFrame(mWorldModels[i], mProperResponses[i], mAccelerationRestrictions[i]));
+  }
+  ASSERT_TRUE(writer.close());
+  std::size_t const fullRecordingSize = readFile().size();
+
+  EXPECT_LT(deltaRecordingSize * 5u, fullRecordingSize);
+}
+
+TEST_F(RssDeltaRecordingSameDirectionTests, Seek)
+{
+  record(30u);
+
+  RssDeltaRecordReader reader;
+  ASSERT_TRUE(reader.open(mFileName));
+  std::vector<RssDeltaRecordKeyframe> const keyframes = reader.getKeyframes();
+  ASSERT_EQ(keyframes.size(), 4u);
+  for (std::size_t k = 0u; k < keyframes.size(); ++k)
+  {
+    EXPECT_EQ(keyframes[k].frameNumber, 30u * k);
+    EXPECT_EQ(keyframes[k].timeIndex, mWorldModels[30u * k].timeIndex);
+  }
+
+  ASSERT_TRUE(reader.seekKeyframe(2u));
+  EXPECT_EQ(reader.getFrameNumber(), 60u);
+  expectFrame(reader.getFrame(), 60u);
+  ASSERT_TRUE(reader.readNextFrame());
+  expectFrame(reader.getFrame(), 61u);
+  EXPECT_FALSE(reader.seekKeyframe(4u));
+
+  ASSERT_TRUE(reader.seekTimeIndex(mWorldModels[45u].timeIndex));
+  EXPECT_EQ(reader.getFrameNumber(), 45u);
+  expectFrame(reader.getFrame(), 45u);
+  for (std::size_t i = 46u; i < mWorldModels.size(); ++i)
+  {
+    ASSERT_TRUE(reader.readNextFrame());
+    expectFrame(reader.getFrame(), i);
+  }
+  EXPECT_TRUE(reader.isAtEnd());
+
+  ASSERT_TRUE(reader.seekTimeIndex(0u));
+  EXPECT_EQ(reader.getFrameNumber(), 0u);
+  EXPECT_FALSE(reader.seekTimeIndex(mWorldModels.back().timeIndex + 1u));
+}
+
+TEST_F(RssDeltaRecordingSameDirectionTests, MissingIndex)
+{
+  record(30u);
+  std::vector<std::uint8_t> recording = readFile();
+
+  // the keyframes of an incomplete recording are found by scanning the frames
+  recording.resize(recording.size() - 20u);
+  writeFile(recording);
+  RssDeltaRecordReader reader;
+  ASSERT_TRUE(reader.open(mFileName));
+  ASSERT_EQ(reader.getKeyframes().size(), 4u);
+  ASSERT_TRUE(reader.seekKeyframe(3u));
+  expectFrame(reader.getFrame(), 90u);
+
+  std::size_t numberOfFrames = 0u;
+  ASSERT_TRUE(reader.seekKeyframe(0u));
+  do
+  {
+    expectFrame(reader.getFrame(), numberOfFrames);
+    numberOfFrames++;
+  } while (reader.readNextFrame());
+  EXPECT_EQ(numberOfFrames, mWorldModels.size());
+  EXPECT_TRUE(reader.isAtEnd());
+}
+
+TEST_F(RssDeltaRecordingSameDirectionTests, InvalidRecordings)
+{
+  RssDeltaRecordReader reader;
+  EXPECT_FALSE(reader.open(mFileName));
+  EXPECT_FALSE(reader.isOpen());
+  EXPECT_FALSE(reader.readNextFrame());
+  EXPECT_FALSE(reader.seekKeyframe(0u));
+
+  record(30u);
+  std::vector<std::uint8_t> const recording = readFile();
+
+  // wrong version
+  std::vector<std::uint8_t> invalidRecording = recording;
+  invalidRecording[4]++;
+  writeFile(invalidRecording);
+  EXPECT_FALSE(reader.open(mFileName));
+
+  // corrupted keyframe: the decoding of the first frame fails and the following delta frames have no reference
+  invalidRecording = recording;
+  std::size_t const firstFramePayload = 5u + 2u;
+  for (std::size_t i = firstFramePayload; i < firstFramePayload + 16u; ++i)
+  {
+    invalidRecording[i] = 0xFFu;
+  }
+  writeFile(invalidRecording);
+  ASSERT_TRUE(reader.open(mFileName));
+  EXPECT_FALSE(reader.readNextFrame());
+  EXPECT_FALSE(reader.readNextFrame());
+  // the next keyframe is still accessible
+  ASSERT_TRUE(reader.seekKeyframe(1u));
+  expectFrame(reader.getFrame(), 30u);
+}
+
+class RssDeltaRecordingIntersectionTests : public RssDeltaRecordingTestBase
+{
+protected:
+  ::ad_rss::world::Object &getEgoObject() override
+  {
+    return objectOnSegment0;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t) override
+  {
+    return objectOnSegment8;
+  }
+
+  situation::SituationType getSituationType() override
+  {
+    return situation::SituationType::IntersectionSamePriority;
+  }
+};
+
+TEST_F(RssDeltaRecordingIntersectionTests, RecordAndReplay)
+{
+  performRecordAndReplay();
+}
+
+} // namespace core
+} // namespace ad_rss
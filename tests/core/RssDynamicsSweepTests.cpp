@@ -0,0 +1,381 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckTestBaseT.hpp"
+#include "ad_rss/core/RssDynamicsSweep.hpp"
+#include "ad_rss/core/RssSituationChecking.hpp"
+#include "ad_rss/state/RssStateOperation.hpp"
+
+namespace ad_rss {
+namespace core {
+
+template <class TESTBASE> class RssDynamicsSweepTestBase : public TESTBASE
+{
+protected:
+  using TESTBASE::worldModel;
+
+  /*
+   * The ego vehicle passes the objects with changing speed, so the frames differ in safety and margin.
+   */
+  std::vector<world::WorldModel> createFrames(uint32_t const numberOfFrames)
+  {
+    std::vector<world::WorldModel> frames;
+    for (uint32_t i = 0u; i < numberOfFrames; ++i)
+    {
+      world::WorldModel frame = worldModel;
+      frame.timeIndex = i + 1u;
+      double const position = 0.9 * static_cast<double>(i) / static_cast<double>(numberOfFrames);
+      for (auto &scene : frame.scenes)
+      {
+        scene.egoVehicle.occupiedRegions[0].lonRange.minimum = ParametricValue(position);
+        scene.egoVehicle.occupiedRegions[0].lonRange.maximum = ParametricValue(position + 0.1);
+        scene.egoVehicle.velocity.speedLon = kmhToMeterPerSec(10. + static_cast<double>((7u * i) % 90u));
+      }
+      frames.push_back(frame);
+    }
+    return frames;
+  }
+
+  std::vector<RssDynamicsConfiguration> createConfigurations()
+  {
+    RssDynamicsConfiguration baseConfiguration;
+    baseConfiguration.egoDynamics = getEgoRssDynamics();
+    baseConfiguration.objectDynamics = getObjectRssDynamics();
+
+    std::vector<RssDynamicsSweepAxis> axes(3u);
+    axes[0].parameter = RssDynamicsParameter::ResponseTime;
+    axes[0].values = {0.2, 1., 2.};
+    axes[1].parameter = RssDynamicsParameter::AlphaLonBrakeMax;
+    axes[1].applyToEgo = false;
+    axes[1].applyToObjects = true;
+    axes[1].values = {4., 6., 8.};
+    axes[2].parameter = RssDynamicsParameter::AlphaLatBrakeMin;
+    axes[2].applyToObjects = true;
+    axes[2].values = {0.4, 2.};
+
+    std::vector<RssDynamicsConfiguration> configurations;
+    EXPECT_TRUE(createDynamicsGrid(baseConfiguration, axes, configurations));
+    EXPECT_EQ(configurations.size(), 18u);
+    return configurations;
+  }
+
+  /*
+   * The reference statistics of a configuration are calculated by the situation checks of each frame.
+   */
+  RssDynamicsSweepStatistics calculateReferenceStatistics(std::vector<world::WorldModel> const &frames,
+                                                          RssDynamicsConfiguration const &configuration)
+  {
+    RssDynamicsSweepStatistics statistics;
+    RssSituationExtraction situationExtraction;
+    RssSituationChecking situationChecking;
+    for (auto const &frame : frames)
+    {
+      world::WorldModel configurationWorldModel = frame;
+      configurationWorldModel.egoVehicleRssDynamics = configuration.egoDynamics;
+      for (auto &scene : configurationWorldModel.scenes)
+      {
+        scene.objectRssDynamics = configuration.objectDynamics;
+      }
+      RssSituationIdState situationIdState;
+      situation::SituationSnapshot situationSnapshot;
+      EXPECT_TRUE(
+        situationExtraction.extractSituations(configurationWorldModel, situationIdState, situationSnapshot));
+      RssSituationCheckingState situationCheckingState;
+      state::RssStateSnapshot rssStateSnapshot;
+      EXPECT_TRUE(situationChecking.checkSituations(situationSnapshot, situationCheckingState, rssStateSnapshot));
+
+      statistics.numberOfFrames++;
+      bool isUnsafe = false;
+      double frameMargin = static_cast<double>(std::numeric_limits<Distance>::max());
+      for (std::size_t i = 0u; i < rssStateSnapshot.individualResponses.size(); ++i)
+      {
+        state::RssState const &rssState = rssStateSnapshot.individualResponses[i];
+        situation::Situation const &situation = situationSnapshot.situations[i];
+        if (state::isDangerous(rssState))
+        {
+          statistics.numberOfDangerousSituations++;
+          isUnsafe = true;
+        }
+        if ((situation.situationType == situation::SituationType::SameDirection)
+            || (situation.situationType == situation::SituationType::OppositeDirection))
+        {
+          auto const &lonInformation = rssState.longitudinalState.rssStateInformation;
+          double margin = static_cast<double>(lonInformation.currentDistance - lonInformation.safeDistance);
+          if (situation.relativePosition.lateralPosition == situation::LateralRelativePosition::AtLeft)
+          {
+            auto const &latInformation = rssState.lateralStateRight.rssStateInformation;
+            margin = std::max(margin,
+                              static_cast<double>(latInformation.currentDistance - latInformation.safeDistance));
+          }
+          else if (situation.relativePosition.lateralPosition == situation::LateralRelativePosition::AtRight)
+          {
+            auto const &latInformation = rssState.lateralStateLeft.rssStateInformation;
+            margin = std::max(margin,
+                              static_cast<double>(latInformation.currentDistance - latInformation.safeDistance));
+          }
+          frameMargin = std::min(frameMargin, margin);
+        }
+      }
+      if (isUnsafe)
+      {
+        statistics.numberOfUnsafeFrames++;
+      }
+      if (frameMargin < static_cast<double>(statistics.minimumMargin))
+      {
+        statistics.minimumMargin = Distance(frameMargin);
+        statistics.minimumMarginTimeIndex = frame.timeIndex;
+      }
+    }
+    return statistics;
+  }
+
+  void expectEqualStatistics(RssDynamicsSweepStatistics const &left, RssDynamicsSweepStatistics const &right)
+  {
+    EXPECT_EQ(left.numberOfFrames, right.numberOfFrames);
+    EXPECT_EQ(left.numberOfUnsafeFrames, right.numberOfUnsafeFrames);
+    EXPECT_EQ(left.numberOfDangerousSituations, right.numberOfDangerousSituations);
+    EXPECT_NEAR(static_cast<double>(left.minimumMargin), static_cast<double>(right.minimumMargin), 1e-6);
+    EXPECT_EQ(left.minimumMarginTimeIndex, right.minimumMarginTimeIndex);
+  }
+
+  void performSweepTest(std::size_t const numberOfThreads)
+  {
+    std::vector<world::WorldModel> const frames = createFrames(40u);
+    std::vector<RssDynamicsConfiguration> const configurations = createConfigurations();
+
+    RssDynamicsSweep sweep(numberOfThreads);
+    EXPECT_EQ(sweep.getNumberOfThreads(), numberOfThreads);
+    std::vector<RssDynamicsSweepStatistics> statistics;
+    ASSERT_TRUE(sweep.evaluate(frames, configurations, statistics));
+    ASSERT_EQ(statistics.size(), configurations.size());
+
+    std::size_t numberOfPartlyUnsafeConfigurations = 0u;
+    for (std::size_t i = 0u; i < configurations.size(); ++i)
+    {
+      expectEqualStatistics(statistics[i], calculateReferenceStatistics(frames, configurations[i]));
+      if ((statistics[i].numberOfUnsafeFrames > 0u) && (statistics[i].numberOfUnsafeFrames < frames.size()))
+      {
+        numberOfPartlyUnsafeConfigurations++;
+        EXPECT_GT(statistics[i].getUnsafeFrameRate(), 0.);
+        EXPECT_LT(statistics[i].getUnsafeFrameRate(), 1.);
+      }
+    }
+    // the test frames have to discriminate the configurations
+    EXPECT_GT(numberOfPartlyUnsafeConfigurations, 0u);
+  }
+};
+
+class RssDynamicsSweepTests : public RssDynamicsSweepTestBase<RssCheckTestBase>
+{
+protected:
+  uint32_t getNumberOfSceneObjects() override
+  {
+    return 3u;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t objectIndex) override
+  {
+    switch (objectIndex)
+    {
+      case 0u:
+        return objectOnSegment7;
+      case 1u:
+        return objectOnSegment3;
+      case 2u:
+        return objectOnSegment5;
+      default:
+        throw std::out_of_range("Test setup out of range");
+    }
+  }
+};
+
+TEST_F(RssDynamicsSweepTests, SingleThread)
+{
+  performSweepTest(1u);
+}
+
+TEST_F(RssDynamicsSweepTests, MultipleThreads)
+{
+  performSweepTest(4u);
+}
+
+TEST_F(RssDynamicsSweepTests, ResultsIndependentOfThreadsAndChunks)
+{
+  std::vector<world::WorldModel> const frames = createFrames(30u);
+  std::vector<RssDynamicsConfiguration> const configurations = createConfigurations();
+
+  RssDynamicsSweep singleThreadSweep(1u);
+  std::vector<RssDynamicsSweepStatistics> singleThreadStatistics;
+  ASSERT_TRUE(singleThreadSweep.evaluate(frames, configurations, singleThreadStatistics));
+
+  RssDynamicsSweep sweep(3u);
+  std::vector<RssDynamicsSweepStatistics> statistics;
+  std::vector<world::WorldModel> const firstChunk(frames.begin(), frames.begin() + 11);
+  std::vector<world::WorldModel> const secondChunk(frames.begin() + 11, frames.end());
+  ASSERT_TRUE(sweep.evaluate(firstChunk, configurations, statistics));
+  ASSERT_TRUE(sweep.evaluate(secondChunk, configurations, statistics));
+
+  ASSERT_EQ(statistics.size(), singleThreadStatistics.size());
+  for (std::size_t i = 0u; i < statistics.size(); ++i)
+  {
+    EXPECT_EQ(statistics[i].numberOfFrames, 30u);
+    EXPECT_EQ(statistics[i].numberOfUnsafeFrames, singleThreadStatistics[i].numberOfUnsafeFrames);
+    EXPECT_EQ(statistics[i].numberOfDangerousSituations, singleThreadStatistics[i].numberOfDangerousSituations);
+    EXPECT_EQ(static_cast<double>(statistics[i].minimumMargin),
+              static_cast<double>(singleThreadStatistics[i].minimumMargin));
+    EXPECT_EQ(statistics[i].minimumMarginTimeIndex, singleThreadStatistics[i].minimumMarginTimeIndex);
+  }
+}
+
+TEST_F(RssDynamicsSweepTests, DynamicsGrid)
+{
+  RssDynamicsConfiguration baseConfiguration;
+  baseConfiguration.egoDynamics = getEgoRssDynamics();
+  baseConfiguration.objectDynamics = getObjectRssDynamics();
+
+  std::vector<RssDynamicsConfiguration> configurations;
+  std::vector<RssDynamicsSweepAxis> axes;
+  ASSERT_TRUE(createDynamicsGrid(baseConfiguration, axes, configurations));
+  ASSERT_EQ(configurations.size(), 1u);
+  EXPECT_EQ(configurations[0].egoDynamics, baseConfiguration.egoDynamics);
+  EXPECT_EQ(configurations[0].objectDynamics, baseConfiguration.objectDynamics);
+
+  axes.resize(2u);
+  axes[0].parameter = RssDynamicsParameter::AlphaLonAccelMax;
+  axes[0].applyToObjects = true;
+  axes[0].values = {1., 2.};
+  axes[1].parameter = RssDynamicsParameter::AlphaLonBrakeMinCorrect;
+  axes[1].values = {1., 2., 3.};
+  ASSERT_TRUE(createDynamicsGrid(baseConfiguration, axes, configurations));
+  ASSERT_EQ(configurations.size(), 6u);
+  for (std::size_t i = 0u; i < configurations.size(); ++i)
+  {
+    // the last axis varies fastest
+    EXPECT_EQ(configurations[i].egoDynamics.alphaLon.accelMax, Acceleration(axes[0].values[i / 3u]));
+    EXPECT_EQ(configurations[i].objectDynamics.alphaLon.accelMax, Acceleration(axes[0].values[i / 3u]));
+    EXPECT_EQ(configurations[i].egoDynamics.alphaLon.brakeMinCorrect, Acceleration(axes[1].values[i % 3u]));
+    EXPECT_EQ(configurations[i].objectDynamics.alphaLon.brakeMinCorrect,
+              baseConfiguration.objectDynamics.alphaLon.brakeMinCorrect);
+    EXPECT_EQ(configurations[i].egoDynamics.alphaLon.brakeMax, baseConfiguration.egoDynamics.alphaLon.brakeMax);
+  }
+
+  // brakeMinCorrect must not exceed brakeMin
+  axes[1].values.push_back(5.);
+  EXPECT_FALSE(createDynamicsGrid(baseConfiguration, axes, configurations));
+  EXPECT_TRUE(configurations.empty());
+
+  axes[1].values.clear();
+  EXPECT_FALSE(createDynamicsGrid(baseConfiguration, axes, configurations));
+
+  axes[1].values = {1.};
+  axes[1].applyToEgo = false;
+  EXPECT_FALSE(createDynamicsGrid(baseConfiguration, axes, configurations));
+}
+
+TEST_F(RssDynamicsSweepTests, InvalidInput)
+{
+  std::vector<world::WorldModel> frames = createFrames(5u);
+  std::vector<RssDynamicsConfiguration> configurations = createConfigurations();
+  RssDynamicsSweep sweep(2u);
+
+  std::vector<RssDynamicsSweepStatistics> statistics;
+  EXPECT_FALSE(sweep.evaluate(frames, std::vector<RssDynamicsConfiguration>(), statistics));
+  EXPECT_TRUE(statistics.empty());
+
+  statistics.resize(1u);
+  EXPECT_FALSE(sweep.evaluate(frames, configurations, statistics));
+  EXPECT_EQ(statistics[0].numberOfFrames, 0u);
+
+  statistics.clear();
+  configurations.back().objectDynamics.alphaLon.brakeMax = Acceleration(1.);
+  EXPECT_FALSE(sweep.evaluate(frames, configurations, statistics));
+  EXPECT_TRUE(statistics.empty());
+
+  configurations.pop_back();
+  frames[3].timeIndex = 0u;
+  EXPECT_FALSE(sweep.evaluate(frames, configurations, statistics));
+  EXPECT_TRUE(statistics.empty());
+
+  frames.pop_back();
+  frames.erase(frames.begin() + 3);
+  EXPECT_TRUE(sweep.evaluate(frames, configurations, statistics));
+  ASSERT_EQ(statistics.size(), configurations.size());
+  EXPECT_EQ(statistics[0].numberOfFrames, 3u);
+
+  // no frames don't change the statistics
+  EXPECT_TRUE(sweep.evaluate(std::vector<world::WorldModel>(), configurations, statistics));
+  EXPECT_EQ(statistics[0].numberOfFrames, 3u);
+}
+
+class RssDynamicsSweepOppositeDirectionTests : public RssDynamicsSweepTestBase<RssCheckTestBase>
+{
+protected:
+  situation::SituationType getSituationType() override
+  {
+    return situation::SituationType::OppositeDirection;
+  }
+};
+
+TEST_F(RssDynamicsSweepOppositeDirectionTests, MultipleThreads)
+{
+  performSweepTest(3u);
+}
+
+class RssDynamicsSweepIntersectionTests : public RssDynamicsSweepTestBase<RssCheckTestBase>
+{
+protected:
+  situation::SituationType getSituationType() override
+  {
+    return situation::SituationType::IntersectionSamePriority;
+  }
+
+  ::ad_rss::world::Object &getEgoObject() override
+  {
+    return objectOnSegment0;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t) override
+  {
+    return objectOnSegment8;
+  }
+};
+
+TEST_F(RssDynamicsSweepIntersectionTests, MultipleThreads)
+{
+  for (auto &scene : worldModel.scenes)
+  {
+    scene.egoVehicle.occupiedRegions[0].segmentId = world::LaneSegmentId(3);
+  }
+  performSweepTest(3u);
+}
+
+} // namespace core
+} // namespace ad_rss
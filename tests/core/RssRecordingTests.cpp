@@ -0,0 +1,302 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <cstdio>
+#include <cstring>
+#include "RssCheckTestBaseT.hpp"
+#include "ad_rss/core/RssRecording.hpp"
+
+namespace ad_rss {
+namespace core {
+
+class RssRecordingTestBase : public RssCheckTestBase
+{
+protected:
+  void SetUp() override
+  {
+    RssCheckTestBase::SetUp();
+    mFileName = ::testing::TempDir() + "RssRecordingTests.rssrec";
+  }
+
+  void TearDown() override
+  {
+    std::remove(mFileName.c_str());
+    RssCheckTestBase::TearDown();
+  }
+
+  void moveEgoVehicle(uint32_t i)
+  {
+    for (auto &scene : worldModel.scenes)
+    {
+      scene.egoVehicle.occupiedRegions[0].lonRange.minimum = ParametricValue(0.01 * i);
+      scene.egoVehicle.occupiedRegions[0].lonRange.maximum = ParametricValue(0.01 * i + 0.1);
+    }
+    worldModel.timeIndex++;
+  }
+
+  /*
+   * Records the world models together with the results of every other cycle, reads the recording and replays it.
+   */
+  void performRecordAndReplay()
+  {
+    RssCheck rssCheck;
+    std::vector<world::WorldModel> worldModels;
+    std::vector<state::ProperResponse> properResponses;
+    std::vector<world::AccelerationRestriction> accelerationRestrictions;
+
+    RssRecordWriter writer;
+    ASSERT_TRUE(writer.open(mFileName));
+    ASSERT_TRUE(writer.isOpen());
+    for (uint32_t i = 0; i <= 90; i++)
+    {
+      moveEgoVehicle(i);
+      world::AccelerationRestriction accelerationRestriction;
+      state::ProperResponse properResponse;
+      ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(worldModel, accelerationRestriction, properResponse));
+      if ((i % 2u) == 0u)
+      {
+        ASSERT_TRUE(writer.writeFrame(worldModel, properResponse, accelerationRestriction));
+      }
+      else
+      {
+        ASSERT_TRUE(writer.writeFrame(worldModel));
+      }
+      worldModels.push_back(worldModel);
+      properResponses.push_back(properResponse);
+      accelerationRestrictions.push_back(accelerationRestriction);
+    }
+    ASSERT_TRUE(writer.close());
+    ASSERT_FALSE(writer.isOpen());
+    ASSERT_FALSE(writer.writeFrame(worldModel));
+
+    RssRecordReader reader;
+    ASSERT_TRUE(reader.open(mFileName));
+    for (uint32_t pass = 0u; pass < 2u; ++pass)
+    {
+      RssCheck replayRssCheck;
+      RssCheck referenceRssCheck;
+      RssRecordFrame frame;
+      for (std::size_t i = 0u; i < worldModels.size(); ++i)
+      {
+        ASSERT_FALSE(reader.isAtEnd());
+        ASSERT_TRUE(reader.readNextFrame(frame));
+        ASSERT_EQ(frame.worldModel.timeIndex, worldModels[i].timeIndex);
+        ASSERT_EQ(frame.worldModel.scenes.size(), worldModels[i].scenes.size());
+        EXPECT_EQ(frame.worldModel.scenes[0].egoVehicle.occupiedRegions[0],
+                  worldModels[i].scenes[0].egoVehicle.occupiedRegions[0]);
+        std::size_t numberOfLaneSegments = 0u;
+        for (auto const &roadSegment : worldModels[i].scenes[0].egoVehicleRoad)
+        {
+          numberOfLaneSegments += roadSegment.size();
+        }
+        EXPECT_EQ(frame.worldModel.scenes[0].egoVehicleRoad.laneSegments.size(), numberOfLaneSegments);
+
+        world::AccelerationRestriction accelerationRestriction;
+        state::ProperResponse properResponse;
+        situation::SituationSnapshot situationSnapshot;
+        ASSERT_TRUE(replayRssCheck.calculateAccelerationRestriction(
+          frame.worldModel, accelerationRestriction, properResponse, &situationSnapshot));
+        world::AccelerationRestriction referenceAccelerationRestriction;
+        state::ProperResponse referenceProperResponse;
+        situation::SituationSnapshot referenceSituationSnapshot;
+        ASSERT_TRUE(referenceRssCheck.calculateAccelerationRestriction(
+          worldModels[i], referenceAccelerationRestriction, referenceProperResponse, &referenceSituationSnapshot));
+        EXPECT_EQ(referenceSituationSnapshot, situationSnapshot);
+        EXPECT_EQ(properResponses[i], properResponse);
+        EXPECT_EQ(accelerationRestrictions[i], accelerationRestriction);
+
+        EXPECT_EQ(frame.hasResult, (i % 2u) == 0u);
+        if (frame.hasResult)
+        {
+          EXPECT_EQ(properResponses[i], createProperResponse(frame.properResponse));
+          EXPECT_EQ(accelerationRestrictions[i], frame.accelerationRestriction);
+        }
+      }
+      EXPECT_TRUE(reader.isAtEnd());
+      EXPECT_FALSE(reader.readNextFrame(frame));
+      reader.rewind();
+    }
+    reader.close();
+    EXPECT_FALSE(reader.isOpen());
+  }
+
+  std::vector<std::uint8_t> readFile()
+  {
+    std::ifstream stream(mFileName, std::ios::in | std::ios::binary);
+    return std::vector<std::uint8_t>(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+  }
+
+  // size of the file header preceding the first frame
+  static constexpr std::size_t cFileHeaderSize = 40u;
+  std::string mFileName;
+};
+
+class RssRecordingSameDirectionTests : public RssRecordingTestBase
+{
+protected:
+  uint32_t getNumberOfSceneObjects() override
+  {
+    return 3u;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t objectIndex) override
+  {
+    switch (objectIndex)
+    {
+      case 0u:
+        return objectOnSegment7;
+      case 1u:
+        return objectOnSegment8;
+      case 2u:
+        return objectOnSegment6;
+      default:
+        throw std::out_of_range("Test setup out of range");
+    }
+  }
+};
+
+TEST_F(RssRecordingSameDirectionTests, RecordAndReplay)
+{
+  performRecordAndReplay();
+}
+
+TEST_F(RssRecordingSameDirectionTests, RecordWorldModelView)
+{
+  std::vector<world::SceneView> sceneViews;
+  std::vector<world::CompactRoadArea> roadAreas(worldModel.scenes.size());
+  for (std::size_t i = 0u; i < worldModel.scenes.size(); ++i)
+  {
+    world::Scene const &scene = worldModel.scenes[i];
+    ASSERT_TRUE(world::convertToCompactRoadArea(scene.egoVehicleRoad, roadAreas[i]));
+    world::SceneView sceneView;
+    sceneView.situationType = scene.situationType;
+    sceneView.egoVehicle = world::createObjectView(scene.egoVehicle);
+    sceneView.object = world::createObjectView(scene.object);
+    sceneView.objectRssDynamics = &scene.objectRssDynamics;
+    sceneView.egoVehicleRoad = world::createRoadAreaView(roadAreas[i]);
+    sceneViews.push_back(sceneView);
+  }
+  world::WorldModelView worldModelView;
+  worldModelView.timeIndex = worldModel.timeIndex;
+  worldModelView.egoVehicleRssDynamics = worldModel.egoVehicleRssDynamics;
+  worldModelView.scenes = world::ArrayView<world::SceneView>(sceneViews);
+
+  RssRecordWriter writer;
+  ASSERT_TRUE(writer.open(mFileName));
+  ASSERT_TRUE(writer.writeFrame(worldModel));
+  ASSERT_TRUE(writer.writeFrame(worldModelView));
+  sceneViews[0].objectRssDynamics = nullptr;
+  EXPECT_FALSE(writer.writeFrame(worldModelView));
+  ASSERT_TRUE(writer.close());
+
+  // both representations result in identical frames
+  std::vector<std::uint8_t> const recording = readFile();
+  ASSERT_EQ((recording.size() - cFileHeaderSize) % 2u, 0u);
+  auto const firstFrame = recording.begin() + static_cast<std::ptrdiff_t>(cFileHeaderSize);
+  auto const secondFrame = firstFrame + static_cast<std::ptrdiff_t>((recording.size() - cFileHeaderSize) / 2u);
+  EXPECT_TRUE(std::equal(firstFrame, secondFrame, secondFrame));
+}
+
+TEST_F(RssRecordingSameDirectionTests, InvalidRecordings)
+{
+  RssRecordReader reader;
+  RssRecordFrame frame;
+  EXPECT_FALSE(reader.open(mFileName));
+  EXPECT_FALSE(reader.isOpen());
+  EXPECT_FALSE(reader.readNextFrame(frame));
+
+  RssRecordWriter writer;
+  ASSERT_TRUE(writer.open(mFileName));
+  ASSERT_TRUE(writer.writeFrame(worldModel));
+  ASSERT_TRUE(writer.close());
+  std::vector<std::uint8_t> recording = readFile();
+
+  ASSERT_TRUE(reader.open(recording.data(), recording.size()));
+  ASSERT_TRUE(reader.readNextFrame(frame));
+  EXPECT_TRUE(reader.isAtEnd());
+
+  // truncated frame
+  ASSERT_TRUE(reader.open(recording.data(), recording.size() - 8u));
+  EXPECT_FALSE(reader.readNextFrame(frame));
+  EXPECT_FALSE(reader.isAtEnd());
+
+  // truncated file header
+  EXPECT_FALSE(reader.open(recording.data(), cFileHeaderSize - 8u));
+
+  // misaligned data
+  EXPECT_FALSE(reader.open(recording.data() + 1u, recording.size() - 1u));
+
+  // wrong version
+  std::vector<std::uint8_t> invalidRecording = recording;
+  invalidRecording[4]++;
+  EXPECT_FALSE(reader.open(invalidRecording.data(), invalidRecording.size()));
+
+  // array outside of the frame: the first array of a scene record are the occupied regions of the ego vehicle,
+  // following the situation type (8 bytes), the object id and type (16 bytes) and the velocity
+  invalidRecording = recording;
+  std::size_t const frameBegin = cFileHeaderSize;
+  std::uint64_t frameSize = 0u;
+  std::memcpy(&frameSize, &invalidRecording[frameBegin], sizeof(frameSize));
+  std::uint64_t scenesOffset = 0u;
+  std::memcpy(&scenesOffset, &invalidRecording[frameBegin + 16u], sizeof(scenesOffset));
+  std::size_t const occupiedRegionsOffset
+    = frameBegin + static_cast<std::size_t>(scenesOffset) + 8u + 16u + sizeof(world::Velocity);
+  std::memcpy(&invalidRecording[occupiedRegionsOffset], &frameSize, sizeof(frameSize));
+  ASSERT_TRUE(reader.open(invalidRecording.data(), invalidRecording.size()));
+  EXPECT_FALSE(reader.readNextFrame(frame));
+}
+
+class RssRecordingIntersectionTests : public RssRecordingTestBase
+{
+protected:
+  ::ad_rss::world::Object &getEgoObject() override
+  {
+    return objectOnSegment0;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t) override
+  {
+    return objectOnSegment8;
+  }
+
+  situation::SituationType getSituationType() override
+  {
+    return situation::SituationType::IntersectionSamePriority;
+  }
+};
+
+TEST_F(RssRecordingIntersectionTests, RecordAndReplay)
+{
+  performRecordAndReplay();
+}
+
+} // namespace core
+} // namespace ad_rss
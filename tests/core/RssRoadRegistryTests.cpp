@@ -0,0 +1,370 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssCheckTestBaseT.hpp"
+
+namespace ad_rss {
+namespace core {
+
+template <class TESTBASE> class RssRoadRegistryTestBase : public TESTBASE
+{
+protected:
+  using TESTBASE::worldModel;
+
+  RoadHandle registerRoad(RssRoadRegistry &roadRegistry, world::RoadArea const &sceneRoadArea)
+  {
+    if (sceneRoadArea.empty())
+    {
+      return 0u;
+    }
+    // the static roads of the scenes are shared, register them only once
+    for (auto const &registeredRoad : mRegisteredRoads)
+    {
+      if (roadRegistry.getRegisteredRoad(registeredRoad)->roadArea == sceneRoadArea)
+      {
+        return registeredRoad;
+      }
+    }
+    RoadHandle roadHandle = 0u;
+    EXPECT_TRUE(roadRegistry.registerRoad(sceneRoadArea, roadHandle));
+    EXPECT_NE(roadHandle, 0u);
+    mRegisteredRoads.push_back(roadHandle);
+    return roadHandle;
+  }
+
+  RegisteredRoadWorldModel createRegisteredRoadWorldModel(RssRoadRegistry &roadRegistry)
+  {
+    RegisteredRoadWorldModel registeredRoadWorldModel;
+    registeredRoadWorldModel.timeIndex = worldModel.timeIndex;
+    registeredRoadWorldModel.egoVehicleRssDynamics = worldModel.egoVehicleRssDynamics;
+    for (auto const &scene : worldModel.scenes)
+    {
+      RegisteredRoadScene registeredRoadScene;
+      registeredRoadScene.situationType = scene.situationType;
+      registeredRoadScene.egoVehicle = scene.egoVehicle;
+      registeredRoadScene.object = scene.object;
+      registeredRoadScene.objectRssDynamics = scene.objectRssDynamics;
+      registeredRoadScene.egoVehicleRoad = registerRoad(roadRegistry, scene.egoVehicleRoad);
+      registeredRoadScene.intersectingRoad = registerRoad(roadRegistry, scene.intersectingRoad);
+      registeredRoadWorldModel.scenes.push_back(registeredRoadScene);
+    }
+    return registeredRoadWorldModel;
+  }
+
+  void performRoadRegistryComparison(RssCheck::ExecutionMode const executionMode)
+  {
+    RssCheck rssCheck(executionMode);
+    RssCheck registeredRoadRssCheck(executionMode);
+    mRegisteredRoads.clear();
+    RegisteredRoadWorldModel registeredRoadWorldModel
+      = createRegisteredRoadWorldModel(registeredRoadRssCheck.getRoadRegistry());
+    EXPECT_EQ(registeredRoadRssCheck.getRoadRegistry().size(), mRegisteredRoads.size());
+
+    for (uint32_t i = 0; i <= 90; i++)
+    {
+      for (std::size_t sceneIndex = 0u; sceneIndex < worldModel.scenes.size(); ++sceneIndex)
+      {
+        // only the occupied regions change from cycle to cycle
+        auto &occupiedRegion = worldModel.scenes[sceneIndex].egoVehicle.occupiedRegions[0];
+        occupiedRegion.lonRange.minimum = ParametricValue(0.01 * i);
+        occupiedRegion.lonRange.maximum = ParametricValue(0.01 * i + 0.1);
+        registeredRoadWorldModel.scenes[sceneIndex].egoVehicle.occupiedRegions[0] = occupiedRegion;
+      }
+      worldModel.timeIndex++;
+      registeredRoadWorldModel.timeIndex = worldModel.timeIndex;
+
+      world::AccelerationRestriction accelerationRestriction;
+      state::ProperResponse properResponse;
+      situation::SituationSnapshot situationSnapshot;
+      state::RssStateSnapshot rssStateSnapshot;
+      ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(
+        worldModel, accelerationRestriction, properResponse, &situationSnapshot, &rssStateSnapshot));
+
+      world::AccelerationRestriction registeredRoadAccelerationRestriction;
+      state::ProperResponse registeredRoadProperResponse;
+      situation::SituationSnapshot registeredRoadSituationSnapshot;
+      state::RssStateSnapshot registeredRoadRssStateSnapshot;
+      ASSERT_TRUE(registeredRoadRssCheck.calculateAccelerationRestriction(registeredRoadWorldModel,
+                                                                          registeredRoadAccelerationRestriction,
+                                                                          registeredRoadProperResponse,
+                                                                          &registeredRoadSituationSnapshot,
+                                                                          &registeredRoadRssStateSnapshot));
+
+      EXPECT_EQ(situationSnapshot, registeredRoadSituationSnapshot);
+      EXPECT_EQ(rssStateSnapshot, registeredRoadRssStateSnapshot);
+      EXPECT_EQ(properResponse, registeredRoadProperResponse);
+      EXPECT_EQ(accelerationRestriction, registeredRoadAccelerationRestriction);
+    }
+  }
+
+  std::vector<RoadHandle> mRegisteredRoads;
+};
+
+class RssRoadRegistrySameDirectionTests : public RssRoadRegistryTestBase<RssCheckTestBase>
+{
+protected:
+  uint32_t getNumberOfSceneObjects() override
+  {
+    return 3u;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t objectIndex) override
+  {
+    switch (objectIndex)
+    {
+      case 0u:
+        return objectOnSegment7;
+      case 1u:
+        return objectOnSegment8;
+      case 2u:
+        return objectOnSegment6;
+      default:
+        throw std::out_of_range("Test setup out of range");
+    }
+  }
+};
+
+TEST_F(RssRoadRegistrySameDirectionTests, IdenticalResultsStaged)
+{
+  performRoadRegistryComparison(RssCheck::ExecutionMode::Staged);
+  // all scenes share the same road
+  EXPECT_EQ(mRegisteredRoads.size(), 1u);
+}
+
+TEST_F(RssRoadRegistrySameDirectionTests, IdenticalResultsFused)
+{
+  performRoadRegistryComparison(RssCheck::ExecutionMode::Fused);
+}
+
+TEST_F(RssRoadRegistrySameDirectionTests, RegisterAndUnregister)
+{
+  RssRoadRegistry roadRegistry;
+  EXPECT_EQ(roadRegistry.size(), 0u);
+  ASSERT_NE(roadRegistry.getRegisteredRoad(0u), nullptr);
+  EXPECT_TRUE(roadRegistry.getRegisteredRoad(0u)->roadArea.empty());
+  EXPECT_EQ(roadRegistry.getRegisteredRoad(1u), nullptr);
+
+  RoadHandle firstRoadHandle = 0u;
+  ASSERT_TRUE(roadRegistry.registerRoad(worldModel.scenes[0].egoVehicleRoad, firstRoadHandle));
+  RoadHandle secondRoadHandle = 0u;
+  ASSERT_TRUE(roadRegistry.registerRoad(worldModel.scenes[0].egoVehicleRoad, secondRoadHandle));
+  EXPECT_NE(firstRoadHandle, secondRoadHandle);
+  EXPECT_EQ(roadRegistry.size(), 2u);
+
+  auto const registeredRoad = roadRegistry.getRegisteredRoad(firstRoadHandle);
+  ASSERT_NE(registeredRoad, nullptr);
+  EXPECT_EQ(registeredRoad->roadArea, worldModel.scenes[0].egoVehicleRoad);
+  // one lateral range per lane segment column plus the outer border
+  EXPECT_EQ(registeredRoad->lateralRanges.size(), worldModel.scenes[0].egoVehicleRoad[0].size() + 1u);
+  EXPECT_TRUE(registeredRoad->intersectionArea.empty());
+
+  auto const &compactRoadArea = registeredRoad->compactRoadArea;
+  ASSERT_EQ(compactRoadArea.getNumberOfRoadSegments(), worldModel.scenes[0].egoVehicleRoad.size());
+  for (std::size_t roadSegmentIndex = 0u; roadSegmentIndex < compactRoadArea.getNumberOfRoadSegments();
+       roadSegmentIndex++)
+  {
+    auto const &roadSegment = worldModel.scenes[0].egoVehicleRoad[roadSegmentIndex];
+    ASSERT_EQ(compactRoadArea.getNumberOfLaneSegments(roadSegmentIndex), roadSegment.size());
+    for (std::size_t laneSegmentIndex = 0u; laneSegmentIndex < roadSegment.size(); laneSegmentIndex++)
+    {
+      auto const index = compactRoadArea.getIndex(roadSegmentIndex, laneSegmentIndex);
+      EXPECT_EQ(compactRoadArea.laneSegments[index], roadSegment[laneSegmentIndex]);
+      EXPECT_EQ(compactRoadArea.lengthMinimum[index], roadSegment[laneSegmentIndex].length.minimum);
+      EXPECT_EQ(compactRoadArea.lengthMaximum[index], roadSegment[laneSegmentIndex].length.maximum);
+      EXPECT_EQ(compactRoadArea.widthMinimum[index], roadSegment[laneSegmentIndex].width.minimum);
+      EXPECT_EQ(compactRoadArea.widthMaximum[index], roadSegment[laneSegmentIndex].width.maximum);
+    }
+  }
+
+  EXPECT_TRUE(roadRegistry.unregisterRoad(firstRoadHandle));
+  EXPECT_FALSE(roadRegistry.unregisterRoad(firstRoadHandle));
+  EXPECT_EQ(roadRegistry.getRegisteredRoad(firstRoadHandle), nullptr);
+  EXPECT_NE(roadRegistry.getRegisteredRoad(secondRoadHandle), nullptr);
+
+  // handles are not reused
+  RoadHandle thirdRoadHandle = 0u;
+  ASSERT_TRUE(roadRegistry.registerRoad(worldModel.scenes[0].egoVehicleRoad, thirdRoadHandle));
+  EXPECT_NE(firstRoadHandle, thirdRoadHandle);
+  EXPECT_NE(secondRoadHandle, thirdRoadHandle);
+
+  roadRegistry.clear();
+  EXPECT_EQ(roadRegistry.size(), 0u);
+  EXPECT_EQ(roadRegistry.getRegisteredRoad(thirdRoadHandle), nullptr);
+}
+
+TEST_F(RssRoadRegistrySameDirectionTests, RoadSegmentsOfDifferentSize)
+{
+  // drop the outermost lane segment of the first road segment
+  for (auto &scene : worldModel.scenes)
+  {
+    scene.egoVehicleRoad[0].pop_back();
+  }
+  performRoadRegistryComparison(RssCheck::ExecutionMode::Staged);
+
+  RssRoadRegistry roadRegistry;
+  RoadHandle roadHandle = 0u;
+  ASSERT_TRUE(roadRegistry.registerRoad(worldModel.scenes[0].egoVehicleRoad, roadHandle));
+  auto const registeredRoad = roadRegistry.getRegisteredRoad(roadHandle);
+  ASSERT_NE(registeredRoad, nullptr);
+  auto const &compactRoadArea = registeredRoad->compactRoadArea;
+  ASSERT_EQ(compactRoadArea.getNumberOfRoadSegments(), 3u);
+  EXPECT_EQ(compactRoadArea.getNumberOfLaneSegments(0u), 2u);
+  EXPECT_EQ(compactRoadArea.getNumberOfLaneSegments(1u), 3u);
+  EXPECT_EQ(compactRoadArea.getNumberOfLaneSegments(2u), 3u);
+  EXPECT_EQ(compactRoadArea.laneSegments.size(), 8u);
+  EXPECT_EQ(compactRoadArea.laneSegments[compactRoadArea.getIndex(1u, 0u)].id, world::LaneSegmentId(3));
+  EXPECT_EQ(registeredRoad->lateralRanges.size(), 4u);
+}
+
+TEST_F(RssRoadRegistrySameDirectionTests, InvalidRoad)
+{
+  RssRoadRegistry roadRegistry;
+  RoadHandle roadHandle = 0u;
+  auto invalidRoadArea = worldModel.scenes[0].egoVehicleRoad;
+  invalidRoadArea[0][0].length.minimum = Distance(-1.);
+  EXPECT_FALSE(roadRegistry.registerRoad(invalidRoadArea, roadHandle));
+  EXPECT_EQ(roadHandle, 0u);
+  EXPECT_EQ(roadRegistry.size(), 0u);
+}
+
+TEST_F(RssRoadRegistrySameDirectionTests, UnknownRoadHandle)
+{
+  RssCheck rssCheck;
+  mRegisteredRoads.clear();
+  auto registeredRoadWorldModel = createRegisteredRoadWorldModel(rssCheck.getRoadRegistry());
+  world::AccelerationRestriction accelerationRestriction;
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(registeredRoadWorldModel, accelerationRestriction));
+
+  ASSERT_TRUE(rssCheck.getRoadRegistry().unregisterRoad(registeredRoadWorldModel.scenes[1].egoVehicleRoad));
+  registeredRoadWorldModel.timeIndex++;
+  ASSERT_FALSE(rssCheck.calculateAccelerationRestriction(registeredRoadWorldModel, accelerationRestriction));
+}
+
+TEST_F(RssRoadRegistrySameDirectionTests, UnknownRoadHandleOfNotRelevantScene)
+{
+  for (auto const executionMode : {RssCheck::ExecutionMode::Staged, RssCheck::ExecutionMode::Fused})
+  {
+    RssCheck rssCheck(executionMode);
+    mRegisteredRoads.clear();
+    auto registeredRoadWorldModel = createRegisteredRoadWorldModel(rssCheck.getRoadRegistry());
+    registeredRoadWorldModel.scenes[1].situationType = situation::SituationType::NotRelevant;
+    registeredRoadWorldModel.scenes[1].egoVehicleRoad = 12345u;
+    registeredRoadWorldModel.scenes[1].intersectingRoad = 12346u;
+    ASSERT_EQ(rssCheck.getRoadRegistry().getRegisteredRoad(12345u), nullptr);
+
+    // the road of a not relevant scene is never read, the remaining scenes are still evaluated
+    world::AccelerationRestriction accelerationRestriction;
+    state::ProperResponse properResponse;
+    situation::SituationSnapshot situationSnapshot;
+    state::RssStateSnapshot rssStateSnapshot;
+    ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(
+      registeredRoadWorldModel, accelerationRestriction, properResponse, &situationSnapshot, &rssStateSnapshot));
+    EXPECT_EQ(situationSnapshot.situations.size(), registeredRoadWorldModel.scenes.size() - 1u);
+
+    // the same handles within a relevant scene are rejected
+    registeredRoadWorldModel.scenes[1].situationType = situation::SituationType::SameDirection;
+    registeredRoadWorldModel.timeIndex++;
+    EXPECT_FALSE(rssCheck.calculateAccelerationRestriction(registeredRoadWorldModel, accelerationRestriction));
+  }
+}
+
+TEST_F(RssRoadRegistrySameDirectionTests, CheckpointDoesNotContainRoadRegistry)
+{
+  RssCheck rssCheck;
+  mRegisteredRoads.clear();
+  auto registeredRoadWorldModel = createRegisteredRoadWorldModel(rssCheck.getRoadRegistry());
+  world::AccelerationRestriction accelerationRestriction;
+  state::ProperResponse properResponse;
+  ASSERT_TRUE(rssCheck.calculateAccelerationRestriction(registeredRoadWorldModel, accelerationRestriction));
+
+  std::vector<std::uint8_t> checkpoint;
+  ASSERT_TRUE(rssCheck.saveCheckpoint(checkpoint));
+  RssCheck restoredRssCheck;
+  ASSERT_TRUE(restoredRssCheck.restoreCheckpoint(checkpoint));
+  EXPECT_EQ(restoredRssCheck.getRoadRegistry().size(), 0u);
+
+  // the handles are unknown to the restored RssCheck until the roads are registered again
+  registeredRoadWorldModel.timeIndex++;
+  world::AccelerationRestriction restoredAccelerationRestriction;
+  state::ProperResponse restoredProperResponse;
+  EXPECT_FALSE(restoredRssCheck.calculateAccelerationRestriction(
+    registeredRoadWorldModel, restoredAccelerationRestriction, restoredProperResponse));
+
+  // registering the same roads in the same order reproduces the handles
+  std::vector<RoadHandle> const registeredRoads = mRegisteredRoads;
+  for (auto const &roadHandle : registeredRoads)
+  {
+    RoadHandle restoredRoadHandle = 0u;
+    ASSERT_TRUE(restoredRssCheck.getRoadRegistry().registerRoad(
+      rssCheck.getRoadRegistry().getRegisteredRoad(roadHandle)->roadArea, restoredRoadHandle));
+    EXPECT_EQ(restoredRoadHandle, roadHandle);
+  }
+
+  registeredRoadWorldModel.timeIndex++;
+  ASSERT_TRUE(
+    rssCheck.calculateAccelerationRestriction(registeredRoadWorldModel, accelerationRestriction, properResponse));
+  ASSERT_TRUE(restoredRssCheck.calculateAccelerationRestriction(
+    registeredRoadWorldModel, restoredAccelerationRestriction, restoredProperResponse));
+  EXPECT_EQ(properResponse, restoredProperResponse);
+  EXPECT_EQ(accelerationRestriction, restoredAccelerationRestriction);
+}
+
+class RssRoadRegistryIntersectionTests : public RssRoadRegistryTestBase<RssCheckTestBase>
+{
+protected:
+  situation::SituationType getSituationType() override
+  {
+    return situation::SituationType::IntersectionSamePriority;
+  }
+
+  ::ad_rss::world::Object &getEgoObject() override
+  {
+    return objectOnSegment0;
+  }
+
+  ::ad_rss::world::Object &getSceneObject(uint32_t) override
+  {
+    return objectOnSegment8;
+  }
+};
+
+TEST_F(RssRoadRegistryIntersectionTests, IdenticalResults)
+{
+  performRoadRegistryComparison(RssCheck::ExecutionMode::Staged);
+  for (auto &scene : worldModel.scenes)
+  {
+    scene.egoVehicle.occupiedRegions[0].segmentId = world::LaneSegmentId(3);
+  }
+  performRoadRegistryComparison(RssCheck::ExecutionMode::Fused);
+}
+
+} // namespace core
+} // namespace ad_rss
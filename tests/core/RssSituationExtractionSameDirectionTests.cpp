@@ -462,5 +462,45 @@ TEST_F(RssSituationExtractionSameDirectionTests, mergeFails)
   EXPECT_EQ(situationSnapshot.situations.size(), 1);
 }
 
+TEST_F(RssSituationExtractionSameDirectionTests, replacedDynamics)
+{
+  scene.egoVehicle = objectAsEgo(followingObject);
+  scene.object = leadingObject;
+  scene.egoVehicleRoad.push_back(longitudinalDifferenceRoadSegment());
+  worldModel.scenes.push_back(scene);
+  scene.egoVehicleRoad.clear();
+  scene.egoVehicleRoad.push_back(longitudinalNoDifferenceRoadSegment());
+  worldModel.scenes.push_back(scene);
+  worldModel.timeIndex = 1;
+
+  world::RssDynamics egoDynamics = getEgoRssDynamics();
+  egoDynamics.responseTime = Duration(0.7);
+  world::RssDynamics objectDynamics = getObjectRssDynamics();
+  objectDynamics.alphaLon.brakeMax = Acceleration(9.);
+
+  // the extraction of a copy with the dynamics replaced
+  world::WorldModel replacedWorldModel = worldModel;
+  replacedWorldModel.egoVehicleRssDynamics = egoDynamics;
+  for (auto &replacedScene : replacedWorldModel.scenes)
+  {
+    replacedScene.objectRssDynamics = objectDynamics;
+  }
+  RssSituationIdState expectedSituationIdState;
+  situation::SituationSnapshot expectedSituationSnapshot;
+  ASSERT_TRUE(situationExtraction.extractSituations(
+    replacedWorldModel, expectedSituationIdState, expectedSituationSnapshot));
+
+  RssSituationIdState situationIdState;
+  situation::SituationSnapshot situationSnapshot;
+  ASSERT_TRUE(
+    situationExtraction.extractSituations(worldModel, egoDynamics, objectDynamics, situationIdState, situationSnapshot));
+  EXPECT_EQ(situationSnapshot, expectedSituationSnapshot);
+  EXPECT_EQ(situationSnapshot.situations[0].egoVehicleState.dynamics.responseTime, Duration(0.7));
+
+  objectDynamics.alphaLon.brakeMax = Acceleration(-1.);
+  EXPECT_FALSE(
+    situationExtraction.extractSituations(worldModel, egoDynamics, objectDynamics, situationIdState, situationSnapshot));
+}
+
 } // namespace core
 } // namespace ad_rss
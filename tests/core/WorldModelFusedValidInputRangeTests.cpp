@@ -0,0 +1,264 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+#include "RssCheckTestBaseT.hpp"
+#include "ad_rss/world/WorldModelFusedValidInputRange.hpp"
+#include "ad_rss/world/WorldModelValidInputRange.hpp"
+#include "world/WorldModelFusedInputRanges.hpp"
+
+namespace ad_rss {
+namespace world {
+
+class WorldModelFusedValidInputRangeTests : public core::RssCheckTestBase
+{
+protected:
+  virtual void SetUp()
+  {
+    core::RssCheckTestBase::SetUp();
+    // a second scene to ensure the scenes are traversed in order
+    worldModel.scenes.push_back(worldModel.scenes[0]);
+    worldModel.scenes[1].object.objectId++;
+  }
+
+  /*
+   * Check the fused validation against the generated one and the reported member.
+   */
+  void expectResult(bool const expectedResult, std::string const &expectedInvalidMember)
+  {
+    ASSERT_EQ(expectedResult, withinValidInputRange(worldModel));
+    EXPECT_EQ(expectedResult, withinValidInputRangeFused(worldModel));
+    std::string invalidMember = "unchanged";
+    EXPECT_EQ(expectedResult, withinValidInputRangeFused(worldModel, invalidMember));
+    EXPECT_EQ(expectedInvalidMember, invalidMember);
+  }
+
+  void expectInvalid(std::function<void(WorldModel &)> const &modification, std::string const &expectedInvalidMember)
+  {
+    WorldModel const validWorldModel = worldModel;
+    modification(worldModel);
+    expectResult(false, expectedInvalidMember);
+    worldModel = validWorldModel;
+  }
+};
+
+TEST_F(WorldModelFusedValidInputRangeTests, valid)
+{
+  ASSERT_GT(worldModel.scenes.size(), 1u);
+  expectResult(true, "");
+}
+
+TEST_F(WorldModelFusedValidInputRangeTests, invalid_members)
+{
+  expectInvalid([](WorldModel &model) { model.timeIndex = 0u; }, "timeIndex");
+  expectInvalid([](WorldModel &model) { model.egoVehicleRssDynamics.responseTime = physics::Duration(11.); },
+                "egoVehicleRssDynamics.responseTime");
+  expectInvalid([](WorldModel &model) { model.egoVehicleRssDynamics.alphaLat.brakeMin = physics::Acceleration(0.); },
+                "egoVehicleRssDynamics.alphaLat.brakeMin");
+  expectInvalid(
+    [](WorldModel &model) {
+      model.egoVehicleRssDynamics.alphaLon.brakeMin
+        = physics::Acceleration(static_cast<double>(model.egoVehicleRssDynamics.alphaLon.brakeMax) + 1.);
+    },
+    "egoVehicleRssDynamics.alphaLon.brakeMax");
+  expectInvalid(
+    [](WorldModel &model) {
+      model.scenes[1].objectRssDynamics.lateralFluctuationMargin
+        = physics::Distance(std::numeric_limits<double>::quiet_NaN());
+    },
+    "scenes[1].objectRssDynamics.lateralFluctuationMargin");
+  expectInvalid([](WorldModel &model) { model.scenes[1].object.velocity.speedLon = physics::Speed(-1.); },
+                "scenes[1].object.velocity.speedLon");
+  expectInvalid([](WorldModel &model) { model.scenes[0].egoVehicle.objectType = static_cast<ObjectType>(42); },
+                "scenes[0].egoVehicle.objectType");
+  expectInvalid(
+    [](WorldModel &model) {
+      model.scenes[1].object.occupiedRegions[0].latRange.minimum = physics::ParametricValue(0.8);
+      model.scenes[1].object.occupiedRegions[0].latRange.maximum = physics::ParametricValue(0.2);
+    },
+    "scenes[1].object.occupiedRegions[0].latRange.maximum");
+  expectInvalid(
+    [](WorldModel &model) {
+      model.scenes[0].egoVehicleRoad[0][0].width.maximum = physics::Distance(std::numeric_limits<double>::denorm_min());
+    },
+    "scenes[0].egoVehicleRoad[0][0].width.maximum");
+  expectInvalid([](WorldModel &model) { model.scenes[0].egoVehicleRoad[0].clear(); }, "scenes[0].egoVehicleRoad[0]");
+  expectInvalid([](WorldModel &model) { model.scenes.resize(1001u, model.scenes[0]); }, "scenes");
+}
+
+TEST_F(WorldModelFusedValidInputRangeTests, first_invalid_member_is_reported)
+{
+  expectInvalid(
+    [](WorldModel &model) {
+      model.scenes[1].object.velocity.speedLat = physics::Speed(20.);
+      model.scenes[0].objectRssDynamics.alphaLon.brakeMinCorrect = physics::Acceleration(-1.);
+      model.scenes[1].situationType = static_cast<situation::SituationType>(42);
+    },
+    "scenes[0].objectRssDynamics.alphaLon.brakeMinCorrect");
+}
+
+TEST_F(WorldModelFusedValidInputRangeTests, boundaries_within_precision)
+{
+  WorldModel const validWorldModel = worldModel;
+  for (double const speed : {-0.0015, -0.0005, 0., 100.0005, 100.0015})
+  {
+    worldModel.scenes[0].object.velocity.speedLon = physics::Speed(speed);
+    expectResult(withinValidInputRange(worldModel),
+                 withinValidInputRange(worldModel) ? "" : "scenes[0].object.velocity.speedLon");
+  }
+  worldModel = validWorldModel;
+  for (double const responseTime : {0.0005, 0.001, 0.0015, 10.0005, 10.0015})
+  {
+    worldModel.egoVehicleRssDynamics.responseTime = physics::Duration(responseTime);
+    expectResult(withinValidInputRange(worldModel),
+                 withinValidInputRange(worldModel) ? "" : "egoVehicleRssDynamics.responseTime");
+  }
+  worldModel = validWorldModel;
+  for (double const margin : {-0.0015, -0.0005, 1.0005, 1.0015})
+  {
+    worldModel.egoVehicleRssDynamics.lateralFluctuationMargin = physics::Distance(margin);
+    expectResult(withinValidInputRange(worldModel),
+                 withinValidInputRange(worldModel) ? "" : "egoVehicleRssDynamics.lateralFluctuationMargin");
+  }
+}
+
+TEST_F(WorldModelFusedValidInputRangeTests, input_ranges_equal_generated_validators)
+{
+  // one member per kind of range check, set together with the members it is ordered with
+  std::vector<std::function<void(WorldModel &, double)>> const setMember = {
+    // ParametricValueRange
+    [](WorldModel &model, double const value) {
+      model.scenes[1].object.occupiedRegions[0].lonRange.minimum = physics::ParametricValue(value);
+      model.scenes[1].object.occupiedRegions[0].lonRange.maximum = physics::ParametricValue(value);
+    },
+    // DistanceRange
+    [](WorldModel &model, double const value) {
+      model.scenes[0].egoVehicleRoad[0][0].length.minimum = physics::Distance(value);
+      model.scenes[0].egoVehicleRoad[0][0].length.maximum = physics::Distance(value);
+    },
+    // LateralFluctuationMarginRange
+    [](WorldModel &model, double const value) {
+      model.egoVehicleRssDynamics.lateralFluctuationMargin = physics::Distance(value);
+    },
+    // SpeedLonRange
+    [](WorldModel &model, double const value) { model.scenes[0].egoVehicle.velocity.speedLon = physics::Speed(value); },
+    // SpeedLatRange
+    [](WorldModel &model, double const value) { model.scenes[1].object.velocity.speedLat = physics::Speed(value); },
+    // AccelerationRange
+    [](WorldModel &model, double const value) {
+      model.scenes[1].objectRssDynamics.alphaLon.brakeMax = physics::Acceleration(value);
+    },
+    // NonNegativeAccelerationRange
+    [](WorldModel &model, double const value) {
+      model.egoVehicleRssDynamics.alphaLon.accelMax = physics::Acceleration(value);
+    },
+    // PositiveAccelerationRange
+    [](WorldModel &model, double const value) {
+      model.egoVehicleRssDynamics.alphaLat.brakeMin = physics::Acceleration(value);
+    },
+    // ResponseTimeRange
+    [](WorldModel &model, double const value) {
+      model.scenes[0].objectRssDynamics.responseTime = physics::Duration(value);
+    },
+  };
+  ASSERT_EQ(static_cast<std::size_t>(fused::NumberOfRangeKinds), setMember.size());
+
+  WorldModel const validWorldModel = worldModel;
+  for (std::size_t rangeKind = 0u; rangeKind < setMember.size(); ++rangeKind)
+  {
+    fused::InputRange const inputRange = fused::getInputRange(static_cast<fused::RangeKind>(rangeKind));
+    for (double const bound : {inputRange.lowerBound, inputRange.upperBound})
+    {
+      for (double const offset : {-1.5, -1., -0.5, 0., 0.5, 1., 1.5})
+      {
+        setMember[rangeKind](worldModel, bound + offset * inputRange.precision);
+        bool const expectedResult = withinValidInputRange(worldModel);
+        EXPECT_EQ(expectedResult, withinValidInputRangeFused(worldModel)) << rangeKind << " " << bound << " " << offset;
+        std::string invalidMember;
+        EXPECT_EQ(expectedResult, withinValidInputRangeFused(worldModel, invalidMember));
+        EXPECT_EQ(expectedResult, invalidMember.empty());
+      }
+    }
+    for (double const value : {std::numeric_limits<double>::quiet_NaN(),
+                               std::numeric_limits<double>::infinity(),
+                               std::numeric_limits<double>::denorm_min(),
+                               -std::numeric_limits<double>::denorm_min()})
+    {
+      setMember[rangeKind](worldModel, value);
+      EXPECT_EQ(withinValidInputRange(worldModel), withinValidInputRangeFused(worldModel)) << rangeKind << " " << value;
+    }
+    worldModel = validWorldModel;
+  }
+}
+
+TEST_F(WorldModelFusedValidInputRangeTests, size_limits_equal_generated_validators)
+{
+  WorldModel const validWorldModel = worldModel;
+  auto const expectGeneratedResult = [this, &validWorldModel](std::string const &limit) {
+    EXPECT_EQ(withinValidInputRange(worldModel), withinValidInputRangeFused(worldModel)) << limit;
+    worldModel = validWorldModel;
+  };
+
+  worldModel.timeIndex = fused::cMinTimeIndex;
+  expectGeneratedResult("cMinTimeIndex");
+  worldModel.timeIndex = fused::cMinTimeIndex - 1u;
+  expectGeneratedResult("cMinTimeIndex - 1");
+
+  for (std::size_t const size : {fused::cMaxNumberOfScenes, fused::cMaxNumberOfScenes + 1u})
+  {
+    worldModel.scenes.resize(size, worldModel.scenes[0]);
+    expectGeneratedResult("cMaxNumberOfScenes");
+  }
+  for (std::size_t const size : {fused::cMaxNumberOfOccupiedRegions, fused::cMaxNumberOfOccupiedRegions + 1u})
+  {
+    worldModel.scenes[1].object.occupiedRegions.resize(size, worldModel.scenes[1].object.occupiedRegions[0]);
+    expectGeneratedResult("cMaxNumberOfOccupiedRegions");
+  }
+  for (std::size_t const size : {fused::cMaxNumberOfRoadSegments, fused::cMaxNumberOfRoadSegments + 1u})
+  {
+    worldModel.scenes[0].egoVehicleRoad.resize(size, worldModel.scenes[0].egoVehicleRoad[0]);
+    expectGeneratedResult("cMaxNumberOfRoadSegments");
+  }
+  for (std::size_t const size : {fused::cMinNumberOfLaneSegments - 1u,
+                                 fused::cMinNumberOfLaneSegments,
+                                 fused::cMaxNumberOfLaneSegments,
+                                 fused::cMaxNumberOfLaneSegments + 1u})
+  {
+    worldModel.scenes[0].egoVehicleRoad[0].resize(size, validWorldModel.scenes[0].egoVehicleRoad[0][0]);
+    expectGeneratedResult("number of lane segments");
+  }
+}
+
+} // namespace world
+} // namespace ad_rss
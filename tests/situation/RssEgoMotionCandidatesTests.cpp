@@ -0,0 +1,240 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "TestSupport.hpp"
+#include "ad_rss/core/RssSituationChecking.hpp"
+#include "ad_rss/situation/RssEgoMotionCandidates.hpp"
+#include "ad_rss/state/RssStateOperation.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+class RssEgoMotionCandidatesTests : public testing::Test
+{
+protected:
+  virtual void SetUp()
+  {
+    situationSnapshot.timeIndex = 1u;
+    // same direction: other in front, ego in front, lateral separated
+    addSituation(situationSnapshot,
+                 SituationType::SameDirection,
+                 createRelativeLongitudinalPosition(LongitudinalRelativePosition::InFront, Distance(60.)),
+                 50.,
+                 30.);
+    addSituation(situationSnapshot,
+                 SituationType::SameDirection,
+                 createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(15.)),
+                 50.,
+                 50.);
+    RelativePosition lateralPosition = createRelativeLateralPosition(LateralRelativePosition::AtRight, Distance(1.));
+    lateralPosition.longitudinalPosition = LongitudinalRelativePosition::AtBack;
+    lateralPosition.longitudinalDistance = Distance(5.);
+    addSituation(situationSnapshot, SituationType::SameDirection, lateralPosition, 50., 40., 3.);
+    lateralPosition.lateralPosition = LateralRelativePosition::AtLeft;
+    addSituation(situationSnapshot, SituationType::SameDirection, lateralPosition, 50., 40., -3.);
+    // opposite direction: ego in the correct lane and in the wrong lane
+    addSituation(situationSnapshot,
+                 SituationType::OppositeDirection,
+                 createRelativeLongitudinalPosition(LongitudinalRelativePosition::InFront, Distance(120.)),
+                 50.,
+                 50.);
+    addSituation(situationSnapshot,
+                 SituationType::OppositeDirection,
+                 createRelativeLongitudinalPosition(LongitudinalRelativePosition::InFront, Distance(150.)),
+                 50.,
+                 30.);
+    situationSnapshot.situations.back().egoVehicleState.isInCorrectLane = false;
+    situationSnapshot.situations.back().otherVehicleState.isInCorrectLane = true;
+    // intersection: ego without priority, approaching
+    addSituation(situationSnapshot,
+                 SituationType::IntersectionObjectHasPriority,
+                 createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(20.)),
+                 50.,
+                 30.);
+    situationSnapshot.situations.back().egoVehicleState.distanceToEnterIntersection = Distance(40.);
+    situationSnapshot.situations.back().egoVehicleState.distanceToLeaveIntersection = Distance(50.);
+    situationSnapshot.situations.back().otherVehicleState.hasPriority = true;
+    situationSnapshot.situations.back().otherVehicleState.distanceToEnterIntersection = Distance(20.);
+    situationSnapshot.situations.back().otherVehicleState.distanceToLeaveIntersection = Distance(30.);
+    addSituation(situationSnapshot,
+                 SituationType::NotRelevant,
+                 createRelativeLongitudinalPosition(LongitudinalRelativePosition::Overlap, Distance(0.)),
+                 50.,
+                 30.);
+
+    for (double speed = 0.; speed <= 120.; speed += 10.)
+    {
+      for (double acceleration = -2.; acceleration <= 4.; acceleration += 3.)
+      {
+        EgoMotionCandidate candidate;
+        candidate.velocity = createVehicleState(speed, 0.).velocity;
+        candidate.velocity.speedLat.minimum = kmhToMeterPerSec(-1.);
+        candidate.velocity.speedLat.maximum = kmhToMeterPerSec(1.);
+        candidate.accelerationLon = Acceleration(acceleration);
+        candidates.push_back(candidate);
+      }
+    }
+  }
+
+  /*
+   * The rss states of the candidate evaluated by the situation checks.
+   */
+  state::RssStateSnapshot checkCandidate(EgoMotionCandidate const &candidate)
+  {
+    SituationSnapshot candidateSnapshot = situationSnapshot;
+    for (auto &situation : candidateSnapshot.situations)
+    {
+      situation.egoVehicleState.velocity = candidate.velocity;
+      situation.egoVehicleState.dynamics.alphaLon.accelMax = std::max(
+        Acceleration(0.), std::min(situation.egoVehicleState.dynamics.alphaLon.accelMax, candidate.accelerationLon));
+    }
+    core::RssSituationChecking situationChecking;
+    state::RssStateSnapshot rssStateSnapshot;
+    EXPECT_TRUE(situationChecking.checkSituations(candidateSnapshot, rssStateSnapshot));
+    return rssStateSnapshot;
+  }
+
+  SituationSnapshot situationSnapshot;
+  std::vector<EgoMotionCandidate> candidates;
+};
+
+TEST_F(RssEgoMotionCandidatesTests, IdenticalToSituationChecking)
+{
+  std::vector<EgoMotionCandidateResult> candidateResults;
+  ASSERT_TRUE(evaluateEgoMotionCandidates(situationSnapshot, candidates, candidateResults));
+  ASSERT_EQ(candidateResults.size(), candidates.size());
+
+  std::size_t numberOfSafeCandidates = 0u;
+  for (std::size_t c = 0u; c < candidates.size(); ++c)
+  {
+    state::RssStateSnapshot const rssStateSnapshot = checkCandidate(candidates[c]);
+    ASSERT_EQ(rssStateSnapshot.individualResponses.size(), situationSnapshot.situations.size());
+    std::size_t numberOfDangerousSituations = 0u;
+    for (auto const &rssState : rssStateSnapshot.individualResponses)
+    {
+      if (state::isDangerous(rssState))
+      {
+        numberOfDangerousSituations++;
+      }
+    }
+    EgoMotionCandidateResult const &candidateResult = candidateResults[c];
+    EXPECT_EQ(candidateResult.numberOfDangerousSituations, numberOfDangerousSituations) << c;
+    EXPECT_EQ(candidateResult.isSafe, numberOfDangerousSituations == 0u) << c;
+    ASSERT_LT(candidateResult.criticalSituationIndex, situationSnapshot.situations.size());
+
+    state::RssState const &criticalRssState
+      = rssStateSnapshot.individualResponses[candidateResult.criticalSituationIndex];
+    EXPECT_EQ(state::isDangerous(criticalRssState), !candidateResult.isSafe);
+    state::RssStateInformation const &information = criticalRssState.longitudinalState.rssStateInformation;
+    EXPECT_NEAR(static_cast<double>(candidateResult.longitudinalMargin),
+                static_cast<double>(information.currentDistance - information.safeDistance),
+                cDoubleNear);
+    if (candidateResult.isSafe)
+    {
+      numberOfSafeCandidates++;
+      EXPECT_GT(std::max(candidateResult.longitudinalMargin, candidateResult.lateralMargin), Distance(0.));
+    }
+  }
+  // the surroundings allow the slow candidates only
+  EXPECT_GT(numberOfSafeCandidates, 0u);
+  EXPECT_LT(numberOfSafeCandidates, candidates.size());
+  EXPECT_TRUE(candidateResults.front().isSafe);
+  EXPECT_FALSE(candidateResults.back().isSafe);
+}
+
+TEST_F(RssEgoMotionCandidatesTests, Acceleration)
+{
+  // only the other vehicle in front
+  situationSnapshot.situations.erase(situationSnapshot.situations.begin());
+  situationSnapshot.situations.resize(1u);
+  candidates.resize(1u);
+  candidates[0].velocity = createVehicleState(50., 0.).velocity;
+  candidates[0].accelerationLon = Acceleration(0.);
+  EgoMotionCandidate accelerating = candidates[0];
+  accelerating.accelerationLon = Acceleration(2.);
+  candidates.push_back(accelerating);
+  // not above the acceleration of the dynamics
+  accelerating.accelerationLon = Acceleration(50.);
+  candidates.push_back(accelerating);
+  candidates.push_back(EgoMotionCandidate());
+  candidates.back().velocity = candidates[0].velocity;
+
+  std::vector<EgoMotionCandidateResult> candidateResults;
+  ASSERT_TRUE(evaluateEgoMotionCandidates(situationSnapshot, candidates, candidateResults));
+  ASSERT_EQ(candidateResults.size(), 4u);
+  EXPECT_GT(candidateResults[0].longitudinalMargin, candidateResults[1].longitudinalMargin);
+  EXPECT_GT(candidateResults[1].longitudinalMargin, candidateResults[2].longitudinalMargin);
+  EXPECT_EQ(candidateResults[2].longitudinalMargin, candidateResults[3].longitudinalMargin);
+  EXPECT_EQ(candidateResults[0].lateralMargin, Distance(0.));
+}
+
+TEST_F(RssEgoMotionCandidatesTests, EmptyInput)
+{
+  std::vector<EgoMotionCandidateResult> candidateResults;
+  ASSERT_TRUE(evaluateEgoMotionCandidates(situationSnapshot, std::vector<EgoMotionCandidate>(), candidateResults));
+  EXPECT_TRUE(candidateResults.empty());
+
+  SituationSnapshot emptySnapshot;
+  emptySnapshot.timeIndex = 1u;
+  ASSERT_TRUE(evaluateEgoMotionCandidates(emptySnapshot, candidates, candidateResults));
+  ASSERT_EQ(candidateResults.size(), candidates.size());
+  for (auto const &candidateResult : candidateResults)
+  {
+    EXPECT_TRUE(candidateResult.isSafe);
+    EXPECT_EQ(candidateResult.criticalSituationIndex, 0u);
+    EXPECT_EQ(candidateResult.longitudinalMargin, std::numeric_limits<Distance>::max());
+  }
+}
+
+TEST_F(RssEgoMotionCandidatesTests, InvalidInput)
+{
+  std::vector<EgoMotionCandidateResult> candidateResults;
+  std::vector<EgoMotionCandidate> invalidCandidates = candidates;
+  invalidCandidates[3].velocity.speedLon.minimum = kmhToMeterPerSec(-10.);
+  EXPECT_FALSE(evaluateEgoMotionCandidates(situationSnapshot, invalidCandidates, candidateResults));
+  EXPECT_TRUE(candidateResults.empty());
+
+  invalidCandidates = candidates;
+  invalidCandidates[3].velocity.speedLon.minimum = invalidCandidates[3].velocity.speedLon.maximum + Speed(1.);
+  EXPECT_FALSE(evaluateEgoMotionCandidates(situationSnapshot, invalidCandidates, candidateResults));
+
+  SituationSnapshot invalidSnapshot = situationSnapshot;
+  invalidSnapshot.situations[1].otherVehicleState.dynamics.responseTime = Duration(-1.);
+  EXPECT_FALSE(evaluateEgoMotionCandidates(invalidSnapshot, candidates, candidateResults));
+
+  // both vehicles with priority
+  invalidSnapshot = situationSnapshot;
+  invalidSnapshot.situations[6].egoVehicleState.hasPriority = true;
+  EXPECT_FALSE(evaluateEgoMotionCandidates(invalidSnapshot, candidates, candidateResults));
+}
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,237 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "TestSupport.hpp"
+#include "ad_rss/situation/RssFixedDynamicsFormulaProvider.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+class RssFixedDynamicsFormulaProviderTests : public testing::Test
+{
+protected:
+  typedef RssFixedDynamicsFormulaProvider<TestEgoRssDynamicsProfile, TestObjectRssDynamicsProfile>
+    FixedDynamicsFormulaProvider;
+
+  VehicleState createEgoVehicleState(double const lonVelocity, double const latVelocity)
+  {
+    VehicleState vehicleState = createVehicleState(lonVelocity, latVelocity);
+    vehicleState.dynamics = getEgoRssDynamics();
+    return vehicleState;
+  }
+
+  void expectEquivalentResults(bool const runtimeResult,
+                               Distance const &runtimeSafeDistance,
+                               bool const runtimeIsSafe,
+                               bool const fixedResult,
+                               Distance const &fixedSafeDistance,
+                               bool const fixedIsSafe)
+  {
+    EXPECT_EQ(runtimeResult, fixedResult);
+    EXPECT_NEAR(static_cast<double>(runtimeSafeDistance), static_cast<double>(fixedSafeDistance), cDoubleNear);
+    EXPECT_EQ(runtimeIsSafe, fixedIsSafe);
+  }
+
+  RssFormulaProvider runtimeFormulaProvider;
+  FixedDynamicsFormulaProvider fixedFormulaProvider;
+  std::vector<double> const lonVelocities{0., 1., 5., 10., 25., 50.};
+  std::vector<double> const latVelocities{-5., -1., -0.1, 0., 0.1, 1., 5.};
+  std::vector<double> const vehicleDistances{0., 0.5, 5., 25., 100., 500.};
+};
+
+TEST_F(RssFixedDynamicsFormulaProviderTests, ProfileTraits)
+{
+  EXPECT_TRUE(world::RssDynamicsProfileTraits<TestEgoRssDynamicsProfile>::matches(getEgoRssDynamics()));
+  EXPECT_FALSE(world::RssDynamicsProfileTraits<TestEgoRssDynamicsProfile>::matches(getObjectRssDynamics()));
+  EXPECT_TRUE(world::RssDynamicsProfileTraits<TestObjectRssDynamicsProfile>::matches(getObjectRssDynamics()));
+  EXPECT_EQ(world::createRssDynamics<TestEgoRssDynamicsProfile>(), getEgoRssDynamics());
+  EXPECT_EQ(world::createRssDynamics<TestObjectRssDynamicsProfile>(), getObjectRssDynamics());
+
+  double const brakeMinStoppingFactor
+    = world::RssDynamicsProfileTraits<TestObjectRssDynamicsProfile>::cLonBrakeMinStoppingFactor;
+  double const responseDistanceOffset
+    = world::RssDynamicsProfileTraits<TestObjectRssDynamicsProfile>::cLonResponseDistanceOffset;
+  EXPECT_DOUBLE_EQ(brakeMinStoppingFactor, 0.125);
+  EXPECT_DOUBLE_EQ(responseDistanceOffset, 7.);
+}
+
+TEST_F(RssFixedDynamicsFormulaProviderTests, LongitudinalDistanceSameDirection)
+{
+  for (auto leadingVelocity : lonVelocities)
+  {
+    for (auto followingVelocity : lonVelocities)
+    {
+      for (auto vehicleDistance : vehicleDistances)
+      {
+        VehicleState const leadingVehicle = createVehicleStateForLongitudinalMotion(leadingVelocity);
+        VehicleState const followingVehicle = createEgoVehicleState(followingVelocity, 0.);
+
+        Distance runtimeSafeDistance(0.);
+        bool runtimeIsSafe = false;
+        bool const runtimeResult = runtimeFormulaProvider.checkSafeLongitudinalDistanceSameDirection(
+          leadingVehicle, followingVehicle, Distance(vehicleDistance), runtimeSafeDistance, runtimeIsSafe);
+        Distance fixedSafeDistance(0.);
+        bool fixedIsSafe = false;
+        bool const fixedResult = fixedFormulaProvider.checkSafeLongitudinalDistanceSameDirection(
+          leadingVehicle, followingVehicle, Distance(vehicleDistance), fixedSafeDistance, fixedIsSafe);
+        ASSERT_TRUE(runtimeResult);
+        expectEquivalentResults(
+          runtimeResult, runtimeSafeDistance, runtimeIsSafe, fixedResult, fixedSafeDistance, fixedIsSafe);
+      }
+    }
+  }
+}
+
+TEST_F(RssFixedDynamicsFormulaProviderTests, LongitudinalDistanceOppositeDirection)
+{
+  for (auto correctVelocity : lonVelocities)
+  {
+    for (auto oppositeVelocity : lonVelocities)
+    {
+      for (auto vehicleDistance : vehicleDistances)
+      {
+        VehicleState const correctVehicle = createEgoVehicleState(correctVelocity, 0.);
+        VehicleState const oppositeVehicle = createVehicleStateForLongitudinalMotion(oppositeVelocity);
+
+        Distance runtimeSafeDistance(0.);
+        bool runtimeIsSafe = false;
+        bool const runtimeResult = runtimeFormulaProvider.checkSafeLongitudinalDistanceOppositeDirection(
+          correctVehicle, oppositeVehicle, Distance(vehicleDistance), runtimeSafeDistance, runtimeIsSafe);
+        Distance fixedSafeDistance(0.);
+        bool fixedIsSafe = false;
+        bool const fixedResult = fixedFormulaProvider.checkSafeLongitudinalDistanceOppositeDirection(
+          correctVehicle, oppositeVehicle, Distance(vehicleDistance), fixedSafeDistance, fixedIsSafe);
+        ASSERT_TRUE(runtimeResult);
+        expectEquivalentResults(
+          runtimeResult, runtimeSafeDistance, runtimeIsSafe, fixedResult, fixedSafeDistance, fixedIsSafe);
+      }
+    }
+  }
+}
+
+TEST_F(RssFixedDynamicsFormulaProviderTests, LateralDistance)
+{
+  for (auto leftVelocity : latVelocities)
+  {
+    for (auto rightVelocity : latVelocities)
+    {
+      for (auto vehicleDistance : vehicleDistances)
+      {
+        VehicleState const leftVehicle = createEgoVehicleState(10., leftVelocity);
+        VehicleState const rightVehicle = createVehicleState(10., rightVelocity);
+
+        Distance runtimeSafeDistance(0.);
+        bool runtimeIsSafe = false;
+        bool const runtimeResult = runtimeFormulaProvider.checkSafeLateralDistance(
+          leftVehicle, rightVehicle, Distance(vehicleDistance), runtimeSafeDistance, runtimeIsSafe);
+        Distance fixedSafeDistance(0.);
+        bool fixedIsSafe = false;
+        bool const fixedResult = fixedFormulaProvider.checkSafeLateralDistance(
+          leftVehicle, rightVehicle, Distance(vehicleDistance), fixedSafeDistance, fixedIsSafe);
+        ASSERT_TRUE(runtimeResult);
+        expectEquivalentResults(
+          runtimeResult, runtimeSafeDistance, runtimeIsSafe, fixedResult, fixedSafeDistance, fixedIsSafe);
+      }
+    }
+  }
+}
+
+TEST_F(RssFixedDynamicsFormulaProviderTests, StopInFrontIntersection)
+{
+  for (auto velocity : lonVelocities)
+  {
+    for (auto distanceToEnterIntersection : vehicleDistances)
+    {
+      VehicleState vehicle = createEgoVehicleState(velocity, 0.);
+      vehicle.distanceToEnterIntersection = Distance(distanceToEnterIntersection);
+
+      Distance runtimeSafeDistance(0.);
+      bool runtimeIsSafe = false;
+      bool const runtimeResult
+        = runtimeFormulaProvider.checkStopInFrontIntersection(vehicle, runtimeSafeDistance, runtimeIsSafe);
+      Distance fixedSafeDistance(0.);
+      bool fixedIsSafe = false;
+      bool const fixedResult
+        = fixedFormulaProvider.checkStopInFrontIntersection(vehicle, fixedSafeDistance, fixedIsSafe);
+      ASSERT_TRUE(runtimeResult);
+      expectEquivalentResults(
+        runtimeResult, runtimeSafeDistance, runtimeIsSafe, fixedResult, fixedSafeDistance, fixedIsSafe);
+    }
+  }
+}
+
+TEST_F(RssFixedDynamicsFormulaProviderTests, DynamicsNotMatchingAnyProfile)
+{
+  VehicleState leadingVehicle = createVehicleStateForLongitudinalMotion(10.);
+  VehicleState followingVehicle = createEgoVehicleState(20., 0.);
+  followingVehicle.dynamics.alphaLon.brakeMin = Acceleration(5.);
+
+  Distance runtimeSafeDistance(0.);
+  bool runtimeIsSafe = false;
+  ASSERT_TRUE(runtimeFormulaProvider.checkSafeLongitudinalDistanceSameDirection(
+    leadingVehicle, followingVehicle, Distance(30.), runtimeSafeDistance, runtimeIsSafe));
+  Distance fixedSafeDistance(0.);
+  bool fixedIsSafe = false;
+  ASSERT_TRUE(fixedFormulaProvider.checkSafeLongitudinalDistanceSameDirection(
+    leadingVehicle, followingVehicle, Distance(30.), fixedSafeDistance, fixedIsSafe));
+  expectEquivalentResults(true, runtimeSafeDistance, runtimeIsSafe, true, fixedSafeDistance, fixedIsSafe);
+
+  // invalid dynamics are rejected by the default implementation
+  followingVehicle.dynamics.alphaLon.brakeMin = Acceleration(-1.);
+  EXPECT_FALSE(fixedFormulaProvider.checkSafeLongitudinalDistanceSameDirection(
+    leadingVehicle, followingVehicle, Distance(30.), fixedSafeDistance, fixedIsSafe));
+}
+
+TEST_F(RssFixedDynamicsFormulaProviderTests, InvalidVehicleState)
+{
+  VehicleState leftVehicle = createEgoVehicleState(10., 0.);
+  VehicleState rightVehicle = createVehicleState(10., 0.);
+  Distance safeDistance(0.);
+  bool isSafe = true;
+
+  EXPECT_FALSE(
+    fixedFormulaProvider.checkSafeLateralDistance(leftVehicle, rightVehicle, Distance(-1.), safeDistance, isSafe));
+
+  leftVehicle.velocity.speedLon.minimum = Speed(-1.);
+  EXPECT_FALSE(
+    fixedFormulaProvider.checkSafeLateralDistance(leftVehicle, rightVehicle, Distance(1.), safeDistance, isSafe));
+  EXPECT_FALSE(isSafe);
+  EXPECT_EQ(safeDistance, std::numeric_limits<Distance>::max());
+
+  leftVehicle = createEgoVehicleState(10., 0.);
+  leftVehicle.distanceToEnterIntersection = Distance(2000.);
+  EXPECT_FALSE(fixedFormulaProvider.checkStopInFrontIntersection(leftVehicle, safeDistance, isSafe));
+  EXPECT_FALSE(fixedFormulaProvider.checkSafeLongitudinalDistanceOppositeDirection(
+    leftVehicle, rightVehicle, Distance(1.), safeDistance, isSafe));
+}
+
+} // namespace situation
+} // namespace ad_rss
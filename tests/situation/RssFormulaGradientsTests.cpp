@@ -0,0 +1,333 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <functional>
+#include "TestSupport.hpp"
+#include "ad_rss/situation/RssFormulaGradients.hpp"
+#include "physics/Math.hpp"
+#include "situation/RssFormulas.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+class RssFormulaGradientsTests : public testing::Test
+{
+protected:
+  typedef std::function<void(VehicleState &, double)> VehicleStateModifier;
+  typedef std::function<bool(VehicleState const &, VehicleState const &, Distance &)> SafeDistanceFormula;
+  typedef std::function<double(VehicleStateGradient const &)> GradientEntry;
+
+  struct Variable
+  {
+    VehicleStateModifier modify;
+    GradientEntry entry;
+  };
+
+  virtual void SetUp()
+  {
+    variables.push_back({[](VehicleState &v, double d) { v.velocity.speedLon.minimum += Speed(d); },
+                         [](VehicleStateGradient const &g) { return g.speedLonMinimum; }});
+    variables.push_back({[](VehicleState &v, double d) { v.velocity.speedLon.maximum += Speed(d); },
+                         [](VehicleStateGradient const &g) { return g.speedLonMaximum; }});
+    variables.push_back({[](VehicleState &v, double d) { v.velocity.speedLat.minimum += Speed(d); },
+                         [](VehicleStateGradient const &g) { return g.speedLatMinimum; }});
+    variables.push_back({[](VehicleState &v, double d) { v.velocity.speedLat.maximum += Speed(d); },
+                         [](VehicleStateGradient const &g) { return g.speedLatMaximum; }});
+    variables.push_back({[](VehicleState &v, double d) { v.dynamics.responseTime += Duration(d); },
+                         [](VehicleStateGradient const &g) { return g.responseTime; }});
+    variables.push_back({[](VehicleState &v, double d) { v.dynamics.alphaLon.accelMax += Acceleration(d); },
+                         [](VehicleStateGradient const &g) { return g.alphaLonAccelMax; }});
+    variables.push_back({[](VehicleState &v, double d) { v.dynamics.alphaLon.brakeMax += Acceleration(d); },
+                         [](VehicleStateGradient const &g) { return g.alphaLonBrakeMax; }});
+    variables.push_back({[](VehicleState &v, double d) { v.dynamics.alphaLon.brakeMin += Acceleration(d); },
+                         [](VehicleStateGradient const &g) { return g.alphaLonBrakeMin; }});
+    variables.push_back({[](VehicleState &v, double d) { v.dynamics.alphaLon.brakeMinCorrect += Acceleration(d); },
+                         [](VehicleStateGradient const &g) { return g.alphaLonBrakeMinCorrect; }});
+    variables.push_back({[](VehicleState &v, double d) { v.dynamics.alphaLat.accelMax += Acceleration(d); },
+                         [](VehicleStateGradient const &g) { return g.alphaLatAccelMax; }});
+    variables.push_back({[](VehicleState &v, double d) { v.dynamics.alphaLat.brakeMin += Acceleration(d); },
+                         [](VehicleStateGradient const &g) { return g.alphaLatBrakeMin; }});
+  }
+
+  VehicleState createState(double const lonSpeed, double const lonSpeedRange, double const latSpeed)
+  {
+    VehicleState vehicleState = createVehicleState(lonSpeed, latSpeed);
+    vehicleState.velocity.speedLon.maximum = vehicleState.velocity.speedLon.minimum + Speed(lonSpeedRange);
+    vehicleState.velocity.speedLat.minimum = vehicleState.velocity.speedLat.maximum - Speed(0.5);
+    vehicleState.dynamics.responseTime = Duration(0.8);
+    vehicleState.dynamics.alphaLon.brakeMin = Acceleration(4.3);
+    vehicleState.dynamics.alphaLon.brakeMinCorrect = Acceleration(3.1);
+    return vehicleState;
+  }
+
+  /*
+   * Compare the gradient with central finite differences of the formula.
+   */
+  void expectGradientMatchesFiniteDifferences(SafeDistanceFormula const &formula,
+                                              VehicleState const &firstVehicle,
+                                              VehicleState const &secondVehicle,
+                                              SafeDistanceGradient const &gradient)
+  {
+    Distance safeDistance;
+    ASSERT_TRUE(formula(firstVehicle, secondVehicle, safeDistance));
+    EXPECT_NEAR(static_cast<double>(gradient.safeDistance), static_cast<double>(safeDistance), 1e-9);
+
+    double const h = 1e-4;
+    for (std::size_t vehicle = 0u; vehicle < 2u; ++vehicle)
+    {
+      for (auto const &variable : variables)
+      {
+        VehicleState upperState = (vehicle == 0u) ? firstVehicle : secondVehicle;
+        VehicleState lowerState = upperState;
+        variable.modify(upperState, h);
+        variable.modify(lowerState, -h);
+        Distance upper;
+        Distance lower;
+        ASSERT_TRUE((vehicle == 0u) ? formula(upperState, secondVehicle, upper)
+                                    : formula(firstVehicle, upperState, upper));
+        ASSERT_TRUE((vehicle == 0u) ? formula(lowerState, secondVehicle, lower)
+                                    : formula(firstVehicle, lowerState, lower));
+        double const finiteDifference = static_cast<double>(upper - lower) / (2. * h);
+        double const derivative = variable.entry((vehicle == 0u) ? gradient.firstVehicle : gradient.secondVehicle);
+        EXPECT_NEAR(derivative, finiteDifference, 1e-4 * std::max(1., std::fabs(finiteDifference)));
+      }
+    }
+  }
+
+  std::vector<Variable> variables;
+};
+
+TEST_F(RssFormulaGradientsTests, SafeLongitudinalDistanceSameDirection)
+{
+  SafeDistanceFormula const formula = [](VehicleState const &leading, VehicleState const &following, Distance &d) {
+    return calculateSafeLongitudinalDistanceSameDirection(leading, following, d);
+  };
+  for (double leadingSpeed = 0.; leadingSpeed < 150.; leadingSpeed += 17.)
+  {
+    for (double followingSpeed = 3.; followingSpeed < 150.; followingSpeed += 19.)
+    {
+      VehicleState const leadingVehicle = createState(leadingSpeed, 0.3, 0.);
+      VehicleState const followingVehicle = createState(followingSpeed, 0.7, 0.);
+      SafeDistanceGradient gradient;
+      ASSERT_TRUE(calculateSafeLongitudinalDistanceSameDirectionGradient(leadingVehicle, followingVehicle, gradient));
+      expectGradientMatchesFiniteDifferences(formula, leadingVehicle, followingVehicle, gradient);
+
+      if (gradient.safeDistance > Distance(0.))
+      {
+        // d/dv of the stated braking distance: t + (v + a * t) / b
+        double const t = static_cast<double>(followingVehicle.dynamics.responseTime);
+        double const v = static_cast<double>(followingVehicle.velocity.speedLon.maximum);
+        double const a = static_cast<double>(followingVehicle.dynamics.alphaLon.accelMax);
+        double const b = static_cast<double>(followingVehicle.dynamics.alphaLon.brakeMin);
+        EXPECT_NEAR(gradient.secondVehicle.speedLonMaximum, t + (v + a * t) / b, 1e-9);
+      }
+      else
+      {
+        // clamped at zero
+        EXPECT_EQ(gradient.secondVehicle.speedLonMaximum, 0.);
+        EXPECT_EQ(gradient.firstVehicle.speedLonMinimum, 0.);
+      }
+    }
+  }
+}
+
+TEST_F(RssFormulaGradientsTests, SafeLongitudinalDistanceOppositeDirection)
+{
+  SafeDistanceFormula const formula = [](VehicleState const &correct, VehicleState const &opposite, Distance &d) {
+    return calculateSafeLongitudinalDistanceOppositeDirection(correct, opposite, d);
+  };
+  for (double correctSpeed = 0.; correctSpeed < 150.; correctSpeed += 23.)
+  {
+    for (double oppositeSpeed = 0.; oppositeSpeed < 150.; oppositeSpeed += 29.)
+    {
+      VehicleState const correctVehicle = createState(correctSpeed, 0.2, 0.);
+      VehicleState const oppositeVehicle = createState(oppositeSpeed, 0.4, 0.);
+      SafeDistanceGradient gradient;
+      ASSERT_TRUE(
+        calculateSafeLongitudinalDistanceOppositeDirectionGradient(correctVehicle, oppositeVehicle, gradient));
+      expectGradientMatchesFiniteDifferences(formula, correctVehicle, oppositeVehicle, gradient);
+      EXPECT_LT(gradient.firstVehicle.alphaLonBrakeMinCorrect, 0.);
+      EXPECT_EQ(gradient.firstVehicle.alphaLonBrakeMin, 0.);
+      EXPECT_LT(gradient.secondVehicle.alphaLonBrakeMin, 0.);
+    }
+  }
+}
+
+TEST_F(RssFormulaGradientsTests, SafeLateralDistance)
+{
+  SafeDistanceFormula const formula = [](VehicleState const &left, VehicleState const &right, Distance &d) {
+    return calculateSafeLateralDistance(left, right, d);
+  };
+  // includes lateral speeds away from each other, where the speed changes its sign within the response time
+  for (double leftSpeed = -7.3; leftSpeed < 8.; leftSpeed += 1.9)
+  {
+    for (double rightSpeed = -7.1; rightSpeed < 8.; rightSpeed += 2.3)
+    {
+      VehicleState const leftVehicle = createState(50., 0., leftSpeed);
+      VehicleState const rightVehicle = createState(50., 0., rightSpeed);
+      SafeDistanceGradient gradient;
+      ASSERT_TRUE(calculateSafeLateralDistanceGradient(leftVehicle, rightVehicle, gradient));
+      expectGradientMatchesFiniteDifferences(formula, leftVehicle, rightVehicle, gradient);
+    }
+  }
+}
+
+TEST_F(RssFormulaGradientsTests, TimeToCoverDistance)
+{
+  double const responseTime = 0.7;
+  double const brakeMax = 7.7;
+  for (double speed = 0.5; speed < 30.; speed += 3.7)
+  {
+    for (double distance = 0.3; distance < 120.; distance += 9.1)
+    {
+      // accelerating and braking with stop within the response time, as for leaving the intersection
+      for (double acceleration : {3.3, -brakeMax})
+      {
+        double const deceleration = (acceleration > 0.) ? 4.1 : brakeMax;
+        TimeToCoverDistanceGradient gradient;
+        ASSERT_TRUE(calculateTimeToCoverDistanceGradient(Speed(speed),
+                                                         Duration(responseTime),
+                                                         Acceleration(acceleration),
+                                                         Acceleration(deceleration),
+                                                         Distance(distance),
+                                                         gradient));
+        auto timeToCover = [&](double const dSpeed,
+                               double const dResponseTime,
+                               double const dAcceleration,
+                               double const dDeceleration,
+                               double const dDistance) {
+          Duration requiredTime;
+          EXPECT_TRUE(physics::calculateTimeToCoverDistance(Speed(speed + dSpeed),
+                                                            Duration(responseTime + dResponseTime),
+                                                            Acceleration(acceleration + dAcceleration),
+                                                            Acceleration(deceleration + dDeceleration),
+                                                            Distance(distance + dDistance),
+                                                            requiredTime));
+          return static_cast<double>(requiredTime);
+        };
+        double const requiredTime = timeToCover(0., 0., 0., 0., 0.);
+        EXPECT_NEAR(static_cast<double>(gradient.requiredTime), requiredTime, 1e-9);
+        if (gradient.requiredTime == std::numeric_limits<Duration>::max())
+        {
+          EXPECT_EQ(gradient.currentSpeed, 0.);
+          EXPECT_EQ(gradient.distanceToCover, 0.);
+          continue;
+        }
+        double const h = 1e-5;
+        double const tolerance = 1e-3;
+        auto centralDifference = [&](std::size_t const index) {
+          double upper[5] = {0., 0., 0., 0., 0.};
+          double lower[5] = {0., 0., 0., 0., 0.};
+          upper[index] = h;
+          lower[index] = -h;
+          return (timeToCover(upper[0], upper[1], upper[2], upper[3], upper[4])
+                  - timeToCover(lower[0], lower[1], lower[2], lower[3], lower[4]))
+            / (2. * h);
+        };
+        EXPECT_NEAR(gradient.currentSpeed, centralDifference(0u), tolerance);
+        EXPECT_NEAR(gradient.responseTime, centralDifference(1u), tolerance);
+        EXPECT_NEAR(gradient.acceleration, centralDifference(2u), tolerance);
+        EXPECT_NEAR(gradient.deceleration, centralDifference(3u), tolerance);
+        EXPECT_NEAR(gradient.distanceToCover, centralDifference(4u), tolerance);
+      }
+    }
+  }
+}
+
+TEST_F(RssFormulaGradientsTests, DoubleInstantiationIdenticalToPhysicsTypes)
+{
+  typedef physics::ScalarTypes<double> DoubleTypes;
+  auto toDouble = [](VehicleState const &vehicleState) {
+    VehicleStateT<DoubleTypes> result;
+    result.speedLonMinimum = static_cast<double>(vehicleState.velocity.speedLon.minimum);
+    result.speedLonMaximum = static_cast<double>(vehicleState.velocity.speedLon.maximum);
+    result.speedLatMinimum = static_cast<double>(vehicleState.velocity.speedLat.minimum);
+    result.speedLatMaximum = static_cast<double>(vehicleState.velocity.speedLat.maximum);
+    result.responseTime = static_cast<double>(vehicleState.dynamics.responseTime);
+    result.alphaLonAccelMax = static_cast<double>(vehicleState.dynamics.alphaLon.accelMax);
+    result.alphaLonBrakeMax = static_cast<double>(vehicleState.dynamics.alphaLon.brakeMax);
+    result.alphaLonBrakeMin = static_cast<double>(vehicleState.dynamics.alphaLon.brakeMin);
+    result.alphaLonBrakeMinCorrect = static_cast<double>(vehicleState.dynamics.alphaLon.brakeMinCorrect);
+    result.alphaLatAccelMax = static_cast<double>(vehicleState.dynamics.alphaLat.accelMax);
+    result.alphaLatBrakeMin = static_cast<double>(vehicleState.dynamics.alphaLat.brakeMin);
+    return result;
+  };
+  for (double speed = 0.; speed < 40.; speed += 3.3)
+  {
+    for (double latSpeed = -2.; latSpeed < 2.; latSpeed += 0.7)
+    {
+      VehicleState const firstVehicle = createState(speed, 1.5, latSpeed);
+      VehicleState const secondVehicle = createState(40. - speed, 0.5, -latSpeed);
+      Distance expected;
+      double safeDistance = -1.;
+      ASSERT_TRUE(calculateSafeLongitudinalDistanceSameDirection(firstVehicle, secondVehicle, expected));
+      ASSERT_TRUE(calculateSafeLongitudinalDistanceSameDirectionT(
+        toDouble(firstVehicle), toDouble(secondVehicle), safeDistance));
+      EXPECT_NEAR(static_cast<double>(expected), safeDistance, 1e-9);
+      ASSERT_TRUE(calculateSafeLongitudinalDistanceOppositeDirection(firstVehicle, secondVehicle, expected));
+      ASSERT_TRUE(calculateSafeLongitudinalDistanceOppositeDirectionT(
+        toDouble(firstVehicle), toDouble(secondVehicle), safeDistance));
+      EXPECT_NEAR(static_cast<double>(expected), safeDistance, 1e-9);
+      ASSERT_TRUE(calculateSafeLateralDistance(firstVehicle, secondVehicle, expected));
+      ASSERT_TRUE(calculateSafeLateralDistanceT(toDouble(firstVehicle), toDouble(secondVehicle), safeDistance));
+      EXPECT_NEAR(static_cast<double>(expected), safeDistance, 1e-9);
+
+      Duration expectedTime;
+      double requiredTime = -1.;
+      ASSERT_TRUE(physics::calculateTimeToCoverDistance(
+        Speed(speed), Duration(0.7), Acceleration(-latSpeed), Acceleration(4.1), Distance(25.), expectedTime));
+      ASSERT_TRUE(physics::calculateTimeToCoverDistanceT(speed, 0.7, -latSpeed, 4.1, 25., requiredTime));
+      EXPECT_NEAR(static_cast<double>(expectedTime), requiredTime, 1e-9);
+    }
+  }
+}
+
+TEST_F(RssFormulaGradientsTests, InvalidInput)
+{
+  VehicleState vehicleState = createState(50., 0., 0.);
+  VehicleState invalidVehicleState = vehicleState;
+  invalidVehicleState.velocity.speedLon.minimum = Speed(-1.);
+  SafeDistanceGradient gradient;
+  EXPECT_FALSE(calculateSafeLongitudinalDistanceSameDirectionGradient(vehicleState, invalidVehicleState, gradient));
+  EXPECT_FALSE(calculateSafeLongitudinalDistanceOppositeDirectionGradient(invalidVehicleState, vehicleState, gradient));
+  invalidVehicleState = vehicleState;
+  invalidVehicleState.dynamics.alphaLat.brakeMin = Acceleration(-1.);
+  EXPECT_FALSE(calculateSafeLateralDistanceGradient(vehicleState, invalidVehicleState, gradient));
+
+  TimeToCoverDistanceGradient timeGradient;
+  EXPECT_FALSE(calculateTimeToCoverDistanceGradient(
+    Speed(-1.), Duration(1.), Acceleration(1.), Acceleration(1.), Distance(10.), timeGradient));
+  EXPECT_FALSE(calculateTimeToCoverDistanceGradient(
+    Speed(1.), Duration(1.), Acceleration(1.), Acceleration(1.), Distance(-10.), timeGradient));
+}
+
+} // namespace situation
+} // namespace ad_rss
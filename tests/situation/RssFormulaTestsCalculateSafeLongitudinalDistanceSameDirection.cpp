@@ -56,5 +56,48 @@ TEST(RssFormulaTestsCalculateSafeLongitudinalDistanceSameDirection, checks_leadi
   ASSERT_NEAR(static_cast<double>(safeDistance), 0, cDoubleNear);
 }
 
+TEST(RssFormulaTestsCalculateSafeLongitudinalDistanceSameDirection, decision_only_check_matches_full_check)
+{
+  for (double leadingSpeed = 0.; leadingSpeed <= 50.; leadingSpeed += 5.)
+  {
+    for (double followingSpeed = 0.; followingSpeed <= 50.; followingSpeed += 5.)
+    {
+      VehicleState leadingVehicle = createVehicleStateForLongitudinalMotion(leadingSpeed);
+      VehicleState followingVehicle = createVehicleStateForLongitudinalMotion(followingSpeed);
+
+      Distance safeDistance(0.);
+      ASSERT_TRUE(calculateSafeLongitudinalDistanceSameDirection(leadingVehicle, followingVehicle, safeDistance));
+      Distance correctSafeDistance(0.);
+      ASSERT_TRUE(calculateSafeLongitudinalDistanceOppositeDirection(
+        leadingVehicle, followingVehicle, correctSafeDistance));
+
+      // distances around the safe distances and their precision boundaries
+      for (auto const &boundary : {safeDistance, correctSafeDistance})
+      {
+        for (double offset : {-1., -Distance::cPrecisionValue, 0., Distance::cPrecisionValue, 1.})
+        {
+          Distance const vehicleDistance(std::max(0., static_cast<double>(boundary) + offset));
+
+          bool isSafe = false;
+          bool isSafeDecision = !isSafe;
+          Distance calculatedSafeDistance(0.);
+          ASSERT_TRUE(checkSafeLongitudinalDistanceSameDirection(
+            leadingVehicle, followingVehicle, vehicleDistance, calculatedSafeDistance, isSafe));
+          ASSERT_TRUE(
+            isSafeLongitudinalDistanceSameDirection(leadingVehicle, followingVehicle, vehicleDistance, isSafeDecision));
+          EXPECT_EQ(isSafe, isSafeDecision);
+
+          isSafeDecision = !isSafe;
+          ASSERT_TRUE(checkSafeLongitudinalDistanceOppositeDirection(
+            leadingVehicle, followingVehicle, vehicleDistance, calculatedSafeDistance, isSafe));
+          ASSERT_TRUE(isSafeLongitudinalDistanceOppositeDirection(
+            leadingVehicle, followingVehicle, vehicleDistance, isSafeDecision));
+          EXPECT_EQ(isSafe, isSafeDecision);
+        }
+      }
+    }
+  }
+}
+
 } // namespace situation
 } // namespace ad_rss
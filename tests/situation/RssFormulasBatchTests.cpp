@@ -0,0 +1,293 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "TestSupport.hpp"
+#include "ad_rss/core/RssSituationChecking.hpp"
+#include "ad_rss/state/RssStateOperation.hpp"
+#include "situation/RssFormulas.hpp"
+#include "situation/RssFormulasBatch.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+class RssFormulasBatchTests : public testing::Test
+{
+protected:
+  /*
+   * A grid of vehicle states covering accelerating, decelerating, approaching and receding vehicles.
+   */
+  virtual void SetUp()
+  {
+    for (double const speedLon : {0., 50., 120.})
+    {
+      for (double const speedLat : {-3., 2.})
+      {
+        for (double const responseTime : {0.5, 2.})
+        {
+          for (double const accelMax : {0., 3.5})
+          {
+            VehicleState vehicleState = createVehicleState(speedLon, speedLat);
+            vehicleState.velocity.speedLon.maximum = vehicleState.velocity.speedLon.minimum + Speed(2.);
+            vehicleState.velocity.speedLat.maximum = vehicleState.velocity.speedLat.minimum + Speed(0.5);
+            vehicleState.dynamics.responseTime = Duration(responseTime);
+            vehicleState.dynamics.alphaLon.accelMax = Acceleration(accelMax);
+            vehicleState.dynamics.alphaLat.accelMax = Acceleration(0.1 * accelMax);
+            vehicleStates.push_back(vehicleState);
+          }
+        }
+      }
+    }
+    // all pairs of vehicle states
+    for (auto const &firstVehicleState : vehicleStates)
+    {
+      for (auto const &secondVehicleState : vehicleStates)
+      {
+        firstVehicles.push_back(firstVehicleState);
+        secondVehicles.push_back(secondVehicleState);
+      }
+    }
+    firstBatch = createBatch(firstVehicles);
+    secondBatch = createBatch(secondVehicles);
+  }
+
+  VehicleStateBatch createBatch(std::vector<VehicleState> const &batchVehicleStates)
+  {
+    VehicleStateBatch batch;
+    batch.resize(batchVehicleStates.size());
+    for (std::size_t i = 0u; i < batchVehicleStates.size(); ++i)
+    {
+      VehicleState const &vehicleState = batchVehicleStates[i];
+      batch.speedLonMinimum[i] = static_cast<double>(vehicleState.velocity.speedLon.minimum);
+      batch.speedLonMaximum[i] = static_cast<double>(vehicleState.velocity.speedLon.maximum);
+      batch.speedLatMinimum[i] = static_cast<double>(vehicleState.velocity.speedLat.minimum);
+      batch.speedLatMaximum[i] = static_cast<double>(vehicleState.velocity.speedLat.maximum);
+      batch.setDynamics(i, vehicleState.dynamics);
+    }
+    return batch;
+  }
+
+  std::vector<VehicleState> vehicleStates;
+  std::vector<VehicleState> firstVehicles;
+  std::vector<VehicleState> secondVehicles;
+  VehicleStateBatch firstBatch;
+  VehicleStateBatch secondBatch;
+};
+
+TEST_F(RssFormulasBatchTests, SafeLongitudinalDistanceSameDirection)
+{
+  std::vector<double> safeDistances(firstBatch.size());
+  calculateSafeLongitudinalDistanceSameDirectionBatch(firstBatch, secondBatch, safeDistances);
+  for (std::size_t i = 0u; i < safeDistances.size(); ++i)
+  {
+    Distance safeDistance(0.);
+    ASSERT_TRUE(calculateSafeLongitudinalDistanceSameDirection(firstVehicles[i], secondVehicles[i], safeDistance));
+    ASSERT_NEAR(safeDistances[i], static_cast<double>(safeDistance), 1e-9);
+  }
+}
+
+TEST_F(RssFormulasBatchTests, SafeLongitudinalDistanceOppositeDirection)
+{
+  std::vector<double> safeDistances(firstBatch.size());
+  calculateSafeLongitudinalDistanceOppositeDirectionBatch(firstBatch, secondBatch, safeDistances);
+  for (std::size_t i = 0u; i < safeDistances.size(); ++i)
+  {
+    Distance safeDistance(0.);
+    ASSERT_TRUE(
+      calculateSafeLongitudinalDistanceOppositeDirection(firstVehicles[i], secondVehicles[i], safeDistance));
+    ASSERT_NEAR(safeDistances[i], static_cast<double>(safeDistance), 1e-9);
+  }
+}
+
+TEST_F(RssFormulasBatchTests, SafeLateralDistance)
+{
+  std::vector<double> safeDistances(firstBatch.size());
+  calculateSafeLateralDistanceBatch(firstBatch, secondBatch, safeDistances);
+  for (std::size_t i = 0u; i < safeDistances.size(); ++i)
+  {
+    Distance safeDistance(0.);
+    ASSERT_TRUE(calculateSafeLateralDistance(firstVehicles[i], secondVehicles[i], safeDistance));
+    ASSERT_NEAR(safeDistances[i], static_cast<double>(safeDistance), 1e-9);
+  }
+}
+
+TEST_F(RssFormulasBatchTests, SituationMarginEqualsSituationChecking)
+{
+  std::vector<Situation> situations;
+  for (auto const situationType : {SituationType::SameDirection, SituationType::OppositeDirection})
+  {
+    for (double const distance : {0., 40., 150.})
+    {
+      for (auto const lonPosition : {LongitudinalRelativePosition::InFront,
+                                     LongitudinalRelativePosition::OverlapFront,
+                                     LongitudinalRelativePosition::AtBack})
+      {
+        Situation situation;
+        situation.situationType = situationType;
+        situation.relativePosition = createRelativeLongitudinalPosition(lonPosition, Distance(distance));
+        situations.push_back(situation);
+      }
+      for (auto const latPosition : {LateralRelativePosition::AtLeft,
+                                     LateralRelativePosition::AtRight,
+                                     LateralRelativePosition::OverlapLeft})
+      {
+        Situation situation;
+        situation.situationType = situationType;
+        situation.relativePosition = createRelativeLateralPosition(latPosition, Distance(0.1 * distance));
+        situation.relativePosition.longitudinalPosition = LongitudinalRelativePosition::Overlap;
+        situations.push_back(situation);
+      }
+    }
+  }
+
+  core::RssSituationChecking situationChecking;
+  SituationMarginBatch situationMargin;
+  std::size_t numberOfDangerousSituations = 0u;
+  for (auto &situation : situations)
+  {
+    for (bool const egoInCorrectLane : {true, false})
+    {
+      situation.egoVehicleState = vehicleStates.front();
+      situation.egoVehicleState.isInCorrectLane = egoInCorrectLane;
+      ASSERT_TRUE(calculateSituationMarginBatch(situation, firstBatch, secondBatch, situationMargin));
+      ASSERT_EQ(situationMargin.isDangerous.size(), firstBatch.size());
+      for (std::size_t i = 0u; i < firstBatch.size(); ++i)
+      {
+        situation.egoVehicleState = firstVehicles[i];
+        situation.egoVehicleState.isInCorrectLane = egoInCorrectLane;
+        situation.otherVehicleState = secondVehicles[i];
+        state::RssState rssState;
+        ASSERT_TRUE(situationChecking.checkSituation(situation, rssState));
+        ASSERT_EQ(situationMargin.isDangerous[i] != 0u, state::isDangerous(rssState));
+        if (situationMargin.isDangerous[i] != 0u)
+        {
+          numberOfDangerousSituations++;
+          EXPECT_LT(situationMargin.margin[i], static_cast<double>(Distance::getPrecision()));
+        }
+        else
+        {
+          EXPECT_GE(situationMargin.margin[i], static_cast<double>(Distance::getPrecision()));
+        }
+      }
+    }
+  }
+  // both decisions have to be covered
+  EXPECT_GT(numberOfDangerousSituations, 0u);
+  EXPECT_LT(numberOfDangerousSituations, 2u * situations.size() * firstBatch.size());
+}
+
+TEST_F(RssFormulasBatchTests, SituationMarginAtPrecisionBoundary)
+{
+  // a standing following vehicle without acceleration requires no safe distance: the margin equals the distance
+  VehicleState vehicleState = createVehicleState(0., 0.);
+  vehicleState.dynamics.alphaLon.accelMax = Acceleration(0.);
+  VehicleStateBatch batch = createBatch({vehicleState, vehicleState, vehicleState});
+
+  core::RssSituationChecking situationChecking;
+  Distance const precision = Distance::getPrecision();
+  for (Distance const distance : {precision - Distance(1e-9), precision, precision + Distance(1e-9)})
+  {
+    Situation situation;
+    situation.situationType = SituationType::SameDirection;
+    situation.relativePosition = createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, distance);
+    situation.egoVehicleState = vehicleState;
+    situation.otherVehicleState = vehicleState;
+
+    SituationMarginBatch situationMargin;
+    ASSERT_TRUE(calculateSituationMarginBatch(situation, batch, batch, situationMargin));
+    state::RssState rssState;
+    ASSERT_TRUE(situationChecking.checkSituation(situation, rssState));
+    for (std::size_t i = 0u; i < batch.size(); ++i)
+    {
+      EXPECT_EQ(situationMargin.margin[i], static_cast<double>(distance));
+      EXPECT_EQ(situationMargin.isDangerous[i] != 0u, state::isDangerous(rssState));
+      // a distance reaching the precision is safe
+      EXPECT_EQ(situationMargin.isDangerous[i] != 0u, static_cast<double>(distance) < static_cast<double>(precision));
+    }
+  }
+}
+
+TEST_F(RssFormulasBatchTests, DistanceOffsetAfterStatedBrakingPattern)
+{
+  // the branch free formulas have to cover all combinations of the signs of speed and acceleration
+  for (double const currentSpeed : {0., 0.5, 10.})
+  {
+    for (double const acceleration : {-0.1, -2., -20., 0., 1., 3.5})
+    {
+      for (double const responseTime : {0., 0.5, 2.})
+      {
+        Distance distanceOffset(0.);
+        ASSERT_TRUE(calculateDistanceOffsetAfterStatedBrakingPattern(physics::CoordinateSystemAxis::Longitudinal,
+                                                                     Speed(currentSpeed),
+                                                                     Duration(responseTime),
+                                                                     Acceleration(acceleration),
+                                                                     Acceleration(4.),
+                                                                     distanceOffset));
+        EXPECT_NEAR(calculateLongitudinalDistanceOffsetAfterStatedBrakingPattern(
+                      currentSpeed, responseTime, acceleration, 4.),
+                    static_cast<double>(distanceOffset),
+                    1e-9);
+
+        for (double const lateralSpeed : {-currentSpeed, currentSpeed})
+        {
+          ASSERT_TRUE(calculateDistanceOffsetAfterStatedBrakingPattern(physics::CoordinateSystemAxis::Lateral,
+                                                                       Speed(lateralSpeed),
+                                                                       Duration(responseTime),
+                                                                       Acceleration(acceleration),
+                                                                       Acceleration(4.),
+                                                                       distanceOffset));
+          EXPECT_NEAR(
+            calculateLateralDistanceOffsetAfterStatedBrakingPattern(lateralSpeed, responseTime, acceleration, 4.),
+            static_cast<double>(distanceOffset),
+            1e-9);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(RssFormulasBatchTests, SituationMarginInvalidInput)
+{
+  Situation situation;
+  situation.situationType = SituationType::SameDirection;
+  situation.relativePosition = createRelativeLongitudinalPosition(LongitudinalRelativePosition::InFront);
+  SituationMarginBatch situationMargin;
+  VehicleStateBatch smallBatch;
+  smallBatch.resize(3u);
+  EXPECT_FALSE(calculateSituationMarginBatch(situation, firstBatch, smallBatch, situationMargin));
+
+  situation.situationType = SituationType::IntersectionSamePriority;
+  EXPECT_FALSE(calculateSituationMarginBatch(situation, firstBatch, secondBatch, situationMargin));
+  situation.situationType = SituationType::NotRelevant;
+  EXPECT_FALSE(calculateSituationMarginBatch(situation, firstBatch, secondBatch, situationMargin));
+}
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,264 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "TestSupport.hpp"
+#include "ad_rss/core/RssSituationChecking.hpp"
+#include "ad_rss/situation/RssHorizonRollout.hpp"
+#include "ad_rss/state/RssStateOperation.hpp"
+#include "situation/RssFormulas.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+class RssHorizonRolloutTests : public testing::Test
+{
+protected:
+  virtual void SetUp()
+  {
+    situationSnapshot.timeIndex = 1u;
+    parameters.timeStep = Duration(0.1);
+    parameters.numberOfTimeSteps = 30u;
+  }
+
+  HorizonRolloutResult rollOutSingleSituation()
+  {
+    std::vector<HorizonRolloutResult> rolloutResults;
+    EXPECT_TRUE(calculateHorizonRollout(situationSnapshot, parameters, rolloutResults));
+    EXPECT_EQ(rolloutResults.size(), 1u);
+    return rolloutResults.empty() ? HorizonRolloutResult() : rolloutResults.front();
+  }
+
+  SituationSnapshot situationSnapshot;
+  HorizonRolloutParameters parameters;
+};
+
+TEST_F(RssHorizonRolloutTests, CurrentTimeStepIdenticalToSituationChecking)
+{
+  addSituation(situationSnapshot,
+               SituationType::SameDirection,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::InFront, Distance(60.)),
+               50.,
+               30.);
+  addSituation(situationSnapshot,
+               SituationType::SameDirection,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(15.)),
+               50.,
+               50.);
+  addSituation(situationSnapshot,
+               SituationType::SameDirection,
+               createRelativeLateralPosition(LateralRelativePosition::AtRight, Distance(1.)),
+               50.,
+               40.,
+               3.);
+  addSituation(situationSnapshot,
+               SituationType::OppositeDirection,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(300.)),
+               50.,
+               50.);
+  Situation &intersection = addSituation(situationSnapshot,
+                                         SituationType::IntersectionObjectHasPriority,
+                                         createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack,
+                                                                            Distance(20.)),
+                                         30.,
+                                         30.);
+  intersection.egoVehicleState.distanceToEnterIntersection = Distance(40.);
+  intersection.egoVehicleState.distanceToLeaveIntersection = Distance(50.);
+  intersection.otherVehicleState.hasPriority = true;
+  intersection.otherVehicleState.distanceToEnterIntersection = Distance(20.);
+  intersection.otherVehicleState.distanceToLeaveIntersection = Distance(30.);
+  addSituation(situationSnapshot,
+               SituationType::NotRelevant,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::Overlap, Distance(0.)),
+               50.,
+               30.);
+
+  core::RssSituationChecking situationChecking;
+  state::RssStateSnapshot rssStateSnapshot;
+  ASSERT_TRUE(situationChecking.checkSituations(situationSnapshot, rssStateSnapshot));
+
+  std::vector<HorizonRolloutResult> rolloutResults;
+  ASSERT_TRUE(calculateHorizonRollout(situationSnapshot, parameters, rolloutResults));
+  ASSERT_EQ(rolloutResults.size(), situationSnapshot.situations.size());
+  std::size_t numberOfDangerousSituations = 0u;
+  for (std::size_t s = 0u; s < situationSnapshot.situations.size(); ++s)
+  {
+    HorizonRolloutResult const &rolloutResult = rolloutResults[s];
+    EXPECT_EQ(rolloutResult.situationId, situationSnapshot.situations[s].situationId);
+    EXPECT_EQ(rolloutResult.objectId, situationSnapshot.situations[s].objectId);
+    bool isDangerousNow = false;
+    for (auto const &rssState : rssStateSnapshot.individualResponses)
+    {
+      if (rssState.situationId == rolloutResult.situationId)
+      {
+        isDangerousNow = state::isDangerous(rssState);
+      }
+    }
+    EXPECT_EQ(isDangerousNow, rolloutResult.isDangerous && (rolloutResult.firstDangerousTimeStep == 0u));
+    if (rolloutResult.isDangerous)
+    {
+      numberOfDangerousSituations++;
+      EXPECT_LE(rolloutResult.firstDangerousTimeStep, parameters.numberOfTimeSteps);
+      EXPECT_NEAR(static_cast<double>(rolloutResult.timeToDanger),
+                  static_cast<double>(rolloutResult.firstDangerousTimeStep) * 0.1,
+                  1e-9);
+    }
+    else
+    {
+      EXPECT_EQ(rolloutResult.firstDangerousTimeStep, parameters.numberOfTimeSteps + 1u);
+      EXPECT_EQ(rolloutResult.timeToDanger, std::numeric_limits<Duration>::max());
+    }
+  }
+  EXPECT_GT(numberOfDangerousSituations, 0u);
+  EXPECT_FALSE(rolloutResults.back().isDangerous);
+}
+
+TEST_F(RssHorizonRolloutTests, ApproachingLeadingVehicleWithConstantSpeed)
+{
+  double const egoSpeed = 100.;
+  double const otherSpeed = 50.;
+  Situation const &situation
+    = addSituation(situationSnapshot,
+                   SituationType::SameDirection,
+                   createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(170.)),
+                   egoSpeed,
+                   otherSpeed);
+  Distance safeDistance;
+  ASSERT_TRUE(calculateSafeLongitudinalDistanceSameDirection(
+    situation.otherVehicleState, situation.egoVehicleState, safeDistance));
+
+  std::size_t expectedTimeStep = parameters.numberOfTimeSteps + 1u;
+  for (std::size_t k = 0u; (k <= parameters.numberOfTimeSteps) && (expectedTimeStep > k); ++k)
+  {
+    Duration const time = static_cast<double>(k) * parameters.timeStep;
+    Distance const distance
+      = Distance(170.) - (kmhToMeterPerSec(egoSpeed) - kmhToMeterPerSec(otherSpeed)) * time;
+    if (!(distance > safeDistance))
+    {
+      expectedTimeStep = k;
+    }
+  }
+  ASSERT_LT(0u, expectedTimeStep);
+  ASSERT_LE(expectedTimeStep, parameters.numberOfTimeSteps);
+
+  HorizonRolloutResult const rolloutResult = rollOutSingleSituation();
+  EXPECT_TRUE(rolloutResult.isDangerous);
+  EXPECT_EQ(rolloutResult.firstDangerousTimeStep, expectedTimeStep);
+
+  // the ego vehicle brakes strong enough to stay safe
+  parameters.egoAcceleration.accelerationLon = Acceleration(-6.);
+  EXPECT_FALSE(rollOutSingleSituation().isDangerous);
+}
+
+TEST_F(RssHorizonRolloutTests, LeadingVehicleBraking)
+{
+  addSituation(situationSnapshot,
+               SituationType::SameDirection,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(45.)),
+               50.,
+               50.);
+  // safe at constant speeds
+  HorizonRolloutResult rolloutResult = rollOutSingleSituation();
+  EXPECT_FALSE(rolloutResult.isDangerous);
+
+  // the leading vehicle stops, the ego vehicle keeps its speed
+  parameters.objectAccelerations[situationSnapshot.situations.front().objectId].accelerationLon = Acceleration(-5.);
+  rolloutResult = rollOutSingleSituation();
+  EXPECT_TRUE(rolloutResult.isDangerous);
+  EXPECT_LT(0u, rolloutResult.firstDangerousTimeStep);
+
+  // other objects don't influence the situation
+  parameters.objectAccelerations.clear();
+  parameters.objectAccelerations[0u].accelerationLon = Acceleration(-5.);
+  EXPECT_FALSE(rollOutSingleSituation().isDangerous);
+}
+
+TEST_F(RssHorizonRolloutTests, LateralApproach)
+{
+  RelativePosition relativePosition = createRelativeLateralPosition(LateralRelativePosition::AtRight, Distance(3.));
+  relativePosition.longitudinalPosition = LongitudinalRelativePosition::Overlap;
+  relativePosition.longitudinalDistance = Distance(0.);
+  addSituation(situationSnapshot, SituationType::SameDirection, relativePosition, 50., 50.);
+  EXPECT_FALSE(rollOutSingleSituation().isDangerous);
+
+  // the vehicle at the left drives towards the ego vehicle
+  parameters.objectAccelerations[situationSnapshot.situations.front().objectId].accelerationLat = Acceleration(1.);
+  HorizonRolloutResult const fastApproach = rollOutSingleSituation();
+  EXPECT_TRUE(fastApproach.isDangerous);
+  EXPECT_LT(0u, fastApproach.firstDangerousTimeStep);
+
+  // a slower approach becomes dangerous later
+  parameters.objectAccelerations[situationSnapshot.situations.front().objectId].accelerationLat = Acceleration(0.5);
+  HorizonRolloutResult const slowApproach = rollOutSingleSituation();
+  EXPECT_LT(fastApproach.firstDangerousTimeStep, slowApproach.firstDangerousTimeStep);
+}
+
+TEST_F(RssHorizonRolloutTests, OppositeDirectionMovingApart)
+{
+  addSituation(situationSnapshot,
+               SituationType::OppositeDirection,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(220.)),
+               50.,
+               50.);
+  HorizonRolloutResult const approaching = rollOutSingleSituation();
+  EXPECT_TRUE(approaching.isDangerous);
+  EXPECT_LT(0u, approaching.firstDangerousTimeStep);
+
+  situationSnapshot.situations.front().relativePosition.longitudinalPosition = LongitudinalRelativePosition::InFront;
+  EXPECT_FALSE(rollOutSingleSituation().isDangerous);
+}
+
+TEST_F(RssHorizonRolloutTests, InvalidInput)
+{
+  addSituation(situationSnapshot,
+               SituationType::SameDirection,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(100.)),
+               50.,
+               50.);
+  std::vector<HorizonRolloutResult> rolloutResults;
+  ASSERT_TRUE(calculateHorizonRollout(situationSnapshot, parameters, rolloutResults));
+  EXPECT_EQ(rolloutResults.size(), 1u);
+
+  HorizonRolloutParameters invalidParameters = parameters;
+  invalidParameters.timeStep = Duration(0.);
+  EXPECT_FALSE(calculateHorizonRollout(situationSnapshot, invalidParameters, rolloutResults));
+  EXPECT_TRUE(rolloutResults.empty());
+
+  invalidParameters = parameters;
+  invalidParameters.objectAccelerations[100u].accelerationLon = Acceleration(1e6);
+  EXPECT_FALSE(calculateHorizonRollout(situationSnapshot, invalidParameters, rolloutResults));
+
+  SituationSnapshot invalidSnapshot = situationSnapshot;
+  invalidSnapshot.situations.front().egoVehicleState.velocity.speedLon.minimum = Speed(-1.);
+  EXPECT_FALSE(calculateHorizonRollout(invalidSnapshot, parameters, rolloutResults));
+}
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,263 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <cmath>
+#include "TestSupport.hpp"
+#include "ad_rss/core/RssSituationChecking.hpp"
+#include "ad_rss/situation/RssMonteCarloEvaluation.hpp"
+#include "ad_rss/state/RssStateOperation.hpp"
+#include "situation/RssFormulas.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+class RssMonteCarloEvaluationTests : public testing::Test
+{
+protected:
+  virtual void SetUp()
+  {
+    situationSnapshot.timeIndex = 1u;
+    parameters.numberOfSamples = 10000u;
+    parameters.seed = 42u;
+  }
+
+  Situation &addIntersectionSituation(double const egoSpeed, double const otherSpeed)
+  {
+    Situation &intersection = addSituation(
+      situationSnapshot,
+      SituationType::IntersectionObjectHasPriority,
+      createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(20.)),
+      egoSpeed,
+      otherSpeed);
+    intersection.egoVehicleState.distanceToEnterIntersection = Distance(40.);
+    intersection.egoVehicleState.distanceToLeaveIntersection = Distance(50.);
+    intersection.otherVehicleState.hasPriority = true;
+    intersection.otherVehicleState.distanceToEnterIntersection = Distance(20.);
+    intersection.otherVehicleState.distanceToLeaveIntersection = Distance(30.);
+    return intersection;
+  }
+
+  std::vector<MonteCarloResult> evaluate()
+  {
+    std::vector<MonteCarloResult> monteCarloResults;
+    EXPECT_TRUE(calculateDangerProbabilities(situationSnapshot, parameters, monteCarloResults));
+    EXPECT_EQ(monteCarloResults.size(), situationSnapshot.situations.size());
+    return monteCarloResults;
+  }
+
+  SituationSnapshot situationSnapshot;
+  MonteCarloParameters parameters;
+};
+
+TEST_F(RssMonteCarloEvaluationTests, WithoutUncertaintyIdenticalToSituationChecking)
+{
+  parameters.numberOfSamples = 100u;
+  for (double const distance : {10., 50., 120.})
+  {
+    addSituation(situationSnapshot,
+                 SituationType::SameDirection,
+                 createRelativeLongitudinalPosition(LongitudinalRelativePosition::InFront, Distance(distance)),
+                 50.,
+                 80.);
+    addSituation(situationSnapshot,
+                 SituationType::SameDirection,
+                 createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(distance)),
+                 80.,
+                 50.);
+    addSituation(situationSnapshot,
+                 SituationType::SameDirection,
+                 createRelativeLateralPosition(LateralRelativePosition::AtRight, Distance(0.02 * distance)),
+                 50.,
+                 50.,
+                 3.);
+    addSituation(situationSnapshot,
+                 SituationType::OppositeDirection,
+                 createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(3. * distance)),
+                 50.,
+                 50.);
+  }
+  addIntersectionSituation(30., 30.);
+  Situation &farIntersection = addIntersectionSituation(10., 30.);
+  farIntersection.egoVehicleState.distanceToEnterIntersection = Distance(100.);
+  farIntersection.egoVehicleState.distanceToLeaveIntersection = Distance(110.);
+  addSituation(situationSnapshot,
+               SituationType::NotRelevant,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(0.)),
+               50.,
+               50.);
+
+  std::vector<MonteCarloResult> const monteCarloResults = evaluate();
+  core::RssSituationChecking situationChecking;
+  state::RssStateSnapshot rssStateSnapshot;
+  ASSERT_TRUE(situationChecking.checkSituations(situationSnapshot, rssStateSnapshot));
+  std::size_t numberOfDangerousSituations = 0u;
+  for (std::size_t i = 0u; i < monteCarloResults.size(); ++i)
+  {
+    EXPECT_EQ(monteCarloResults[i].situationId, situationSnapshot.situations[i].situationId);
+    EXPECT_EQ(monteCarloResults[i].objectId, situationSnapshot.situations[i].objectId);
+    EXPECT_EQ(monteCarloResults[i].numberOfSamples, 100u);
+    bool const isDangerous = state::isDangerous(rssStateSnapshot.individualResponses[i]);
+    EXPECT_EQ(monteCarloResults[i].dangerProbability, isDangerous ? 1. : 0.);
+    if (isDangerous)
+    {
+      numberOfDangerousSituations++;
+    }
+  }
+  EXPECT_GT(numberOfDangerousSituations, 0u);
+  EXPECT_LT(numberOfDangerousSituations, monteCarloResults.size());
+}
+
+TEST_F(RssMonteCarloEvaluationTests, SpeedUncertaintyMatchesAnalyticProbability)
+{
+  // the ego vehicle follows the other vehicle: dangerous if the speed of the leading vehicle is below a threshold
+  Distance const distance(60.);
+  Situation &situation
+    = addSituation(situationSnapshot,
+                   SituationType::SameDirection,
+                   createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, distance),
+                   60.,
+                   40.);
+  Speed const speedUncertainty(5.);
+  parameters.speedLonUncertainty = speedUncertainty;
+
+  // the following distance of the ego vehicle, the leading vehicle stops within v^2 / (2 * brakeMax)
+  Distance safeDistanceStandingLeader(0.);
+  VehicleState standingLeader = situation.otherVehicleState;
+  standingLeader.velocity.speedLon.minimum = Speed(0.);
+  standingLeader.velocity.speedLon.maximum = Speed(0.);
+  ASSERT_TRUE(calculateSafeLongitudinalDistanceSameDirection(
+    standingLeader, situation.egoVehicleState, safeDistanceStandingLeader));
+  double const brakeMax = static_cast<double>(situation.otherVehicleState.dynamics.alphaLon.brakeMax);
+  double const thresholdSpeed = std::sqrt(
+    2. * brakeMax
+    * (static_cast<double>(safeDistanceStandingLeader - distance) + static_cast<double>(Distance::getPrecision())));
+  double const minimumSpeed
+    = static_cast<double>(situation.otherVehicleState.velocity.speedLon.minimum - speedUncertainty);
+  double const maximumSpeed
+    = static_cast<double>(situation.otherVehicleState.velocity.speedLon.maximum + speedUncertainty);
+  ASSERT_GT(thresholdSpeed, minimumSpeed);
+  ASSERT_LT(thresholdSpeed, maximumSpeed);
+  double const expectedProbability = (thresholdSpeed - minimumSpeed) / (maximumSpeed - minimumSpeed);
+
+  std::vector<MonteCarloResult> const monteCarloResults = evaluate();
+  // the standard deviation of the estimate is below 0.005
+  EXPECT_NEAR(monteCarloResults[0].dangerProbability, expectedProbability, 0.02);
+}
+
+TEST_F(RssMonteCarloEvaluationTests, DynamicsUncertainty)
+{
+  parameters.responseTimeUncertainty = 0.5;
+  parameters.accelerationUncertainty = 0.5;
+  parameters.decelerationUncertainty = 0.5;
+  // the other vehicle follows the ego vehicle; the more distance the less danger
+  for (double const distance : {20., 35., 50., 80.})
+  {
+    addSituation(situationSnapshot,
+                 SituationType::SameDirection,
+                 createRelativeLongitudinalPosition(LongitudinalRelativePosition::InFront, Distance(distance)),
+                 40.,
+                 50.);
+  }
+  addIntersectionSituation(30., 30.);
+
+  std::vector<MonteCarloResult> const monteCarloResults = evaluate();
+  EXPECT_GT(monteCarloResults[0].dangerProbability, 0.);
+  for (std::size_t i = 1u; i < 4u; ++i)
+  {
+    EXPECT_LE(monteCarloResults[i].dangerProbability, monteCarloResults[i - 1u].dangerProbability);
+  }
+  EXPECT_LT(monteCarloResults[3].dangerProbability, 1.);
+  EXPECT_GT(monteCarloResults[0].dangerProbability, monteCarloResults[3].dangerProbability);
+  EXPECT_GE(monteCarloResults[4].dangerProbability, 0.);
+  EXPECT_LE(monteCarloResults[4].dangerProbability, 1.);
+}
+
+TEST_F(RssMonteCarloEvaluationTests, Reproducible)
+{
+  parameters.speedLonUncertainty = Speed(5.);
+  parameters.decelerationUncertainty = 0.3;
+  addSituation(situationSnapshot,
+               SituationType::SameDirection,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(60.)),
+               60.,
+               40.);
+  std::vector<MonteCarloResult> const monteCarloResults = evaluate();
+  ASSERT_GT(monteCarloResults[0].numberOfDangerousSamples, 0u);
+  ASSERT_LT(monteCarloResults[0].numberOfDangerousSamples, parameters.numberOfSamples);
+  EXPECT_EQ(evaluate()[0].numberOfDangerousSamples, monteCarloResults[0].numberOfDangerousSamples);
+
+  // the samples only depend on their index: additional samples keep the previous ones
+  parameters.numberOfSamples = 15000u;
+  std::uint32_t const numberOfDangerousSamples = evaluate()[0].numberOfDangerousSamples;
+  EXPECT_GE(numberOfDangerousSamples, monteCarloResults[0].numberOfDangerousSamples);
+  EXPECT_LE(numberOfDangerousSamples, monteCarloResults[0].numberOfDangerousSamples + 5000u);
+
+  // other seeds provide other samples of the same distribution
+  parameters.numberOfSamples = 10000u;
+  parameters.seed = 43u;
+  MonteCarloResult const otherSeedResult = evaluate()[0];
+  EXPECT_NE(otherSeedResult.numberOfDangerousSamples, monteCarloResults[0].numberOfDangerousSamples);
+  EXPECT_NEAR(otherSeedResult.dangerProbability, monteCarloResults[0].dangerProbability, 0.03);
+}
+
+TEST_F(RssMonteCarloEvaluationTests, InvalidInput)
+{
+  addSituation(situationSnapshot,
+               SituationType::SameDirection,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(45.)),
+               60.,
+               40.);
+  std::vector<MonteCarloResult> monteCarloResults;
+
+  parameters.numberOfSamples = 0u;
+  EXPECT_FALSE(calculateDangerProbabilities(situationSnapshot, parameters, monteCarloResults));
+  EXPECT_TRUE(monteCarloResults.empty());
+  parameters.numberOfSamples = 10u;
+
+  parameters.speedLonUncertainty = Speed(-1.);
+  EXPECT_FALSE(calculateDangerProbabilities(situationSnapshot, parameters, monteCarloResults));
+  parameters.speedLonUncertainty = Speed(0.);
+
+  parameters.decelerationUncertainty = 1.;
+  EXPECT_FALSE(calculateDangerProbabilities(situationSnapshot, parameters, monteCarloResults));
+  parameters.decelerationUncertainty = 0.;
+
+  situationSnapshot.situations[0].egoVehicleState.velocity.speedLon.minimum = Speed(-1.);
+  EXPECT_FALSE(calculateDangerProbabilities(situationSnapshot, parameters, monteCarloResults));
+  EXPECT_TRUE(monteCarloResults.empty());
+  situationSnapshot.situations[0].egoVehicleState.velocity.speedLon.minimum = Speed(0.);
+
+  EXPECT_TRUE(calculateDangerProbabilities(situationSnapshot, parameters, monteCarloResults));
+  EXPECT_EQ(monteCarloResults.size(), 1u);
+}
+
+} // namespace situation
+} // namespace ad_rss
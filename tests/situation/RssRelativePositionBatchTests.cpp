@@ -0,0 +1,180 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <limits>
+#include "TestSupport.hpp"
+#include "ad_rss/core/RssSituationExtraction.hpp"
+#include "situation/RssRelativePositionBatch.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+using physics::MetricRange;
+
+class RssRelativePositionBatchTests : public testing::Test
+{
+protected:
+  /*
+   * All pairs of a grid of metric ranges, including boundaries closer than the precision of physics::Distance.
+   */
+  virtual void SetUp()
+  {
+    std::vector<MetricRange> metricRanges;
+    for (double const minimum : {-5., 0., 0.0009, 0.001, 0.0011, 0.5, 2.})
+    {
+      for (double const length : {0., 0.0005, 0.001, 1.})
+      {
+        MetricRange metricRange;
+        metricRange.minimum = Distance(minimum);
+        metricRange.maximum = Distance(minimum + length);
+        metricRanges.push_back(metricRange);
+      }
+    }
+    for (auto const &egoRange : metricRanges)
+    {
+      for (auto const &otherRange : metricRanges)
+      {
+        egoRanges.push_back(egoRange);
+        otherRanges.push_back(otherRange);
+      }
+    }
+  }
+
+  core::RssSituationExtraction situationExtraction;
+  std::vector<MetricRange> egoRanges;
+  std::vector<MetricRange> otherRanges;
+};
+
+TEST_F(RssRelativePositionBatchTests, longitudinal_equals_extraction)
+{
+  RelativePositionBatch batch;
+  batch.resize(egoRanges.size());
+  for (std::size_t i = 0u; i < egoRanges.size(); ++i)
+  {
+    batch.setRanges(i, egoRanges[i], otherRanges[i]);
+  }
+  ASSERT_TRUE(calculateRelativePositionBatch(batch));
+
+  for (std::size_t i = 0u; i < egoRanges.size(); ++i)
+  {
+    LongitudinalRelativePosition expectedPosition;
+    Distance expectedDistance;
+    situationExtraction.calcluateRelativeLongitudinalPosition(
+      egoRanges[i], otherRanges[i], expectedPosition, expectedDistance);
+    EXPECT_EQ(expectedPosition, toLongitudinalRelativePosition(batch.position[i])) << i;
+    EXPECT_DOUBLE_EQ(static_cast<double>(expectedDistance), batch.distance[i]) << i;
+  }
+}
+
+TEST_F(RssRelativePositionBatchTests, lateral_equals_extraction)
+{
+  RelativePositionBatch batch;
+  batch.resize(egoRanges.size());
+  for (std::size_t i = 0u; i < egoRanges.size(); ++i)
+  {
+    batch.setRanges(i, egoRanges[i], otherRanges[i]);
+  }
+  ASSERT_TRUE(calculateRelativePositionBatch(batch));
+
+  for (std::size_t i = 0u; i < egoRanges.size(); ++i)
+  {
+    LateralRelativePosition expectedPosition;
+    Distance expectedDistance;
+    situationExtraction.calcluateRelativeLateralPosition(
+      egoRanges[i], otherRanges[i], expectedPosition, expectedDistance);
+    EXPECT_EQ(expectedPosition, toLateralRelativePosition(batch.position[i])) << i;
+    EXPECT_DOUBLE_EQ(static_cast<double>(expectedDistance), batch.distance[i]) << i;
+  }
+}
+
+TEST_F(RssRelativePositionBatchTests, intersection_equals_extraction)
+{
+  RelativePositionBatch batch;
+  batch.resize(egoRanges.size() + 1u);
+  for (std::size_t i = 0u; i < egoRanges.size(); ++i)
+  {
+    batch.setRangesIntersection(i, egoRanges[i], otherRanges[i]);
+  }
+  batch.setOverlap(egoRanges.size());
+  ASSERT_TRUE(calculateRelativePositionBatch(batch));
+
+  for (std::size_t i = 0u; i < egoRanges.size(); ++i)
+  {
+    LongitudinalRelativePosition expectedPosition;
+    Distance expectedDistance;
+    situationExtraction.calcluateRelativeLongitudinalPositionIntersection(
+      egoRanges[i], otherRanges[i], expectedPosition, expectedDistance);
+    EXPECT_EQ(expectedPosition, toLongitudinalRelativePosition(batch.position[i])) << i;
+    EXPECT_DOUBLE_EQ(static_cast<double>(expectedDistance), batch.distance[i]) << i;
+  }
+  EXPECT_EQ(LongitudinalRelativePosition::Overlap, toLongitudinalRelativePosition(batch.position.back()));
+  EXPECT_EQ(LateralRelativePosition::Overlap, toLateralRelativePosition(batch.position.back()));
+  EXPECT_DOUBLE_EQ(0., batch.distance.back());
+}
+
+TEST_F(RssRelativePositionBatchTests, invalid_input)
+{
+  RelativePositionBatch batch;
+  EXPECT_TRUE(calculateRelativePositionBatch(batch));
+
+  batch.resize(2u);
+  batch.setRanges(0u, egoRanges[0u], otherRanges[0u]);
+  batch.setOverlap(1u);
+  EXPECT_TRUE(calculateRelativePositionBatch(batch));
+
+  batch.otherMaximum[1u] = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_FALSE(calculateRelativePositionBatch(batch));
+
+  batch.otherMaximum[1u] = 2. * static_cast<double>(Distance::getMax());
+  EXPECT_FALSE(calculateRelativePositionBatch(batch));
+
+  // the resulting distance exceeds the range of physics::Distance
+  batch.egoMinimum[1u] = static_cast<double>(Distance::getMax());
+  batch.egoMaximum[1u] = static_cast<double>(Distance::getMax());
+  batch.otherMinimum[1u] = static_cast<double>(Distance::getMin());
+  batch.otherMaximum[1u] = static_cast<double>(Distance::getMin());
+  EXPECT_FALSE(calculateRelativePositionBatch(batch));
+
+  // each of the ranges is checked for subnormal values
+  for (auto values : {&batch.egoMinimum, &batch.egoMaximum, &batch.otherMinimum, &batch.otherMaximum})
+  {
+    batch.setOverlap(1u);
+    ASSERT_TRUE(calculateRelativePositionBatch(batch));
+    (*values)[1u] = std::numeric_limits<double>::denorm_min();
+    EXPECT_FALSE(calculateRelativePositionBatch(batch));
+  }
+
+  batch.egoMaximum.pop_back();
+  EXPECT_FALSE(calculateRelativePositionBatch(batch));
+}
+
+} // namespace situation
+} // namespace ad_rss
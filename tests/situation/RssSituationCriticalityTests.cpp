@@ -0,0 +1,132 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "TestSupport.hpp"
+#include "ad_rss/situation/RssSituationCriticality.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+TEST(RssSituationCriticalityTests, SameDirection)
+{
+  // ego following with 72 km/h (20 m/s), other leading with 36 km/h (10 m/s)
+  Situation situation = createSituation(
+    SituationType::SameDirection,
+    createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(50.)),
+    72.,
+    36.);
+  EXPECT_NEAR(static_cast<double>(estimateTimeToConflict(situation)), 5., cDoubleNear);
+
+  situation.relativePosition.longitudinalPosition = LongitudinalRelativePosition::InFront;
+  EXPECT_EQ(estimateTimeToConflict(situation), std::numeric_limits<Duration>::max());
+
+  situation.relativePosition.longitudinalPosition = LongitudinalRelativePosition::OverlapFront;
+  EXPECT_EQ(estimateTimeToConflict(situation), Duration(0.));
+}
+
+TEST(RssSituationCriticalityTests, OppositeDirection)
+{
+  Situation situation = createSituation(
+    SituationType::OppositeDirection,
+    createRelativeLongitudinalPosition(LongitudinalRelativePosition::InFront, Distance(90.)),
+    72.,
+    36.);
+  EXPECT_NEAR(static_cast<double>(estimateTimeToConflict(situation)), 3., cDoubleNear);
+
+  situation.egoVehicleState = createVehicleStateForLongitudinalMotion(0.);
+  situation.otherVehicleState = createVehicleStateForLongitudinalMotion(0.);
+  EXPECT_EQ(estimateTimeToConflict(situation), std::numeric_limits<Duration>::max());
+}
+
+TEST(RssSituationCriticalityTests, Intersection)
+{
+  Situation situation = createSituation(
+    SituationType::IntersectionSamePriority,
+    createRelativeLongitudinalPosition(LongitudinalRelativePosition::InFront, Distance(0.)),
+    72.,
+    36.);
+  situation.egoVehicleState.distanceToEnterIntersection = Distance(20.);
+  situation.otherVehicleState.distanceToEnterIntersection = Distance(30.);
+  EXPECT_NEAR(static_cast<double>(estimateTimeToConflict(situation)), 3., cDoubleNear);
+}
+
+TEST(RssSituationCriticalityTests, NotRelevant)
+{
+  Situation const situation = createSituation(
+    SituationType::NotRelevant,
+    createRelativeLongitudinalPosition(LongitudinalRelativePosition::Overlap, Distance(0.)),
+    72.,
+    36.);
+  EXPECT_EQ(estimateTimeToConflict(situation), std::numeric_limits<Duration>::max());
+}
+
+TEST(RssSituationCriticalityTests, OrderSituations)
+{
+  SituationSnapshot situationSnapshot;
+  addSituation(situationSnapshot,
+               SituationType::NotRelevant,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::Overlap, Distance(0.)),
+               72.,
+               36.);
+  addSituation(situationSnapshot,
+               SituationType::SameDirection,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(50.)),
+               72.,
+               36.);
+  addSituation(situationSnapshot,
+               SituationType::OppositeDirection,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::InFront, Distance(90.)),
+               72.,
+               36.);
+  addSituation(situationSnapshot,
+               SituationType::SameDirection,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::InFront, Distance(10.)),
+               72.,
+               36.);
+  addSituation(situationSnapshot,
+               SituationType::SameDirection,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::InFront, Distance(5.)),
+               72.,
+               36.);
+
+  std::vector<std::size_t> situationOrder;
+  ASSERT_TRUE(orderSituationsByCriticality(situationSnapshot, situationOrder));
+  // situations not approaching each other are ordered by distance, then by their order in the snapshot
+  std::vector<std::size_t> const expectedOrder = {2u, 1u, 0u, 4u, 3u};
+  EXPECT_EQ(situationOrder, expectedOrder);
+
+  situationSnapshot.situations.clear();
+  ASSERT_TRUE(orderSituationsByCriticality(situationSnapshot, situationOrder));
+  EXPECT_TRUE(situationOrder.empty());
+}
+
+} // namespace situation
+} // namespace ad_rss
@@ -0,0 +1,282 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "TestSupport.hpp"
+#include "ad_rss/core/RssSituationChecking.hpp"
+#include "ad_rss/situation/RssHorizonRollout.hpp"
+#include "ad_rss/situation/RssSituationCriticality.hpp"
+#include "ad_rss/state/RssStateOperation.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+class RssSituationTimeToDangerTests : public testing::Test
+{
+protected:
+  Duration calculateTime(Situation const &situation)
+  {
+    Duration timeToDanger(-1.);
+    EXPECT_TRUE(calculateTimeToDanger(situation, getDefaultFormulaProvider(), timeToDanger));
+    return timeToDanger;
+  }
+
+  /*
+   * The first time the situation becomes dangerous, if the vehicles move with the given accelerations.
+   */
+  Duration rollOut(Situation const &situation, PredictedAcceleration const &ego, PredictedAcceleration const &other)
+  {
+    SituationSnapshot situationSnapshot;
+    situationSnapshot.timeIndex = 1u;
+    situationSnapshot.situations.push_back(situation);
+    HorizonRolloutParameters parameters;
+    parameters.timeStep = Duration(0.01);
+    parameters.numberOfTimeSteps = 600u;
+    parameters.egoAcceleration = ego;
+    parameters.objectAccelerations[situation.objectId] = other;
+    std::vector<HorizonRolloutResult> rolloutResults;
+    EXPECT_TRUE(calculateHorizonRollout(situationSnapshot, parameters, rolloutResults));
+    return rolloutResults.empty() ? Duration(0.) : rolloutResults.front().timeToDanger;
+  }
+
+  PredictedAcceleration createAcceleration(double const accelerationLon, double const accelerationLat = 0.)
+  {
+    PredictedAcceleration acceleration;
+    acceleration.accelerationLon = Acceleration(accelerationLon);
+    acceleration.accelerationLat = Acceleration(accelerationLat);
+    return acceleration;
+  }
+
+  /*
+   * The bound holds for the worst case and is tight, if the worst case is exactly the one of the RSS formulas.
+   */
+  void expectLowerBound(Duration const &timeToDanger, Duration const &worstCaseTime, bool const expectTight)
+  {
+    EXPECT_LE(static_cast<double>(timeToDanger), static_cast<double>(worstCaseTime) + 1e-6);
+    if (expectTight && (worstCaseTime < Duration(5.5)))
+    {
+      EXPECT_NEAR(static_cast<double>(timeToDanger), static_cast<double>(worstCaseTime), 0.02);
+    }
+  }
+};
+
+TEST_F(RssSituationTimeToDangerTests, SameDirection)
+{
+  std::size_t numberOfSafeSituations = 0u;
+  for (double egoSpeed = 10.; egoSpeed < 130.; egoSpeed += 30.)
+  {
+    for (double otherSpeed = 0.; otherSpeed < 130.; otherSpeed += 40.)
+    {
+      for (double distance = 10.; distance < 250.; distance += 40.)
+      {
+        // ego following: ego accelerates, other brakes
+        Situation situation = createSituation(
+          SituationType::SameDirection,
+          createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(distance)),
+          egoSpeed,
+          otherSpeed);
+        Duration timeToDanger = calculateTime(situation);
+        Duration worstCaseTime
+          = rollOut(situation,
+                    createAcceleration(static_cast<double>(situation.egoVehicleState.dynamics.alphaLon.accelMax)),
+                    createAcceleration(-static_cast<double>(situation.otherVehicleState.dynamics.alphaLon.brakeMax)));
+        expectLowerBound(timeToDanger, worstCaseTime, true);
+        if (timeToDanger > Duration(0.))
+        {
+          numberOfSafeSituations++;
+        }
+
+        // ego leading: ego brakes, other accelerates
+        situation.relativePosition.longitudinalPosition = LongitudinalRelativePosition::InFront;
+        timeToDanger = calculateTime(situation);
+        worstCaseTime
+          = rollOut(situation,
+                    createAcceleration(-static_cast<double>(situation.egoVehicleState.dynamics.alphaLon.brakeMax)),
+                    createAcceleration(static_cast<double>(situation.otherVehicleState.dynamics.alphaLon.accelMax)));
+        expectLowerBound(timeToDanger, worstCaseTime, true);
+      }
+    }
+  }
+  EXPECT_GT(numberOfSafeSituations, 10u);
+}
+
+TEST_F(RssSituationTimeToDangerTests, OppositeDirection)
+{
+  for (double egoSpeed = 0.; egoSpeed < 130.; egoSpeed += 30.)
+  {
+    for (double otherSpeed = 0.; otherSpeed < 130.; otherSpeed += 40.)
+    {
+      for (double distance = 50.; distance < 500.; distance += 60.)
+      {
+        Situation situation = createSituation(
+          SituationType::OppositeDirection,
+          createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(distance)),
+          egoSpeed,
+          otherSpeed);
+        for (bool isEgoInCorrectLane : {true, false})
+        {
+          situation.egoVehicleState.isInCorrectLane = isEgoInCorrectLane;
+          situation.otherVehicleState.isInCorrectLane = !isEgoInCorrectLane;
+          Duration const timeToDanger = calculateTime(situation);
+          Duration const worstCaseTime
+            = rollOut(situation,
+                      createAcceleration(static_cast<double>(situation.egoVehicleState.dynamics.alphaLon.accelMax)),
+                      createAcceleration(static_cast<double>(situation.otherVehicleState.dynamics.alphaLon.accelMax)));
+          expectLowerBound(timeToDanger, worstCaseTime, true);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(RssSituationTimeToDangerTests, Lateral)
+{
+  for (double egoLatSpeed = -1.5; egoLatSpeed < 2.; egoLatSpeed += 0.75)
+  {
+    for (double otherLatSpeed = -1.5; otherLatSpeed < 2.; otherLatSpeed += 0.7)
+    {
+      for (double distance = 0.5; distance < 6.; distance += 1.3)
+      {
+        RelativePosition relativePosition
+          = createRelativeLateralPosition(LateralRelativePosition::AtLeft, Distance(distance));
+        relativePosition.longitudinalPosition = LongitudinalRelativePosition::Overlap;
+        relativePosition.longitudinalDistance = Distance(0.);
+        Situation situation = createSituation(SituationType::SameDirection, relativePosition, 50., 50.);
+        situation.egoVehicleState.velocity.speedLat.minimum = Speed(egoLatSpeed);
+        situation.egoVehicleState.velocity.speedLat.maximum = Speed(egoLatSpeed);
+        situation.otherVehicleState.velocity.speedLat.minimum = Speed(otherLatSpeed);
+        situation.otherVehicleState.velocity.speedLat.maximum = Speed(otherLatSpeed);
+
+        // ego at left: moving towards the other with positive lateral accelerations
+        double const egoAccel = static_cast<double>(situation.egoVehicleState.dynamics.alphaLat.accelMax);
+        double const otherAccel = static_cast<double>(situation.otherVehicleState.dynamics.alphaLat.accelMax);
+        Duration timeToDanger = calculateTime(situation);
+        Duration worstCaseTime
+          = rollOut(situation, createAcceleration(0., egoAccel), createAcceleration(0., -otherAccel));
+        // the bound is tight if both vehicles don't change their lateral direction
+        expectLowerBound(timeToDanger, worstCaseTime, (egoLatSpeed >= 0.) && (otherLatSpeed <= 0.));
+
+        situation.relativePosition.lateralPosition = LateralRelativePosition::AtRight;
+        timeToDanger = calculateTime(situation);
+        worstCaseTime = rollOut(situation, createAcceleration(0., -egoAccel), createAcceleration(0., otherAccel));
+        expectLowerBound(timeToDanger, worstCaseTime, (egoLatSpeed <= 0.) && (otherLatSpeed >= 0.));
+      }
+    }
+  }
+}
+
+TEST_F(RssSituationTimeToDangerTests, Intersection)
+{
+  Situation situation
+    = createSituation(SituationType::IntersectionObjectHasPriority,
+                      createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(10.)),
+                      50.,
+                      50.);
+  situation.egoVehicleState.distanceToEnterIntersection = Distance(120.);
+  situation.egoVehicleState.distanceToLeaveIntersection = Distance(130.);
+  situation.otherVehicleState.hasPriority = true;
+  situation.otherVehicleState.distanceToEnterIntersection = Distance(10.);
+  situation.otherVehicleState.distanceToLeaveIntersection = Distance(20.);
+
+  Duration const timeToDanger = calculateTime(situation);
+  EXPECT_GT(timeToDanger, Duration(0.));
+  Duration const worstCaseTime
+    = rollOut(situation,
+              createAcceleration(static_cast<double>(situation.egoVehicleState.dynamics.alphaLon.accelMax)),
+              createAcceleration(static_cast<double>(situation.otherVehicleState.dynamics.alphaLon.accelMax)));
+  expectLowerBound(timeToDanger, worstCaseTime, false);
+
+  // the ego vehicle is not able to stop in front of the intersection anymore
+  situation.egoVehicleState.distanceToEnterIntersection = Distance(20.);
+  EXPECT_EQ(calculateTime(situation), Duration(0.));
+}
+
+TEST_F(RssSituationTimeToDangerTests, DangerousAndNotRelevant)
+{
+  Situation situation
+    = createSituation(SituationType::SameDirection,
+                      createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(5.)),
+                      100.,
+                      50.);
+  EXPECT_EQ(calculateTime(situation), Duration(0.));
+
+  situation.situationType = SituationType::NotRelevant;
+  EXPECT_EQ(calculateTime(situation), std::numeric_limits<Duration>::max());
+
+  // not approaching at all
+  situation = createSituation(SituationType::SameDirection,
+                              createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(50.)),
+                              0.,
+                              50.);
+  situation.egoVehicleState.dynamics.alphaLon.accelMax = Acceleration(0.);
+  EXPECT_EQ(calculateTime(situation), std::numeric_limits<Duration>::max());
+}
+
+TEST_F(RssSituationTimeToDangerTests, SituationCheckingSideOutput)
+{
+  SituationSnapshot situationSnapshot;
+  situationSnapshot.timeIndex = 1u;
+  for (double distance = 5.; distance < 300.; distance += 50.)
+  {
+    addSituation(situationSnapshot,
+                 SituationType::SameDirection,
+                 createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(distance)),
+                 100.,
+                 50.);
+  }
+
+  core::RssSituationChecking situationChecking;
+  state::RssStateSnapshot rssStateSnapshot;
+  std::vector<Duration> timesToDanger;
+  ASSERT_TRUE(situationChecking.checkSituations(situationSnapshot, rssStateSnapshot, timesToDanger));
+  ASSERT_EQ(rssStateSnapshot.individualResponses.size(), situationSnapshot.situations.size());
+  ASSERT_EQ(timesToDanger.size(), situationSnapshot.situations.size());
+
+  Duration lastTimeToDanger(0.);
+  for (std::size_t i = 0u; i < timesToDanger.size(); ++i)
+  {
+    Duration timeToDanger;
+    ASSERT_TRUE(situationChecking.calculateTimeToDanger(situationSnapshot.situations[i], timeToDanger));
+    EXPECT_EQ(timesToDanger[i], timeToDanger);
+    EXPECT_EQ(state::isDangerous(rssStateSnapshot.individualResponses[i]), timesToDanger[i] == Duration(0.));
+    // the farther away, the longer the situation stays safe
+    EXPECT_GE(timesToDanger[i], lastTimeToDanger);
+    lastTimeToDanger = timesToDanger[i];
+  }
+  EXPECT_EQ(timesToDanger.front(), Duration(0.));
+  EXPECT_GT(timesToDanger.back(), Duration(0.));
+
+  // invalid time index
+  EXPECT_FALSE(situationChecking.checkSituations(situationSnapshot, rssStateSnapshot, timesToDanger));
+  EXPECT_TRUE(timesToDanger.empty());
+}
+
+} // namespace situation
+} // namespace ad_rss
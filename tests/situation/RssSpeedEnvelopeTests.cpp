@@ -0,0 +1,295 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "TestSupport.hpp"
+#include "ad_rss/core/RssSituationChecking.hpp"
+#include "ad_rss/situation/RssSpeedEnvelope.hpp"
+#include "ad_rss/state/RssStateOperation.hpp"
+
+namespace ad_rss {
+namespace situation {
+
+class RssSpeedEnvelopeTests : public testing::Test
+{
+protected:
+  state::RssState checkSituation(Situation const &situation)
+  {
+    SituationSnapshot situationSnapshot;
+    situationSnapshot.timeIndex = 1u;
+    situationSnapshot.situations.push_back(situation);
+    core::RssSituationChecking situationChecking;
+    state::RssStateSnapshot rssStateSnapshot;
+    EXPECT_TRUE(situationChecking.checkSituations(situationSnapshot, rssStateSnapshot));
+    return rssStateSnapshot.individualResponses.empty() ? state::RssState() : rssStateSnapshot.individualResponses[0];
+  }
+
+  bool isLongitudinalSafeAt(Situation situation, Speed const &speedLon)
+  {
+    situation.egoVehicleState.velocity.speedLon.minimum = speedLon;
+    situation.egoVehicleState.velocity.speedLon.maximum = speedLon;
+    return state::isLongitudinalSafe(checkSituation(situation));
+  }
+
+  bool isLateralSafeAt(Situation situation, Speed const &speedLat)
+  {
+    situation.egoVehicleState.velocity.speedLat.minimum = speedLat;
+    situation.egoVehicleState.velocity.speedLat.maximum = speedLat;
+    return state::isLateralSafe(checkSituation(situation));
+  }
+
+  SituationSpeedLimits calculateLimits(Situation const &situation)
+  {
+    SituationSnapshot situationSnapshot;
+    situationSnapshot.timeIndex = 1u;
+    situationSnapshot.situations.push_back(situation);
+    SpeedEnvelope speedEnvelope;
+    EXPECT_TRUE(calculateSpeedEnvelope(situationSnapshot, speedEnvelope));
+    EXPECT_EQ(speedEnvelope.situationLimits.size(), 1u);
+    return speedEnvelope.situationLimits.empty() ? SituationSpeedLimits() : speedEnvelope.situationLimits[0];
+  }
+
+  void expectLongitudinalLimitsExact(Situation const &situation)
+  {
+    SituationSpeedLimits const limits = calculateLimits(situation);
+    EXPECT_EQ(limits.isLongitudinalSafe, state::isLongitudinalSafe(checkSituation(situation)));
+    if (limits.speedLonMax < std::numeric_limits<Speed>::max())
+    {
+      ASSERT_GT(limits.speedLonMax, Speed(cEpsilon));
+      EXPECT_TRUE(isLongitudinalSafeAt(situation, limits.speedLonMax - Speed(cEpsilon)));
+      EXPECT_FALSE(isLongitudinalSafeAt(situation, limits.speedLonMax + Speed(cEpsilon)));
+    }
+    if (limits.speedLonMin > std::numeric_limits<Speed>::lowest())
+    {
+      ASSERT_GT(limits.speedLonMin, Speed(cEpsilon));
+      EXPECT_FALSE(isLongitudinalSafeAt(situation, limits.speedLonMin - Speed(cEpsilon)));
+      EXPECT_TRUE(isLongitudinalSafeAt(situation, limits.speedLonMin + Speed(cEpsilon)));
+    }
+  }
+
+  void expectLateralLimitsExact(Situation const &situation)
+  {
+    SituationSpeedLimits const limits = calculateLimits(situation);
+    EXPECT_EQ(limits.isLateralSafe, state::isLateralSafe(checkSituation(situation)));
+    if (limits.speedLatMax < std::numeric_limits<Speed>::max())
+    {
+      EXPECT_TRUE(isLateralSafeAt(situation, limits.speedLatMax - Speed(cEpsilon)));
+      EXPECT_FALSE(isLateralSafeAt(situation, limits.speedLatMax + Speed(cEpsilon)));
+    }
+    if (limits.speedLatMin > std::numeric_limits<Speed>::lowest())
+    {
+      EXPECT_FALSE(isLateralSafeAt(situation, limits.speedLatMin - Speed(cEpsilon)));
+      EXPECT_TRUE(isLateralSafeAt(situation, limits.speedLatMin + Speed(cEpsilon)));
+    }
+  }
+
+  static constexpr double cEpsilon = 0.01;
+};
+
+constexpr double RssSpeedEnvelopeTests::cEpsilon;
+
+TEST_F(RssSpeedEnvelopeTests, SameDirectionFollowing)
+{
+  for (double distance = 5.; distance < 200.; distance += 15.)
+  {
+    Situation const situation = createSituation(
+      SituationType::SameDirection,
+      createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(distance)),
+      50.,
+      30.);
+    SituationSpeedLimits const limits = calculateLimits(situation);
+    EXPECT_EQ(limits.speedLonMin, std::numeric_limits<Speed>::lowest());
+    EXPECT_LT(limits.speedLonMax, std::numeric_limits<Speed>::max());
+    expectLongitudinalLimitsExact(situation);
+  }
+}
+
+TEST_F(RssSpeedEnvelopeTests, SameDirectionLeading)
+{
+  for (double distance = 5.; distance < 100.; distance += 10.)
+  {
+    Situation const situation = createSituation(
+      SituationType::SameDirection,
+      createRelativeLongitudinalPosition(LongitudinalRelativePosition::InFront, Distance(distance)),
+      50.,
+      100.);
+    SituationSpeedLimits const limits = calculateLimits(situation);
+    EXPECT_EQ(limits.speedLonMax, std::numeric_limits<Speed>::max());
+    expectLongitudinalLimitsExact(situation);
+  }
+}
+
+TEST_F(RssSpeedEnvelopeTests, OppositeDirection)
+{
+  for (double distance = 160.; distance < 400.; distance += 30.)
+  {
+    Situation situation = createSituation(
+      SituationType::OppositeDirection,
+      createRelativeLongitudinalPosition(LongitudinalRelativePosition::InFront, Distance(distance)),
+      50.,
+      50.);
+    expectLongitudinalLimitsExact(situation);
+    situation.egoVehicleState.isInCorrectLane = false;
+    expectLongitudinalLimitsExact(situation);
+  }
+}
+
+TEST_F(RssSpeedEnvelopeTests, Lateral)
+{
+  for (double distance = 0.2; distance < 3.; distance += 0.4)
+  {
+    for (double otherLatSpeed = -4.; otherLatSpeed <= 4.; otherLatSpeed += 2.)
+    {
+      Situation situation = createSituation(
+        SituationType::SameDirection,
+        createRelativeLateralPosition(LateralRelativePosition::AtLeft, Distance(distance)),
+        50.,
+        50.,
+        otherLatSpeed);
+      expectLateralLimitsExact(situation);
+      EXPECT_EQ(calculateLimits(situation).speedLatMin, std::numeric_limits<Speed>::lowest());
+      situation.relativePosition.lateralPosition = LateralRelativePosition::AtRight;
+      expectLateralLimitsExact(situation);
+      EXPECT_EQ(calculateLimits(situation).speedLatMax, std::numeric_limits<Speed>::max());
+    }
+  }
+
+  // lateral overlap: no safe lateral speed
+  Situation const situation
+    = createSituation(SituationType::SameDirection,
+                      createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(10.)),
+                      50.,
+                      50.);
+  SituationSpeedLimits const limits = calculateLimits(situation);
+  EXPECT_GT(limits.speedLatMin, limits.speedLatMax);
+  EXPECT_FALSE(limits.isLateralSafe);
+}
+
+TEST_F(RssSpeedEnvelopeTests, Intersection)
+{
+  for (double distanceToEnter = 5.; distanceToEnter < 100.; distanceToEnter += 10.)
+  {
+    Situation situation = createSituation(
+      SituationType::IntersectionObjectHasPriority,
+      createRelativeLongitudinalPosition(LongitudinalRelativePosition::InFront, Distance(0.)),
+      50.,
+      50.);
+    situation.otherVehicleState.hasPriority = true;
+    situation.egoVehicleState.distanceToEnterIntersection = Distance(distanceToEnter);
+    situation.egoVehicleState.distanceToLeaveIntersection = Distance(distanceToEnter + 10.);
+    expectLongitudinalLimitsExact(situation);
+    EXPECT_GT(calculateLimits(situation).speedLatMin, calculateLimits(situation).speedLatMax);
+  }
+}
+
+TEST_F(RssSpeedEnvelopeTests, Aggregation)
+{
+  SituationSnapshot situationSnapshot;
+  situationSnapshot.timeIndex = 1u;
+  // two vehicles in front at different distances, one laterally separated and a not relevant one
+  addSituation(situationSnapshot,
+               SituationType::SameDirection,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(30.)),
+               50.,
+               30.);
+  addSituation(situationSnapshot,
+               SituationType::SameDirection,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(10.)),
+               50.,
+               30.);
+  RelativePosition lateralPosition = createRelativeLateralPosition(LateralRelativePosition::AtLeft, Distance(2.));
+  lateralPosition.longitudinalPosition = LongitudinalRelativePosition::AtBack;
+  lateralPosition.longitudinalDistance = Distance(1.);
+  addSituation(situationSnapshot, SituationType::SameDirection, lateralPosition, 50., 30.);
+  addSituation(situationSnapshot,
+               SituationType::NotRelevant,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::Overlap),
+               50.,
+               30.);
+
+  SpeedEnvelope speedEnvelope;
+  ASSERT_TRUE(calculateSpeedEnvelope(situationSnapshot, speedEnvelope));
+  ASSERT_EQ(speedEnvelope.situationLimits.size(), 4u);
+  EXPECT_LT(speedEnvelope.situationLimits[1].speedLonMax, speedEnvelope.situationLimits[0].speedLonMax);
+  // the laterally safe situation doesn't restrict the longitudinal speed
+  EXPECT_TRUE(speedEnvelope.situationLimits[2].isLateralSafe);
+  EXPECT_LT(speedEnvelope.situationLimits[2].speedLonMax, speedEnvelope.situationLimits[1].speedLonMax);
+  EXPECT_EQ(speedEnvelope.speedLonMax, speedEnvelope.situationLimits[1].speedLonMax);
+  EXPECT_EQ(speedEnvelope.speedLonMin, std::numeric_limits<Speed>::lowest());
+
+  // the longitudinal unsafe situations overlap laterally: no safe lateral speed
+  EXPECT_GT(speedEnvelope.speedLatMin, speedEnvelope.speedLatMax);
+
+  // the dangerous objects are those of the situation checking
+  core::RssSituationChecking situationChecking;
+  state::RssStateSnapshot rssStateSnapshot;
+  ASSERT_TRUE(situationChecking.checkSituations(situationSnapshot, rssStateSnapshot));
+  std::vector<world::ObjectId> expectedDangerousObjects;
+  for (auto const &rssState : rssStateSnapshot.individualResponses)
+  {
+    if (state::isDangerous(rssState))
+    {
+      expectedDangerousObjects.push_back(rssState.objectId);
+    }
+  }
+  EXPECT_FALSE(expectedDangerousObjects.empty());
+  EXPECT_EQ(speedEnvelope.dangerousObjects, expectedDangerousObjects);
+
+  // the ego speed within the envelope is safe
+  for (auto &situation : situationSnapshot.situations)
+  {
+    situation.egoVehicleState.velocity.speedLon.minimum = speedEnvelope.speedLonMax - Speed(cEpsilon);
+    situation.egoVehicleState.velocity.speedLon.maximum = speedEnvelope.speedLonMax - Speed(cEpsilon);
+  }
+  ASSERT_TRUE(calculateSpeedEnvelope(situationSnapshot, speedEnvelope));
+  EXPECT_TRUE(speedEnvelope.dangerousObjects.empty());
+}
+
+TEST_F(RssSpeedEnvelopeTests, InvalidInput)
+{
+  SituationSnapshot situationSnapshot;
+  situationSnapshot.timeIndex = 1u;
+  addSituation(situationSnapshot,
+               SituationType::SameDirection,
+               createRelativeLongitudinalPosition(LongitudinalRelativePosition::AtBack, Distance(30.)),
+               50.,
+               30.);
+  situationSnapshot.situations[0].egoVehicleState.velocity.speedLon.minimum = Speed(-1.);
+  SpeedEnvelope speedEnvelope;
+  EXPECT_FALSE(calculateSpeedEnvelope(situationSnapshot, speedEnvelope));
+  EXPECT_TRUE(speedEnvelope.situationLimits.empty());
+
+  situationSnapshot.situations[0].egoVehicleState.velocity.speedLon.minimum = Speed(1.);
+  situationSnapshot.situations[0].egoVehicleState.dynamics.responseTime = Duration(-1.);
+  EXPECT_FALSE(calculateSpeedEnvelope(situationSnapshot, speedEnvelope));
+}
+
+} // namespace situation
+} // namespace ad_rss
@@ -54,4 +54,34 @@ const physics::Acceleration cMinimumLongitudinalBrakingDecelelerationCorrect(3);
 const physics::Acceleration cMaximumLateralAcceleration(0.2);
 const physics::Acceleration cMinimumLateralBrakingDeceleleration(0.8);
 
+/*!
+ * @brief Dynamics profile of the ego vehicle used within tests, equivalent to getEgoRssDynamics()
+ */
+struct TestEgoRssDynamicsProfile
+{
+  static constexpr double cLonAccelMax = 3.5;
+  static constexpr double cLonBrakeMax = 8.;
+  static constexpr double cLonBrakeMin = 4.;
+  static constexpr double cLonBrakeMinCorrect = 3.;
+  static constexpr double cLatAccelMax = 0.2;
+  static constexpr double cLatBrakeMin = 0.8;
+  static constexpr double cLateralFluctuationMargin = 0.;
+  static constexpr double cResponseTime = 1.;
+};
+
+/*!
+ * @brief Dynamics profile of non-ego vehicles used within tests, equivalent to getObjectRssDynamics()
+ */
+struct TestObjectRssDynamicsProfile
+{
+  static constexpr double cLonAccelMax = 3.5;
+  static constexpr double cLonBrakeMax = 8.;
+  static constexpr double cLonBrakeMin = 4.;
+  static constexpr double cLonBrakeMinCorrect = 3.;
+  static constexpr double cLatAccelMax = 0.2;
+  static constexpr double cLatBrakeMin = 0.8;
+  static constexpr double cLateralFluctuationMargin = 0.;
+  static constexpr double cResponseTime = 2.;
+};
+
 } // namespace ad_rss
@@ -153,6 +153,38 @@ situation::RelativePosition createRelativeLateralPosition(situation::LateralRela
   return relativePosition;
 }
 
+situation::Situation createSituation(situation::SituationType const situationType,
+                                     situation::RelativePosition const &relativePosition,
+                                     double const egoSpeed,
+                                     double const otherSpeed,
+                                     double const otherLatSpeed)
+{
+  situation::Situation situation;
+  situation.situationId = 1u;
+  situation.objectId = 100u;
+  situation.situationType = situationType;
+  situation.egoVehicleState = createVehicleState(egoSpeed, 0.);
+  situation.egoVehicleState.dynamics = getEgoRssDynamics();
+  situation.otherVehicleState = createVehicleState(otherSpeed, otherLatSpeed);
+  situation.relativePosition = relativePosition;
+  return situation;
+}
+
+situation::Situation &addSituation(situation::SituationSnapshot &situationSnapshot,
+                                   situation::SituationType const situationType,
+                                   situation::RelativePosition const &relativePosition,
+                                   double const egoSpeed,
+                                   double const otherSpeed,
+                                   double const otherLatSpeed)
+{
+  situation::Situation situation
+    = createSituation(situationType, relativePosition, egoSpeed, otherSpeed, otherLatSpeed);
+  situation.situationId = situationSnapshot.situations.size() + 1u;
+  situation.objectId = situationSnapshot.situations.size() + 100u;
+  situationSnapshot.situations.push_back(situation);
+  return situationSnapshot.situations.back();
+}
+
 Distance calculateLongitudinalStoppingDistance(physics::Speed const &objectSpeed,
                                                Acceleration const &acceleration,
                                                Acceleration const &deceleration,
@@ -37,6 +37,7 @@
 #include "ad_rss/physics/Operations.hpp"
 #include "ad_rss/situation/RelativePosition.hpp"
 #include "ad_rss/situation/Situation.hpp"
+#include "ad_rss/situation/SituationSnapshot.hpp"
 #include "ad_rss/situation/VehicleState.hpp"
 #include "ad_rss/state/ProperResponse.hpp"
 #include "ad_rss/state/RssState.hpp"
@@ -208,6 +209,46 @@ situation::RelativePosition createRelativeLongitudinalPosition(situation::Longit
 situation::RelativePosition createRelativeLateralPosition(situation::LateralRelativePosition const &position,
                                                           Distance const &distance = Distance(0.));
 
+/**
+ * @brief create a situation
+ *
+ * The ego vehicle has the ego RSS dynamics and no lateral velocity, the other vehicle the object RSS dynamics.
+ *
+ * @param[in] situationType the situation type to be applied
+ * @param[in] relativePosition the relative position to be applied
+ * @param[in] egoSpeed the longitudinal velocity of the ego vehicle in km/h
+ * @param[in] otherSpeed the longitudinal velocity of the other vehicle in km/h
+ * @param[in] otherLatSpeed the lateral velocity of the other vehicle in km/h
+ *
+ * @returns a situation with situation id 1 and object id 100
+ */
+situation::Situation createSituation(situation::SituationType const situationType,
+                                     situation::RelativePosition const &relativePosition,
+                                     double const egoSpeed,
+                                     double const otherSpeed,
+                                     double const otherLatSpeed = 0.);
+
+/**
+ * @brief add a situation to a situation snapshot
+ *
+ * The situation is created by createSituation(), the situation id and the object id are increased per situation.
+ *
+ * @param[in/out] situationSnapshot the situation snapshot to be extended
+ * @param[in] situationType the situation type to be applied
+ * @param[in] relativePosition the relative position to be applied
+ * @param[in] egoSpeed the longitudinal velocity of the ego vehicle in km/h
+ * @param[in] otherSpeed the longitudinal velocity of the other vehicle in km/h
+ * @param[in] otherLatSpeed the lateral velocity of the other vehicle in km/h
+ *
+ * @returns the situation added to the situation snapshot
+ */
+situation::Situation &addSituation(situation::SituationSnapshot &situationSnapshot,
+                                   situation::SituationType const situationType,
+                                   situation::RelativePosition const &relativePosition,
+                                   double const egoSpeed,
+                                   double const otherSpeed,
+                                   double const otherLatSpeed = 0.);
+
 /**
  * @brief calculate the longitudinal stopping distance
  *
@@ -0,0 +1,270 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include "RssCheckTestBaseT.hpp"
+#include "ad_rss/core/RssDeltaRecording.hpp"
+#include "ad_rss/core/RssRecording.hpp"
+#include "RssReplay.hpp"
+
+namespace ad_rss {
+namespace core {
+
+class RssReplayTests : public RssCheckTestBase
+{
+protected:
+  void SetUp() override
+  {
+    RssCheckTestBase::SetUp();
+    mConfiguration.outputDirectory = ::testing::TempDir();
+    mConfiguration.recordings = {::testing::TempDir() + "RssReplayTests_0.rssrec",
+                                 ::testing::TempDir() + "RssReplayTests_1.rssdelta",
+                                 ::testing::TempDir() + "RssReplayTests_2.rssrec"};
+    for (std::size_t i = 0u; i < mConfiguration.recordings.size(); ++i)
+    {
+      record(mConfiguration.recordings[i], (i % 2u) == 1u, cNumberOfFrames + i);
+    }
+  }
+
+  void TearDown() override
+  {
+    for (auto const &recording : mConfiguration.recordings)
+    {
+      std::remove(recording.c_str());
+      std::remove(getReplayResultFileName(mConfiguration, recording).c_str());
+    }
+    RssCheckTestBase::TearDown();
+  }
+
+  void record(std::string const &fileName,
+              bool const deltaCoded,
+              std::size_t const numberOfFrames,
+              std::size_t const failingFrame = std::numeric_limits<std::size_t>::max())
+  {
+    world::WorldModel recordedWorldModel = worldModel;
+    RssRecordWriter writer;
+    RssDeltaRecordWriter deltaWriter;
+    ASSERT_TRUE(deltaCoded ? deltaWriter.open(fileName) : writer.open(fileName));
+    for (std::size_t i = 0u; i < numberOfFrames; ++i)
+    {
+      // the RssCheck fails on a frame repeating the time index of its predecessor
+      if (i != failingFrame)
+      {
+        recordedWorldModel.timeIndex++;
+      }
+      recordedWorldModel.scenes[0].egoVehicle.occupiedRegions[0].lonRange.maximum
+        = ParametricValue(0.1 + 0.01 * static_cast<double>(i));
+      ASSERT_TRUE(deltaCoded ? deltaWriter.writeFrame(recordedWorldModel) : writer.writeFrame(recordedWorldModel));
+    }
+    ASSERT_TRUE(deltaCoded ? deltaWriter.close() : writer.close());
+  }
+
+  std::vector<std::string> readLines(std::string const &fileName)
+  {
+    std::vector<std::string> lines;
+    std::ifstream stream(fileName);
+    std::string line;
+    while (std::getline(stream, line))
+    {
+      lines.push_back(line);
+    }
+    return lines;
+  }
+
+  static constexpr std::size_t cNumberOfFrames = 20u;
+  RssReplayConfiguration mConfiguration;
+};
+
+constexpr std::size_t RssReplayTests::cNumberOfFrames;
+
+TEST_F(RssReplayTests, ReplayRecording)
+{
+  std::ostringstream output;
+  std::uint64_t numberOfFrames = 0u;
+  std::uint64_t numberOfFailedFrames = 0u;
+  ASSERT_TRUE(replayRecording(mConfiguration.recordings[1], output, numberOfFrames, numberOfFailedFrames));
+  EXPECT_EQ(numberOfFrames, cNumberOfFrames + 1u);
+  EXPECT_EQ(numberOfFailedFrames, 0u);
+
+  std::istringstream input(output.str());
+  std::string line;
+  std::size_t numberOfLines = 0u;
+  while (std::getline(input, line))
+  {
+    std::string const frame = "{\"frame\":" + std::to_string(numberOfLines) + ",\"timeIndex\":";
+    EXPECT_EQ(line.compare(0u, frame.size(), frame), 0);
+    EXPECT_NE(line.find("\"properResponse\":{\"isSafe\":"), std::string::npos);
+    EXPECT_NE(line.find("\"rssStates\":[{\"objectId\":"), std::string::npos);
+    EXPECT_EQ(line.back(), '}');
+    numberOfLines++;
+  }
+  EXPECT_EQ(numberOfLines, numberOfFrames);
+
+  EXPECT_FALSE(replayRecording(
+    ::testing::TempDir() + "RssReplayTests_missing.rssrec", output, numberOfFrames, numberOfFailedFrames));
+  EXPECT_EQ(numberOfFrames, 0u);
+}
+
+TEST_F(RssReplayTests, ReplayRecordingRestoresPrecision)
+{
+  std::uint64_t numberOfFrames = 0u;
+  std::uint64_t numberOfFailedFrames = 0u;
+  std::ostringstream output;
+  output.precision(3);
+  ASSERT_TRUE(replayRecording(mConfiguration.recordings[0], output, numberOfFrames, numberOfFailedFrames));
+  EXPECT_EQ(output.precision(), 3);
+
+  // writing to a file that is not open throws, the precision is restored nevertheless
+  std::ofstream closedOutput;
+  closedOutput.exceptions(std::ios::badbit);
+  closedOutput.precision(3);
+  EXPECT_FALSE(replayRecording(mConfiguration.recordings[0], closedOutput, numberOfFrames, numberOfFailedFrames));
+  EXPECT_EQ(closedOutput.precision(), 3);
+}
+
+TEST_F(RssReplayTests, FailedFrame)
+{
+  for (std::size_t i = 0u; i < 2u; ++i)
+  {
+    record(mConfiguration.recordings[i], i == 1u, cNumberOfFrames, 5u);
+  }
+
+  // the failed frames are recorded, the replay continues
+  RssReplayReport report;
+  ASSERT_TRUE(replayRecordings(mConfiguration, report));
+  EXPECT_EQ(report.replayedRecordings, 3u);
+  EXPECT_EQ(report.failedRecordings, 0u);
+  EXPECT_EQ(report.replayedFrames, 3u * cNumberOfFrames + 2u);
+  EXPECT_EQ(report.failedFrames, 2u);
+  for (std::size_t i = 0u; i < 2u; ++i)
+  {
+    std::vector<std::string> const lines
+      = readLines(getReplayResultFileName(mConfiguration, mConfiguration.recordings[i]));
+    ASSERT_EQ(lines.size(), cNumberOfFrames);
+    EXPECT_EQ(lines[4].find("\"failed\":true"), std::string::npos);
+    EXPECT_NE(lines[5].find("{\"frame\":5,"), std::string::npos);
+    EXPECT_NE(lines[5].find("\"failed\":true"), std::string::npos);
+    EXPECT_NE(lines[6].find("\"properResponse\":{\"isSafe\":"), std::string::npos);
+  }
+}
+
+TEST_F(RssReplayTests, ReplayRecordingsWithResume)
+{
+  mConfiguration.numberOfWorkers = 2u;
+  RssReplayReport report;
+  ASSERT_TRUE(replayRecordings(mConfiguration, report));
+  EXPECT_EQ(report.replayedRecordings, 3u);
+  EXPECT_EQ(report.skippedRecordings, 0u);
+  EXPECT_EQ(report.failedRecordings, 0u);
+  EXPECT_EQ(report.replayedFrames, 3u * cNumberOfFrames + 3u);
+  EXPECT_GT(report.framesPerSecond, 0.);
+  for (std::size_t i = 0u; i < mConfiguration.recordings.size(); ++i)
+  {
+    std::string const resultFileName = getReplayResultFileName(mConfiguration, mConfiguration.recordings[i]);
+    EXPECT_EQ(readLines(resultFileName).size(), cNumberOfFrames + i);
+    EXPECT_FALSE(std::ifstream(resultFileName + ".partial").good());
+  }
+
+  // the complete results are not replayed again
+  ASSERT_TRUE(replayRecordings(mConfiguration, report));
+  EXPECT_EQ(report.replayedRecordings, 0u);
+  EXPECT_EQ(report.skippedRecordings, 3u);
+  EXPECT_EQ(report.replayedFrames, 0u);
+
+  mConfiguration.resume = false;
+  ASSERT_TRUE(replayRecordings(mConfiguration, report));
+  EXPECT_EQ(report.replayedRecordings, 3u);
+}
+
+TEST_F(RssReplayTests, Sharding)
+{
+  mConfiguration.numberOfShards = 2u;
+  mConfiguration.shardIndex = 1u;
+  RssReplayReport report;
+  ASSERT_TRUE(replayRecordings(mConfiguration, report));
+  EXPECT_EQ(report.replayedRecordings, 1u);
+  EXPECT_EQ(report.replayedFrames, cNumberOfFrames + 1u);
+  EXPECT_TRUE(std::ifstream(getReplayResultFileName(mConfiguration, mConfiguration.recordings[1])).good());
+  EXPECT_FALSE(std::ifstream(getReplayResultFileName(mConfiguration, mConfiguration.recordings[0])).good());
+
+  mConfiguration.shardIndex = 2u;
+  EXPECT_FALSE(replayRecordings(mConfiguration, report));
+  mConfiguration.numberOfShards = 0u;
+  mConfiguration.shardIndex = 0u;
+  EXPECT_FALSE(replayRecordings(mConfiguration, report));
+}
+
+TEST_F(RssReplayTests, InvalidRecording)
+{
+  // a truncated recording fails, but does not affect the others
+  std::vector<char> recording;
+  {
+    std::ifstream input(mConfiguration.recordings[2], std::ios::in | std::ios::binary);
+    recording.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream output(mConfiguration.recordings[2], std::ios::out | std::ios::binary | std::ios::trunc);
+    output.write(recording.data(), static_cast<std::streamsize>(recording.size() - 8u));
+  }
+
+  mConfiguration.numberOfWorkers = 0u;
+  RssReplayReport report;
+  EXPECT_FALSE(replayRecordings(mConfiguration, report));
+  EXPECT_EQ(report.replayedRecordings, 2u);
+  EXPECT_EQ(report.failedRecordings, 1u);
+  // the frames of the failed recording are not counted
+  EXPECT_EQ(report.replayedFrames, 2u * cNumberOfFrames + 1u);
+  std::string const resultFileName = getReplayResultFileName(mConfiguration, mConfiguration.recordings[2]);
+  EXPECT_FALSE(std::ifstream(resultFileName).good());
+  EXPECT_FALSE(std::ifstream(resultFileName + ".partial").good());
+}
+
+TEST(RssReplayResultFileNameTests, ResultFileName)
+{
+  RssReplayConfiguration configuration;
+  configuration.outputDirectory = "results";
+  EXPECT_EQ(getReplayResultFileName(configuration, "/data/drive.0001.rssrec"),
+            "results/drive.0001.3f8d006aaecfe97e.jsonl");
+  EXPECT_EQ(getReplayResultFileName(configuration, "drive"), "results/drive.5ae9eac9344ce1f7.jsonl");
+  configuration.outputDirectory = "/results/";
+  EXPECT_EQ(getReplayResultFileName(configuration, ".hidden"), "/results/.hidden.28280da0cdcb6865.jsonl");
+
+  // recordings of the same name in different directories get different result files
+  EXPECT_NE(getReplayResultFileName(configuration, "/data/day1/drive.rssrec"),
+            getReplayResultFileName(configuration, "/data/day2/drive.rssrec"));
+}
+
+} // namespace core
+} // namespace ad_rss
@@ -0,0 +1,446 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include "RssReplay.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include "ad_rss/core/RssCheck.hpp"
+#include "ad_rss/core/RssDeltaRecording.hpp"
+#include "ad_rss/core/RssRecording.hpp"
+
+namespace ad_rss {
+namespace core {
+
+namespace {
+
+/**
+ * @brief the enumeration value without the qualifying namespaces, e.g. "BrakeMin"
+ */
+template <typename T> std::string toShortString(T const value)
+{
+  std::string const name = toString(value);
+  std::size_t const separator = name.rfind("::");
+  return (separator == std::string::npos) ? name : name.substr(separator + 2u);
+}
+
+void writeDouble(std::ostream &output, double const value)
+{
+  // JSON has no representation of the non-finite values
+  if (std::isfinite(value))
+  {
+    output << value;
+  }
+  else
+  {
+    output << "null";
+  }
+}
+
+void writeRssStateInformation(std::ostream &output, state::RssStateInformation const &rssStateInformation)
+{
+  output << "{\"safeDistance\":";
+  writeDouble(output, static_cast<double>(rssStateInformation.safeDistance));
+  output << ",\"currentDistance\":";
+  writeDouble(output, static_cast<double>(rssStateInformation.currentDistance));
+  output << ",\"evaluator\":\"" << toShortString(rssStateInformation.evaluator) << "\"}";
+}
+
+template <typename RssStateType> void writeRssState(std::ostream &output, RssStateType const &rssState)
+{
+  output << "{\"isSafe\":" << (rssState.isSafe ? "true" : "false") << ",\"response\":\""
+         << toShortString(rssState.response) << "\",\"information\":";
+  writeRssStateInformation(output, rssState.rssStateInformation);
+  output << "}";
+}
+
+void writeFrameResult(std::ostream &output,
+                      std::uint64_t const frameNumber,
+                      double const durationMicroseconds,
+                      state::ProperResponse const &properResponse,
+                      world::AccelerationRestriction const &accelerationRestriction,
+                      state::RssStateSnapshot const &rssStateSnapshot)
+{
+  output << "{\"frame\":" << frameNumber << ",\"timeIndex\":" << rssStateSnapshot.timeIndex
+         << ",\"durationUs\":" << durationMicroseconds;
+
+  output << ",\"properResponse\":{\"isSafe\":" << (properResponse.isSafe ? "true" : "false")
+         << ",\"dangerousObjects\":[";
+  for (std::size_t i = 0u; i < properResponse.dangerousObjects.size(); ++i)
+  {
+    output << ((i > 0u) ? "," : "") << properResponse.dangerousObjects[i];
+  }
+  output << "],\"longitudinalResponse\":\"" << toShortString(properResponse.longitudinalResponse)
+         << "\",\"lateralResponseRight\":\"" << toShortString(properResponse.lateralResponseRight)
+         << "\",\"lateralResponseLeft\":\"" << toShortString(properResponse.lateralResponseLeft) << "\"}";
+
+  output << ",\"accelerationRestriction\":{\"longitudinal\":[";
+  writeDouble(output, static_cast<double>(accelerationRestriction.longitudinalRange.minimum));
+  output << ",";
+  writeDouble(output, static_cast<double>(accelerationRestriction.longitudinalRange.maximum));
+  output << "],\"lateralLeft\":[";
+  writeDouble(output, static_cast<double>(accelerationRestriction.lateralLeftRange.minimum));
+  output << ",";
+  writeDouble(output, static_cast<double>(accelerationRestriction.lateralLeftRange.maximum));
+  output << "],\"lateralRight\":[";
+  writeDouble(output, static_cast<double>(accelerationRestriction.lateralRightRange.minimum));
+  output << ",";
+  writeDouble(output, static_cast<double>(accelerationRestriction.lateralRightRange.maximum));
+  output << "]}";
+
+  output << ",\"rssStates\":[";
+  for (std::size_t i = 0u; i < rssStateSnapshot.individualResponses.size(); ++i)
+  {
+    state::RssState const &rssState = rssStateSnapshot.individualResponses[i];
+    output << ((i > 0u) ? "," : "") << "{\"objectId\":" << rssState.objectId
+           << ",\"situationId\":" << rssState.situationId << ",\"longitudinal\":";
+    writeRssState(output, rssState.longitudinalState);
+    output << ",\"lateralRight\":";
+    writeRssState(output, rssState.lateralStateRight);
+    output << ",\"lateralLeft\":";
+    writeRssState(output, rssState.lateralStateLeft);
+    output << "}";
+  }
+  output << "]}\n";
+}
+
+void writeFailedFrameResult(std::ostream &output,
+                            std::uint64_t const frameNumber,
+                            physics::TimeIndex const timeIndex,
+                            double const durationMicroseconds)
+{
+  output << "{\"frame\":" << frameNumber << ",\"timeIndex\":" << timeIndex
+         << ",\"durationUs\":" << durationMicroseconds << ",\"failed\":true}\n";
+}
+
+/**
+ * @brief checks the world model of a frame and writes its results
+ *
+ * A frame the RssCheck fails on is recorded as failed frame; the replay of the recording continues.
+ *
+ * @returns false if the results could not be written
+ */
+template <typename WorldModelType>
+bool replayFrame(RssCheck &rssCheck,
+                 WorldModelType const &worldModel,
+                 std::uint64_t const frameNumber,
+                 std::ostream &output,
+                 std::uint64_t &numberOfFailedFrames)
+{
+  world::AccelerationRestriction accelerationRestriction;
+  state::ProperResponse properResponse;
+  state::RssStateSnapshot rssStateSnapshot;
+  auto const start = std::chrono::steady_clock::now();
+  bool const result = rssCheck.calculateAccelerationRestriction(
+    worldModel, accelerationRestriction, properResponse, nullptr, &rssStateSnapshot);
+  auto const end = std::chrono::steady_clock::now();
+  double const durationMicroseconds = std::chrono::duration<double, std::micro>(end - start).count();
+  if (result)
+  {
+    writeFrameResult(
+      output, frameNumber, durationMicroseconds, properResponse, accelerationRestriction, rssStateSnapshot);
+  }
+  else
+  {
+    writeFailedFrameResult(output, frameNumber, worldModel.timeIndex, durationMicroseconds);
+    numberOfFailedFrames++;
+  }
+  return output.good();
+}
+
+bool replayRssRecording(std::string const &recording,
+                        std::ostream &output,
+                        std::uint64_t &numberOfFrames,
+                        std::uint64_t &numberOfFailedFrames)
+{
+  RssRecordReader reader;
+  if (!reader.open(recording))
+  {
+    return false;
+  }
+  RssCheck rssCheck;
+  RssRecordFrame frame;
+  while (!reader.isAtEnd())
+  {
+    if (!reader.readNextFrame(frame)
+        || !replayFrame(rssCheck, frame.worldModel, numberOfFrames, output, numberOfFailedFrames))
+    {
+      return false;
+    }
+    numberOfFrames++;
+  }
+  return true;
+}
+
+bool replayRssDeltaRecording(std::string const &recording,
+                             std::ostream &output,
+                             std::uint64_t &numberOfFrames,
+                             std::uint64_t &numberOfFailedFrames)
+{
+  RssDeltaRecordReader reader;
+  if (!reader.open(recording))
+  {
+    return false;
+  }
+  RssCheck rssCheck;
+  while (!reader.isAtEnd())
+  {
+    if (!reader.readNextFrame()
+        || !replayFrame(rssCheck, reader.getFrame().worldModel, numberOfFrames, output, numberOfFailedFrames))
+    {
+      return false;
+    }
+    numberOfFrames++;
+  }
+  return true;
+}
+
+/**
+ * @brief 64 bit FNV-1a hash of a string; independent of the platform and the standard library
+ */
+std::uint64_t hashString(std::string const &text)
+{
+  std::uint64_t hash = 14695981039346656037u;
+  for (char const character : text)
+  {
+    hash ^= static_cast<std::uint8_t>(character);
+    hash *= 1099511628211u;
+  }
+  return hash;
+}
+
+enum class ReplayStatus
+{
+  Replayed,
+  Skipped,
+  Failed
+};
+
+/**
+ * @brief replays a recording of the corpus into its result file
+ */
+ReplayStatus replayToResultFile(RssReplayConfiguration const &configuration,
+                                std::string const &recording,
+                                std::uint64_t &numberOfFrames,
+                                std::uint64_t &numberOfFailedFrames)
+{
+  ReplayStatus status = ReplayStatus::Failed;
+  std::string temporaryFileName;
+  try
+  {
+    std::string const resultFileName = getReplayResultFileName(configuration, recording);
+    if (configuration.resume && std::ifstream(resultFileName).good())
+    {
+      return ReplayStatus::Skipped;
+    }
+
+    temporaryFileName = resultFileName + ".partial";
+    std::ofstream output(temporaryFileName, std::ios::out | std::ios::trunc);
+    bool success = output.good() && replayRecording(recording, output, numberOfFrames, numberOfFailedFrames);
+    output.close();
+    success = success && !output.fail() && (std::rename(temporaryFileName.c_str(), resultFileName.c_str()) == 0);
+    if (success)
+    {
+      status = ReplayStatus::Replayed;
+    }
+  }
+  catch (...)
+  {
+    status = ReplayStatus::Failed;
+  }
+  if ((status == ReplayStatus::Failed) && !temporaryFileName.empty())
+  {
+    std::remove(temporaryFileName.c_str());
+  }
+  return status;
+}
+
+} // namespace
+
+bool replayRecording(std::string const &recording,
+                     std::ostream &output,
+                     std::uint64_t &numberOfFrames,
+                     std::uint64_t &numberOfFailedFrames)
+{
+  numberOfFrames = 0u;
+  numberOfFailedFrames = 0u;
+  bool result = false;
+  std::streamsize const precision = output.precision();
+  // global try catch block to ensure this call doesn't throw an exception
+  try
+  {
+    char magic[4] = {0, 0, 0, 0};
+    std::ifstream stream(recording, std::ios::in | std::ios::binary);
+    stream.read(magic, sizeof(magic));
+    stream.close();
+
+    output.precision(std::numeric_limits<double>::max_digits10);
+    if (std::memcmp(magic, "RSSR", sizeof(magic)) == 0)
+    {
+      result = replayRssRecording(recording, output, numberOfFrames, numberOfFailedFrames);
+    }
+    else if (std::memcmp(magic, "RSSD", sizeof(magic)) == 0)
+    {
+      result = replayRssDeltaRecording(recording, output, numberOfFrames, numberOfFailedFrames);
+    }
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  output.precision(precision);
+  return result;
+}
+
+std::string getReplayResultFileName(RssReplayConfiguration const &configuration, std::string const &recording)
+{
+  // the hash of the complete path distinguishes recordings of the same name in different directories
+  char hash[17];
+  std::snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(hashString(recording)));
+
+  std::string name = recording;
+  std::size_t const separator = name.find_last_of('/');
+  if (separator != std::string::npos)
+  {
+    name = name.substr(separator + 1u);
+  }
+  std::size_t const extension = name.find_last_of('.');
+  if ((extension != std::string::npos) && (extension > 0u))
+  {
+    name = name.substr(0u, extension);
+  }
+
+  std::string directory = configuration.outputDirectory;
+  if (!directory.empty() && (directory.back() != '/'))
+  {
+    directory += '/';
+  }
+  return directory + name + "." + hash + ".jsonl";
+}
+
+bool replayRecordings(RssReplayConfiguration const &configuration, RssReplayReport &report)
+{
+  report = RssReplayReport();
+  if ((configuration.numberOfShards == 0u) || (configuration.shardIndex >= configuration.numberOfShards))
+  {
+    return false;
+  }
+
+  bool result = false;
+  // global try catch block to ensure this call doesn't throw an exception
+  try
+  {
+    std::vector<std::string> shard;
+    for (std::size_t i = configuration.shardIndex; i < configuration.recordings.size();
+         i += configuration.numberOfShards)
+    {
+      shard.push_back(configuration.recordings[i]);
+    }
+
+    std::size_t numberOfWorkers = configuration.numberOfWorkers;
+    if (numberOfWorkers == 0u)
+    {
+      numberOfWorkers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    numberOfWorkers = std::max(std::size_t(1u), std::min(numberOfWorkers, shard.size()));
+
+    std::atomic<std::size_t> nextRecording(0u);
+    std::mutex reportMutex;
+    auto const worker = [&]() {
+      for (std::size_t i = nextRecording++; i < shard.size(); i = nextRecording++)
+      {
+        std::uint64_t numberOfFrames = 0u;
+        std::uint64_t numberOfFailedFrames = 0u;
+        ReplayStatus const status = replayToResultFile(configuration, shard[i], numberOfFrames, numberOfFailedFrames);
+
+        std::lock_guard<std::mutex> lock(reportMutex);
+        switch (status)
+        {
+          case ReplayStatus::Replayed:
+            report.replayedRecordings++;
+            // only the frames of completely replayed recordings are counted
+            report.replayedFrames += numberOfFrames;
+            report.failedFrames += numberOfFailedFrames;
+            break;
+          case ReplayStatus::Skipped:
+            report.skippedRecordings++;
+            break;
+          case ReplayStatus::Failed:
+          default:
+            report.failedRecordings++;
+            break;
+        }
+      }
+    };
+
+    auto const start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    try
+    {
+      for (std::size_t i = 1u; i < numberOfWorkers; ++i)
+      {
+        workers.push_back(std::thread(worker));
+      }
+    }
+    catch (...)
+    {
+      // continue with the workers already started
+    }
+    worker();
+    for (auto &workerThread : workers)
+    {
+      workerThread.join();
+    }
+    auto const end = std::chrono::steady_clock::now();
+
+    report.durationSeconds = std::chrono::duration<double>(end - start).count();
+    if (report.durationSeconds > 0.)
+    {
+      report.framesPerSecond = static_cast<double>(report.replayedFrames) / report.durationSeconds;
+    }
+    result = (report.failedRecordings == 0u);
+  }
+  catch (...)
+  {
+    result = false;
+  }
+  return result;
+}
+
+} // namespace core
+} // namespace ad_rss
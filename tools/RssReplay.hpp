@@ -0,0 +1,180 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/*!
+ * @brief namespace ad_rss
+ */
+namespace ad_rss {
+
+/*!
+ * @brief namespace core
+ */
+namespace core {
+
+/*!
+ * @brief Configuration of the replay of a corpus of RSS recordings
+ */
+struct RssReplayConfiguration
+{
+  /*!
+   * The recordings to replay; each recording is a single drive written either by the RssRecordWriter or the
+   * RssDeltaRecordWriter. The format is detected by the file content.
+   */
+  std::vector<std::string> recordings;
+
+  /*!
+   * The directory the results are written to; it has to exist.
+   */
+  std::string outputDirectory{"."};
+
+  /*!
+   * The number of worker threads replaying recordings in parallel; 0 uses the number of hardware threads.
+   */
+  std::size_t numberOfWorkers{1u};
+
+  /*!
+   * The number of shards the recordings are split into, e.g. to distribute the corpus over several processes
+   */
+  std::size_t numberOfShards{1u};
+
+  /*!
+   * The shard to be replayed: the recordings with (index % numberOfShards) == shardIndex
+   */
+  std::size_t shardIndex{0u};
+
+  /*!
+   * If true, recordings with an already complete result file are skipped; this allows to resume an interrupted replay.
+   */
+  bool resume{true};
+};
+
+/*!
+ * @brief Summary of the replay of a corpus of RSS recordings
+ */
+struct RssReplayReport
+{
+  /*!
+   * The number of recordings of the shard that were replayed successfully
+   */
+  std::size_t replayedRecordings{0u};
+
+  /*!
+   * The number of recordings of the shard that were skipped because their result already exists
+   */
+  std::size_t skippedRecordings{0u};
+
+  /*!
+   * The number of recordings of the shard that could not be replayed
+   */
+  std::size_t failedRecordings{0u};
+
+  /*!
+   * The number of frames of the replayed recordings; the frames of failed recordings are not counted
+   */
+  std::uint64_t replayedFrames{0u};
+
+  /*!
+   * The number of frames of the replayed recordings the RssCheck failed on
+   */
+  std::uint64_t failedFrames{0u};
+
+  /*!
+   * The wall clock duration of the replay in seconds
+   */
+  double durationSeconds{0.};
+
+  /*!
+   * The throughput of the replay in frames per second
+   */
+  double framesPerSecond{0.};
+};
+
+/**
+ * @brief replay a single recording
+ *
+ * Each frame of the recording is passed to a RssCheck. For each frame a line of JSON is written to the output,
+ * containing the frame number, the time index, the duration of the RssCheck call in microseconds, the ProperResponse,
+ * the AccelerationRestriction and the RssStateSnapshot. If the RssCheck fails on a frame, its line contains
+ * "failed":true instead of the results and the replay continues with the next frame.
+ *
+ * @param [in] recording - the file name of the recording
+ * @param [out] output - the stream the results are written to
+ * @param [out] numberOfFrames - the number of frames replayed
+ * @param [out] numberOfFailedFrames - the number of frames the RssCheck failed on
+ *
+ * @returns false if the recording could not be read or the results could not be written, true otherwise.
+ */
+bool replayRecording(std::string const &recording,
+                     std::ostream &output,
+                     std::uint64_t &numberOfFrames,
+                     std::uint64_t &numberOfFailedFrames);
+
+/**
+ * @brief get the name of the result file of a recording
+ *
+ * The result file is placed into the output directory and named after the recording, followed by a hash of the
+ * complete path of the recording and the extension ".jsonl". So recordings of the same name in different directories
+ * get different result files.
+ *
+ * @param [in] configuration - the replay configuration
+ * @param [in] recording - the file name of the recording
+ *
+ * @returns the file name of the result file
+ */
+std::string getReplayResultFileName(RssReplayConfiguration const &configuration, std::string const &recording);
+
+/**
+ * @brief replay a corpus of recordings
+ *
+ * The recordings of the selected shard are distributed over the worker threads. The results of each recording are
+ * written to a temporary file which is renamed to the result file (see getReplayResultFileName()) once the recording
+ * is completely replayed; so an interrupted replay never leaves incomplete result files behind and can be resumed.
+ *
+ * @param [in] configuration - the replay configuration
+ * @param [out] report - the summary of the replay
+ *
+ * @returns false if the configuration is invalid or any recording could not be replayed, true otherwise.
+ */
+bool replayRecordings(RssReplayConfiguration const &configuration, RssReplayReport &report);
+
+} // namespace core
+} // namespace ad_rss
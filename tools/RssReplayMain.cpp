@@ -0,0 +1,125 @@
+// ----------------- BEGIN LICENSE BLOCK ---------------------------------
+//
+// Copyright (c) 2018-2019 Intel Corporation
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its contributors
+//    may be used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+//    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+//    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+//    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//    IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+//    INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+//    OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+//    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//    POSSIBILITY OF SUCH DAMAGE.
+//
+// ----------------- END LICENSE BLOCK -----------------------------------
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "RssReplay.hpp"
+
+namespace {
+
+void printUsage(char const *executable)
+{
+  std::cerr << "Usage: " << executable << " [options] recording...\n"
+            << "Replays RSS recordings through the RssCheck and writes the results of each recording as JSON lines.\n"
+            << "Options:\n"
+            << "  --output <directory>  directory of the result files (default: .)\n"
+            << "  --workers <n>         number of worker threads, 0 for all hardware threads (default: 1)\n"
+            << "  --shard <i>/<n>       replay only the i-th of n shards of the recordings (default: 0/1)\n"
+            << "  --no-resume           replay recordings with existing result files again\n";
+}
+
+bool parseNumber(std::string const &text, std::size_t &value)
+{
+  std::istringstream stream(text);
+  unsigned long long number = 0u;
+  stream >> number;
+  value = static_cast<std::size_t>(number);
+  return !stream.fail() && stream.eof() && (text.find('-') == std::string::npos);
+}
+
+bool parseShard(std::string const &text, std::size_t &shardIndex, std::size_t &numberOfShards)
+{
+  std::size_t const separator = text.find('/');
+  return (separator != std::string::npos) && parseNumber(text.substr(0u, separator), shardIndex)
+    && parseNumber(text.substr(separator + 1u), numberOfShards) && (shardIndex < numberOfShards);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+  ::ad_rss::core::RssReplayConfiguration configuration;
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string const argument(argv[i]);
+    bool const hasValue = (i + 1) < argc;
+    bool valid = true;
+    if ((argument == "--output") && hasValue)
+    {
+      configuration.outputDirectory = argv[++i];
+    }
+    else if ((argument == "--workers") && hasValue)
+    {
+      valid = parseNumber(argv[++i], configuration.numberOfWorkers);
+    }
+    else if ((argument == "--shard") && hasValue)
+    {
+      valid = parseShard(argv[++i], configuration.shardIndex, configuration.numberOfShards);
+    }
+    else if (argument == "--no-resume")
+    {
+      configuration.resume = false;
+    }
+    else if (argument.empty() || (argument[0] == '-'))
+    {
+      valid = false;
+    }
+    else
+    {
+      configuration.recordings.push_back(argument);
+    }
+
+    if (!valid)
+    {
+      printUsage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (configuration.recordings.empty())
+  {
+    printUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  ::ad_rss::core::RssReplayReport report;
+  bool const result = ::ad_rss::core::replayRecordings(configuration, report);
+
+  std::cout << "Replayed recordings: " << report.replayedRecordings << "\n"
+            << "Skipped recordings:  " << report.skippedRecordings << "\n"
+            << "Failed recordings:   " << report.failedRecordings << "\n"
+            << "Replayed frames:     " << report.replayedFrames << "\n"
+            << "Failed frames:       " << report.failedFrames << "\n"
+            << "Duration:            " << report.durationSeconds << " s\n"
+            << "Throughput:          " << report.framesPerSecond << " frames/s" << std::endl;
+  return result ? EXIT_SUCCESS : EXIT_FAILURE;
+}